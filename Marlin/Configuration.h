@@ -87,7 +87,7 @@
 #define SHORT_BUILD_VERSION 			"Marlin-2.0.8"
 #define WEBSITE_URL 							"www.zonestar3d.com"
 #define STRING_CONFIG_H_AUTHOR    "(ZONESTAR, Hally)" 		// Who made the changes.
-#define EEPROM_VERSION 			    	"V83"						//modify it if need auto inilize EEPROM after upload firmware
+#define EEPROM_VERSION 			    	"V85"						//modify it if need auto inilize EEPROM after upload firmware
 //===========================================================================
 //default feature, usually keep it enable
 #define	SWITCH_EXTRUDER_SQUENCY
@@ -591,6 +591,8 @@
 
 // Comment the following line to disable PID and enable bang-bang.
 #define PIDTEMP
+// Or replace PIDTEMP with MPCTEMP for model predictive control. Tune it with M306 T.
+//#define MPCTEMP
 #define BANG_MAX 	255     		// Limits current to nozzle while in bang-bang mode; 255=full current
 #define PID_MAX 	BANG_MAX 		// Limits current to nozzle while PID is active (see PID_FUNCTIONAL_RANGE below); 255=full current
 #define PID_K1 		0.95      	// Smoothing factor within any PID loop
@@ -613,6 +615,36 @@
   #endif
 #endif // PIDTEMP
 
+/**
+ * Model Predictive Control for the hotends
+ *
+ * Models the heater block and its sensor from the heater power, the heat
+ * capacity of the block and the heat lost to the air, the part fan and the
+ * filament. Heats at full power until the model says the heat already in the
+ * block will carry it to the target, then holds it there, adding the power
+ * the fan and extrusion take away as soon as they start.
+ *
+ * Run "M306 T" to measure the constants with the nozzle where it prints and
+ * the part fan able to blow on it, then M500 to save them.
+ * Use "M306 E<hotend> P C R A F H" to set them by hand.
+ */
+#if ENABLED(MPCTEMP)
+  #define MPC_MAX BANG_MAX                          // (0..255) Limits current to nozzle while MPC is active
+  #define MPC_HEATER_POWER { 40.0f }                // (W) Heater cartridge power of each hotend
+
+  // Measured by M306 T
+  #define MPC_BLOCK_HEAT_CAPACITY { 16.7f }         // (J/K) Heat capacity of the heater block
+  #define MPC_SENSOR_RESPONSIVENESS { 0.22f }       // (K/s per K) How fast the sensor follows the block
+  #define MPC_AMBIENT_XFER_COEFF { 0.068f }         // (W/K) Heat lost to the air with the part fan off
+  #define MPC_AMBIENT_XFER_COEFF_FAN255 { 0.097f }  // (W/K) Heat lost to the air with the part fan at full speed
+
+  #define FILAMENT_HEAT_CAPACITY_PERMM { 5.6e-3f }  // (J/K/mm) 5.6e-3 for 1.75mm PLA, 3.6e-3 for 1.75mm PETG
+
+  #define MPC_SMOOTHING_FACTOR 0.5f                 // (0..1) Pull of the sensor reading on the model. Lower it for a noisy sensor.
+  #define MPC_MIN_AMBIENT_CHANGE 1.0f               // (K/s) Least rate at which the modelled ambient is corrected
+  #define MPC_STEADYSTATE 0.5f                      // (K/s) Temperature change rate below which the ambient is corrected
+#endif // MPCTEMP
+
 //===========================================================================
 //====================== PID > Bed Temperature Control ======================
 //===========================================================================
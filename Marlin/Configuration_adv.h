@@ -158,6 +158,31 @@
   #endif
 #endif
 
+/**
+ * Heater Power Budget
+ *
+ * For a PSU that can't run the bed and hotends flat out at once. Heater PWM
+ * is cut back so the watts drawn stay within the budget, letting all heaters
+ * heat together instead of one after another. Heaters holding their target
+ * are served first, then the heaters still heating up, the one with most of
+ * its heat-up still ahead first.
+ *
+ * The bed is switched with PWM when its share is cut, so don't use this
+ * with a bed heater on a relay.
+ */
+//#define HEATER_POWER_BUDGET
+#if ENABLED(HEATER_POWER_BUDGET)
+  // Measure these on your printer: the PSU rating less the rest of its load,
+  // and each heater's V^2/R at the supply voltage.
+  #define HEATER_BUDGET_WATTS  240  // (W) Most the PSU can give the heaters at once
+  #define BED_HEATER_WATTS     220  // (W) Bed heater power at full duty
+  #if DISABLED(MPCTEMP)
+    #define HOTEND_HEATER_WATTS { 40 } // (W) Heater power at full duty, per hotend. MPCTEMP uses MPC_HEATER_POWER.
+  #endif
+  //#define SYNC_HEATUP             // Hold back heaters that are ahead so all reach their targets together
+  //#define HEATUP_LOOKAHEAD        // M109 and M190 start heating for the M104/M109/M140/M190 queued behind them
+#endif
+
 //
 // Heated Chamber options
 //
@@ -412,6 +437,15 @@
 #define TEMP_SENSOR_AD8495_OFFSET 0.0
 #define TEMP_SENSOR_AD8495_GAIN   1.0
 
+/**
+ * Convert thermistor readings with uniformly spaced tables from
+ * module/thermistor/thermistors_uniform.h instead of searching the
+ * original tables. Faster, but each table takes up to 2K of flash.
+ * Tables that can't be resampled accurately keep the search.
+ * Regenerate with buildroot/share/scripts/createTemperatureLookupMarlin.py --uniform
+ */
+#define THERMISTOR_UNIFORM_TABLES
+
 /**
  * Controller Fan
  * To cool down the stepper drivers and MOSFETs.
@@ -916,6 +950,13 @@
 // if unwanted behavior is observed on a user's machine when running at very slow speeds.
 #define MINIMUM_PLANNER_SPEED 0.05 // (mm/s)
 
+/**
+ * Work out the acceleration and deceleration steps of each block with
+ * integer math instead of float. Much faster on boards without an FPU,
+ * and within a step of the float results.
+ */
+#define TRAPEZOID_INTEGER_MATH
+
 //
 // Backlash Compensation
 // Adds extra movement to axes on direction-changes to account for backlash.
@@ -1012,6 +1053,31 @@
  */
 //#define ADAPTIVE_STEP_SMOOTHING
 
+/**
+ * Input Shaping
+ *
+ * Cancel the ringing of the X and Y axes at high acceleration by splitting each
+ * step into two (ZV) or three (ZVD, EI) impulses spread over one ringing period.
+ * Corners get a little rounder, by the distance moved in about half a period.
+ *
+ * Measure the ringing frequency from the spacing of the ripples after a corner
+ * in a test print (frequency = speed / spacing), set it with M593 and save with M500.
+ * The shaping frequency and damping can be set per axis with M593 X Y F D T.
+ * On CoreXY each motor follows the shaped X and Y together.
+ */
+#define INPUT_SHAPING
+#if ENABLED(INPUT_SHAPING)
+  #define SHAPING_FREQ_X       0      // (Hz) Ringing frequency of X. 0 leaves X unshaped until it's set with M593.
+  #define SHAPING_FREQ_Y       0      // (Hz) Ringing frequency of Y. 0 leaves Y unshaped until it's set with M593.
+  #define SHAPING_ZETA_X    0.15      // Damping ratio of X (0 to <1)
+  #define SHAPING_ZETA_Y    0.15      // Damping ratio of Y (0 to <1)
+  #define SHAPING_TYPE SHAPER_ZVD     // SHAPER_ZV, SHAPER_ZVD (more tolerant) or SHAPER_EI (most tolerant, softer corners)
+  #define SHAPING_MIN_FREQ    20      // (Hz) Lowest frequency M593 accepts
+  #define SHAPING_BUFFER_SIZE 800     // Steps queued per axis for their echoes, 2 bytes each. XY moves slow down
+                                      // to fit: about SHAPING_BUFFER_SIZE x frequency steps/s with ZVD or EI,
+                                      // so 800 allows 98mm/s at 20Hz and 195mm/s at 40Hz with 160 steps/mm.
+#endif
+
 /**
  * Custom Microstepping
  * Override as-needed for your setup. Up to 3 MS pins are supported.
@@ -1204,6 +1270,16 @@
 
   //#define SDCARD_READONLY                 // Read-only SD card (to save over 2K of flash)
 
+  #define SD_READ_AHEAD                     // Read the print file a sector at a time (uses 512 bytes of RAM)
+
+  /**
+   * Pre-parsed G-code cache for files that are printed again and again.
+   * The first print of FILENAME.GCO writes FILENAME.BGC next to it, holding
+   * the commands with their numbers already parsed. Later prints of the
+   * unchanged file read that instead. Uses 512 bytes of RAM.
+   */
+  //#define SD_GCODE_CACHE
+
   #define SD_PROCEDURE_DEPTH 1              // Increase if you need more nested M32 calls
 
   #define SD_FINISHED_STEPPERRELEASE true   // Disable steppers when SD Print is finished
@@ -1250,6 +1326,10 @@
     // Without a POWER_LOSS_PIN the following option helps reduce wear on the SD card,
     // especially with "vase mode" printing. Set too high and vases cannot be continued.
     #define POWER_LOSS_MIN_Z_CHANGE 0.05 // (mm) Minimum Z change before saving power-loss data
+
+    // Most saves only journal the head position, SD position and print time.
+    // The rest is written again after this many saves, or when it changes.
+    //#define POWER_LOSS_JOURNAL_RECORDS 64
   #endif
 
   /**
@@ -1368,6 +1448,12 @@
 
   // Add an optimized binary file transfer mode, initiated with 'M28 B1'
   //#define BINARY_FILE_TRANSFER
+  #if ENABLED(BINARY_FILE_TRANSFER)
+    #define BINARY_STREAM_PACKETS         4 // Packets the host may send ahead of the acks, a power of 2. 1 for stop-and-wait.
+    #define BINARY_STREAM_PACKET_SIZE   512 // Largest packet payload. Uses PACKETS * PACKET_SIZE bytes of RAM.
+    #define BINARY_STREAM_HEATSHRINK_WINDOW_BITS    10 // Compression window of 2^n bytes, held in RAM. The host is told at QUERY.
+    #define BINARY_STREAM_HEATSHRINK_LOOKAHEAD_BITS  4
+  #endif
 
   /**
    * Set this option to one of the following (or the board's defaults apply):
@@ -1509,6 +1595,16 @@
   #endif
 #endif // HAS_DGUS_LCD
 
+//
+// Additional options for ZONESTAR DWIN displays
+//
+#if HAS_DWIN_LCD
+  // Queue drawing commands and send them in the background, by DMA on STM32F1
+  // USART1, 2 or 4 (USART1 shares DMA1 channel 4 with SPI2 RX). USART3 shares DMA1
+  // channel 2 with SPI1 RX, which SD reads use, so it sends by interrupt. 0 to send at once.
+  #define DWIN_TX_BUFFER_SIZE 1024  // (bytes) Power of 2
+#endif
+
 //
 // Touch UI for the FTDI Embedded Video Engine (EVE)
 //
@@ -1634,6 +1730,37 @@
   //#define WATCHDOG_RESET_MANUAL
 #endif
 
+/**
+ * Idle Task Scheduler
+ *
+ * Run the tasks of idle() to periods and deadlines so the LCD, SD card
+ * detection and auto-reports wait while the planner is running low on moves,
+ * and report the time each task takes with M577.
+ */
+#define IDLE_TASK_SCHEDULER
+#if ENABLED(IDLE_TASK_SCHEDULER)
+  #define IDLE_MIN_PLANNED_MOVES   8  // Hold background tasks while commands are queued and fewer moves are planned
+  #define IDLE_TIME_BUDGET_US   2000  // (us) Hold the remaining background tasks once a pass has taken this long
+#endif
+
+/**
+ * ISR Profiling
+ *
+ * Count the CPU cycles the stepper and temperature ISRs take, with the
+ * processor's cycle counter, and report them with M578.
+ *
+ * With MEASURED_STEP_ISR_LIMITS the stepper sets its multistepping limits
+ * from the measured costs instead of the estimates in stepper.h, so a fast
+ * board takes one step per ISR up to a higher step rate. The costs are those
+ * 99% of runs stay within, and the limits keep the step ISR to no more than
+ * STEP_ISR_MAX_LOAD of the CPU.
+ */
+//#define ISR_PROFILING
+#if ENABLED(ISR_PROFILING)
+  //#define MEASURED_STEP_ISR_LIMITS
+  #define STEP_ISR_MAX_LOAD 0.6   // Fraction of the CPU the step ISR may take
+#endif
+
 // @section lcd
 
 /**
@@ -1834,10 +1961,12 @@
 //
 // G2/G3 Arc Support
 //
-//#define ARC_SUPPORT                 // Disable this feature to save ~3226 bytes
+#define ARC_SUPPORT                 // Disable this feature to save ~3226 bytes
 #if ENABLED(ARC_SUPPORT)
-  #define MM_PER_ARC_SEGMENT      1 // (mm) Length (or minimum length) of each arc segment
+  #define MM_PER_ARC_SEGMENT    0.2 // (mm) Length (or minimum length) of each arc segment
   //#define ARC_SEGMENTS_PER_R    1 // Max segment length, MM_PER = Min
+  #define ARC_SEGMENT_TOLERANCE 0.01 // (mm) Longest segments within this of the arc, MM_PER = Min. Longer at high feedrates,
+                                     // to keep the distance needed to stop within the planner buffer.
   #define MIN_ARC_SEGMENTS       24 // Minimum number of segments in a complete circle
   //#define ARC_SEGMENTS_PER_SEC 50 // Use feedrate to choose segment length (with MM_PER_ARC_SEGMENT as the minimum)
   #define N_ARC_CORRECTION       25 // Number of interpolated segments between corrections
@@ -1931,10 +2060,15 @@
 
 // The number of linear moves that can be in the planner at once.
 // The value of BLOCK_BUFFER_SIZE must be a power of 2 (e.g. 8, 16, 32)
+// 32-bit boards with RAM to spare (about 84 bytes per block) can use 64 or 128
+// for more look-ahead on prints made of many short segments.
+// The size of the buffer is reported at startup as PlannerBufferBytes.
+// With SD support this is the largest that leaves 16 KB of SRAM for the stack
+// and heap on the 48 KB STM32F103RC/VC boards. Static RAM is about 27 KB.
 #if BOTH(SDSUPPORT, DIRECT_STEPPING)
   #define BLOCK_BUFFER_SIZE  8
 #elif ENABLED(SDSUPPORT)
-  #define BLOCK_BUFFER_SIZE 32
+  #define BLOCK_BUFFER_SIZE 64
 #else
   #define BLOCK_BUFFER_SIZE 16
 #endif
@@ -1942,8 +2076,15 @@
 // @section serial
 
 // The ASCII buffer for serial input
+// Up to BUFSIZE commands are queued in BUFSIZE_BYTES, each taking only its own
+// length, so a deep queue of short moves fits in little RAM. BUFSIZE_BYTES must
+// be at least 2 * MAX_CMD_SIZE. (Default BUFSIZE * MAX_CMD_SIZE)
 #define MAX_CMD_SIZE 128
-#define BUFSIZE 4
+#define BUFSIZE 16
+#define BUFSIZE_BYTES 512
+
+// Report command queue occupancy with M576, for tuning BUFSIZE and BUFSIZE_BYTES
+#define COMMAND_QUEUE_STATS
 
 // Transmission to Host Buffer Size
 // To save 386 bytes of PROGMEM (and TX_BUFFER_SIZE+3 bytes of RAM) set to 0.
@@ -1957,8 +2098,10 @@
 // Host Receive Buffer Size
 // Without XON/XOFF flow control (see SERIAL_XON_XOFF below) 32 bytes should be enough.
 // To use flow control, set this buffer size to at least 1024 bytes.
+// The STM32F1 UARTs used for commands or the LCD, and the LINUX serial ports,
+// receive into rings of this size that frame lines. Make it larger than MAX_CMD_SIZE.
 // :[0, 2, 4, 8, 16, 32, 64, 128, 256, 512, 1024, 2048]
-//#define RX_BUFFER_SIZE 1024
+#define RX_BUFFER_SIZE 256
 
 #if RX_BUFFER_SIZE >= 1024
   // Enable to have the controller send XON/XOFF control characters to
@@ -3226,6 +3369,13 @@
   //#define GCODE_QUOTED_STRINGS  // Support for quoted string parameters
 #endif
 
+/**
+ * Convert G-code values with integer math and a single division instead
+ * of strtof, which is slow on boards without an FPU. The results are the
+ * same. Values too long to convert exactly still go through strtof.
+ */
+#define GCODE_FIXED_POINT_VALUES
+
 //#define GCODE_CASE_INSENSITIVE  // Accept G-code sent to the firmware in lowercase
 
 //#define REPETIER_GCODE_M360     // Add commands originally from Repetier FW
@@ -0,0 +1,78 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifdef __PLAT_LINUX__
+
+#include "../../inc/MarlinConfig.h"
+#include "../shared/Delay.h"
+
+// U8glib required functions
+extern "C" void u8g_xMicroDelay(uint16_t val) {
+  DELAY_US(val);
+}
+extern "C" void u8g_MicroDelay(void) {
+  u8g_xMicroDelay(1);
+}
+extern "C" void u8g_10MicroDelay(void) {
+  u8g_xMicroDelay(10);
+}
+extern "C" void u8g_Delay(uint16_t val) {
+  delay(val);
+}
+//************************//
+
+// return free heap space
+int freeMemory() {
+  return 0;
+}
+
+void HAL_idletask() {
+  Clock::idle();
+}
+
+uint32_t HAL_cycle_count() {
+  return uint32_t(Clock::host_nanos() * ((F_CPU) / 1000000UL) / 1000UL);
+}
+
+void HAL_reboot() { /* Reset the application state and GPIO */ }
+
+// ------------------------
+// ADC
+// ------------------------
+
+void HAL_adc_init() {}
+
+void HAL_adc_enable_channel(const uint8_t ch) {
+  pinMode(analogInputToDigitalPin(ch), Gpio::MODE_ANALOG);
+}
+
+uint8_t active_ch = 0;
+void HAL_adc_start_conversion(const uint8_t ch) {
+  active_ch = ch;
+}
+
+uint16_t HAL_adc_get_result() {
+  const pin_t pin = analogInputToDigitalPin(active_ch);
+  if (!VALID_PIN(pin)) return 0;
+  return Gpio::get(pin) & 0x3FF;    // return 10bit value as Marlin expects
+}
+
+#endif // __PLAT_LINUX__
@@ -0,0 +1,148 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * HAL for Linux x86_64 (host simulator)
+ */
+
+#define CPU_32_BIT
+
+#include <stdint.h>
+#include <stdarg.h>
+#include <algorithm>
+
+#include "../../inc/MarlinConfigPre.h"
+
+#include "hardware/Clock.h"
+#include "hardware/Timer.h"
+
+#include "../shared/Marduino.h"
+#include "../shared/math_32bit.h"
+#include "../shared/HAL_SPI.h"
+#include "fastio.h"
+#include "watchdog.h"
+#include "serial.h"
+
+// ------------------------
+// Defines
+// ------------------------
+
+// Clocked like the STM32F103 on the ZONESTAR boards, so cycle-based
+// delays and step timing match the real hardware
+#define F_CPU 72000000
+#define SystemCoreClock F_CPU
+
+#define SHARED_SERVOS HAS_SERVOS
+
+//
+// Serial ports. Each one is a pty on the host (see main.cpp).
+//
+extern HalSerial usb_serial;
+#define MYSERIAL0 usb_serial
+#define HAS_MYSERIAL0 1
+
+#ifdef SERIAL_PORT_2
+  extern HalSerial aux_serial;
+  #define MYSERIAL1 aux_serial
+  #define HAS_MYSERIAL1 1
+#endif
+
+#ifdef LCD_SERIAL_PORT
+  extern HalSerial lcd_serial;
+  #define LCD_SERIAL lcd_serial
+  #define HAS_LCD_SERIAL 1
+#endif
+
+#ifdef WIFI_SERIAL_PORT
+  extern HalSerial wifi_serial;
+  #define WIFI_SERIAL wifi_serial
+  #define HAS_WIFI_SERIAL 1
+#endif
+
+#define ST7920_DELAY_1 DELAY_NS(600)
+#define ST7920_DELAY_2 DELAY_NS(750)
+#define ST7920_DELAY_3 DELAY_NS(750)
+
+//
+// Interrupts
+//
+#define CRITICAL_SECTION_START()  const bool _irq_enabled = Interrupts::enabled(); Interrupts::disable()
+#define CRITICAL_SECTION_END()    if (_irq_enabled) Interrupts::enable()
+#define ISRS_ENABLED()            Interrupts::enabled()
+#define ENABLE_ISRS()             Interrupts::enable()
+#define DISABLE_ISRS()            Interrupts::disable()
+
+inline void HAL_init() {}
+
+// Service any interrupts that fell due while the main loop was busy
+#define HAL_IDLETASK 1
+void HAL_idletask();
+
+// Host time in F_CPU cycles, for ISR_PROFILING. This measures the simulator
+// on the host, which is much faster than the board but has no pulse waits.
+#define HAL_CYCLE_COUNTER 1
+inline void HAL_cycle_counter_init() {}
+uint32_t HAL_cycle_count();
+
+// Utility functions
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-function"
+int freeMemory();
+#pragma GCC diagnostic pop
+
+// ADC
+#define HAL_ANALOG_SELECT(ch) HAL_adc_enable_channel(ch)
+#define HAL_START_ADC(ch)     HAL_adc_start_conversion(ch)
+#define HAL_ADC_VREF          3.3
+#define HAL_ADC_RESOLUTION   10
+#define HAL_READ_ADC()        HAL_adc_get_result()
+#define HAL_ADC_READY()       true
+
+void HAL_adc_init();
+void HAL_adc_enable_channel(const uint8_t ch);
+void HAL_adc_start_conversion(const uint8_t ch);
+uint16_t HAL_adc_get_result();
+
+// Reset source
+inline void HAL_clear_reset_source(void) {}
+inline uint8_t HAL_get_reset_source(void) { return RST_POWER_ON; }
+
+void HAL_reboot();
+
+/* ---------------- Delay in cycles */
+FORCE_INLINE static void DELAY_CYCLES(uint64_t x) {
+  Clock::delayCycles(x);
+}
+
+// Add strcmp_P if missing
+#ifndef strcmp_P
+  #define strcmp_P(a, b) strcmp((a), (b))
+#endif
+
+#ifndef strcat_P
+  #define strcat_P(a, b) strcat((a), (b))
+#endif
+
+#ifndef strcpy_P
+  #define strcpy_P(a, b) strcpy((a), (b))
+#endif
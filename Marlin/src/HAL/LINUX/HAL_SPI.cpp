@@ -0,0 +1,45 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifdef __PLAT_LINUX__
+
+/**
+ * There is no SPI peripheral on the host. The SD card is reached through
+ * the SDIO interface (see sdio.cpp), so these only satisfy the linker for
+ * code that talks to SPI devices directly.
+ */
+
+#include "../../inc/MarlinConfig.h"
+#include "../shared/HAL_SPI.h"
+
+void spiBegin() {}
+void spiInit(uint8_t spiRate) {}
+void spiSend(uint8_t b) {}
+uint8_t spiRec() { return 0xFF; }
+void spiRead(uint8_t* buf, uint16_t nbyte) { memset(buf, 0xFF, nbyte); }
+void spiSendBlock(uint8_t token, const uint8_t* buf) {}
+void spiBeginTransaction(uint32_t spiClock, uint8_t bitOrder, uint8_t dataMode) {}
+
+void spiSend(uint32_t chan, byte b) {}
+void spiSend(uint32_t chan, const uint8_t* buf, size_t n) {}
+uint8_t spiRec(uint32_t chan) { return 0xFF; }
+
+#endif // __PLAT_LINUX__
@@ -0,0 +1,120 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifdef __PLAT_LINUX__
+
+#include "../../inc/MarlinConfig.h"
+#include "../shared/Delay.h"
+
+// Interrupts
+void cli() { Interrupts::disable(); }
+void sei() { Interrupts::enable(); }
+
+void attachInterrupt(const pin_t, void (*)(), uint32_t) {}
+void detachInterrupt(const pin_t) {}
+
+// Time functions. Reading the time is also a chance for pending interrupts to run.
+void _delay_ms(const int delay_ms) {
+  delay(delay_ms);
+}
+
+uint32_t millis() {
+  const uint32_t ms = (uint32_t)Clock::millis();
+  Timer::dispatch();
+  return ms;
+}
+
+uint32_t micros() {
+  const uint32_t us = (uint32_t)Clock::micros();
+  Timer::dispatch();
+  return us;
+}
+
+// This is required for some Arduino libraries we are using
+void delayMicroseconds(unsigned long us) {
+  Clock::delayMicros(us);
+}
+
+extern "C" void delay(const int msec) {
+  Clock::delayMillis(msec);
+}
+
+// IO functions
+// As defined by Arduino INPUT(0x0), OUTPUT(0x1), INPUT_PULLUP(0x2), INPUT_PULLDOWN(0x3)
+void pinMode(const pin_t pin, const uint8_t mode) {
+  if (!VALID_PIN(pin)) return;
+  Gpio::setMode(pin, mode);
+}
+
+void digitalWrite(pin_t pin, uint8_t pin_status) {
+  if (!VALID_PIN(pin)) return;
+  Gpio::set(pin, pin_status ? 1 : 0);
+}
+
+bool digitalRead(pin_t pin) {
+  if (!VALID_PIN(pin)) return false;
+  return Gpio::get(pin);
+}
+
+void analogWrite(pin_t pin, int pwm_value) {  // 1 - 254: pwm_value, 0: LOW, 255: HIGH
+  if (!VALID_PIN(pin)) return;
+  if (Gpio::getMode(pin) != Gpio::MODE_PWM) Gpio::setMode(pin, Gpio::MODE_PWM);
+  Gpio::set(pin, constrain(pwm_value, 0, 255));
+}
+
+uint16_t analogRead(pin_t adc_pin) {
+  const pin_t pin = analogInputToDigitalPin(adc_pin);
+  if (!VALID_PIN(pin)) return 0;
+  return Gpio::get(pin);
+}
+
+char *dtostrf(double __val, signed char __width, unsigned char __prec, char *__s) {
+  char format_string[20];
+  snprintf(format_string, 20, "%%%d.%df", __width, __prec);
+  sprintf(__s, format_string, __val);
+  return __s;
+}
+
+void tone(const pin_t pin, const unsigned int frequency, const unsigned long duration) {
+  Gpio::set(pin, frequency ? 1 : 0);
+}
+
+void noTone(const pin_t pin) {
+  Gpio::set(pin, 0);
+}
+
+int32_t random(int32_t max) {
+  return rand() % max;
+}
+
+int32_t random(int32_t min, int32_t max) {
+  return min + rand() % (max - min);
+}
+
+void randomSeed(uint32_t value) {
+  srand(value);
+}
+
+int map(uint16_t x, uint16_t in_min, uint16_t in_max, uint16_t out_min, uint16_t out_max) {
+  return (x - in_min) * (out_max - out_min) / (in_max - in_min) + out_min;
+}
+
+#endif // __PLAT_LINUX__
@@ -0,0 +1,78 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifdef __PLAT_LINUX__
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(FLASH_EEPROM_JOURNAL)
+
+#include "../shared/eeprom_api.h"
+#include "../shared/eeprom_journal.h"
+#include "../../module/planner.h"
+#include "hardware/Flash.h"
+
+extern const char *eeprom_filename;
+
+// The pages of the journal, kept in the EEPROM file
+Flash eeprom_flash;
+
+// Settings files from before the journal are a flat copy, like the first page
+#define LEGACY_PAGE 0
+
+static bool flash_open() {
+  return eeprom_flash.isOpen() || eeprom_flash.open(eeprom_filename, EEPROM_JOURNAL_PAGES, EEPROM_PAGE_SIZE);
+}
+
+const uint16_t* flash_journal_page(const uint8_t page) { return eeprom_flash.page(page); }
+bool flash_journal_erase(const uint8_t page) { return eeprom_flash.erase(page); }
+bool flash_journal_program(const uint8_t page, const uint16_t index, const uint16_t value) { return eeprom_flash.program(page, index, value); }
+
+size_t PersistentStore::capacity() { return FlashJournal::capacity; }
+
+bool PersistentStore::access_start() {
+  if (!flash_open()) return false;
+  if (!flash_journal.mounted() && !flash_journal.mount())
+    flash_journal.import(reinterpret_cast<const uint8_t*>(eeprom_flash.page(LEGACY_PAGE)), LEGACY_PAGE);
+  return true;
+}
+
+bool PersistentStore::access_finish() { return flash_journal.commit(!planner.has_blocks_queued()); }
+
+bool PersistentStore::write_data(int &pos, const uint8_t *value, size_t size, uint16_t *crc) {
+  if (pos + size > FlashJournal::capacity) return true;
+  flash_journal.write(pos, value, size);
+  crc16(crc, value, size);
+  pos += size;
+  return false;  // return true for any error
+}
+
+bool PersistentStore::read_data(int &pos, uint8_t *value, const size_t size, uint16_t *crc, const bool writing/*=true*/) {
+  if (pos + size > FlashJournal::capacity) return true;
+  const uint8_t * const buff = writing ? &value[0] : &FlashJournal::image[pos];
+  if (writing) memcpy(value, &FlashJournal::image[pos], size);
+  crc16(crc, buff, size);
+  pos += size;
+  return false;  // return true for any error
+}
+
+#endif // FLASH_EEPROM_JOURNAL
+#endif // __PLAT_LINUX__
@@ -0,0 +1,103 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifdef __PLAT_LINUX__
+
+#include "Clock.h"
+#include "Timer.h"
+
+#include <time.h>
+#include <thread>
+#include <chrono>
+
+Clock::Mode Clock::mode = Clock::REALTIME;
+uint32_t Clock::frequency = 72000000;
+double Clock::time_multiplier = 1.0;
+uint32_t Clock::quantum_ns = 100;
+uint64_t Clock::virtual_ns = 0;
+uint64_t Clock::host_start_ns = Clock::host_nanos();
+
+uint64_t Clock::host_nanos() {
+  timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return uint64_t(ts.tv_sec) * ONE_BILLION + ts.tv_nsec;
+}
+
+uint64_t Clock::peek() {
+  if (mode == VIRTUAL) return virtual_ns;
+  return virtual_ns + uint64_t((host_nanos() - host_start_ns) * time_multiplier);
+}
+
+uint64_t Clock::nanos() {
+  if (mode != VIRTUAL) return peek();
+  // Interrupts that fall due within the quantum run at their exact deadline,
+  // so ISR timing doesn't depend on how often the main loop reads the clock
+  delayNanos(quantum_ns);
+  return virtual_ns;
+}
+
+void Clock::start() {
+  virtual_ns = 0;
+  host_start_ns = host_nanos();
+}
+
+void Clock::setMode(const Mode m) {
+  if (m == mode) return;
+  virtual_ns = peek();            // Carry the current time over
+  host_start_ns = host_nanos();
+  mode = m;
+}
+
+void Clock::setTimeMultiplier(const double tm) {
+  virtual_ns = peek();
+  host_start_ns = host_nanos();
+  time_multiplier = tm;
+}
+
+void Clock::advanceTo(const uint64_t ns) {
+  if (mode == VIRTUAL && ns > virtual_ns) virtual_ns = ns;
+}
+
+void Clock::delayNanos(const uint64_t ns) {
+  const uint64_t target = peek() + ns;
+  if (mode == VIRTUAL) {
+    // Service each interrupt at the moment it falls due
+    for (uint64_t next; (next = Timer::nextDeadline()) <= target;) {
+      advanceTo(next);
+      Timer::dispatch();
+    }
+    advanceTo(target);
+  }
+  else
+    while (peek() < target) Timer::dispatch();
+}
+
+void Clock::idle() {
+  const uint64_t next = Timer::nextDeadline();
+  if (mode == VIRTUAL) {
+    if (next != UINT64_MAX) advanceTo(next);
+  }
+  else if (next > peek() + 100000UL)
+    std::this_thread::sleep_for(std::chrono::microseconds(50));
+  Timer::dispatch();
+}
+
+#endif // __PLAT_LINUX__
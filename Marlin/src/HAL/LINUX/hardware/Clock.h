@@ -0,0 +1,98 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * Virtual system clock for the Linux simulator
+ *
+ * All firmware time (millis, micros, timer counts, delays) is read from here.
+ *
+ *  REALTIME : Virtual time follows the host monotonic clock, scaled by the
+ *             time multiplier. Use this when talking to a host over the pty.
+ *  VIRTUAL  : Virtual time only advances when the firmware consumes it. Each
+ *             clock read costs one quantum, delays advance by their length and
+ *             the idle task skips straight to the next pending interrupt.
+ *             Interrupts always run at their deadline, as if they preempted
+ *             whatever code was consuming the time.
+ *             Runs are fully repeatable, and usually much faster than real time.
+ */
+class Clock {
+public:
+  enum Mode : uint8_t { REALTIME, VIRTUAL };
+
+  static constexpr uint64_t ONE_BILLION = 1000000000ULL;
+
+  // Set time zero. Called once the simulator is configured, so that virtual
+  // time doesn't depend on how long the host took to get there.
+  static void start();
+
+  static void setMode(const Mode m);
+  static Mode getMode() { return mode; }
+  static bool isVirtual() { return mode == VIRTUAL; }
+
+  // CPU frequency used to convert cycle delays
+  static void setFrequency(const uint32_t freq) { frequency = freq; }
+  static uint32_t getFrequency() { return frequency; }
+
+  // REALTIME only: 2.0 runs the firmware at twice the host speed
+  static void setTimeMultiplier(const double tm);
+  static double getTimeMultiplier() { return time_multiplier; }
+
+  // VIRTUAL only: nanoseconds charged for every read of the clock
+  static void setQuantum(const uint32_t ns) { quantum_ns = ns; }
+  static uint32_t getQuantum() { return quantum_ns; }
+
+  // Current virtual time. In VIRTUAL mode every call charges one quantum.
+  static uint64_t nanos();
+  static uint64_t micros() { return nanos() / 1000; }
+  static uint64_t millis() { return nanos() / 1000000; }
+  static double seconds() { return nanos() / double(ONE_BILLION); }
+
+  // Current virtual time without charging a quantum
+  static uint64_t peek();
+
+  // VIRTUAL only: jump forward to the given absolute time (never backward)
+  static void advanceTo(const uint64_t ns);
+
+  // Busy-wait delays. Pending interrupts are serviced while waiting.
+  static void delayNanos(const uint64_t ns);
+  static void delayCycles(const uint64_t cycles) { delayNanos(cycles * ONE_BILLION / frequency); }
+  static void delayMicros(const uint64_t us) { delayNanos(us * 1000); }
+  static void delayMillis(const uint64_t ms) { delayNanos(ms * 1000000); }
+
+  // Give up the CPU until the next timer event (or a short while)
+  static void idle();
+
+  // Host monotonic time, for measuring the simulator itself
+  static uint64_t host_nanos();
+
+private:
+
+  static Mode mode;
+  static uint32_t frequency;
+  static double time_multiplier;
+  static uint32_t quantum_ns;
+  static uint64_t virtual_ns;
+  static uint64_t host_start_ns;
+};
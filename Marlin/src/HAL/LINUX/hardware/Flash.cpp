@@ -0,0 +1,90 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifdef __PLAT_LINUX__
+
+#include "Flash.h"
+#include "Clock.h"
+
+#include <algorithm>
+
+bool Flash::open(const char *filename, const uint8_t p, const uint32_t page_size) {
+  pages = p;
+  page_words = page_size / 2;
+  data.assign(pages * page_words, 0xFFFF);
+  erase_count.assign(pages, 0);
+
+  // Start from the file's contents, if it has any. New flash is erased.
+  // With no file the pages live only in RAM, for tests.
+  if (!filename) return true;
+  file = fopen(filename, "rb+");
+  if (file) {
+    const size_t words = fread(data.data(), 2, data.size(), file);
+    if (words < data.size()) writeThrough(words, data.size() - words);
+  }
+  else {
+    file = fopen(filename, "wb+");
+    if (file) writeThrough(0, data.size());
+  }
+  return file != nullptr;
+}
+
+bool Flash::erase(const uint8_t p) {
+  if (p >= pages || !powered()) return false;
+  std::fill(data.begin() + p * page_words, data.begin() + (p + 1) * page_words, 0xFFFF);
+  erase_count[p]++;
+  writeThrough(p * page_words, page_words);
+  stall(erase_ns);
+  return true;
+}
+
+bool Flash::program(const uint8_t p, const uint16_t index, const uint16_t value) {
+  if (p >= pages || index >= page_words || !powered()) return false;
+  uint16_t &w = data[p * page_words + index];
+  // The STM32F1 refuses to program a half-word that isn't erased
+  if (w != 0xFFFF && value != 0) return false;
+  w = value;
+  program_count++;
+  writeThrough(p * page_words + index, 1);
+  stall(program_ns);
+  return true;
+}
+
+// Count down to a power cut, if one is set
+bool Flash::powered() {
+  if (!power_ops) return false;
+  if (power_ops > 0) power_ops--;
+  return true;
+}
+
+void Flash::stall(const uint64_t ns) {
+  if (ns > longest_stall_ns) longest_stall_ns = ns;
+  Clock::advanceTo(Clock::peek() + ns);
+}
+
+void Flash::writeThrough(const uint32_t word, const uint32_t count) {
+  if (!file) return;
+  fseek(file, word * 2, SEEK_SET);
+  fwrite(&data[word], 2, count, file);
+  fflush(file);
+}
+
+#endif // __PLAT_LINUX__
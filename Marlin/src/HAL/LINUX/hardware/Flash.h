@@ -0,0 +1,72 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+#include <vector>
+
+/**
+ * NOR flash pages, as used for the flash EEPROM on STM32F1 boards
+ *
+ * Erasing sets a whole page to 0xFF and programming writes one erased
+ * half-word. While either runs the CPU stalls for the STM32F103's worst-case
+ * time, so interrupts falling due in the meantime run late, as on the board.
+ * The contents are written through to a file so settings survive a restart.
+ */
+class Flash {
+public:
+  static constexpr uint64_t erase_ns = 40000000,  // tERASE max
+                            program_ns = 70000;   // tPROG max
+
+  bool open(const char *filename, const uint8_t pages, const uint32_t page_size);
+  bool isOpen() const { return file != nullptr; }
+
+  const uint16_t* page(const uint8_t p) const { return &data[p * page_words]; }
+  bool erase(const uint8_t p);
+  bool program(const uint8_t p, const uint16_t index, const uint16_t value);
+
+  uint8_t pageCount() const { return pages; }
+  uint32_t erases(const uint8_t p) const { return erase_count[p]; }
+  uint64_t programs() const { return program_count; }
+
+  // Lose power after 'ops' more erases and programs. Later ones fail and change nothing.
+  void cutPowerAfter(const uint32_t ops) { power_ops = ops; }
+  void restorePower() { power_ops = -1; }
+
+  // Longest single stall since the last reset
+  uint64_t longestStall() const { return longest_stall_ns; }
+  void resetStall() { longest_stall_ns = 0; }
+
+private:
+  void stall(const uint64_t ns);
+  bool powered();
+  void writeThrough(const uint32_t word, const uint32_t count);
+
+  FILE *file = nullptr;
+  uint8_t pages = 0;
+  uint32_t page_words = 0;
+  std::vector<uint16_t> data;
+  std::vector<uint32_t> erase_count;
+  uint64_t program_count = 0, longest_stall_ns = 0;
+  int64_t power_ops = -1;                         // Operations left before the power cut, -1 for none
+};
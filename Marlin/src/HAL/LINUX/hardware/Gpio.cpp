@@ -0,0 +1,54 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifdef __PLAT_LINUX__
+
+#include "Gpio.h"
+
+Gpio::pin_data Gpio::pin_map[Gpio::pin_count];
+GpioListener *Gpio::logger = nullptr;
+
+void Gpio::setMode(const pin_type pin, const uint8_t mode) {
+  if (!valid(pin)) return;
+  pin_data &p = pin_map[pin];
+  p.mode = mode;
+  // An unconnected input floats to its pull resistor
+  if (!p.listener) {
+    if (mode == MODE_INPUT_PULLUP) set(pin, 1);
+    else if (mode == MODE_INPUT_PULLDOWN) set(pin, 0);
+  }
+}
+
+void Gpio::set(const pin_type pin, const uint16_t value) {
+  if (!valid(pin)) return;
+  pin_data &p = pin_map[pin];
+  const uint16_t old_value = p.value;
+  if (old_value == value) return;
+  p.value = value;
+  if (p.listener) p.listener->onPinChange(pin, old_value, value);
+  if (logger) logger->onPinChange(pin, old_value, value);
+}
+
+void Gpio::attach(const pin_type pin, GpioListener * const listener) {
+  if (valid(pin)) pin_map[pin].listener = listener;
+}
+
+#endif // __PLAT_LINUX__
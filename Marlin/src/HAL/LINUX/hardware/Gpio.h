@@ -0,0 +1,74 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+#include <stdint.h>
+
+typedef int16_t pin_type;
+
+/**
+ * Receives every value change on a pin it is attached to
+ */
+class GpioListener {
+public:
+  virtual ~GpioListener() {}
+  virtual void onPinChange(const pin_type pin, const uint16_t old_value, const uint16_t new_value) = 0;
+};
+
+/**
+ * Emulated GPIO bank
+ *
+ * Every pin holds a mode and a value. Digital pins read 0 or 1, analog
+ * inputs hold the raw ADC reading and PWM outputs hold the duty (0-255).
+ * The firmware drives outputs and the simulated hardware drives inputs;
+ * listeners see the changes in the order they happen.
+ */
+class Gpio {
+public:
+  static constexpr pin_type pin_count = 256;
+
+  enum Mode : uint8_t { MODE_INPUT, MODE_OUTPUT, MODE_INPUT_PULLUP, MODE_INPUT_PULLDOWN, MODE_ANALOG, MODE_PWM };
+
+  static bool valid(const pin_type pin) { return pin >= 0 && pin < pin_count; }
+
+  static void setMode(const pin_type pin, const uint8_t mode);
+  static uint8_t getMode(const pin_type pin) { return valid(pin) ? pin_map[pin].mode : uint8_t(MODE_INPUT); }
+  static void setDir(const pin_type pin, const bool output) { setMode(pin, output ? MODE_OUTPUT : MODE_INPUT); }
+
+  static void set(const pin_type pin, const uint16_t value);
+  static void set(const pin_type pin) { set(pin, 1); }
+  static void clear(const pin_type pin) { set(pin, 0); }
+  static uint16_t get(const pin_type pin) { return valid(pin) ? pin_map[pin].value : 0; }
+
+  // One simulated device per pin, plus one logger that sees all pins
+  static void attach(const pin_type pin, GpioListener * const listener);
+  static void attachLogger(GpioListener * const listener) { logger = listener; }
+
+private:
+  struct pin_data {
+    uint8_t mode;
+    uint16_t value;
+    GpioListener *listener;
+  };
+  static pin_data pin_map[pin_count];
+  static GpioListener *logger;
+};
@@ -0,0 +1,71 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifdef __PLAT_LINUX__
+
+#include "Heater.h"
+
+#include <algorithm>
+#include <math.h>
+
+#define THERMISTOR_R25    100000.0
+#define THERMISTOR_BETA     3950.0
+#define THERMISTOR_PULLUP   4700.0
+#define KELVIN_OFFSET        273.15
+
+Heater::Heater(const pin_type heater, const pin_type sensor, const double w, const double c, const double k)
+  : to_celsius(nullptr), heater_pin(heater), sensor_pin(sensor), fan_pin(-1), watts(w), heat_capacity(c), loss_per_kelvin(k),
+    sensor_responsiveness(0), fan_loss_per_kelvin(0), ambient(25.0), celsius(25.0), sensor_celsius(25.0), fan_speed(0), drawn(0)
+{
+  Gpio::set(sensor_pin, adcReading());
+}
+
+// Duty cycle of a pin driven by analogWrite() or by software PWM
+double Heater::duty(const pin_type pin) {
+  const uint16_t v = Gpio::get(pin);
+  return Gpio::getMode(pin) == Gpio::MODE_PWM ? v / 255.0 : (v ? 1.0 : 0.0);
+}
+
+void Heater::update(const double dt) {
+  if (!Gpio::valid(heater_pin)) return;
+  if (Gpio::valid(fan_pin)) fan_speed += (duty(fan_pin) - fan_speed) * std::min(1.0, dt / 0.5);
+  const double loss = loss_per_kelvin + fan_loss_per_kelvin * fan_speed;
+  drawn = watts * duty(heater_pin);
+  celsius += (drawn - loss * (celsius - ambient)) * dt / heat_capacity;
+  sensor_celsius = sensor_responsiveness ? sensor_celsius + (celsius - sensor_celsius) * std::min(1.0, sensor_responsiveness * dt) : celsius;
+  Gpio::set(sensor_pin, adcReading());
+}
+
+uint16_t Heater::adcReading() const {
+  if (to_celsius) {
+    // The reading the table converts nearest to the sensor temperature. NTC readings fall as it warms.
+    uint16_t lo = 0, hi = 1023;
+    while (hi - lo > 1) {
+      const uint16_t mid = (lo + hi) / 2;
+      if (to_celsius(mid) > sensor_celsius) lo = mid; else hi = mid;
+    }
+    return fabs(to_celsius(lo) - sensor_celsius) < fabs(to_celsius(hi) - sensor_celsius) ? lo : hi;
+  }
+  const double r = THERMISTOR_R25 * exp(THERMISTOR_BETA * (1.0 / (sensor_celsius + KELVIN_OFFSET) - 1.0 / (25.0 + KELVIN_OFFSET)));
+  return uint16_t(lround(1023.0 * r / (r + THERMISTOR_PULLUP)));
+}
+
+#endif // __PLAT_LINUX__
@@ -0,0 +1,65 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+#include "Gpio.h"
+
+/**
+ * Lumped thermal model of a heater with an NTC thermistor
+ *
+ * The heater output pin is sampled on every update and its average duty
+ * drives the block temperature:
+ *
+ *   C * dT/dt = P * duty - k * (T - T_ambient)
+ *
+ * The temperature is written to the sensor pin as the raw 10-bit reading
+ * of a 100K beta-3950 NTC thermistor under a 4.7K pullup.
+ */
+class Heater {
+public:
+  typedef float (*ToCelsius)(const int raw);  // Firmware conversion of a 10-bit ADC reading
+
+  Heater(const pin_type heater_pin, const pin_type sensor_pin, const double watts, const double heat_capacity, const double loss_per_kelvin);
+
+  void update(const double dt);         // Advance the model by 'dt' seconds
+
+  // The sensor follows the block at 'responsiveness' kelvin per second per kelvin apart (0 for no lag)
+  void setSensorLag(const double responsiveness) { sensor_responsiveness = responsiveness; }
+  // A fan on 'pin' adds up to 'loss' watts per kelvin, spinning up and down over about half a second
+  void setFan(const pin_type pin, const double loss) { fan_pin = pin; fan_loss_per_kelvin = loss; }
+  // Read as the firmware's own thermistor table says, rather than as a 100K/3950 NTC
+  void setThermistor(const ToCelsius f) { to_celsius = f; }
+
+  double temperature() const { return celsius; }
+  double sensorTemperature() const { return sensor_celsius; }
+  double power() const { return drawn; }  // Watts drawn over the last update
+  void setAmbient(const double t) { ambient = t; }
+
+private:
+  uint16_t adcReading() const;
+  static double duty(const pin_type pin);
+
+  ToCelsius to_celsius;
+  pin_type heater_pin, sensor_pin, fan_pin;
+  double watts, heat_capacity, loss_per_kelvin, sensor_responsiveness, fan_loss_per_kelvin;
+  double ambient, celsius, sensor_celsius, fan_speed, drawn;
+};
@@ -0,0 +1,107 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifdef __PLAT_LINUX__
+
+#include "StepTrace.h"
+#include "Clock.h"
+
+#include <string.h>
+
+static inline void keep_min(uint64_t &v, const uint64_t n) { if (n < v) v = n; }
+
+void StepTrace::addAxis(const char *name, const pin_type step_pin, const pin_type dir_pin) {
+  if (axis_count >= max_axes || !Gpio::valid(step_pin)) return;
+  Axis &a = axes[axis_count++];
+  memset(&a, 0, sizeof(a));
+  a.name = name;
+  a.step_pin = step_pin;
+  a.dir_pin = dir_pin;
+  a.min_interval = a.min_pulse = a.min_setup = UINT64_MAX;
+}
+
+bool StepTrace::open(const char *filename) {
+  close();
+  file = fopen(filename, "wb");
+  if (!file) return false;
+  const uint8_t header[] = {
+    'M', 'S', 'T', 'P', 1, axis_count,
+    uint8_t(rate), uint8_t(rate >> 8), uint8_t(rate >> 16), uint8_t(rate >> 24)
+  };
+  fwrite(header, sizeof(header), 1, file);
+  for (uint8_t i = 0; i < axis_count; i++) fwrite(axes[i].name, strlen(axes[i].name) + 1, 1, file);
+  last_tick = 0;
+  return true;
+}
+
+void StepTrace::close() {
+  if (!file) return;
+  fclose(file);
+  file = nullptr;
+}
+
+uint64_t StepTrace::now() const {
+  return uint64_t((__uint128_t)Clock::peek() * rate / Clock::ONE_BILLION);
+}
+
+void StepTrace::record(const uint8_t event, const uint64_t tick) {
+  edge_count++;
+  if (!file) return;
+  fputc(event, file);
+  for (uint64_t delta = tick - last_tick; ; delta >>= 7) {
+    if (delta < 0x80) { fputc(uint8_t(delta), file); break; }
+    fputc(uint8_t(delta) | 0x80, file);
+  }
+  last_tick = tick;
+}
+
+void StepTrace::onPinChange(const pin_type pin, const uint16_t, const uint16_t new_value) {
+  for (uint8_t i = 0; i < axis_count; i++) {
+    Axis &a = axes[i];
+    const bool is_step = pin == a.step_pin;
+    if (!is_step && pin != a.dir_pin) continue;
+
+    const uint64_t tick = now();
+    if (is_step) {
+      if (new_value) {
+        if (a.steps) keep_min(a.min_interval, tick - a.last_rise);
+        if (a.dir_changes) keep_min(a.min_setup, tick - a.last_dir);
+        a.last_rise = tick;
+        a.steps++;
+      }
+      else
+        keep_min(a.min_pulse, tick - a.last_rise);
+    }
+    else {
+      a.last_dir = tick;
+      a.dir_changes++;
+    }
+    record(i << 2 | (is_step ? 0 : 2) | (new_value ? 1 : 0), tick);
+  }
+}
+
+uint64_t StepTrace::totalSteps() const {
+  uint64_t total = 0;
+  for (uint8_t i = 0; i < axis_count; i++) total += axes[i].steps;
+  return total;
+}
+
+#endif // __PLAT_LINUX__
@@ -0,0 +1,84 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+#include "Gpio.h"
+
+#include <stdio.h>
+
+/**
+ * Step/dir timeline recorder
+ *
+ * Logs every edge on the step and dir pins of the registered axes, timed in
+ * stepper timer ticks of the virtual Clock. In VIRTUAL mode a given G-code
+ * file always produces the same trace, so two firmware builds can be
+ * compared edge for edge (see buildroot/share/scripts/steptrace.py).
+ *
+ * Trace file layout (little-endian):
+ *   "MSTP" <version:u8> <axes:u8> <tick rate:u32>
+ *   then each axis name as a NUL-terminated string
+ *   then one record per edge:
+ *   <event:u8> <ticks since previous edge:LEB128>
+ *   event = axis << 2 | is_dir << 1 | new level
+ *
+ * Statistics are kept even when no file is written.
+ */
+class StepTrace : public GpioListener {
+public:
+  static constexpr uint8_t max_axes = 16;
+
+  struct Axis {
+    const char *name;
+    pin_type step_pin, dir_pin;
+    uint64_t steps, dir_changes;
+    uint64_t last_rise, last_dir;     // Tick of the last step and dir edges
+    uint64_t min_interval;            // Shortest step period seen, in ticks
+    uint64_t min_pulse;               // Shortest step high time, in ticks
+    uint64_t min_setup;               // Shortest dir change to step time, in ticks
+  };
+
+  StepTrace(const uint32_t tick_rate) : rate(tick_rate) {}
+
+  void addAxis(const char *name, const pin_type step_pin, const pin_type dir_pin);
+
+  // Start recording to a file, after all axes are added
+  bool open(const char *filename);
+  void close();
+
+  void onPinChange(const pin_type pin, const uint16_t old_value, const uint16_t new_value) override;
+
+  uint8_t axisCount() const { return axis_count; }
+  const Axis& axis(const uint8_t i) const { return axes[i]; }
+  uint64_t totalSteps() const;
+  uint64_t edges() const { return edge_count; }
+  uint32_t tickRate() const { return rate; }
+
+private:
+  uint64_t now() const;
+  void record(const uint8_t event, const uint64_t tick);
+
+  uint32_t rate;
+  Axis axes[max_axes];
+  uint8_t axis_count = 0;
+  FILE *file = nullptr;
+  uint64_t last_tick = 0, edge_count = 0;
+};
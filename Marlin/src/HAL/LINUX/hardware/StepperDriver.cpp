@@ -0,0 +1,56 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifdef __PLAT_LINUX__
+
+#include "StepperDriver.h"
+
+StepperDriver::StepperDriver(const pin_type enable, const pin_type dir, const pin_type step)
+  : position(0), steps(0), enable_pin(enable), dir_pin(dir), step_pin(step),
+    enable_on(false), invert_dir(false), step_callback(nullptr)
+{
+  Gpio::attach(step_pin, this);
+}
+
+void StepperDriver::configure(const bool en_on, const bool inv_dir) {
+  enable_on = en_on;
+  invert_dir = inv_dir;
+}
+
+void StepperDriver::onPinChange(const pin_type pin, const uint16_t old_value, const uint16_t new_value) {
+  if (pin != step_pin || old_value || !new_value) return;         // Step rising edges only
+  if (Gpio::valid(enable_pin) && bool(Gpio::get(enable_pin)) != enable_on) return;
+  position += (bool(Gpio::get(dir_pin)) != invert_dir) ? 1 : -1;
+  steps++;
+  if (step_callback) step_callback();
+}
+
+Endstop::Endstop(const pin_type p, const bool state) : pin(p), hit_state(state), hit(false) {
+  Gpio::attach(pin, this);
+  update(false);
+}
+
+void Endstop::update(const bool triggered) {
+  hit = triggered;
+  Gpio::set(pin, hit == hit_state);   // Only notifies on change, so re-driving is cheap
+}
+
+#endif // __PLAT_LINUX__
@@ -0,0 +1,73 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+#include "Gpio.h"
+
+/**
+ * A step/dir stepper driver
+ *
+ * Counts step pulses (rising edges) while the driver is enabled. The
+ * position is in motor steps; the simulator maps motors to axes, so
+ * CoreXY and friends can be modelled on top.
+ */
+class StepperDriver : public GpioListener {
+public:
+  typedef void (step_callback_fn)();
+
+  StepperDriver(const pin_type enable, const pin_type dir, const pin_type step);
+
+  // Electrical conventions, taken from the firmware configuration
+  void configure(const bool enable_on, const bool invert_dir);
+
+  // Called after every counted step
+  void onStep(step_callback_fn *fn) { step_callback = fn; }
+
+  void onPinChange(const pin_type pin, const uint16_t old_value, const uint16_t new_value) override;
+
+  int32_t position;
+  uint64_t steps;             // Total pulses seen, in either direction
+
+private:
+  pin_type enable_pin, dir_pin, step_pin;
+  bool enable_on, invert_dir;
+  step_callback_fn *step_callback;
+};
+
+/**
+ * A mechanical endstop switch
+ *
+ * Owning the pin keeps the firmware's pullup setup from overriding it.
+ */
+class Endstop : public GpioListener {
+public:
+  Endstop(const pin_type pin, const bool hit_state=true);
+
+  void setHitState(const bool state) { hit_state = state; update(hit); }
+  void update(const bool triggered);
+
+  void onPinChange(const pin_type, const uint16_t, const uint16_t) override {}
+
+private:
+  pin_type pin;
+  bool hit_state, hit;
+};
@@ -0,0 +1,127 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifdef __PLAT_LINUX__
+
+#include "Timer.h"
+#include "Clock.h"
+
+Timer *Timer::timers[max_timers];
+uint8_t Timer::timer_count = 0;
+
+volatile bool Interrupts::enabled_ = true;
+uint8_t Interrupts::depth = 0;
+
+void Interrupts::enable() {
+  enabled_ = true;
+  if (!depth) Timer::dispatch();
+}
+
+void Timer::init(const uint32_t r, const uint32_t cmax, callback_fn *fn, const bool m) {
+  rate = r;
+  counter_max = cmax;
+  handler = fn;
+  maskable = m;
+  active = false;
+  deadline = UINT64_MAX;
+  for (uint8_t i = 0; i < timer_count; i++) if (timers[i] == this) return;
+  if (timer_count < max_timers) timers[timer_count++] = this;
+}
+
+uint64_t Timer::ticksToNanos(const uint64_t ticks) const {
+  return uint64_t(((__uint128_t)ticks * Clock::ONE_BILLION + rate - 1) / rate);
+}
+
+uint32_t Timer::getCount() const {
+  const uint64_t now = Clock::nanos();
+  if (now <= period_start) return 0;
+  return uint32_t(((__uint128_t)(now - period_start) * rate / Clock::ONE_BILLION) & counter_max);
+}
+
+void Timer::start(const uint32_t frequency) {
+  compare = frequency ? rate / frequency : counter_max;
+  if (compare > counter_max) compare = counter_max;
+  period_start = Clock::peek();
+  schedule();
+}
+
+void Timer::setCompare(const uint32_t value) {
+  compare = value > counter_max ? counter_max : value;
+  schedule();
+}
+
+void Timer::schedule() {
+  const uint64_t ticks = compare ? compare : 1,
+                 match = period_start + ticksToNanos(ticks);
+  // Missed the compare value? Then the counter has to wrap around first.
+  deadline = match > Clock::peek() ? match : period_start + ticksToNanos(uint64_t(counter_max) + 1 + ticks);
+}
+
+void Timer::fire() {
+  // The counter reset at the match, not now, and kept counting while the CPU
+  // was stalled. Matches passed meanwhile leave one interrupt pending.
+  period_start = deadline;
+  const uint64_t period = ticksToNanos(compare ? compare : 1), now = Clock::peek();
+  if (period_start + period <= now) {
+    period_start += (now - period_start) / period * period;
+    deadline = period_start;
+  }
+  else
+    deadline = period_start + period;
+  fired++;
+  const uint64_t entry_ns = Clock::host_nanos();
+  if (maskable) {
+    Interrupts::depth++;
+    handler();
+    Interrupts::depth--;
+    Interrupts::enabled_ = true;    // Return from interrupt
+  }
+  else
+    handler();
+  busy_ns += Clock::host_nanos() - entry_ns;
+}
+
+uint64_t Timer::nextDeadline() {
+  const bool ready = Interrupts::ready();
+  uint64_t next = UINT64_MAX;
+  for (uint8_t i = 0; i < timer_count; i++) {
+    const Timer &t = *timers[i];
+    if (t.active && (ready || !t.maskable) && t.deadline < next) next = t.deadline;
+  }
+  return next;
+}
+
+void Timer::dispatch() {
+  for (;;) {
+    const uint64_t now = Clock::peek();
+    const bool ready = Interrupts::ready();
+    Timer *due = nullptr;
+    for (uint8_t i = 0; i < timer_count; i++) {
+      Timer *t = timers[i];
+      if (t->active && t->deadline <= now && (ready || !t->maskable) && (!due || t->deadline < due->deadline))
+        due = t;
+    }
+    if (!due) break;
+    due->fire();
+  }
+}
+
+#endif // __PLAT_LINUX__
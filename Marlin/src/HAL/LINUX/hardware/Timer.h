@@ -0,0 +1,92 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * Virtual compare-match timer
+ *
+ * The counter runs at 'rate' Hz on the virtual Clock. When it reaches the
+ * compare value it resets to zero and calls the handler, the same way the
+ * STM32F1 timers behave with ARR preload disabled. A compare value set
+ * below the current count is only matched after the counter wraps.
+ *
+ * Maskable timers model interrupts: they only fire while interrupts are
+ * enabled and no other handler is running. Unmaskable timers model the
+ * outside world (heaters, sensors) and may fire at any dispatch point.
+ */
+class Timer {
+public:
+  typedef void (callback_fn)();
+
+  void init(const uint32_t rate, const uint32_t counter_max, callback_fn *fn, const bool maskable=true);
+  void start(const uint32_t frequency);
+
+  void enable() { active = true; }
+  void disable() { active = false; }
+  bool enabled() const { return active; }
+
+  void setCompare(const uint32_t value);
+  uint32_t getCompare() const { return compare; }
+  uint32_t getCount() const;
+  uint32_t getRate() const { return rate; }
+  uint64_t getFired() const { return fired; }
+  uint64_t getBusyNanos() const { return busy_ns; }   // Host time spent in the handler
+
+  // Earliest deadline of a timer that is allowed to fire right now
+  static uint64_t nextDeadline();
+
+  // Run the handler of every timer that has fallen due, earliest first
+  static void dispatch();
+
+private:
+  uint64_t ticksToNanos(const uint64_t ticks) const;
+  void schedule();
+  void fire();
+
+  bool active = false, maskable = true;
+  uint32_t rate = 1, counter_max = 0xFFFFFFFF, compare = 0;
+  uint64_t period_start = 0, deadline = UINT64_MAX, fired = 0, busy_ns = 0;
+  callback_fn *handler = nullptr;
+
+  static constexpr uint8_t max_timers = 8;
+  static Timer *timers[max_timers];
+  static uint8_t timer_count;
+};
+
+/**
+ * Global interrupt mask, as set by cli() / sei()
+ */
+class Interrupts {
+public:
+  static void enable();             // Also services anything left pending
+  static void disable() { enabled_ = false; }
+  static bool enabled() { return enabled_; }
+  static bool inHandler() { return depth > 0; }
+  static bool ready() { return enabled_ && !depth; }
+
+private:
+  friend class Timer;
+  static volatile bool enabled_;
+  static uint8_t depth;
+};
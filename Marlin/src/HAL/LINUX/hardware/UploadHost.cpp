@@ -0,0 +1,287 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifdef __PLAT_LINUX__
+
+#include "UploadHost.h"
+#include "Clock.h"
+
+#include <algorithm>
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// The parts of the binary protocol the host needs
+enum : uint8_t {
+  CONTROL_SYNC = 0x01, CONTROL_CLOSE = 0x02,
+  FILE_QUERY = 0x10, FILE_OPEN = 0x11, FILE_CLOSE = 0x12, FILE_WRITE = 0x13
+};
+static constexpr uint64_t ack_timeout_ns = 250000000; // Beyond the line and latency times
+
+static uint16_t fletcher16(uint16_t cs, const uint8_t *data, const size_t count) {
+  for (size_t i = 0; i < count; i++) {
+    const uint16_t lo = ((cs & 0xFF) + data[i]) % 255;
+    cs = ((((cs >> 8) + lo) % 255) << 8) | lo;
+  }
+  return cs;
+}
+
+void UploadHost::start(const std::vector<uint8_t> &data, const char *name, const Options &opts) {
+  const uint64_t now = Clock::peek();
+  opt = opts;
+  st = {};
+  st.start_ns = now;
+  st.file_bytes = data.size();
+  file = &data;
+  filename = name;
+  error_text.clear();
+  byte_ns = 10 * Clock::ONE_BILLION / opt.baud;
+  latency_ns = uint64_t(opt.latency_us) * 1000;
+  wire_free_ns = reply_free_ns = now;
+  inbound.clear();
+  lines.clear();
+  packets.clear();
+  reply.clear();
+
+  state = SWITCH;
+  const char m28[] = "M28 B1\n";
+  send(reinterpret_cast<const uint8_t*>(m28), strlen(m28), now);
+}
+
+// Bytes go out back to back, each one arriving at the firmware a latency after it leaves
+void UploadHost::send(const uint8_t *data, const size_t count, const uint64_t now) {
+  uint64_t t = std::max(now, wire_free_ns);
+  for (size_t i = 0; i < count; i++) {
+    t += byte_ns;
+    inbound.emplace_back(t + latency_ns, data[i]);
+  }
+  wire_free_ns = t;
+  st.wire_bytes += count;
+}
+
+void UploadHost::queuePacket(const uint8_t meta, const uint8_t *payload, const uint16_t size) {
+  Packet p;
+  p.sync = next_sync++;
+  p.sent = p.acked = false;
+  p.due_ns = 0;
+  p.write = (meta == FILE_WRITE);
+  const uint8_t header[6] = { 0xAD, 0xB5, p.sync, meta, uint8_t(size), uint8_t(size >> 8) };
+  const uint16_t header_cs = fletcher16(0, &header[2], 4);
+  p.frame.assign(header, header + 6);
+  p.frame.push_back(header_cs & 0xFF);
+  p.frame.push_back(header_cs >> 8);
+  // Packets without a payload end with the header
+  if (size) {
+    p.frame.insert(p.frame.end(), payload, payload + size);
+    const uint16_t cs = fletcher16(0, &p.frame[2], p.frame.size() - 2);
+    p.frame.push_back(cs & 0xFF);
+    p.frame.push_back(cs >> 8);
+  }
+  packets.push_back(p);
+}
+
+void UploadHost::sendPacket(Packet &p, const uint64_t now) {
+  if (p.sent) st.resends++; else if (p.write) st.packets++;
+  std::vector<uint8_t> frame = p.frame;
+  if (p.write && opt.corrupt_every && ++sends % opt.corrupt_every == 0) {
+    frame[8] ^= 0x10; // In the payload, so the firmware knows which packet to ask for
+    st.corrupted++;
+  }
+  send(frame.data(), frame.size(), now);
+  p.sent = true;
+  p.due_ns = wire_free_ns + 2 * latency_ns + ack_timeout_ns;
+}
+
+void UploadHost::onLine(const std::string &line, const uint64_t now) {
+  unsigned n, size, major, minor, patch, window, bits, lookahead;
+  if (!line.compare(0, 2, "ok") && line.size() > 2 && isdigit(line[2])) {
+    n = atoi(&line[2]);
+    for (Packet &p : packets) {
+      if (!p.sent) break;
+      if (p.sync == n) p.acked = true;
+    }
+  }
+  else if (!line.compare(0, 2, "rs") && line.size() > 2 && isdigit(line[2])) {
+    n = atoi(&line[2]);
+    for (Packet &p : packets) {
+      if (!p.sent) break;
+      if (!p.acked && p.sync == n) sendPacket(p, now);
+    }
+  }
+  else if (!line.compare(0, 2, "fe"))
+    fail(line.c_str());
+  else if (state == SWITCH && line.find("Switching to Binary Protocol") != std::string::npos) {
+    // SYNC has no sync of its own and isn't acked
+    const uint8_t header[6] = { 0xAD, 0xB5, 0, CONTROL_SYNC, 0, 0 };
+    const uint16_t cs = fletcher16(0, &header[2], 4);
+    const uint8_t frame[8] = { header[0], header[1], header[2], header[3], header[4], header[5], uint8_t(cs), uint8_t(cs >> 8) };
+    send(frame, sizeof(frame), now);
+    state = SYNC;
+  }
+  else if (state == SYNC && sscanf(line.c_str(), "ss%u,%u,%u.%u.%u,%u", &n, &size, &major, &minor, &patch, &window) >= 5) {
+    if (sscanf(line.c_str(), "ss%*u,%*u,%*u.%*u.%*u,%u", &window) != 1) window = 1; // Stop-and-wait before 0.2
+    next_sync = n;
+    st.packet_size = opt.packet_size ? std::min<unsigned>(opt.packet_size, size) : size;
+    st.window = opt.window ? std::min<unsigned>(opt.window, window) : window;
+    queuePacket(FILE_QUERY, nullptr, 0);
+    state = QUERY;
+  }
+  else if (state == QUERY && !line.compare(0, 12, "PFT:version:")) {
+    const size_t hs = line.find(":compresion:heatshrink,");
+    if (opt.compress && hs != std::string::npos && sscanf(&line[hs], ":compresion:heatshrink,%u,%u", &bits, &lookahead) == 2) {
+      st.window_bits = bits;
+      st.lookahead_bits = lookahead;
+      payload = compress(*file, bits, lookahead);
+    }
+    else
+      payload = *file;
+    st.payload_bytes = payload.size();
+
+    std::vector<uint8_t> open = { 0, uint8_t(st.window_bits ? 1 : 0) }; // Not a dummy transfer, compression
+    open.insert(open.end(), filename.begin(), filename.end());
+    open.push_back('\0');
+    queuePacket(FILE_OPEN, open.data(), open.size());
+    state = OPEN;
+  }
+  else if (state == OPEN && line == "PFT:success") {
+    for (size_t pos = 0; pos < payload.size(); pos += st.packet_size)
+      queuePacket(FILE_WRITE, &payload[pos], std::min<size_t>(st.packet_size, payload.size() - pos));
+    state = WRITE;
+  }
+  else if (state == CLOSE && line == "PFT:success") {
+    st.end_ns = now;
+    queuePacket(CONTROL_CLOSE, nullptr, 0);
+    state = END;
+  }
+  else if (!line.compare(0, 4, "PFT:") && state >= OPEN && state <= CLOSE)
+    fail(line.c_str());
+}
+
+void UploadHost::service(const uint64_t now) {
+  while (!lines.empty() && lines.front().first <= now) {
+    const std::string line = lines.front().second;
+    lines.pop_front();
+    if (state != IDLE && !finished()) onLine(line, now);
+  }
+  if (state == IDLE || finished()) return;
+
+  // The window starts at the oldest packet not yet acked. Send what fits
+  // and resend packets whose ack never came.
+  while (!packets.empty() && packets.front().acked) packets.pop_front();
+  const size_t window = std::min<size_t>(std::max<size_t>(st.window, 1), packets.size());
+  for (size_t i = 0; i < window; i++) {
+    Packet &p = packets[i];
+    if (!p.sent)
+      sendPacket(p, now);
+    else if (!p.acked && now >= p.due_ns) {
+      st.timeouts++;
+      sendPacket(p, now);
+    }
+  }
+
+  if (packets.empty()) {
+    if (state == WRITE) {
+      queuePacket(FILE_CLOSE, nullptr, 0);
+      state = CLOSE;
+    }
+    else if (state == END)
+      state = DONE;
+  }
+}
+
+size_t UploadHost::receive(uint8_t *buffer, const size_t room) {
+  const uint64_t now = Clock::peek();
+  service(now);
+  size_t count = 0;
+  while (count < room && !inbound.empty() && inbound.front().first <= now) {
+    buffer[count++] = inbound.front().second;
+    inbound.pop_front();
+  }
+  return count;
+}
+
+// Replies cross the line at the same baud rate and reach the host a latency later
+void UploadHost::transmit(const uint8_t *buffer, const size_t count) {
+  const uint64_t now = Clock::peek();
+  for (size_t i = 0; i < count; i++) {
+    reply_free_ns = std::max(now, reply_free_ns) + byte_ns;
+    const char c = buffer[i];
+    if (c == '\n') {
+      lines.emplace_back(reply_free_ns + latency_ns, reply);
+      reply.clear();
+    }
+    else if (c != '\r')
+      reply += c;
+  }
+}
+
+std::vector<uint8_t> UploadHost::compress(const std::vector<uint8_t> &data, const uint8_t window_bits, const uint8_t lookahead_bits) {
+  std::vector<uint8_t> out;
+  uint8_t bits = 0, acc = 0;
+  auto put = [&](const uint32_t value, const uint8_t count) {
+    for (int8_t b = count - 1; b >= 0; b--) {
+      acc = (acc << 1) | ((value >> b) & 1);
+      if (++bits == 8) { out.push_back(acc); acc = bits = 0; }
+    }
+  };
+
+  // Chains of earlier positions with the same two bytes
+  const size_t size = data.size(), window = size_t(1) << window_bits, max_len = size_t(1) << lookahead_bits;
+  std::vector<int32_t> head(0x10000, -1), prev(size, -1);
+  auto insert = [&](const size_t i) {
+    if (i + 1 >= size) return;
+    const uint16_t h = data[i] | (data[i + 1] << 8);
+    prev[i] = head[h];
+    head[h] = i;
+  };
+
+  for (size_t i = 0; i < size;) {
+    size_t best_len = 0, best_off = 0;
+    if (i + 1 < size) {
+      const size_t limit = std::min(max_len, size - i);
+      int tries = 256;
+      for (int32_t j = head[data[i] | (data[i + 1] << 8)]; j >= 0 && i - j <= window && tries--; j = prev[j]) {
+        size_t len = 0;
+        while (len < limit && data[j + len] == data[i + len]) len++;
+        if (len > best_len) { best_len = len; best_off = i - j; }
+        if (len == limit) break;
+      }
+    }
+    // A back-reference costs a tag bit, the offset and the count; a literal costs 9 bits
+    if (best_len * 9 > 1u + window_bits + lookahead_bits) {
+      put(0, 1);
+      put(best_off - 1, window_bits);
+      put(best_len - 1, lookahead_bits);
+      for (size_t k = 0; k < best_len; k++) insert(i + k);
+      i += best_len;
+    }
+    else {
+      put(1, 1);
+      put(data[i], 8);
+      insert(i++);
+    }
+  }
+  if (bits) out.push_back(acc << (8 - bits));
+  return out;
+}
+
+#endif // __PLAT_LINUX__
@@ -0,0 +1,107 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+#include "SerialLink.h"
+
+#include <deque>
+#include <string>
+#include <vector>
+
+/**
+ * A host uploading a file with the binary file transfer protocol (M28 B1)
+ *
+ * The host talks through a serial line of a given baud rate, where every
+ * byte takes 10 bit times, and sees replies a fixed USB latency after the
+ * firmware sends them. As with a USB CDC port, nothing is lost when the
+ * firmware is slow to read: the bytes wait at the host end.
+ *
+ * It sends as many packets ahead of the acks as the firmware offers at SYNC
+ * (or fewer, down to stop-and-wait), resends a packet when asked or when its
+ * ack is overdue, and compresses with the heatshrink window the firmware
+ * reports at QUERY. Packets can be corrupted on purpose to exercise resends.
+ */
+class UploadHost : public SerialLink {
+public:
+  struct Options {
+    uint32_t baud = 115200;
+    uint32_t latency_us = 2000;
+    uint8_t window = 0;         // Most packets in flight. 0 for as many as the firmware takes.
+    bool compress = true;       // Use heatshrink if the firmware has it
+    uint16_t corrupt_every = 0; // Flip a bit in every Nth packet sent
+    uint16_t packet_size = 0;   // Largest payload. 0 for as large as the firmware takes.
+  };
+
+  struct Stats {
+    uint64_t start_ns, end_ns;  // From M28 to the reply to CLOSE
+    uint32_t file_bytes, payload_bytes, wire_bytes;
+    uint32_t packets, resends, timeouts, corrupted;
+    uint16_t packet_size;
+    uint8_t window, window_bits, lookahead_bits;
+  };
+
+  // Upload data as a file with the given name, starting now
+  void start(const std::vector<uint8_t> &data, const char *filename, const Options &opts);
+  bool finished() const { return state == DONE || state == FAILED; }
+  bool failed() const { return state == FAILED; }
+  const char* error() const { return error_text.c_str(); }
+  const Stats& stats() const { return st; }
+
+  size_t receive(uint8_t *buffer, const size_t room) override;
+  void transmit(const uint8_t *buffer, const size_t count) override;
+
+  // Heatshrink stream for the decoder in libs/heatshrink, with a greedy match search
+  static std::vector<uint8_t> compress(const std::vector<uint8_t> &data, const uint8_t window_bits, const uint8_t lookahead_bits);
+
+private:
+  enum State : uint8_t { IDLE, SWITCH, SYNC, QUERY, OPEN, WRITE, CLOSE, END, DONE, FAILED };
+
+  struct Packet {
+    uint8_t sync;
+    std::vector<uint8_t> frame;
+    uint64_t due_ns;            // When the ack is overdue
+    bool write, sent, acked;
+  };
+
+  void service(const uint64_t now);
+  void onLine(const std::string &line, const uint64_t now);
+  void queuePacket(const uint8_t meta, const uint8_t *payload, const uint16_t size);
+  void sendPacket(Packet &p, const uint64_t now);
+  void send(const uint8_t *data, const size_t count, const uint64_t now);
+  void fail(const char *why) { error_text = why; state = FAILED; }
+
+  Options opt;
+  Stats st;
+  State state = IDLE;
+  std::string error_text, filename, reply;
+  const std::vector<uint8_t> *file = nullptr;
+  std::vector<uint8_t> payload;                       // The file as sent, maybe compressed
+
+  uint64_t byte_ns = 0, latency_ns = 0;
+  uint64_t wire_free_ns = 0, reply_free_ns = 0;       // When each direction of the line is next idle
+  std::deque<std::pair<uint64_t, uint8_t>> inbound;   // Bytes on their way to the firmware
+  std::deque<std::pair<uint64_t, std::string>> lines; // Replies on their way to the host
+
+  uint8_t next_sync = 0;
+  uint32_t sends = 0;                                 // Write packets sent, for corrupting every Nth
+  std::deque<Packet> packets;                         // Queued or waiting for an ack, oldest first
+};
@@ -0,0 +1,42 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+// Settings are journaled to simulated flash, kept in a file on the host,
+// the same way as the flash-emulated EEPROM on the ZONESTAR boards
+#if USE_FALLBACK_EEPROM
+  #define FLASH_EEPROM_EMULATION
+#elif EITHER(I2C_EEPROM, SPI_EEPROM)
+  #define USE_SHARED_EEPROM 1
+#endif
+
+// Flash EEPROM is kept as a journal (see shared/eeprom_journal.h)
+#if ENABLED(FLASH_EEPROM_EMULATION)
+  #define FLASH_EEPROM_JOURNAL 1
+#endif
+
+// The SD card is a block image on the host, read through the SDIO interface
+#if ENABLED(SDSUPPORT)
+  #define SDIO_SUPPORT
+#else
+  #undef SDIO_SUPPORT
+#endif
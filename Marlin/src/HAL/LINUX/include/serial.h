@@ -0,0 +1,222 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+#include "../../../inc/MarlinConfigPre.h"
+#if ENABLED(EMERGENCY_PARSER)
+  #include "../../../feature/e_parser.h"
+#endif
+
+#include "../hardware/SerialLink.h"
+#include "../../shared/serial_line_ring.h"
+
+#include <stdarg.h>
+#include <stdio.h>
+
+/**
+ * Generic RingBuffer
+ * T type of the buffer array
+ * S size of the buffer (must be power of 2)
+ */
+template <typename T, std::size_t S> class RingBuffer {
+public:
+  RingBuffer() { index_read = index_write = 0; }
+  std::size_t available() { return mask(index_write - index_read); }
+  std::size_t free() { return size() - available(); }
+  bool empty() { return index_read == index_write; }
+  bool full() { return next(index_write) == index_read; }
+  void clear() { index_read = index_write = 0; }
+  bool peek(T *const value) {
+    if (value == nullptr || empty()) return false;
+    *value = buffer[index_read];
+    return true;
+  }
+  uint32_t read(T *const value) {
+    if (value == nullptr || empty()) return 0;
+    *value = buffer[index_read];
+    index_read = next(index_read);
+    return 1;
+  }
+  uint32_t write(T value) {
+    std::size_t next_head = next(index_write);
+    if (next_head == index_read) return 0;     // buffer full
+    buffer[index_write] = value;
+    index_write = next_head;
+    return 1;
+  }
+  static constexpr std::size_t size() { return buffer_size - 1; }
+
+private:
+  inline std::size_t mask(std::size_t val) { return val & buffer_mask; }
+  inline std::size_t next(std::size_t val) { return mask(val + 1); }
+
+  static const std::size_t buffer_size = S;
+  static const std::size_t buffer_mask = buffer_size - 1;
+  T buffer[buffer_size];
+  volatile std::size_t index_write;
+  volatile std::size_t index_read;
+};
+
+/**
+ * Serial Interface Class
+ *
+ * Bytes move between the ring buffers and a host file descriptor, which is
+ * either a pseudo-terminal (the default, so a host like OctoPrint or Pronterface
+ * can connect to it), stdin/stdout, or a G-code file being replayed. The descriptor is polled without blocking
+ * whenever the firmware checks for input, and output is pushed out on every
+ * newline or when the transmit buffer fills. A SerialLink can stand in for
+ * the descriptor.
+ */
+
+#define DEC 10
+#define HEX 16
+#define OCT 8
+#define BIN 2
+
+class HalSerial {
+public:
+
+  #if ENABLED(EMERGENCY_PARSER)
+    EmergencyParser::State emergency_state;
+    inline bool emergency_parser_enabled() { return ep_enabled; }
+  #endif
+
+  HalSerial(const char *port_name, const bool e=false);
+
+  bool openPty(const char *link=nullptr);   // Create a pty and optionally symlink it
+  bool openStdio();                         // Talk through stdin/stdout
+  bool openFile(const char *filename);      // Read a G-code file, reply on stdout
+  bool openLink(SerialLink *l);             // Talk to a simulated host
+  bool atEOF() { return input_done && !rx_ring.available(); } // All input has been read
+  const char* name() const { return label; }
+  const char* device() const { return device_name; }
+
+  void begin(const long) {}
+  void end() {}
+
+  int peek() {
+    poll();
+    return rx_ring.peek();
+  }
+
+  int read() {
+    poll();
+    return rx_ring.read();
+  }
+
+  uint16_t available() {
+    poll();
+    return rx_ring.available();
+  }
+
+  // Lines are framed as bytes arrive, like the STM32F1 UARTs. A line too long
+  // for the ring is let in to be dropped, as it would be by a UART.
+  SerialLineRing* line_ring() {
+    poll(!rx_ring.lines());
+    return &rx_ring;
+  }
+
+  size_t write(const uint8_t c) {
+    if (transmit_buffer.full()) flushTX();
+    transmit_buffer.write(c);
+    if (c == '\n') flushTX();
+    return 1;
+  }
+  size_t write(const char *str) { size_t n = 0; while (*str) n += write(uint8_t(*str++)); return n; }
+  size_t write(const uint8_t *buffer, size_t size) { for (size_t i = 0; i < size; i++) write(buffer[i]); return size; }
+
+  operator bool() { return true; }
+
+  void flush() { rx_ring.clear(); }
+
+  uint8_t availableForWrite() {
+    return transmit_buffer.free() > 255 ? 255 : (uint8_t)transmit_buffer.free();
+  }
+
+  void flushTX();
+
+  void printf(const char *format, ...) {
+    char buffer[256];
+    va_list vArgs;
+    va_start(vArgs, format);
+    const int length = vsnprintf(buffer, sizeof(buffer), format, vArgs);
+    va_end(vArgs);
+    for (int i = 0; i < length && i < int(sizeof(buffer)) - 1; i++) write(uint8_t(buffer[i]));
+  }
+
+  void print_bin(uint32_t value, uint8_t num_digits) {
+    uint32_t mask = 1 << (num_digits -1);
+    for (uint8_t i = 0; i < num_digits; i++) {
+      if (!(i % 4) && i) write(' ');
+      if (!(i % 16) && i) write(' ');
+      write((value & mask) ? '1' : '0');
+      value <<= 1;
+    }
+  }
+
+  void print_base(const unsigned long value, const int nbase) {
+    if (nbase == BIN) print_bin(value, value > 0xFFFF ? 32 : value > 0xFF ? 16 : 8);
+    else if (nbase == OCT) printf("%lo", value);
+    else if (nbase == HEX) printf("%lX", value);
+    else printf("%lu", value);
+  }
+
+  // Arduino Print semantics: 'char' is a character, other integers are numbers
+  void print(const char value[]) { write(value); }
+  void print(char value, int nbase = 0) { if (nbase) print_base(uint8_t(value), nbase); else write(uint8_t(value)); }
+  void print(unsigned char value, int nbase = DEC) { print_base(value, nbase); }
+  void print(int value, int nbase = DEC) { print(long(value), nbase); }
+  void print(unsigned int value, int nbase = DEC) { print_base(value, nbase); }
+  void print(long value, int nbase = DEC) { if (nbase == DEC) printf("%ld", value); else print_base((unsigned long)value, nbase); }
+  void print(unsigned long value, int nbase = DEC) { print_base(value, nbase); }
+  void print(float value, int digits = 2) { printf("%.*f", digits, double(value)); }
+  void print(double value, int digits = 2) { printf("%.*f", digits, value); }
+
+  void println(const char value[]) { print(value); println(); }
+  void println(char value, int nbase = 0) { print(value, nbase); println(); }
+  void println(unsigned char value, int nbase = DEC) { print(value, nbase); println(); }
+  void println(int value, int nbase = DEC) { print(value, nbase); println(); }
+  void println(unsigned int value, int nbase = DEC) { print(value, nbase); println(); }
+  void println(long value, int nbase = DEC) { print(value, nbase); println(); }
+  void println(unsigned long value, int nbase = DEC) { print(value, nbase); println(); }
+  void println(float value, int digits = 2) { print(value, digits); println(); }
+  void println(double value, int digits = 2) { print(value, digits); println(); }
+  void println() { write('\n'); }
+
+  // Traffic counters, for throughput measurements
+  uint32_t bytes_received = 0, bytes_sent = 0;
+
+private:
+  void poll(const bool overrun=false);
+
+  const char *label;
+  char device_name[64];
+  int fd_in = -1, fd_out = -1;
+  SerialLink *link = nullptr;
+  bool input_done = false;
+  #if ENABLED(EMERGENCY_PARSER)
+    bool ep_enabled;
+  #endif
+
+  SerialLineRingBuffer<RX_BUFFER_SIZE> rx_ring;
+  RingBuffer<uint8_t, 256> transmit_buffer;
+};
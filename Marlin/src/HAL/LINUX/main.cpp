@@ -0,0 +1,1348 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifdef __PLAT_LINUX__
+
+/**
+ * Linux native simulator entry point
+ *
+ * Wires the emulated hardware (clock, timers, GPIO, heaters, axes, serial
+ * ports, EEPROM and SD image) to the firmware, then runs setup() and loop()
+ * exactly as the bootloader would on a board.
+ */
+
+#include "../../inc/MarlinConfig.h"
+#include "../../module/planner.h"
+#include "../../gcode/queue.h"
+#include "../../gcode/parser.h"
+#include "../../module/temperature.h"
+#include "../../libs/crc16.h"
+#if ENABLED(INPUT_SHAPING)
+  #include "../../feature/input_shaping.h"
+#endif
+#if ENABLED(SDSUPPORT)
+  #include "../../sd/cardreader.h"
+#endif
+#if HAS_DWIN_LCD
+  #include "../../lcd/dwin/DWIN_LCD.h"
+#endif
+#if ENABLED(FLASH_EEPROM_JOURNAL)
+  #include "../../module/settings.h"
+  #include "../shared/eeprom_journal.h"
+  #include "hardware/Flash.h"
+  extern Flash eeprom_flash;
+#endif
+#include "hardware/Heater.h"
+#include "hardware/StepperDriver.h"
+#include "hardware/StepTrace.h"
+#include "hardware/UploadHost.h"
+
+#include <algorithm>
+#include <getopt.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+extern void setup();
+extern void loop();
+
+// Host files backing the EEPROM and SD card
+const char *eeprom_filename = "eeprom.dat",
+           *sdcard_filename = "sdcard.img";
+
+HalSerial usb_serial("usb");
+#ifdef SERIAL_PORT_2
+  HalSerial aux_serial("aux");
+#endif
+#ifdef LCD_SERIAL_PORT
+  HalSerial lcd_serial("lcd");
+#endif
+#ifdef WIFI_SERIAL_PORT
+  HalSerial wifi_serial("wifi");
+#endif
+
+#if HAS_HOTEND
+  static Heater hotend(HEATER_0_PIN, analogInputToDigitalPin(TEMP_0_PIN), 40, 12.0, 0.12);
+#endif
+#if HAS_HEATED_BED
+  static Heater bed(HEATER_BED_PIN, analogInputToDigitalPin(TEMP_BED_PIN), 220, 300.0, 1.1);
+#endif
+
+//
+// Replay benchmark: run a G-code file through the firmware, then report
+// how the planner and stepper ISR coped with it
+//
+static StepTrace step_trace(STEPPER_TIMER_RATE);
+
+static struct {
+  const char *gcode_file = nullptr;
+  uint64_t host_start_ns;
+  uint32_t moving_ms, slowdown_ms, starved_ms, underruns, blocks;
+  uint8_t last_tail;
+  bool moved, was_moving;
+  double heater_joules, peak_heater_watts; // Heater energy this second, and the most drawn in any second
+} replay;
+
+// Each rise of a heater's target, followed at the sensor until the target changes again
+struct HeatUp {
+  const char *heater;
+  int16_t target;
+  double from, over, under;             // Start temperature, then the most above and below target once reached
+  uint32_t start_ms, reached_ms, end_ms;
+};
+static std::vector<HeatUp> heat_ups;
+
+static void setup_trace() {
+  step_trace.addAxis("X", X_STEP_PIN, X_DIR_PIN);
+  step_trace.addAxis("Y", Y_STEP_PIN, Y_DIR_PIN);
+  step_trace.addAxis("Z", Z_STEP_PIN, Z_DIR_PIN);
+  #if PIN_EXISTS(Z2_STEP)
+    step_trace.addAxis("Z2", Z2_STEP_PIN, Z2_DIR_PIN);
+  #endif
+  #if PIN_EXISTS(E0_STEP)
+    step_trace.addAxis("E0", E0_STEP_PIN, E0_DIR_PIN);
+  #endif
+  #if PIN_EXISTS(E1_STEP)
+    step_trace.addAxis("E1", E1_STEP_PIN, E1_DIR_PIN);
+  #endif
+  #if PIN_EXISTS(E2_STEP)
+    step_trace.addAxis("E2", E2_STEP_PIN, E2_DIR_PIN);
+  #endif
+  #if PIN_EXISTS(E3_STEP)
+    step_trace.addAxis("E3", E3_STEP_PIN, E3_DIR_PIN);
+  #endif
+  Gpio::attachLogger(&step_trace);
+}
+
+static void replay_report() {
+  const double virtual_s = Clock::peek() / double(Clock::ONE_BILLION),
+               host_s = (Clock::host_nanos() - replay.host_start_ns) / double(Clock::ONE_BILLION);
+  const Timer &isr = timers[STEP_TIMER_NUM];
+  const uint64_t steps = step_trace.totalSteps(), calls = isr.getFired();
+
+  fprintf(stderr, "\nReplay of %s\n", replay.gcode_file);
+  fprintf(stderr, "  Print time    : %.3f s virtual, %.3f s host (%.1fx)\n", virtual_s, host_s, host_s > 0 ? virtual_s / host_s : 0.0);
+  fprintf(stderr, "  Steps         : %llu, %llu edges\n", (unsigned long long)steps, (unsigned long long)step_trace.edges());
+  fprintf(stderr, "  Stepper ISR   : %llu calls, %.2f steps/call, %.0f host ns/call, %.0f host ns/step\n",
+    (unsigned long long)calls, calls ? double(steps) / calls : 0.0,
+    calls ? double(isr.getBusyNanos()) / calls : 0.0, steps ? double(isr.getBusyNanos()) / steps : 0.0
+  );
+  fprintf(stderr, "  Blocks        : %u, %.0f per second of motion, buffer of %d x %u bytes\n",
+    replay.blocks, replay.moving_ms ? replay.blocks * 1000.0 / replay.moving_ms : 0.0, BLOCK_BUFFER_SIZE, unsigned(sizeof(block_t))
+  );
+  fprintf(stderr, "  Planner       : moving %u ms, below SLOWDOWN threshold %u ms, ran dry %u times (%u ms) with commands pending\n",
+    replay.moving_ms, replay.slowdown_ms, replay.underruns, replay.starved_ms
+  );
+  for (const HeatUp &h : heat_ups) {
+    fprintf(stderr, "  %-14s: %.0f to %d °C, ", h.heater, h.from, h.target);
+    if (h.reached_ms)
+      fprintf(stderr, "within 1 °C after %.1f s, then +%.1f/-%.1f °C over %.1f s\n",
+        (h.reached_ms - h.start_ms) / 1000.0, h.over, h.under, (h.end_ms - h.reached_ms) / 1000.0
+      );
+    else
+      fprintf(stderr, "not reached in %.1f s\n", (h.end_ms - h.start_ms) / 1000.0);
+  }
+  if (replay.peak_heater_watts)
+    fprintf(stderr, "  Heater power  : %.0f W at most over any second\n", replay.peak_heater_watts);
+  #if HAS_DWIN_LCD
+    fprintf(stderr, "  LCD serial    : %lu bytes, %.0f per second\n", (unsigned long)dwinLCD.bytes_sent, virtual_s > 0 ? dwinLCD.bytes_sent / virtual_s : 0.0);
+  #endif
+  #if ENABLED(SDIO_SUPPORT)
+    extern uint32_t sdio_blocks_read, sdio_blocks_written;
+    fprintf(stderr, "  SD card       : %u blocks read, %u written\n", sdio_blocks_read, sdio_blocks_written);
+  #endif
+
+  // Timer ticks to nanoseconds, for the pulse timing columns
+  const double tick_ns = double(Clock::ONE_BILLION) / step_trace.tickRate();
+  fprintf(stderr, "  Axis     Steps  Dir changes  Peak rate  Min pulse  Min dir setup\n");
+  for (uint8_t i = 0; i < step_trace.axisCount(); i++) {
+    const StepTrace::Axis &a = step_trace.axis(i);
+    if (!a.steps) continue;
+    fprintf(stderr, "  %-4s %9llu %12llu", a.name, (unsigned long long)a.steps, (unsigned long long)a.dir_changes);
+    if (a.min_interval != UINT64_MAX) fprintf(stderr, " %6.1f kHz", step_trace.tickRate() / 1000.0 / a.min_interval); else fprintf(stderr, "%11s", "-");
+    if (a.min_pulse != UINT64_MAX) fprintf(stderr, " %7.0f ns", a.min_pulse * tick_ns); else fprintf(stderr, "%11s", "-");
+    if (a.min_setup != UINT64_MAX) fprintf(stderr, " %11.0f ns", a.min_setup * tick_ns); else fprintf(stderr, "%15s", "-");
+    fputc('\n', stderr);
+  }
+}
+
+// Follow a heater's sensor through each heat-up
+struct HeatFollower {
+  const char *heater;
+  int16_t last_target;
+  int current;                          // Index of its heat-up in heat_ups, or -1
+
+  void tick(const int16_t target, const double t, const uint32_t ms) {
+    if (target != last_target) {
+      if (current >= 0 && !heat_ups[current].end_ms) heat_ups[current].end_ms = ms;
+      current = -1;
+      if (target > last_target) {
+        current = heat_ups.size();
+        heat_ups.push_back({ heater, target, t, 0, 0, ms, 0, 0 });
+      }
+      last_target = target;
+    }
+    if (current < 0) return;
+    HeatUp &h = heat_ups[current];
+    if (!h.reached_ms) {
+      if (t >= target - 1) h.reached_ms = ms;
+    }
+    else {
+      h.over = std::max(h.over, t - target);
+      h.under = std::max(h.under, target - t);
+    }
+  }
+};
+
+static void heat_tick(const uint32_t ms) {
+  double watts = 0;
+  #if HAS_HOTEND
+    static HeatFollower hotend_follower = { "Hotend", 0, -1 };
+    hotend_follower.tick(thermalManager.degTargetHotend(0), hotend.sensorTemperature(), ms);
+    watts += hotend.power();
+  #endif
+  #if HAS_HEATED_BED
+    static HeatFollower bed_follower = { "Bed", 0, -1 };
+    bed_follower.tick(thermalManager.degTargetBed(), bed.sensorTemperature(), ms);
+    watts += bed.power();
+  #endif
+  replay.heater_joules += watts * 0.001;
+  if (ms % 1000 == 999) {
+    replay.peak_heater_watts = std::max(replay.peak_heater_watts, replay.heater_joules);
+    replay.heater_joules = 0;
+  }
+}
+
+// Called every millisecond while a G-code file is replayed
+static void replay_tick() {
+  const uint32_t ms = Clock::peek() / (Clock::ONE_BILLION / 1000);
+  heat_tick(ms);
+  const bool moving = planner.has_blocks_queued(),
+             pending = queue.length || !usb_serial.atEOF() || TERN0(SDSUPPORT, IS_SD_FILE_OPEN());
+  // Far fewer than BLOCK_BUFFER_SIZE blocks finish in a millisecond
+  replay.blocks += BLOCK_MOD(planner.block_buffer_tail - replay.last_tail);
+  replay.last_tail = planner.block_buffer_tail;
+  if (moving) {
+    replay.moving_ms++;
+    if (WITHIN(planner.movesplanned(), 2, (BLOCK_BUFFER_SIZE) / 2 - 1)) replay.slowdown_ms++;
+  }
+  else if (replay.moved && pending) {
+    if (replay.was_moving) replay.underruns++;
+    replay.starved_ms++;
+  }
+  replay.was_moving = moving;
+  replay.moved |= moving;
+
+  // Every command has run and the last move has been stepped out
+  if (!moving && !pending) {
+    for (HeatUp &h : heat_ups) if (!h.end_ms) h.end_ms = ms;
+    replay_report();
+    step_trace.close();
+    exit(0);
+  }
+}
+
+//
+// Parser benchmark: parse every command in a G-code file and fetch all of
+// its values, as the command handlers would, for at least a second
+//
+static int parse_benchmark(const char *path) {
+  FILE *f = fopen(path, "r");
+  if (!f) {
+    fprintf(stderr, "Unable to open %s\n", path);
+    return 1;
+  }
+
+  // Commands as the queue would hold them, without comments or line ends
+  std::vector<std::string> lines;
+  size_t bytes = 0;
+  for (char line[256]; fgets(line, sizeof(line), f);) {
+    char *end = strchr(line, ';');
+    if (!end) end = line + strlen(line);
+    while (end > line && strchr(" \t\r\n", end[-1])) --end;
+    if (end == line || end - line >= MAX_CMD_SIZE) continue;
+    lines.emplace_back(line, end - line);
+    bytes += end - line;
+  }
+  fclose(f);
+  if (lines.empty()) {
+    fprintf(stderr, "No commands in %s\n", path);
+    return 1;
+  }
+
+  volatile float sink = 0;
+  uint64_t passes = 0, values = 0;
+  const uint64_t start_ns = Clock::host_nanos();
+  uint64_t elapsed_ns;
+  do {
+    for (const std::string &line : lines) {
+      char cmd[MAX_CMD_SIZE];
+      strcpy(cmd, line.c_str());
+      parser.parse(cmd);
+      for (char c = 'A'; c <= 'Z'; c++)
+        if (parser.seenval(c)) { sink = sink + parser.value_float(); values++; }
+    }
+    passes++;
+    elapsed_ns = Clock::host_nanos() - start_ns;
+  } while (elapsed_ns < Clock::ONE_BILLION);
+
+  const double count = double(lines.size()) * passes;
+  fprintf(stderr, "Parse of %s\n", path);
+  fprintf(stderr, "  Commands      : %zu (%zu bytes), %llu passes\n", lines.size(), bytes, (unsigned long long)passes);
+  fprintf(stderr, "  Parser        : %.0f lines/s, %.0f host ns/line, %.1f values/line\n",
+    count * Clock::ONE_BILLION / elapsed_ns, elapsed_ns / count, values / count
+  );
+  return 0;
+}
+
+//
+// Thermistor benchmark: convert every raw reading the ADC can produce, for
+// at least a second, with the hotend and bed conversions
+//
+static int thermistor_benchmark() {
+  #if HAS_HOTEND || HAS_HEATED_BED
+    volatile float sink = 0;
+    float sum = 0;
+    uint64_t passes = 0, conversions = 0;
+    const uint64_t start_ns = Clock::host_nanos();
+    uint64_t elapsed_ns;
+    do {
+      sum = 0;
+      for (uint32_t raw = 0; raw <= MAX_RAW_THERMISTOR_VALUE; raw++) {
+        #if HAS_HOTEND
+          sum += thermalManager.analog_to_celsius_hotend(raw, 0);
+          conversions++;
+        #endif
+        #if HAS_HEATED_BED
+          sum += thermalManager.analog_to_celsius_bed(raw);
+          conversions++;
+        #endif
+      }
+      sink = sink + sum;
+      passes++;
+      elapsed_ns = Clock::host_nanos() - start_ns;
+    } while (elapsed_ns < Clock::ONE_BILLION);
+
+    fprintf(stderr, "Thermistor conversion of raw 0-%lu\n", (unsigned long)MAX_RAW_THERMISTOR_VALUE);
+    fprintf(stderr, "  Conversions   : %.0f/s, %.1f host ns each, %llu passes\n",
+      double(conversions) * Clock::ONE_BILLION / elapsed_ns, double(elapsed_ns) / conversions, (unsigned long long)passes
+    );
+    fprintf(stderr, "  Mean          : %.3f °C\n", sum * passes / conversions);
+    return 0;
+  #else
+    fprintf(stderr, "No thermistors to convert\n");
+    return 1;
+  #endif
+}
+
+//
+// Checksum benchmark: check crc16() and fletcher16() against the bit-by-bit
+// and byte-by-byte definitions, then time them against those definitions
+//
+static uint16_t crc16_reference(uint16_t crc, const uint8_t *data, size_t cnt) {
+  while (cnt--) {
+    crc ^= uint16_t(*data++) << 8;
+    for (uint8_t i = 0; i < 8; i++) crc = (crc & 0x8000) ? uint16_t(crc << 1) ^ 0x1021 : uint16_t(crc << 1);
+  }
+  return crc;
+}
+
+static uint16_t fletcher16_reference(uint16_t cs, const uint8_t *data, size_t cnt) {
+  while (cnt--) {
+    const uint16_t sum1 = ((cs & 0xFF) + *data++) % 255;
+    cs = ((((cs >> 8) + sum1) % 255) << 8) | sum1;
+  }
+  return cs;
+}
+
+template<typename F>
+static double checksum_rate(F fn, const uint8_t *data, const size_t size) {
+  volatile uint16_t sink = 0;
+  uint64_t bytes = 0;
+  const uint64_t start_ns = Clock::host_nanos();
+  uint64_t elapsed_ns;
+  do {
+    sink = sink + fn(data, size);
+    bytes += size;
+    elapsed_ns = Clock::host_nanos() - start_ns;
+  } while (elapsed_ns < Clock::ONE_BILLION / 2);
+  return double(bytes) * Clock::ONE_BILLION / elapsed_ns / 1e6;
+}
+
+static int checksum_benchmark() {
+  int failed = 0;
+  const auto expect = [&](const char *what, const uint16_t got, const uint16_t want) {
+    if (got != want) { fprintf(stderr, "  %s: 0x%04X, expected 0x%04X\n", what, got, want); failed++; }
+  };
+
+  // Published check values
+  uint16_t crc = 0;
+  crc16(&crc, "123456789", 9);
+  expect("CRC-16/XMODEM(\"123456789\")", crc, 0x31C3);
+  crc = 0xFFFF;
+  crc16(&crc, "123456789", 9);
+  expect("CRC-16/CCITT-FALSE(\"123456789\")", crc, 0x29B1);
+  expect("Fletcher-16(\"abcde\")", fletcher16(0, "abcde", 5), 0xC8F0);
+  expect("Fletcher-16(\"abcdef\")", fletcher16(0, "abcdef", 6), 0x2057);
+  expect("Fletcher-16(\"abcdefgh\")", fletcher16(0, "abcdefgh", 8), 0x0627);
+
+  // Random data at every alignment, run over two calls, and past the
+  // point where the Fletcher sums are reduced
+  static uint8_t data[16384];
+  srand(1);
+  for (uint8_t &b : data) b = rand();
+  for (int i = 0; i < 2000; i++) {
+    const size_t off = rand() % 64, len = rand() % 600, split = len ? rand() % len : 0;
+    const uint16_t init = rand();
+    uint16_t c = init;
+    crc16(&c, data + off, split);
+    crc16(&c, data + off + split, len - split);
+    expect("crc16", c, crc16_reference(init, data + off, len));
+    const uint16_t f = fletcher16_reference(0, data, 1 + rand() % 8);
+    expect("fletcher16", fletcher16(f, data + off, len), fletcher16_reference(f, data + off, len));
+  }
+  memset(data, 0xFF, sizeof(data));
+  expect("fletcher16 of 0xFF", fletcher16(0xFEFE, data, sizeof(data)), fletcher16_reference(0xFEFE, data, sizeof(data)));
+  for (uint8_t &b : data) b = rand();
+
+  // Settings-sized, field by field as PersistentStore sees them, and packet-sized
+  const size_t settings_size = 768, packet_size = 512;
+  const double crc_fields = checksum_rate([](const uint8_t *d, const size_t n) {
+    uint16_t c = 0;
+    for (size_t i = 0; i < n; i += 4) crc16(&c, d + i, 4);
+    return c;
+  }, data, settings_size);
+  const double crc_block = checksum_rate([](const uint8_t *d, const size_t n) { uint16_t c = 0; crc16(&c, d, n); return c; }, data, settings_size),
+               crc_ref = checksum_rate([](const uint8_t *d, const size_t n) { return crc16_reference(0, d, n); }, data, settings_size),
+               fl_block = checksum_rate([](const uint8_t *d, const size_t n) { return fletcher16(0, d, n); }, data, packet_size),
+               fl_ref = checksum_rate([](const uint8_t *d, const size_t n) { return fletcher16_reference(0, d, n); }, data, packet_size);
+
+  fprintf(stderr, "Checksums, %s\n", failed ? "FAILED" : "all check values and cross-checks match");
+  fprintf(stderr, "  crc16         : %.1f MB/s (%.1f MB/s in 4-byte fields), bit by bit %.1f MB/s, %.1fx\n", crc_block, crc_fields, crc_ref, crc_block / crc_ref);
+  fprintf(stderr, "  fletcher16    : %.1f MB/s, byte by byte %.1f MB/s, %.1fx\n", fl_block, fl_ref, fl_block / fl_ref);
+  return failed ? 1 : 0;
+}
+
+//
+// Trapezoids: run random chains of blocks, each exit rate being the next
+// block's entry rate and within reach of it, through the float and integer
+// trapezoid kernels.
+// They must agree to within a step, and the S-curve cruise rate and times to
+// within what that step is worth. Host time per block is reported for both,
+// though unlike the STM32F103 the host has an FPU.
+//
+struct trapezoid_case_t { block_t block; uint32_t initial_rate, final_rate; };
+
+template<typename F>
+static double trapezoid_rate(F fn, std::vector<trapezoid_case_t> &cases) {
+  uint64_t blocks = 0;
+  const uint64_t start_ns = Clock::host_nanos();
+  uint64_t elapsed_ns;
+  do {
+    for (trapezoid_case_t &t : cases) fn(&t.block, t.initial_rate, t.final_rate);
+    blocks += cases.size();
+    elapsed_ns = Clock::host_nanos() - start_ns;
+  } while (elapsed_ns < Clock::ONE_BILLION / 2);
+  return double(elapsed_ns) / blocks;
+}
+
+static int trapezoid_benchmark() {
+  const uint32_t min_rate = 120; // MINIMAL_STEP_RATE
+  std::vector<trapezoid_case_t> cases;
+  srand(1);
+  for (int chain = 0; chain < 2000; chain++) {
+    uint32_t rate = min_rate;
+    for (int i = 0, n = 1 + rand() % 32; i < n; i++) {
+      trapezoid_case_t t = {};
+      t.block.nominal_rate = min_rate + rand() % 200000;
+      t.block.acceleration_steps_per_s2 = 100 + rand() % 2000000;
+      t.block.step_event_count = 1 + rand() % (rand() % 4 ? 2000 : 50000);
+      t.initial_rate = _MIN(rate, t.block.nominal_rate);
+      // The planner only asks for exit rates reachable from the entry rate
+      const double reach = 2.0 * t.block.acceleration_steps_per_s2 * t.block.step_event_count,
+                   entry_sq = sq(double(t.initial_rate));
+      const uint32_t lo = _MAX(min_rate, uint32_t(ceil(sqrt(_MAX(entry_sq - reach, 0.0))))),
+                     hi = _MIN(t.block.nominal_rate, uint32_t(sqrt(entry_sq + reach)));
+      rate = (i == n - 1 || hi <= lo) ? lo : lo + rand() % (hi - lo + 1);
+      t.final_rate = rate;
+      cases.push_back(t);
+    }
+  }
+
+  int failed = 0;
+  uint32_t max_diff = 0;
+  const auto within = [&](const char *what, const trapezoid_case_t &t, const uint32_t got, const uint32_t want, const uint32_t tolerance) {
+    const uint32_t diff = got > want ? got - want : want - got;
+    if (diff > tolerance) {
+      if (failed++ < 10)
+        fprintf(stderr, "  %s: %u, expected %u (rates %u / %u / %u, accel %u, steps %u)\n", what, got, want,
+          t.initial_rate, t.block.nominal_rate, t.final_rate, t.block.acceleration_steps_per_s2, t.block.step_event_count);
+    }
+    else if (tolerance == 1) NOLESS(max_diff, diff);
+  };
+  for (const trapezoid_case_t &t : cases) {
+    trapezoid_case_t f = t, i = t;
+    Planner::trapezoid_float(&f.block, t.initial_rate, t.final_rate);
+    Planner::trapezoid_integer(&i.block, t.initial_rate, t.final_rate);
+    within("accelerate_until", t, i.block.accelerate_until, f.block.accelerate_until, 1);
+    within("decelerate_after", t, i.block.decelerate_after, f.block.decelerate_after, 1);
+    #if ENABLED(S_CURVE_ACCELERATION)
+      // A step more or less of acceleration moves the cruise rate by accel / cruise_rate
+      const uint32_t accel = t.block.acceleration_steps_per_s2,
+                     accel_diff = i.block.accelerate_until > f.block.accelerate_until ? i.block.accelerate_until - f.block.accelerate_until : f.block.accelerate_until - i.block.accelerate_until,
+                     cruise_rate = _MAX(1U, _MIN(i.block.cruise_rate, f.block.cruise_rate)),
+                     rate_slack = 1 + (uint64_t(accel_diff) * accel + cruise_rate - 1) / cruise_rate,
+                     tick_slack = rate_slack * (1 + (STEPPER_TIMER_RATE) / accel);
+      within("cruise_rate", t, i.block.cruise_rate, f.block.cruise_rate, rate_slack);
+      within("acceleration_time", t, i.block.acceleration_time, f.block.acceleration_time, tick_slack + f.block.acceleration_time / 1000000);
+      within("deceleration_time", t, i.block.deceleration_time, f.block.deceleration_time, tick_slack + f.block.deceleration_time / 1000000);
+    #endif
+  }
+
+  const double float_ns = trapezoid_rate(Planner::trapezoid_float, cases),
+               integer_ns = trapezoid_rate(Planner::trapezoid_integer, cases);
+
+  fprintf(stderr, "Trapezoids, %u blocks, %s (largest difference %u step%s)\n", unsigned(cases.size()),
+    failed ? "FAILED" : "integer and float kernels agree", max_diff, max_diff == 1 ? "" : "s");
+  fprintf(stderr, "  float         : %.1f ns per block\n", float_ns);
+  fprintf(stderr, "  integer       : %.1f ns per block, %.2fx%s\n", integer_ns, float_ns / integer_ns,
+    TERN(TRAPEZOID_INTEGER_MATH, " (used by the planner)", ""));
+  return failed ? 1 : 0;
+}
+
+//
+// Junctions: run random pairs of unit vectors, from sharp corners to nearly
+// straight curves, through Planner::junction_speed_sqr() and the code it
+// replaced (a dot product, then normalizing the change of direction and a
+// division per limiting axis, then the acos lookup table), measuring both
+// against the same math in double. Check Planner::junction_theta() against
+// acos() over the small segment angles. Exit non-zero if the new code is off
+// by more than 0.01%, and report host time per junction for both.
+//
+static float acos_lookup_reference(const float t) {
+  static constexpr float k[16] = {
+    -1.03145837f, -1.30760646f, -1.75205851f, -2.41705704f, -3.37769222f, -4.74888992f, -6.69649887f, -9.45661736f,
+    -13.3640480f, -18.8928222f, -26.7136841f, -37.7754593f, -53.4201813f, -75.5458374f, -106.836761f, -218.532821f };
+  static constexpr float b[16] = {
+    1.57079637f, 1.70887053f, 2.04220939f, 2.62408352f, 3.52467871f, 4.85302639f, 6.77020454f, 9.50875854f,
+    13.4009285f, 18.9188995f, 26.7321243f, 37.7885055f, 53.4293975f, 75.5523529f, 106.841369f, 218.534011f };
+  const uint16_t v = (1.0f - t) * 32768;
+  const int idx = (t < 0.00000003f) ? 0 : v ? __builtin_clz(v) - 17 : 15;
+  return t * k[idx] + b[idx];
+}
+
+// The junction code before the single pass kernel
+static float junction_reference(const xyze_float_t &prev_unit_vec, const xyze_float_t &unit_vec, const float accel, const float millimeters, const float deviation_mm) {
+  float junction_cos_theta = 0;
+  LOOP_XYZE(i) junction_cos_theta -= prev_unit_vec[i] * unit_vec[i];
+  if (junction_cos_theta > 0.999999f) return sq(float(MINIMUM_PLANNER_SPEED));
+  NOLESS(junction_cos_theta, -0.999999f);
+  xyze_float_t junction_unit_vec = unit_vec - prev_unit_vec;
+  float magnitude_sq = 0;
+  LOOP_XYZE(i) if (junction_unit_vec[i]) magnitude_sq += sq(junction_unit_vec[i]);
+  junction_unit_vec *= RSQRT(magnitude_sq);
+  float junction_acceleration = accel;
+  LOOP_XYZE(i) if (junction_unit_vec[i] && junction_acceleration * ABS(junction_unit_vec[i]) > planner.settings.max_acceleration_mm_per_s2[i])
+    junction_acceleration = ABS(planner.settings.max_acceleration_mm_per_s2[i] / junction_unit_vec[i]);
+  const float sin_theta_d2 = SQRT(0.5f * (1.0f - junction_cos_theta));
+  float vmax_junction_sqr = junction_acceleration * deviation_mm * sin_theta_d2 / (1.0f - sin_theta_d2);
+  #if ENABLED(JD_HANDLE_SMALL_SEGMENTS)
+    if (millimeters < 1 && junction_cos_theta < -0.7071067812f)
+      NOMORE(vmax_junction_sqr, millimeters * junction_acceleration / acos_lookup_reference(-junction_cos_theta));
+  #else
+    UNUSED(millimeters);
+  #endif
+  return vmax_junction_sqr;
+}
+
+// The same limits in double, from the deflection angle between the vectors
+static double junction_exact(const xyze_float_t &prev_unit_vec, const xyze_float_t &unit_vec, const double accel, const double millimeters, const double deviation_mm) {
+  double diff[XYZE], diff_sq = 0, sum_sq = 0;
+  LOOP_XYZE(i) {
+    diff[i] = double(unit_vec[i]) - prev_unit_vec[i];
+    diff_sq += sq(diff[i]);
+    sum_sq += sq(double(unit_vec[i]) + prev_unit_vec[i]);
+  }
+  const double min_deflection = acos(0.999999);
+  double deflection = 2 * atan2(sqrt(diff_sq), sqrt(sum_sq));
+  if (deflection > M_PI - min_deflection) return sq(double(MINIMUM_PLANNER_SPEED));
+  NOLESS(deflection, min_deflection);
+  double junction_acceleration = accel;
+  LOOP_XYZE(i) {
+    const double c = fabs(diff[i]) / sqrt(diff_sq), m = planner.settings.max_acceleration_mm_per_s2[i];
+    if (junction_acceleration * c > m) junction_acceleration = m / c;
+  }
+  // The junction angle is pi - deflection, so sin(junction / 2) = cos(deflection / 2)
+  const double sin_theta_d2 = cos(deflection / 2), one_minus = 2 * sq(sin(deflection / 4));
+  double vmax_junction_sqr = junction_acceleration * deviation_mm * sin_theta_d2 / one_minus;
+  #if ENABLED(JD_HANDLE_SMALL_SEGMENTS)
+    if (millimeters < 1 && deflection < M_PI / 4)
+      NOMORE(vmax_junction_sqr, millimeters * junction_acceleration / deflection);
+  #else
+    UNUSED(millimeters);
+  #endif
+  return vmax_junction_sqr;
+}
+
+struct junction_case_t { xyze_float_t prev_unit_vec, unit_vec; float accel, millimeters, deviation_mm; };
+
+template<typename F>
+static double junction_rate(F fn, const std::vector<junction_case_t> &cases) {
+  volatile float sink = 0;
+  uint64_t junctions = 0;
+  const uint64_t start_ns = Clock::host_nanos();
+  uint64_t elapsed_ns;
+  do {
+    for (const junction_case_t &j : cases) sink = sink + fn(j);
+    junctions += cases.size();
+    elapsed_ns = Clock::host_nanos() - start_ns;
+  } while (elapsed_ns < Clock::ONE_BILLION / 2);
+  return double(elapsed_ns) / junctions;
+}
+
+static int junction_benchmark() {
+  const float max_acceleration[] = DEFAULT_MAX_ACCELERATION;
+  LOOP_XYZE(i) planner.settings.max_acceleration_mm_per_s2[i] = max_acceleration[_MIN(i, COUNT(max_acceleration) - 1)];
+
+  const auto random = [](const float lo, const float hi) { return lo + (hi - lo) * rand() / float(RAND_MAX); };
+  const auto unit = [](xyze_float_t v) { v *= RSQRT(sq(v.x) + sq(v.y) + sq(v.z) + sq(v.e)); return v; };
+  std::vector<junction_case_t> cases;
+  srand(1);
+  for (int n = 0; n < 100000; n++) {
+    junction_case_t j;
+    j.prev_unit_vec = unit({ random(-1, 1), random(-1, 1), rand() % 8 ? 0 : random(-1, 1), rand() % 4 ? random(0, 0.05f) : 0 });
+    if (n & 1)
+      j.unit_vec = unit({ random(-1, 1), random(-1, 1), rand() % 8 ? 0 : random(-1, 1), rand() % 4 ? random(0, 0.05f) : 0 });
+    else {
+      // A curve, deflected by 0.001 to 1 of the segment
+      const float d = powf(10, random(-3, 0));
+      j.unit_vec = unit(j.prev_unit_vec + xyze_float_t({ random(-d, d), random(-d, d), 0, 0 }));
+    }
+    j.accel = random(100, 5000);
+    j.millimeters = random(0.05f, 2);
+    j.deviation_mm = random(0.01f, 0.3f);
+    cases.push_back(j);
+  }
+
+  const auto kernel = [](const junction_case_t &j) { return Planner::junction_speed_sqr(j.prev_unit_vec, j.unit_vec, j.accel, j.millimeters, j.deviation_mm); };
+  const auto before = [](const junction_case_t &j) { return junction_reference(j.prev_unit_vec, j.unit_vec, j.accel, j.millimeters, j.deviation_mm); };
+
+  double kernel_err = 0, before_err = 0;
+  for (const junction_case_t &j : cases) {
+    const double want = junction_exact(j.prev_unit_vec, j.unit_vec, j.accel, j.millimeters, j.deviation_mm);
+    NOLESS(kernel_err, fabs(kernel(j) / want - 1));
+    NOLESS(before_err, fabs(before(j) / want - 1));
+  }
+
+  double theta_err = 0, lookup_err = 0;
+  for (int i = 1; i <= 100000; i++) {
+    const double chord_sq = (2 - M_SQRT2) * i / 100000, want = 2 * asin(sqrt(chord_sq) / 2);
+    NOLESS(theta_err, fabs(Planner::junction_theta(chord_sq) / want - 1));
+    NOLESS(lookup_err, fabs(acos_lookup_reference(1 - chord_sq / 2) / want - 1));
+  }
+
+  const double kernel_ns = junction_rate(kernel, cases), before_ns = junction_rate(before, cases);
+  const bool failed = kernel_err > 1e-4 || theta_err > 1e-4;
+
+  fprintf(stderr, "Junctions, %u pairs, %s\n", unsigned(cases.size()), failed ? "FAILED" : "within 0.01% of double math");
+  fprintf(stderr, "  speed limit   : %.1f ns, max error %.2g%%, before %.1f ns, max error %.2g%%, %.2fx\n",
+    kernel_ns, kernel_err * 100, before_ns, before_err * 100, before_ns / kernel_ns);
+  fprintf(stderr, "  junction angle: max error %.2g%%, lookup table %.2g%% (up to 45 degrees)\n", theta_err * 100, lookup_err * 100);
+  return failed ? 1 : 0;
+}
+
+//
+// Input shaping: run the XY motor step timelines of some moves through an
+// InputShaper the way the stepper ISR does, checking that each motor ends on
+// its commanded position, never strays half a step from the exact shaped
+// position, and that the axis rings less
+//
+#if ENABLED(INPUT_SHAPING)
+
+typedef struct { uint32_t time; int8_t step[XY]; } shaping_event_t;
+
+// Trapezoid move of (dx, dy) axis steps from time t (s), at v (events/s) and a (events/s^2),
+// Bresenham-split into XY motor steps as the stepper does
+static void shaping_move(std::vector<shaping_event_t> &out, double &t, const int32_t dx, const int32_t dy, const double v, const double a) {
+  #if CORE_IS_XY
+    const int32_t d[XY] = { dx + dy, CORESIGN(dx - dy) };
+  #else
+    const int32_t d[XY] = { dx, dy };
+  #endif
+  const int32_t n = _MAX(ABS(d[0]), ABS(d[1]));
+  if (!n) return;
+  const double ramp = _MIN(double(n) / 2, v * v / (2 * a)), t_ramp = SQRT(2 * ramp / a), t_cruise = (n - 2 * ramp) / v;
+  int32_t err[XY] = { -n, -n };
+  for (int32_t i = 1; i <= n; i++) {
+    double s = i;
+    if (s <= ramp) s = SQRT(2 * s / a);
+    else if (s <= n - ramp) s = t_ramp + (s - ramp) / v;
+    else s = 2 * t_ramp + t_cruise - SQRT(2 * (n - s) / a);
+    shaping_event_t e = { uint32_t(LROUND((t + s) * (STEPPER_TIMER_RATE))), { 0, 0 } };
+    LOOP_L_N(m, XY) if ((err[m] += 2 * ABS(d[m])) >= 0) { err[m] -= 2 * n; e.step[m] = d[m] < 0 ? -1 : 1; }
+    out.push_back(e);
+  }
+  t += 2 * t_ramp + t_cruise;
+}
+
+typedef struct {
+  int32_t position[XY];
+  uint32_t motor_steps, overflows;
+  double max_error, settle_ms;
+  std::vector<shaping_event_t> motor;
+} shaping_result_t;
+
+// Interleave commanded steps and echoes as Stepper::isr() does
+static shaping_result_t shaping_run(InputShaper &shaper, const std::vector<shaping_event_t> &cmd, const bool track) {
+  shaping_result_t r = {};
+
+  // Commanded axis positions in units, for the exact shaped position
+  std::vector<int32_t> cx, cy;
+  int32_t ux = 0, uy = 0;
+  for (const shaping_event_t &c : cmd) {
+    #if CORE_IS_XY
+      ux += c.step[0] + CORESIGN(c.step[1]); uy += c.step[0] - CORESIGN(c.step[1]);
+    #else
+      ux += c.step[0]; uy += c.step[1];
+    #endif
+    cx.push_back(ux); cy.push_back(uy);
+  }
+  const auto commanded = [&](const std::vector<int32_t> &pos, const int64_t t) {
+    if (t < 0) return int32_t(0);
+    const auto it = std::upper_bound(cmd.begin(), cmd.end(), uint32_t(t), [](const uint32_t v, const shaping_event_t &s) { return v < s.time; });
+    return it == cmd.begin() ? int32_t(0) : pos[it - cmd.begin() - 1];
+  };
+  const auto shaped = [&](const ShapedAxis &axis, const std::vector<int32_t> &pos, const uint32_t now) {
+    if (!axis.enabled) return int64_t(SHAPING_UNIT) * commanded(pos, now);
+    int64_t s = int64_t(axis.amplitude[0]) * commanded(pos, now);
+    LOOP_L_N(k, axis.echoes) s += int64_t(axis.amplitude[k + 1]) * commanded(pos, int64_t(now) - axis.delay[k]);
+    return s;
+  };
+
+  uint32_t now = 0, done = 0;
+  const auto take_steps = [&]() {
+    for (bool stepped = true; stepped;) {
+      shaping_event_t e = { now, { 0, 0 } };
+      stepped = false;
+      LOOP_L_N(m, XY) if ((e.step[m] = shaper.step(AxisEnum(m)))) { r.position[m] += e.step[m]; r.motor_steps++; stepped = true; }
+      if (stepped) r.motor.push_back(e);
+    }
+  };
+
+  while (done < cmd.size() || shaper.busy()) {
+    const uint32_t next_cmd = done < cmd.size() ? cmd[done].time - now : SHAPING_NEVER;
+    now += _MIN(next_cmd, shaper.next_echo(now));
+    for (; done < cmd.size() && cmd[done].time == now; done++) {
+      LOOP_L_N(m, XY) if (cmd[done].step[m]) shaper.command(AxisEnum(m), cmd[done].step[m] < 0, now);
+      take_steps();
+    }
+    shaper.echo(now);
+    take_steps();
+
+    if (track) {
+      const int64_t sx = shaped(shaper.x, cx, now), sy = shaped(shaper.y, cy, now);
+      #if CORE_IS_XY
+        const int64_t s[XY] = { sx + sy, CORESIGN(sx - sy) };
+      #else
+        const int64_t s[XY] = { sx, sy };
+      #endif
+      LOOP_L_N(m, XY) NOLESS(r.max_error, fabs(double(s[m] - int64_t(r.position[m]) * SHAPING_ONE) / SHAPING_ONE));
+    }
+  }
+  r.overflows = shaper.x.overflows + shaper.y.overflows;
+  r.settle_ms = cmd.empty() ? 0 : (double(now) - cmd.back().time) * 1000 / (STEPPER_TIMER_RATE);
+  return r;
+}
+
+// Peak ringing along X of an axis with the given frequency and damping after the motors stop, in steps
+static double shaping_ringing(const std::vector<shaping_event_t> &motor, const double freq, const double zeta) {
+  const double w = 2 * M_PI * freq, dt = 1e-6, end = motor.back().time / double(STEPPER_TIMER_RATE);
+  double x = 0, v = 0, u = 0, peak = 0;
+  size_t i = 0;
+  for (double t = 0; t < end + 0.5; t += dt) {
+    for (; i < motor.size() && motor[i].time / double(STEPPER_TIMER_RATE) <= t; i++)
+      u += TERN(CORE_IS_XY, (motor[i].step[0] + CORESIGN(motor[i].step[1])) * 0.5, motor[i].step[0]);
+    v += (-w * w * (x - u) - 2 * zeta * w * v) * dt;
+    x += v * dt;
+    if (t > end) NOLESS(peak, fabs(x - u));
+  }
+  return peak;
+}
+
+static int shaping_check() {
+  const double freq = 40, zeta = 0.1, spm = 160;     // Z9V5: 160 steps/mm
+  const double v = 150 * spm, a = 3000 * spm;
+
+  // Travel along X, Y and a diagonal, a reversal, a zigzag of short moves inside one ringing period and a crawl
+  std::vector<shaping_event_t> cmd;
+  double t = 0.001;
+  shaping_move(cmd, t, 20 * spm, 0, v, a); t += 0.03;
+  shaping_move(cmd, t, 0, 15 * spm, v, a); t += 0.01;
+  shaping_move(cmd, t, -10 * spm, -10 * spm, v, a);
+  shaping_move(cmd, t, -10 * spm, 5 * spm, v, a);
+  LOOP_L_N(i, 20) shaping_move(cmd, t, i & 1 ? -16 : 16, i & 2 ? 8 : -8, v, a);
+  t += 0.005;
+  shaping_move(cmd, t, 40, 25, 90, 1000);
+
+  // One move along X alone, for the ringing it leaves
+  std::vector<shaping_event_t> single;
+  t = 0.001;
+  shaping_move(single, t, 20 * spm, 0, v, a);
+
+  // A long fast move, faster than the queues hold at the lowest frequency
+  const auto flood = [&](const double speed) {
+    std::vector<shaping_event_t> out;
+    double t = 0.001;
+    shaping_move(out, t, 100 * spm, 30 * spm, speed, 10000 * spm);
+    return out;
+  };
+  const double flood_v = 200 * spm;
+  const std::vector<shaping_event_t> fast = flood(flood_v);
+
+  int32_t end[XY] = { 0 }, flood_end[XY] = { 0 };
+  uint32_t flood_steps[XY] = { 0 };
+  for (const shaping_event_t &c : cmd) LOOP_L_N(m, XY) end[m] += c.step[m];
+  for (const shaping_event_t &c : fast) LOOP_L_N(m, XY) { flood_end[m] += c.step[m]; flood_steps[m] += c.step[m] != 0; }
+  uint32_t cmd_steps = 0;
+  for (const shaping_event_t &c : cmd) LOOP_L_N(m, XY) cmd_steps += c.step[m] != 0;
+
+  static InputShaper shaper;
+  const auto setup = [&](const ShaperType type, const double f) {
+    shaper.x.params = shaper.y.params = { float(f), float(zeta), type };
+    shaper.configure();
+  };
+
+  setup(SHAPER_ZV, 0);
+  const double unshaped = shaping_ringing(shaping_run(shaper, single, false).motor, freq, zeta);
+
+  static const char * const names[] = { "ZV", "ZVD", "EI" };
+  bool failed = false;
+  fprintf(stderr, "Input shaping of %s motors at %.0f Hz, zeta %.2f, %u commanded steps, queues of %d\n",
+    TERN(CORE_IS_XY, "CoreXY", "XY"), freq, zeta, cmd_steps, SHAPING_BUFFER_SIZE);
+  fprintf(stderr, "  Shaper    Steps  End  Max error  Settles   Ringing vs unshaped (%.2f steps) at -10%%, 0, +10%%\n", unshaped);
+  LOOP_L_N(type, 3) {
+    setup(ShaperType(type), freq);
+    const uint64_t start_ns = Clock::host_nanos();
+    shaping_run(shaper, cmd, false);
+    const double ns = double(Clock::host_nanos() - start_ns) / cmd_steps;
+
+    setup(ShaperType(type), freq);
+    const shaping_result_t r = shaping_run(shaper, cmd, true);
+    const bool on_end = r.position[0] == end[0] && r.position[1] == end[1],
+               ok = on_end && r.max_error <= 0.5 && !r.overflows && !shaper.busy();
+    failed |= !ok;
+
+    setup(ShaperType(type), freq);
+    const std::vector<shaping_event_t> motor = shaping_run(shaper, single, false).motor;
+    fprintf(stderr, "  %-4s %10u %4s %8.3f %7.1f ms   ", names[type], r.motor_steps, on_end ? "ok" : "off", r.max_error, r.settle_ms);
+    for (const double m : { 0.9, 1.0, 1.1 }) fprintf(stderr, " %5.1f%%", 100 * shaping_ringing(motor, freq * m, zeta) / unshaped);
+    fprintf(stderr, "  %s(%.0f host ns/step)\n", ok ? "" : "FAILED ", ns);
+  }
+
+  // At the speed the planner caps the move to, every step fits the queues
+  LOOP_L_N(type, 3) {
+    setup(ShaperType(type), SHAPING_MIN_FREQ);
+    const float f = shaper.speed_limit(flood_steps[0], flood_steps[1], fast.size(), flood_v / fast.size());
+    const shaping_result_t r = shaping_run(shaper, flood(flood_v * f), false);
+    const bool ok = r.position[0] == flood_end[0] && r.position[1] == flood_end[1] && !r.overflows && !shaper.busy();
+    failed |= !ok;
+    fprintf(stderr, "  Flood capped from %.0f to %.1f kHz, %-3s at %d Hz: %u steps, %u past the queues, end %s\n",
+      flood_v / 1000, flood_v * f / 1000, names[type], SHAPING_MIN_FREQ, r.motor_steps, r.overflows, ok ? "ok" : "FAILED");
+  }
+
+  // Uncapped, the steps the queues can't hold move at once, and the motors still end up in the right place
+  setup(SHAPER_ZVD, SHAPING_MIN_FREQ);
+  const shaping_result_t r = shaping_run(shaper, fast, false);
+  const bool fast_ok = r.position[0] == flood_end[0] && r.position[1] == flood_end[1] && !shaper.busy();
+  failed |= !fast_ok;
+  fprintf(stderr, "  Flood uncapped at %.0f kHz, ZVD at %d Hz: %u steps, %u past the queues, end %s\n",
+    flood_v / 1000, SHAPING_MIN_FREQ, r.motor_steps, r.overflows, fast_ok ? "ok" : "FAILED");
+
+  fprintf(stderr, "%s\n", failed ? "FAILED" : "Steps and positions exact");
+  return failed ? 1 : 0;
+}
+
+#endif // INPUT_SHAPING
+
+//
+// Flash EEPROM wear: save the settings N times, changing one value each
+// time. Every 64th save finds the printer idle, so the idle loop gets to
+// erase and compact; the others are made mid-print, with motion queued.
+// A save made mid-print must never erase, and the journal must mount with
+// the last settings at the end.
+//
+static int eeprom_wear(const uint32_t saves) {
+  #if ENABLED(FLASH_EEPROM_JOURNAL)
+    Clock::setMode(Clock::VIRTUAL);
+    Clock::setFrequency(F_CPU);
+    Clock::start();
+    settings.load();
+
+    const FlashJournal::stats_t start = FlashJournal::stats;
+    uint64_t save_stall = 0, moving_stall = 0, idle_stall = 0;
+    for (uint32_t i = 0; i < saves; i++) {
+      // A block stands queued for the saves made mid-print. The stepper isn't running.
+      const bool idle = i % 64 == 63;
+      planner.block_buffer_head = idle ? planner.block_buffer_tail : BLOCK_MOD(planner.block_buffer_tail + 1);
+
+      planner.settings.axis_steps_per_mm[X_AXIS] += 0.01f;
+      eeprom_flash.resetStall();
+      if (!settings.save()) {
+        fprintf(stderr, "Save %u failed\n", i);
+        return 1;
+      }
+      NOLESS(idle ? save_stall : moving_stall, eeprom_flash.longestStall());
+
+      eeprom_flash.resetStall();
+      LOOP_L_N(n, EEPROM_JOURNAL_PAGES + 1) flash_journal.service(idle);
+      NOLESS(idle_stall, eeprom_flash.longestStall());
+    }
+    planner.clear_block_buffer();
+
+    // Write any held save, then boot again
+    LOOP_L_N(n, EEPROM_JOURNAL_PAGES + 1) flash_journal.service(true);
+    static uint8_t last[FlashJournal::capacity];
+    memcpy(last, FlashJournal::image, sizeof(last));
+    const bool mounts = flash_journal.mount() && !memcmp(last, FlashJournal::image, sizeof(last)),
+               ok = mounts && moving_stall < Flash::erase_ns;
+
+    uint32_t most = 0, least = UINT32_MAX;
+    LOOP_L_N(p, eeprom_flash.pageCount()) {
+      NOLESS(most, eeprom_flash.erases(p));
+      NOMORE(least, eeprom_flash.erases(p));
+    }
+    const FlashJournal::stats_t &st = FlashJournal::stats;
+    const uint32_t written = st.saves - start.saves;
+    fprintf(stderr, "Flash EEPROM journal, %u pages of %u bytes, %u byte image\n", eeprom_flash.pageCount(), EEPROM_PAGE_SIZE, (unsigned)FlashJournal::capacity);
+    fprintf(stderr, "  Saves         : %u, %.1f half-words programmed each, %u held until idle for an erase\n",
+      saves, written ? double(st.halfwords - start.halfwords) / written : 0.0, st.deferred - start.deferred);
+    fprintf(stderr, "  Erases        : %u (%u while saving), %u compactions, %u-%u per page\n",
+      st.erases - start.erases, st.foreground_erases - start.foreground_erases, st.compactions - start.compactions, least, most
+    );
+    fprintf(stderr, "  Longest stall : %.3f ms saving mid-print%s, %.3f ms saving idle, %.3f ms idle\n",
+      moving_stall / 1e6, moving_stall < Flash::erase_ns ? "" : " FAILED", save_stall / 1e6, idle_stall / 1e6);
+    fprintf(stderr, "  Mount         : %s\n", mounts ? "last settings" : "FAILED");
+    fprintf(stderr, "  Endurance     : %.0f saves at 10k erase cycles per page\n", most ? 10000.0 * saves / most : 0.0);
+
+    // The flat store it replaces erased both pages and rewrote them with interrupts off
+    const double flat_ms = (2 * Flash::erase_ns + (MARLIN_EEPROM_SIZE) / 2 * Flash::program_ns) / 1e6;
+    fprintf(stderr, "  Flat store    : %u erases per page, %.3f ms with interrupts off per save, 10000 saves endurance\n", saves, flat_ms);
+    return ok ? 0 : 1;
+  #else
+    UNUSED(saves);
+    fprintf(stderr, "No flash EEPROM\n");
+    return 1;
+  #endif
+}
+
+//
+// Flash EEPROM power cuts: cut the power at each erase and program of a
+// plain save, then of a save that compacts the journal. After every cut the
+// journal must mount with the image from before or after the save, never a
+// mix, and the saves that follow must work.
+//
+static int eeprom_power_cuts() {
+  #if ENABLED(FLASH_EEPROM_JOURNAL)
+    Clock::setMode(Clock::VIRTUAL);
+    Clock::setFrequency(F_CPU);
+    Clock::start();
+    eeprom_flash.open(nullptr, EEPROM_JOURNAL_PAGES, EEPROM_PAGE_SIZE); // Scratch pages, leaving the settings alone
+
+    constexpr size_t size = FlashJournal::capacity;
+    constexpr uint8_t later_saves = 20;
+
+    // Like the settings, the image is half full. Save v differs from the
+    // others in three chunks far apart, so a save is a few records.
+    static uint8_t expected[size];
+    auto version = [](const uint8_t v) {
+      for (size_t i = 0; i < size; i++) expected[i] = i < size / 2 ? uint8_t(i * 7) : 0xFF;
+      expected[0] = expected[size / 4] = expected[size / 2 - 8] = v;
+      return expected;
+    };
+    auto save = [&](const uint8_t v) {
+      flash_journal.write(0, version(v), size);
+      return flash_journal.commit();
+    };
+    auto holds = [&](const uint8_t v) { return !memcmp(FlashJournal::image, version(v), size); };
+
+    // A fresh journal holding saves 0 to v
+    auto start_over = [&](const uint8_t v) {
+      eeprom_flash.restorePower();
+      LOOP_L_N(p, eeprom_flash.pageCount()) eeprom_flash.erase(p);
+      flash_journal.mount();
+      flash_journal.import(version(0), eeprom_flash.pageCount() - 1);
+      flash_journal.commit();
+      for (uint8_t s = 1; s <= v; s++) save(s);
+    };
+
+    // The first save after save 0 that compacts
+    start_over(0);
+    uint8_t compacting = 0;
+    for (uint8_t v = 1; v < 200 && !compacting; v++) {
+      const uint32_t before = FlashJournal::stats.compactions;
+      save(v);
+      if (FlashJournal::stats.compactions != before) compacting = v;
+    }
+
+    fprintf(stderr, "Flash EEPROM journal power cuts, %u pages of %u bytes, %u byte image\n", eeprom_flash.pageCount(), EEPROM_PAGE_SIZE, (unsigned)size);
+    bool failed = !compacting;
+    const struct { const char *label; uint8_t v; } runs[] = { { "Save", 1 }, { "Compacting save", compacting } };
+    for (const auto &run : runs) {
+      if (!run.v) continue;
+      uint32_t cuts = 0, mixed = 0, failed_saves = 0, lost = 0;
+      for (bool cut = true; cut; cuts++) {
+        start_over(run.v - 1);
+        eeprom_flash.cutPowerAfter(cuts);
+        cut = !save(run.v);
+        eeprom_flash.restorePower();
+
+        // Power comes back
+        flash_journal.mount();
+        if (!holds(run.v - 1) && !holds(run.v)) mixed++;
+        LOOP_L_N(s, later_saves) if (!save(run.v + 1 + s)) failed_saves++;
+        flash_journal.mount();
+        if (!holds(run.v + later_saves)) lost++;
+      }
+      fprintf(stderr, "  %-16s: %u cut points, %u mixed images, %u of %u later saves failed, %u lost\n",
+        run.label, cuts, mixed, failed_saves, cuts * later_saves, lost
+      );
+      failed |= mixed || failed_saves || lost;
+    }
+    if (!compacting) fprintf(stderr, "  No save compacted the journal\n");
+    fprintf(stderr, "%s\n", failed ? "FAILED" : "Every cut kept a whole image");
+    return failed ? 1 : 0;
+  #else
+    fprintf(stderr, "No flash EEPROM\n");
+    return 1;
+  #endif
+}
+
+//
+// Upload benchmark: send a file with the binary transfer protocol from a
+// simulated host, stop-and-wait and windowed, then read each copy back
+//
+static UploadHost upload_host;
+static struct {
+  const char *file = nullptr;
+  uint32_t baud = 115200, latency_us = 2000;
+} upload;
+
+#if ENABLED(BINARY_FILE_TRANSFER)
+
+  static bool upload_matches(const char *name, const std::vector<uint8_t> &data) {
+    #if ENABLED(SDSUPPORT)
+      char path[13];
+      strcpy(path, name);
+      card.mount();
+      card.openFileRead(path);
+      bool ok = card.isFileOpen() && card.getFileSize() == data.size();
+      for (size_t i = 0; ok && i < data.size(); i++) ok = card.get() == data[i];
+      card.closefile();
+      return ok;
+    #else
+      UNUSED(name); UNUSED(data);
+      return false;
+    #endif
+  }
+
+#endif
+
+static int upload_benchmark() {
+  #if ENABLED(BINARY_FILE_TRANSFER)
+    FILE *f = fopen(upload.file, "rb");
+    if (!f) {
+      fprintf(stderr, "Unable to open %s\n", upload.file);
+      return 1;
+    }
+    std::vector<uint8_t> data;
+    for (int c; (c = fgetc(f)) != EOF;) data.push_back(c);
+    fclose(f);
+
+    static const struct { const char *label; UploadHost::Options opt; } runs[] = {
+      { "Stop-and-wait, 128-byte packets", { upload.baud, upload.latency_us, 1, false, 0, 128 } },
+      { "... with heatshrink",             { upload.baud, upload.latency_us, 1, true,  0, 128 } },
+      { "Windowed, heatshrink",            { upload.baud, upload.latency_us, 0, true,  0, 0 } },
+      { "... 1 packet in 20 corrupt",      { upload.baud, upload.latency_us, 0, true,  20, 0 } }
+    };
+
+    fprintf(stderr, "\nUpload of %s, %u bytes, at %u baud with %.1f ms latency\n", upload.file, unsigned(data.size()), upload.baud, upload.latency_us / 1000.0);
+    fprintf(stderr, "  %-32s Packet Window  Sent bytes  Resends     Time  Bytes/s  Copy\n", "");
+    int result = 0;
+    LOOP_L_N(r, COUNT(runs)) {
+      char name[13];
+      sprintf(name, "UPLOAD%u.GCO", unsigned(r + 1));
+      upload_host.start(data, name, runs[r].opt);
+      while (!upload_host.finished() && Clock::peek() - upload_host.stats().start_ns < 3600 * Clock::ONE_BILLION) loop();
+
+      const UploadHost::Stats &st = upload_host.stats();
+      if (!upload_host.finished() || upload_host.failed()) {
+        fprintf(stderr, "  %-32s failed: %s\n", runs[r].label, upload_host.finished() ? upload_host.error() : "timed out");
+        result = 1;
+        continue;
+      }
+      const bool same = upload_matches(name, data);
+      if (!same) result = 1;
+      const double secs = (st.end_ns - st.start_ns) / double(Clock::ONE_BILLION);
+      fprintf(stderr, "  %-32s %6u %6u %11u %8u %7.2fs %8.0f  %s\n",
+        runs[r].label, st.packet_size, st.window, st.wire_bytes, st.resends, secs, data.size() / secs, same ? "ok" : "differs"
+      );
+    }
+
+    const UploadHost::Stats &st = upload_host.stats();
+    if (st.window_bits)
+      fprintf(stderr, "  Heatshrink %u,%u sends %.1f%% of the file (8,4 would send %.1f%%)\n", st.window_bits, st.lookahead_bits,
+        100.0 * st.payload_bytes / data.size(), 100.0 * UploadHost::compress(data, 8, 4).size() / data.size()
+      );
+    #if ENABLED(SDIO_SUPPORT)
+      extern uint32_t sdio_blocks_read, sdio_blocks_written;
+      fprintf(stderr, "  SD card : %u blocks read, %u written\n", sdio_blocks_read, sdio_blocks_written);
+    #endif
+    return result;
+  #else
+    fprintf(stderr, "No BINARY_FILE_TRANSFER\n");
+    return 1;
+  #endif
+}
+
+// The outside world runs at 1kHz regardless of interrupt masking
+static Timer simulation_timer;
+static void simulation_tick() {
+  TERN_(HAS_HOTEND, hotend.update(0.001));
+  TERN_(HAS_HEATED_BED, bed.update(0.001));
+  if (replay.gcode_file) replay_tick();
+}
+
+//
+// Motion system: one driver per motor, endstops follow the carriage
+//
+#define _PIN_OR_NC(P) TERN(HAS_##P, P##_PIN, P_NC)
+
+static StepperDriver x_stepper(_PIN_OR_NC(X_ENABLE), X_DIR_PIN, X_STEP_PIN),
+                     y_stepper(_PIN_OR_NC(Y_ENABLE), Y_DIR_PIN, Y_STEP_PIN),
+                     z_stepper(_PIN_OR_NC(Z_ENABLE), Z_DIR_PIN, Z_STEP_PIN);
+
+static Endstop x_min(_PIN_OR_NC(X_MIN), !X_MIN_ENDSTOP_INVERTING), x_max(_PIN_OR_NC(X_MAX), !X_MAX_ENDSTOP_INVERTING),
+               y_min(_PIN_OR_NC(Y_MIN), !Y_MIN_ENDSTOP_INVERTING), y_max(_PIN_OR_NC(Y_MAX), !Y_MAX_ENDSTOP_INVERTING),
+               z_min(_PIN_OR_NC(Z_MIN), !Z_MIN_ENDSTOP_INVERTING), z_max(_PIN_OR_NC(Z_MAX), !Z_MAX_ENDSTOP_INVERTING);
+
+static int32_t travel_min[XYZ], travel_max[XYZ];
+
+static void update_endstops() {
+  // Carriage position in steps. CoreXY motors share the X and Y travel.
+  #if CORE_IS_XY
+    const int32_t a = x_stepper.position, b = CORESIGN(y_stepper.position),
+                  x = (a + b) / 2, y = (a - b) / 2;
+  #else
+    const int32_t x = x_stepper.position, y = y_stepper.position;
+  #endif
+  const int32_t z = z_stepper.position;
+  x_min.update(x <= travel_min[X_AXIS]); x_max.update(x >= travel_max[X_AXIS]);
+  y_min.update(y <= travel_min[Y_AXIS]); y_max.update(y >= travel_max[Y_AXIS]);
+  z_min.update(z <= travel_min[Z_AXIS]); z_max.update(z >= travel_max[Z_AXIS]);
+}
+
+static void setup_axes() {
+  constexpr float steps_per_mm[] = DEFAULT_AXIS_STEPS_PER_UNIT;
+  constexpr float min_pos[] = { X_MIN_POS, Y_MIN_POS, Z_MIN_POS }, max_pos[] = { X_MAX_POS, Y_MAX_POS, Z_MAX_POS };
+  int32_t start[XYZ];
+  LOOP_XYZ(i) {
+    travel_min[i] = lround(min_pos[i] * steps_per_mm[i]);
+    travel_max[i] = lround(max_pos[i] * steps_per_mm[i]);
+    start[i] = (travel_min[i] + travel_max[i]) / 2;
+  }
+
+  // Start with the carriage in the middle of the bed, just above it
+  start[Z_AXIS] = travel_min[Z_AXIS] + lround(10 * steps_per_mm[Z_AXIS]);
+  #if CORE_IS_XY
+    x_stepper.position = start[X_AXIS] + start[Y_AXIS];
+    y_stepper.position = CORESIGN(start[X_AXIS] - start[Y_AXIS]);
+  #else
+    x_stepper.position = start[X_AXIS];
+    y_stepper.position = start[Y_AXIS];
+  #endif
+  z_stepper.position = start[Z_AXIS];
+
+  x_stepper.configure(X_ENABLE_ON, INVERT_X_DIR);
+  y_stepper.configure(Y_ENABLE_ON, INVERT_Y_DIR);
+  z_stepper.configure(Z_ENABLE_ON, INVERT_Z_DIR);
+  x_stepper.onStep(update_endstops);
+  y_stepper.onStep(update_endstops);
+  z_stepper.onStep(update_endstops);
+  update_endstops();
+}
+
+static void usage(const char *prog) {
+  fprintf(stderr,
+    "Usage: %s [options]\n"
+    "  -r, --realtime        Follow the host clock (default)\n"
+    "  -v, --virtual         Run on virtual time, as fast as the host allows\n"
+    "  -m, --multiplier N    Realtime speed multiplier\n"
+    "  -q, --quantum NS      Virtual nanoseconds charged per clock read (default 100)\n"
+    "  -s, --stdio           Use stdin/stdout for the main serial port\n"
+    "  -g, --gcode FILE      Replay FILE on the main serial port, report and exit (implies -v)\n"
+    "  -t, --trace FILE      Record every step and dir edge to FILE\n"
+    "  -p, --parse FILE      Time the G-code parser on FILE, report and exit\n"
+    "  -T, --thermistors     Time the thermistor conversions, report and exit\n"
+    "  -c, --checksums       Check and time the CRC and checksum code, report and exit\n"
+    "  -z, --trapezoids      Check and time the integer trapezoid code, report and exit\n"
+    "  -S, --shaping         Check the input shaping step timelines, report and exit\n"
+    "  -w, --wear N          Save the settings N times to the flash EEPROM, report wear and exit\n"
+    "  -P, --power-cuts      Cut the power during flash EEPROM saves, check the settings survive and exit\n"
+    "  -u, --upload FILE     Upload FILE with the binary transfer protocol, report and exit (implies -v)\n"
+    "  -b, --baud N          Line speed for -u (default 115200)\n"
+    "  -L, --latency US      One-way USB latency for -u (default 2000)\n"
+    "  -l, --link PATH       Symlink the main serial pty to PATH\n"
+    "  -e, --eeprom FILE     EEPROM image (default %s)\n"
+    "  -d, --sdcard FILE     SD card image (default %s)\n",
+    prog, eeprom_filename, sdcard_filename
+  );
+}
+
+static void open_port(HalSerial &port, const char *link=nullptr) {
+  if (port.openPty(link))
+    fprintf(stderr, "%s serial: %s\n", port.name(), port.device());
+  else
+    fprintf(stderr, "%s serial: unable to open a pty\n", port.name());
+}
+
+int main(int argc, char **argv) {
+  static const struct option long_options[] = {
+    { "realtime",   no_argument,       nullptr, 'r' },
+    { "virtual",    no_argument,       nullptr, 'v' },
+    { "multiplier", required_argument, nullptr, 'm' },
+    { "quantum",    required_argument, nullptr, 'q' },
+    { "stdio",      no_argument,       nullptr, 's' },
+    { "gcode",      required_argument, nullptr, 'g' },
+    { "trace",      required_argument, nullptr, 't' },
+    { "parse",      required_argument, nullptr, 'p' },
+    { "thermistors", no_argument,      nullptr, 'T' },
+    { "checksums",  no_argument,       nullptr, 'c' },
+    { "trapezoids", no_argument,       nullptr, 'z' },
+    { "junctions",  no_argument,       nullptr, 'j' },
+    { "shaping",    no_argument,       nullptr, 'S' },
+    { "wear",       required_argument, nullptr, 'w' },
+    { "power-cuts", no_argument,       nullptr, 'P' },
+    { "upload",     required_argument, nullptr, 'u' },
+    { "baud",       required_argument, nullptr, 'b' },
+    { "latency",    required_argument, nullptr, 'L' },
+    { "link",       required_argument, nullptr, 'l' },
+    { "eeprom",     required_argument, nullptr, 'e' },
+    { "sdcard",     required_argument, nullptr, 'd' },
+    { "help",       no_argument,       nullptr, 'h' },
+    { nullptr, 0, nullptr, 0 }
+  };
+
+  bool use_stdio = false, thermistors = false, checksums = false, trapezoids = false, junctions = false, shaping = false, power_cuts = false;
+  uint32_t wear_saves = 0;
+  const char *link = nullptr, *trace_file = nullptr, *parse_file = nullptr;
+  for (int c; (c = getopt_long(argc, argv, "rvm:q:sg:t:p:TczjSw:Pu:b:L:l:e:d:h", long_options, nullptr)) != -1;) {
+    switch (c) {
+      case 'r': Clock::setMode(Clock::REALTIME); break;
+      case 'v': Clock::setMode(Clock::VIRTUAL); break;
+      case 'm': Clock::setTimeMultiplier(atof(optarg)); break;
+      case 'q': Clock::setQuantum(atol(optarg)); break;
+      case 's': use_stdio = true; break;
+      case 'g': replay.gcode_file = optarg; Clock::setMode(Clock::VIRTUAL); break;
+      case 't': trace_file = optarg; break;
+      case 'p': parse_file = optarg; break;
+      case 'T': thermistors = true; break;
+      case 'c': checksums = true; break;
+      case 'z': trapezoids = true; break;
+      case 'j': junctions = true; break;
+      case 'S': shaping = true; break;
+      case 'w': wear_saves = atol(optarg); break;
+      case 'P': power_cuts = true; break;
+      case 'u': upload.file = optarg; Clock::setMode(Clock::VIRTUAL); break;
+      case 'b': upload.baud = atol(optarg); break;
+      case 'L': upload.latency_us = atol(optarg); break;
+      case 'l': link = optarg; break;
+      case 'e': eeprom_filename = optarg; break;
+      case 'd': sdcard_filename = optarg; break;
+      default: usage(argv[0]); return c == 'h' ? 0 : 1;
+    }
+  }
+
+  if (parse_file) return parse_benchmark(parse_file);
+  if (thermistors) return thermistor_benchmark();
+  if (checksums) return checksum_benchmark();
+  if (trapezoids) return trapezoid_benchmark();
+  if (junctions) return junction_benchmark();
+  #if ENABLED(INPUT_SHAPING)
+    if (shaping) return shaping_check();
+  #endif
+  if (wear_saves) return eeprom_wear(wear_saves);
+  if (power_cuts) return eeprom_power_cuts();
+
+  Clock::setFrequency(F_CPU);
+  Clock::start();
+
+  if (upload.file)
+    usb_serial.openLink(&upload_host);
+  else if (replay.gcode_file) {
+    if (!usb_serial.openFile(replay.gcode_file)) {
+      fprintf(stderr, "Unable to open %s\n", replay.gcode_file);
+      return 1;
+    }
+    replay.host_start_ns = Clock::host_nanos();
+  }
+  else if (use_stdio)
+    usb_serial.openStdio();
+  else
+    open_port(usb_serial, link);
+  #ifdef SERIAL_PORT_2
+    open_port(aux_serial);
+  #endif
+  #ifdef LCD_SERIAL_PORT
+    open_port(lcd_serial);
+  #endif
+  #ifdef WIFI_SERIAL_PORT
+    open_port(wifi_serial);
+  #endif
+
+  #if HAS_HOTEND
+    // A thermistor in a cartridge takes a few seconds to follow the block, and the part fan cools it
+    hotend.setThermistor([](const int raw) { return thermalManager.analog_to_celsius_hotend(raw * OVERSAMPLENR, 0); });
+    hotend.setSensorLag(0.25);
+    #if HAS_FAN0
+      hotend.setFan(FAN_PIN, 0.08);
+    #endif
+  #endif
+  TERN_(HAS_HEATED_BED, bed.setThermistor([](const int raw) { return thermalManager.analog_to_celsius_bed(raw * OVERSAMPLENR); }));
+
+  setup_axes();
+  setup_trace();
+  if (trace_file && !step_trace.open(trace_file)) {
+    fprintf(stderr, "Unable to create %s\n", trace_file);
+    return 1;
+  }
+
+  HAL_timer_init();
+  simulation_timer.init(1000000, UINT32_MAX, simulation_tick, false);
+  simulation_timer.start(1000);
+  simulation_timer.enable();
+
+  setup();
+  if (upload.file) return upload_benchmark();
+  for (;;) loop();
+}
+
+#endif // __PLAT_LINUX__
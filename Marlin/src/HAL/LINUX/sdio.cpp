@@ -0,0 +1,75 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifdef __PLAT_LINUX__
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(SDIO_SUPPORT)
+
+/**
+ * SD card image
+ *
+ * The card is a raw disk image on the host, addressed in 512-byte blocks.
+ * Create one with e.g. "mkfs.vfat -C sdcard.img 65536" and copy G-code in
+ * with mtools. A missing image reads as "no card inserted".
+ */
+
+#include <stdio.h>
+
+extern const char *sdcard_filename;
+
+static FILE *sdcard_file = nullptr;
+static uint32_t sdcard_blocks = 0;
+
+// Block traffic, for the replay report
+uint32_t sdio_blocks_read, sdio_blocks_written;
+
+bool SDIO_Init() {
+  if (sdcard_file) return true;
+  sdcard_file = fopen(sdcard_filename, "rb+");
+  if (!sdcard_file) return false;
+  fseek(sdcard_file, 0L, SEEK_END);
+  sdcard_blocks = ftell(sdcard_file) / 512;
+  return true;
+}
+
+// Like the STM32F1's SDIO DMA, transfers only work on whole words
+bool SDIO_ReadBlock(uint32_t block, uint8_t *dst) {
+  if (!sdcard_file || block >= sdcard_blocks || (uintptr_t(dst) & 3)) return false;
+  if (fseek(sdcard_file, long(block) * 512, SEEK_SET)) return false;
+  sdio_blocks_read++;
+  return fread(dst, 512, 1, sdcard_file) == 1;
+}
+
+bool SDIO_WriteBlock(uint32_t block, const uint8_t *src) {
+  if (!sdcard_file || block >= sdcard_blocks || (uintptr_t(src) & 3)) return false;
+  if (fseek(sdcard_file, long(block) * 512, SEEK_SET)) return false;
+  if (fwrite(src, 512, 1, sdcard_file) != 1) return false;
+  fflush(sdcard_file);
+  sdio_blocks_written++;
+  return true;
+}
+
+uint32_t SDIO_GetCardSize() { return sdcard_blocks; }
+
+#endif // SDIO_SUPPORT
+#endif // __PLAT_LINUX__
@@ -0,0 +1,116 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifdef __PLAT_LINUX__
+
+#include "../../inc/MarlinConfig.h"
+
+#include <fcntl.h>
+#include <stdlib.h>
+#include <termios.h>
+#include <unistd.h>
+#include <errno.h>
+
+HalSerial::HalSerial(const char *port_name, const bool e/*=false*/) : label(port_name) {
+  device_name[0] = '\0';
+  #if ENABLED(EMERGENCY_PARSER)
+    emergency_state = EmergencyParser::State::EP_RESET;
+    ep_enabled = e;
+  #else
+    UNUSED(e);
+  #endif
+}
+
+bool HalSerial::openPty(const char *link/*=nullptr*/) {
+  const int fd = posix_openpt(O_RDWR | O_NOCTTY);
+  if (fd < 0 || grantpt(fd) || unlockpt(fd)) return false;
+
+  // Raw 8-bit line with no echo, whatever the host does when it connects
+  termios tio;
+  if (!tcgetattr(fd, &tio)) { cfmakeraw(&tio); tcsetattr(fd, TCSANOW, &tio); }
+  fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+
+  strncpy(device_name, ptsname(fd), sizeof(device_name) - 1);
+  if (link) {
+    unlink(link);
+    if (!symlink(device_name, link)) strncpy(device_name, link, sizeof(device_name) - 1);
+  }
+  fd_in = fd_out = fd;
+  return true;
+}
+
+bool HalSerial::openStdio() {
+  fd_in = STDIN_FILENO;
+  fd_out = STDOUT_FILENO;
+  fcntl(fd_in, F_SETFL, fcntl(fd_in, F_GETFL) | O_NONBLOCK);
+  strcpy(device_name, "stdio");
+  return true;
+}
+
+bool HalSerial::openFile(const char *filename) {
+  const int fd = open(filename, O_RDONLY);
+  if (fd < 0) return false;
+  fd_in = fd;
+  fd_out = STDOUT_FILENO;
+  strncpy(device_name, filename, sizeof(device_name) - 1);
+  return true;
+}
+
+bool HalSerial::openLink(SerialLink *l) {
+  link = l;
+  strcpy(device_name, "link");
+  return true;
+}
+
+void HalSerial::poll(const bool overrun/*=false*/) {
+  if (fd_in < 0 && !link) return;
+  uint8_t buffer[64];
+  const size_t room = (overrun && !rx_ring.room()) ? sizeof(buffer) : _MIN(size_t(rx_ring.room()), sizeof(buffer));
+  if (!room) return;
+  // No host on the pty reads as EIO. Either way there is nothing to take.
+  const ssize_t count = link ? ssize_t(link->receive(buffer, room)) : ::read(fd_in, buffer, room);
+  for (ssize_t i = 0; i < count; i++) {
+    const uint8_t c = buffer[i];
+    #if ENABLED(EMERGENCY_PARSER)
+      if (emergency_parser_enabled()) emergency_parser.update(emergency_state, c);
+    #endif
+    rx_ring.store(c);
+  }
+  if (count > 0) bytes_received += count;
+  else if (count == 0 && !link) input_done = true;
+}
+
+void HalSerial::flushTX() {
+  uint8_t buffer[256];
+  size_t count = 0;
+  for (uint8_t c; transmit_buffer.read(&c);) buffer[count++] = c;
+  if (!count) return;
+  bytes_sent += count;
+  if (link) link->transmit(buffer, count);
+  // With no host attached the output is dropped, just like a USB CDC port
+  else if (fd_out >= 0) for (size_t done = 0; done < count;) {
+    const ssize_t n = ::write(fd_out, buffer + done, count - done);
+    if (n <= 0) break;
+    done += n;
+  }
+}
+
+#endif // __PLAT_LINUX__
@@ -0,0 +1,70 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifdef __PLAT_LINUX__
+
+#include "../../inc/MarlinConfig.h"
+
+/**
+ * Timers are compare-match counters on the virtual Clock (hardware/Timer.h).
+ * Their handlers run on the firmware thread whenever it reads the time,
+ * delays, re-enables interrupts or idles, so ISRs and main loop never race.
+ */
+
+HAL_STEP_TIMER_ISR();
+HAL_TEMP_TIMER_ISR();
+
+Timer timers[2];
+
+void HAL_timer_init() {
+  timers[STEP_TIMER_NUM].init(STEPPER_TIMER_RATE, HAL_TIMER_TYPE_MAX, TIMER0_IRQHandler);
+  timers[TEMP_TIMER_NUM].init(TEMP_TIMER_RATE, HAL_TIMER_TYPE_MAX, TIMER1_IRQHandler);
+}
+
+void HAL_timer_start(const uint8_t timer_num, const uint32_t frequency) {
+  timers[timer_num].start(frequency);
+}
+
+void HAL_timer_enable_interrupt(const uint8_t timer_num) {
+  timers[timer_num].enable();
+}
+
+void HAL_timer_disable_interrupt(const uint8_t timer_num) {
+  timers[timer_num].disable();
+}
+
+bool HAL_timer_interrupt_enabled(const uint8_t timer_num) {
+  return timers[timer_num].enabled();
+}
+
+void HAL_timer_set_compare(const uint8_t timer_num, const hal_timer_t compare) {
+  timers[timer_num].setCompare(compare);
+}
+
+hal_timer_t HAL_timer_get_compare(const uint8_t timer_num) {
+  return timers[timer_num].getCompare();
+}
+
+hal_timer_t HAL_timer_get_count(const uint8_t timer_num) {
+  return timers[timer_num].getCount();
+}
+
+#endif // __PLAT_LINUX__
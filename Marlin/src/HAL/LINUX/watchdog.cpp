@@ -0,0 +1,51 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifdef __PLAT_LINUX__
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(USE_WATCHDOG)
+
+#include "watchdog.h"
+
+/**
+ * The watchdog runs on the virtual clock. If the firmware stalls for longer
+ * than WDT_TIMEOUT the simulator reports it, which on hardware would be a reset.
+ */
+static uint64_t watchdog_last_feed = 0;
+static bool watchdog_enabled = false;
+
+void watchdog_init() {
+  watchdog_enabled = true;
+  watchdog_last_feed = Clock::peek();
+}
+
+void HAL_watchdog_refresh() {
+  if (!watchdog_enabled) return;
+  const uint64_t now = Clock::peek();
+  if (now - watchdog_last_feed > uint64_t(WDT_TIMEOUT) * 1000)
+    fprintf(stderr, "Watchdog: main loop stalled for %llu ms\n", (unsigned long long)((now - watchdog_last_feed) / 1000000));
+  watchdog_last_feed = now;
+}
+
+#endif // USE_WATCHDOG
+#endif // __PLAT_LINUX__
@@ -318,4 +318,9 @@
   }
 
 #endif // !USBD_USE_CDC_COMPOSITE
+
+uint32_t SDIO_GetCardSize() {
+  return (uint32_t)(hsd.SdCard.BlockNbr) * (hsd.SdCard.BlockSize / 512U);
+}
+
 #endif // SDIO_SUPPORT
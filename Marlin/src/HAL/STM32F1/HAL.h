@@ -113,6 +113,9 @@
   #elif WITHIN(LCD_SERIAL_PORT, 1, NUM_UARTS)
     #define LCD_SERIAL MSERIAL(LCD_SERIAL_PORT)
 		#define	HAS_LCD_SERIAL	1
+    #if LCD_SERIAL_PORT <= 4 && LCD_SERIAL_PORT != 3
+      #define LCD_SERIAL_TX_DMA 1 // UART5 has no DMA request line. USART3's is SPI1 RX's channel.
+    #endif
   #elif NUM_UARTS == 5
     #error "LCD_SERIAL_PORT must be -1 or from 1 to 5. Please update your configuration."
   #else
@@ -144,6 +147,15 @@ void HAL_init();
 #define HAL_IDLETASK 1
 void HAL_idletask();
 
+// The Cortex-M3 DWT cycle counter, for ISR_PROFILING
+#define HAL_CYCLE_COUNTER 1
+inline void HAL_cycle_counter_init() {
+  *(volatile uint32_t *)0xE000EDFC |= _BV(24);  // DEMCR.TRCENA: enable the DWT
+  *(volatile uint32_t *)0xE0001004 = 0;         // DWT_CYCCNT
+  *(volatile uint32_t *)0xE0001000 |= _BV(0);   // DWT_CTRL.CYCCNTENA
+}
+FORCE_INLINE uint32_t HAL_cycle_count() { return *(volatile uint32_t *)0xE0001004; }
+
 /**
  * TODO: review this to return 1 for pins that are not analog input
  */
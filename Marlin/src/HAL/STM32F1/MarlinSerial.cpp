@@ -27,7 +27,7 @@
 #include <libmaple/usart.h>
 
 // Copied from ~/.platformio/packages/framework-arduinoststm32-maple/STM32F1/system/libmaple/usart_private.h
-// Changed to handle Emergency Parser
+// Changed to handle Emergency Parser and to store into the line ring
 static inline __always_inline void my_usart_irq(ring_buffer *rb, ring_buffer *wb, usart_reg_map *regs, MarlinSerial &serial) {
  /* Handle RXNEIE and TXEIE interrupts.
   * RXNE signifies availability of a byte in DR.
@@ -44,14 +44,21 @@ static inline __always_inline void my_usart_irq(ring_buffer *rb, ring_buffer *wb
     }
     else {
       uint8_t c = (uint8)regs->DR;
-      #ifdef USART_SAFE_INSERT
-        // If the buffer is full and the user defines USART_SAFE_INSERT,
-        // ignore new bytes.
-        rb_safe_insert(rb, c);
-      #else
-        // By default, push bytes around in the ring buffer.
-        rb_push_insert(rb, c);
-      #endif
+      if (serial.rx_ring) {
+        // Full lines wait in the ring, so a byte that finds it full is dropped
+        // with the rest of its line rather than overwriting an older byte
+        serial.rx_ring->store(c);
+      }
+      else {
+        #ifdef USART_SAFE_INSERT
+          // If the buffer is full and the user defines USART_SAFE_INSERT,
+          // ignore new bytes.
+          rb_safe_insert(rb, c);
+        #else
+          // By default, push bytes around in the ring buffer.
+          rb_push_insert(rb, c);
+        #endif
+      }
       #if ENABLED(EMERGENCY_PARSER)
         if (serial.emergency_parser_enabled())
           emergency_parser.update(serial.emergency_state, c);
@@ -74,6 +81,48 @@ static inline __always_inline void my_usart_irq(ring_buffer *rb, ring_buffer *wb
   }
 }
 
+// TX DMA request lines (RM0008 tables 78 and 79). USART3 TX is on DMA1 channel 2,
+// which spiRead() takes for SPI1 RX, so USART3 keeps interrupt-driven writes.
+bool MarlinSerial::txDMAChannel(dma_dev *&dev, dma_channel &channel) {
+  const usart_dev * const udev = c_dev();
+       if (udev == USART1) { dev = DMA1; channel = DMA_CH4; }
+  else if (udev == USART2) { dev = DMA1; channel = DMA_CH7; }
+  #if EITHER(STM32_HIGH_DENSITY, STM32_XL_DENSITY)
+    else if (udev == UART4) { dev = DMA2; channel = DMA_CH5; }
+  #endif
+  else return false;
+  return true;
+}
+
+bool MarlinSerial::txDMABusy() {
+  if (!tx_dma_active) return false;
+  dma_dev *dev; dma_channel channel;
+  txDMAChannel(dev, channel);
+  if (!(dma_get_isr_bits(dev, channel) & DMA_ISR_TCIF1)) return true;
+  dma_disable(dev, channel);
+  dma_clear_isr_bits(dev, channel);
+  tx_dma_active = false;
+  return false;
+}
+
+bool MarlinSerial::writeDMA(const uint8_t *buffer, const uint16_t length) {
+  dma_dev *dev; dma_channel channel;
+  if (!length || !txDMAChannel(dev, channel) || txDMABusy()) return false;
+
+  usart_dev * const udev = c_dev();
+  while (!rb_is_empty(udev->wb)) { /* nada */ } // Let interrupt-driven writes finish first
+
+  dma_init(dev);
+  dma_setup_transfer(dev, channel, &udev->regs->DR, DMA_SIZE_8BITS, (volatile void*)buffer, DMA_SIZE_8BITS, DMA_MINC_MODE | DMA_FROM_MEM);
+  dma_set_priority(dev, channel, DMA_PRIORITY_LOW);
+  dma_set_num_transfers(dev, channel, length);
+  dma_clear_isr_bits(dev, channel);
+  udev->regs->CR3 |= USART_CR3_DMAT;
+  dma_enable(dev, channel);
+  tx_dma_active = true;
+  return true;
+}
+
 // Not every MarlinSerial port should handle emergency parsing.
 // It would not make sense to parse GCode from TMC responses, for example.
 constexpr bool serial_handles_emergency(int port) {
@@ -93,10 +142,34 @@ constexpr bool serial_handles_emergency(int port) {
   ;
 }
 
+/**
+ * Only the ports that take commands or talk to the LCD get a line ring
+ * (RX_BUFFER_SIZE bytes of SRAM each). The rest keep the libmaple ring.
+ *
+ * On the LCD port the ring carries the display's binary replies. Bytes pass
+ * through unchanged while there is room, but 0x0A, 0x0D and 0x18 count as
+ * line ends, and a ring that overflows drops bytes up to the next of them
+ * and stores LINE_LOST (0x18) in their place. The DWIN handshake skips
+ * bytes until a frame header, so it resynchronizes after such a loss.
+ */
+constexpr bool serial_has_ring(int port) { return serial_handles_emergency(port); }
+
+// The ring's storage is only instantiated for the ports that use it
+template<int N, bool = serial_has_ring(N)>
+struct SerialRing { static constexpr SerialLineRing* ring() { return nullptr; } };
+
+template<int N>
+struct SerialRing<N, true> {
+  static SerialLineRingBuffer<RX_BUFFER_SIZE> buffer;
+  static SerialLineRing* ring() { return &buffer; }
+};
+template<int N> SerialLineRingBuffer<RX_BUFFER_SIZE> SerialRing<N, true>::buffer;
+
 #define DEFINE_HWSERIAL_MARLIN(name, n)   \
   MarlinSerial name(USART##n,             \
             BOARD_USART##n##_TX_PIN,      \
             BOARD_USART##n##_RX_PIN,      \
+            SerialRing<n>::ring(),        \
             serial_handles_emergency(n)); \
   extern "C" void __irq_usart##n(void) {  \
     my_usart_irq(USART##n->rb, USART##n->wb, USART##n##_BASE, MSerial##n); \
@@ -106,6 +179,7 @@ constexpr bool serial_handles_emergency(int port) {
   MarlinSerial name(UART##n,                 \
           BOARD_USART##n##_TX_PIN,           \
           BOARD_USART##n##_RX_PIN,           \
+          SerialRing<n>::ring(),             \
           serial_handles_emergency(n));      \
   extern "C" void __irq_usart##n(void) {     \
     my_usart_irq(UART##n->rb, UART##n->wb, UART##n##_BASE, MSerial##n); \
@@ -23,9 +23,11 @@
 
 #include <HardwareSerial.h>
 #include <libmaple/usart.h>
+#include <libmaple/dma.h>
 #include <WString.h>
 
 #include "../../inc/MarlinConfigPre.h"
+#include "../shared/serial_line_ring.h"
 #if ENABLED(EMERGENCY_PARSER)
   #include "../../feature/e_parser.h"
 #endif
@@ -41,8 +43,8 @@ public:
     inline bool emergency_parser_enabled() { return ep_enabled; }
   #endif
 
-  MarlinSerial(struct usart_dev *usart_device, uint8 tx_pin, uint8 rx_pin, bool TERN_(EMERGENCY_PARSER, ep_capable)) :
-    HardwareSerial(usart_device, tx_pin, rx_pin)
+  MarlinSerial(struct usart_dev *usart_device, uint8 tx_pin, uint8 rx_pin, SerialLineRing * const ring, bool TERN_(EMERGENCY_PARSER, ep_capable)) :
+    HardwareSerial(usart_device, tx_pin, rx_pin), rx_ring(ring)
     #if ENABLED(EMERGENCY_PARSER)
       , ep_enabled(ep_capable)
       , emergency_state(EmergencyParser::State::EP_RESET)
@@ -60,6 +62,26 @@ public:
       nvic_irq_set_priority(c_dev()->irq_num, UART_IRQ_PRIO);
     }
   #endif
+
+  // The configured host, LCD and WiFi ports receive into a ring that frames
+  // lines as they arrive, in place of the libmaple ring, so the command queue
+  // can take them a line at a time. Other ports have no ring (nullptr).
+  int available() { return rx_ring ? rx_ring->available() : HardwareSerial::available(); }
+  int peek() { return rx_ring ? rx_ring->peek() : HardwareSerial::peek(); }
+  int read() { return rx_ring ? rx_ring->read() : HardwareSerial::read(); }
+  SerialLineRing* line_ring() { return rx_ring; }
+
+  SerialLineRing * const rx_ring;
+
+  // Send a buffer in the background by DMA. The buffer must stay unchanged
+  // until txDMABusy() returns false. Returns false if the port has no TX
+  // DMA channel or a transfer is still running.
+  bool writeDMA(const uint8_t *buffer, const uint16_t length);
+  bool txDMABusy();
+
+private:
+  bool tx_dma_active = false;
+  bool txDMAChannel(dma_dev *&dev, dma_channel &channel);
 };
 
 extern MarlinSerial MSerial1;
@@ -24,7 +24,7 @@
 /**
  * persistent_store_flash.cpp
  * HAL for stm32duino and compatible (STM32F1)
- * Implementation of EEPROM settings in SDCard
+ * Implementation of EEPROM settings in flash, as a journal (see shared/eeprom_journal.h)
  */
 
 #ifdef __STM32F1__
@@ -34,81 +34,65 @@
 #if ENABLED(FLASH_EEPROM_EMULATION)
 
 #include "../shared/eeprom_api.h"
+#include "../shared/eeprom_journal.h"
+#include "../../module/planner.h"
 
 #include <flash_stm32.h>
 #include <EEPROM.h>
 
-// Store settings in the last two pages
-#ifndef MARLIN_EEPROM_SIZE
-  #define MARLIN_EEPROM_SIZE ((EEPROM_PAGE_SIZE) * 2)
-#endif
-size_t PersistentStore::capacity() { return MARLIN_EEPROM_SIZE; }
+// The journal ends where the flash EEPROM area does. Pages beyond the
+// area's own come below EEPROM_START_ADDRESS and must be kept out of the
+// firmware's flash in the linker script.
+#define JOURNAL_BASE  ((EEPROM_START_ADDRESS) + (MARLIN_EEPROM_SIZE) - (EEPROM_JOURNAL_PAGES) * (EEPROM_PAGE_SIZE))
+// Older firmware kept a flat copy of the settings at the start of the area
+#define LEGACY_PAGE   ((EEPROM_JOURNAL_PAGES) - (MARLIN_EEPROM_SIZE) / (EEPROM_PAGE_SIZE))
 
-static uint8_t ram_eeprom[MARLIN_EEPROM_SIZE] __attribute__((aligned(4))) = {0};
-static bool eeprom_dirty = false;
+static_assert(EEPROM_JOURNAL_PAGES >= (MARLIN_EEPROM_SIZE) / (EEPROM_PAGE_SIZE), "EEPROM_JOURNAL_PAGES must cover the flash EEPROM area.");
 
-bool PersistentStore::access_start() {
-  const uint32_t* source = reinterpret_cast<const uint32_t*>(EEPROM_PAGE0_BASE);
-  uint32_t* destination = reinterpret_cast<uint32_t*>(ram_eeprom);
-
-  static_assert(0 == (MARLIN_EEPROM_SIZE) % 4, "MARLIN_EEPROM_SIZE is corrupted. (Must be a multiple of 4.)"); // Ensure copying as uint32_t is safe
-  constexpr size_t eeprom_size_u32 = (MARLIN_EEPROM_SIZE) / 4;
-
-  for (size_t i = 0; i < eeprom_size_u32; ++i, ++destination, ++source)
-    *destination = *source;
-
-  eeprom_dirty = false;
-  return true;
+const uint16_t* flash_journal_page(const uint8_t page) {
+  return reinterpret_cast<const uint16_t*>(JOURNAL_BASE + page * (EEPROM_PAGE_SIZE));
 }
 
-bool PersistentStore::access_finish() {
-
-  if (eeprom_dirty) {
-    FLASH_Status status;
-
-    // Instead of erasing all (both) pages, maybe in the loop we check what page we are in, and if the
-    // data has changed in that page. We then erase the first time we "detect" a change. In theory, if
-    // nothing changed in a page, we wouldn't need to erase/write it.
-    // Or, instead of checking at this point, turn eeprom_dirty into an array of bool the size of number
-    // of pages. Inside write_data, we set the flag to true at that time if something in that
-    // page changes...either way, something to look at later.
-
-		//TERN_(USE_WATCHDOG, HAL_watchdog_refresh());
-		cli(); // Stop interrupts
-    
-    FLASH_Unlock();
-
-    #define ACCESS_FINISHED(TF) { FLASH_Lock(); eeprom_dirty = false; sei(); return TF; }
-
-    status = FLASH_ErasePage(EEPROM_PAGE0_BASE);
-    if (status != FLASH_COMPLETE) ACCESS_FINISHED(true);
-    status = FLASH_ErasePage(EEPROM_PAGE1_BASE);
-    if (status != FLASH_COMPLETE) ACCESS_FINISHED(true);
+// The CPU stalls while the flash is busy but interrupts stay enabled, so
+// the stepper and temperature ISRs are only held up by one operation.
+bool flash_journal_erase(const uint8_t page) {
+  FLASH_Unlock();
+  const bool ok = FLASH_ErasePage(JOURNAL_BASE + page * (EEPROM_PAGE_SIZE)) == FLASH_COMPLETE;
+  FLASH_Lock();
+  return ok;
+}
 
-    const uint16_t *source = reinterpret_cast<const uint16_t*>(ram_eeprom);
-    for (size_t i = 0; i < MARLIN_EEPROM_SIZE; i += 2, ++source) {
-      if (FLASH_ProgramHalfWord(EEPROM_PAGE0_BASE + i, *source) != FLASH_COMPLETE)
-        ACCESS_FINISHED(false);
-    }
+bool flash_journal_program(const uint8_t page, const uint16_t index, const uint16_t value) {
+  FLASH_Unlock();
+  const bool ok = FLASH_ProgramHalfWord(JOURNAL_BASE + page * (EEPROM_PAGE_SIZE) + index * 2, value) == FLASH_COMPLETE;
+  FLASH_Lock();
+  return ok;
+}
 
-    ACCESS_FINISHED(true);
-  }
+size_t PersistentStore::capacity() { return FlashJournal::capacity; }
 
-	sei();
+bool PersistentStore::access_start() {
+  if (!flash_journal.mounted() && !flash_journal.mount())
+    flash_journal.import(reinterpret_cast<const uint8_t*>(EEPROM_START_ADDRESS), LEGACY_PAGE);
   return true;
 }
 
+// Only the changes are written, without erasing unless the journal is full.
+// An erase would stall the steppers, so while they run that waits for idle.
+bool PersistentStore::access_finish() { return flash_journal.commit(!planner.has_blocks_queued()); }
+
 bool PersistentStore::write_data(int &pos, const uint8_t *value, size_t size, uint16_t *crc) {
-  for (size_t i = 0; i < size; ++i) ram_eeprom[pos + i] = value[i];
-  eeprom_dirty = true;
+  if (pos + size > FlashJournal::capacity) return true;
+  flash_journal.write(pos, value, size);
   crc16(crc, value, size);
   pos += size;
   return false;  // return true for any error
 }
 
 bool PersistentStore::read_data(int &pos, uint8_t* value, const size_t size, uint16_t *crc, const bool writing/*=true*/) {
-  const uint8_t * const buff = writing ? &value[0] : &ram_eeprom[pos];
-  if (writing) for (size_t i = 0; i < size; i++) value[i] = ram_eeprom[pos + i];
+  if (pos + size > FlashJournal::capacity) return true;
+  const uint8_t * const buff = writing ? &value[0] : &FlashJournal::image[pos];
+  if (writing) for (size_t i = 0; i < size; i++) value[i] = FlashJournal::image[pos + i];
   crc16(crc, buff, size);
   pos += size;
   return false;  // return true for any error
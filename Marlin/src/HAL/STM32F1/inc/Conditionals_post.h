@@ -28,6 +28,11 @@
   #define USE_SHARED_EEPROM 1
 #endif
 
+// Flash EEPROM is kept as a journal (see shared/eeprom_journal.h)
+#if ENABLED(FLASH_EEPROM_EMULATION)
+  #define FLASH_EEPROM_JOURNAL 1
+#endif
+
 // Allow SDSUPPORT to be disabled
 #if DISABLED(SDSUPPORT)
   #undef SDIO_SUPPORT
@@ -48,6 +48,11 @@
   #error "SERIAL_STATS_DROPPED_RX is not supported on this platform."
 #endif
 
+// Serial ports receive into rings that hold whole lines (HAL/shared/serial_line_ring.h)
+#if RX_BUFFER_SIZE <= MAX_CMD_SIZE
+  #error "RX_BUFFER_SIZE must be larger than MAX_CMD_SIZE."
+#endif
+
 #if ENABLED(NEOPIXEL_LED)
   #error "NEOPIXEL_LED (Adafruit NeoPixel) is not supported for HAL/STM32F1. Comment out this line to proceed at your own risk!"
 #endif
@@ -32,6 +32,21 @@
 
 SDIO_CardInfoTypeDef SdCard;
 
+#if SDIO_READ_AHEAD_BLOCKS > 1
+
+  /**
+   * Read-ahead for sequential access
+   *
+   * When a block follows the last one read, the next SDIO_READ_AHEAD_BLOCKS
+   * blocks are fetched with a single CMD18 DMA transfer and later reads are
+   * served from RAM. Reads elsewhere (FAT, directories) leave the buffer alone
+   * and any write to a buffered block drops it.
+   */
+  static uint32_t ahead_buffer[SDIO_READ_AHEAD_BLOCKS][128];
+  static uint32_t ahead_first, ahead_count, last_block;
+
+#endif
+
 bool SDIO_Init() {
   uint32_t count = 0U;
   SdCard.CardType = SdCard.CardVersion = SdCard.Class = SdCard.RelCardAdd = SdCard.BlockNbr = SdCard.BlockSize = SdCard.LogBlockNbr = SdCard.LogBlockSize = 0;
@@ -39,6 +54,10 @@ bool SDIO_Init() {
   sdio_begin();
   sdio_set_dbus_width(SDIO_CLKCR_WIDBUS_1BIT);
 
+  #if SDIO_READ_AHEAD_BLOCKS > 1
+    ahead_count = 0;
+  #endif
+
   dma_init(SDIO_DMA_DEV);
   dma_disable(SDIO_DMA_DEV, SDIO_DMA_CHANNEL);
   dma_set_priority(SDIO_DMA_DEV, SDIO_DMA_CHANNEL, DMA_PRIORITY_MEDIUM);
@@ -81,21 +100,21 @@ bool SDIO_Init() {
   return true;
 }
 
-bool SDIO_ReadBlock_DMA(uint32_t blockAddress, uint8_t *data) {
+bool SDIO_ReadBlock_DMA(uint32_t blockAddress, uint8_t *data, const uint16_t count=1) {
   if (SDIO_GetCardState() != SDIO_CARD_TRANSFER) return false;
-  if (blockAddress >= SdCard.LogBlockNbr) return false;
+  if (blockAddress + count > SdCard.LogBlockNbr) return false;
   if ((0x03 & (uint32_t)data)) return false; // misaligned data
 
   if (SdCard.CardType != CARD_SDHC_SDXC) { blockAddress *= 512U; }
 
   dma_setup_transfer(SDIO_DMA_DEV, SDIO_DMA_CHANNEL, &SDIO->FIFO, DMA_SIZE_32BITS, data, DMA_SIZE_32BITS, DMA_MINC_MODE);
-  dma_set_num_transfers(SDIO_DMA_DEV, SDIO_DMA_CHANNEL, 128);
+  dma_set_num_transfers(SDIO_DMA_DEV, SDIO_DMA_CHANNEL, 128U * count);
   dma_clear_isr_bits(SDIO_DMA_DEV, SDIO_DMA_CHANNEL);
   dma_enable(SDIO_DMA_DEV, SDIO_DMA_CHANNEL);
 
-  sdio_setup_transfer(SDIO_DATA_TIMEOUT * (F_CPU / 1000U), 512, SDIO_BLOCKSIZE_512 | SDIO_DCTRL_DMAEN | SDIO_DCTRL_DTEN | SDIO_DIR_RX);
+  sdio_setup_transfer(SDIO_DATA_TIMEOUT * (F_CPU / 1000U), 512U * count, SDIO_BLOCKSIZE_512 | SDIO_DCTRL_DMAEN | SDIO_DCTRL_DTEN | SDIO_DIR_RX);
 
-  if (!SDIO_CmdReadSingleBlock(blockAddress)) {
+  if (!(count > 1 ? SDIO_CmdReadMultiBlock(blockAddress) : SDIO_CmdReadSingleBlock(blockAddress))) {
     SDIO_CLEAR_FLAG(SDIO_ICR_CMD_FLAGS);
     dma_disable(SDIO_DMA_DEV, SDIO_DMA_CHANNEL);
     return false;
@@ -103,6 +122,13 @@ bool SDIO_ReadBlock_DMA(uint32_t blockAddress, uint8_t *data) {
 
   while (!SDIO_GET_FLAG(SDIO_STA_DATAEND | SDIO_STA_TRX_ERROR_FLAGS)) { /* wait */ }
 
+  // A multi-block read runs until the card is told to stop
+  if (count > 1 && !SDIO_CmdStopTransfer()) {
+    SDIO_CLEAR_FLAG(SDIO_ICR_CMD_FLAGS | SDIO_ICR_DATA_FLAGS);
+    dma_disable(SDIO_DMA_DEV, SDIO_DMA_CHANNEL);
+    return false;
+  }
+
   //If there were SDIO errors, do not wait DMA.
   if (SDIO->STA & SDIO_STA_TRX_ERROR_FLAGS) {
     SDIO_CLEAR_FLAG(SDIO_ICR_CMD_FLAGS | SDIO_ICR_DATA_FLAGS);
@@ -136,11 +162,33 @@ bool SDIO_ReadBlock_DMA(uint32_t blockAddress, uint8_t *data) {
 }
 
 bool SDIO_ReadBlock(uint32_t blockAddress, uint8_t *data) {
+  #if SDIO_READ_AHEAD_BLOCKS > 1
+    const bool sequential = blockAddress == last_block + 1;
+    last_block = blockAddress;
+
+    if (sequential && blockAddress - ahead_first >= ahead_count && blockAddress + SDIO_READ_AHEAD_BLOCKS <= SdCard.LogBlockNbr) {
+      ahead_count = 0;
+      for (uint32_t retries = SDIO_READ_RETRIES; retries--;)
+        if (SDIO_ReadBlock_DMA(blockAddress, (uint8_t*)ahead_buffer, SDIO_READ_AHEAD_BLOCKS)) {
+          ahead_first = blockAddress;
+          ahead_count = SDIO_READ_AHEAD_BLOCKS;
+          break;
+        }
+    }
+
+    if (blockAddress - ahead_first < ahead_count) {
+      memcpy(data, ahead_buffer[blockAddress - ahead_first], 512);
+      return true;
+    }
+  #endif
+
   uint32_t retries = SDIO_READ_RETRIES;
   while (retries--) if (SDIO_ReadBlock_DMA(blockAddress, data)) return true;
   return false;
 }
 
+uint32_t SDIO_GetCardSize() { return SdCard.LogBlockNbr; }
+
 uint32_t millis();
 
 bool SDIO_WriteBlock(uint32_t blockAddress, const uint8_t *data) {
@@ -148,6 +196,10 @@ bool SDIO_WriteBlock(uint32_t blockAddress, const uint8_t *data) {
   if (blockAddress >= SdCard.LogBlockNbr) return false;
   if ((0x03 & (uint32_t)data)) return false; // misaligned data
 
+  #if SDIO_READ_AHEAD_BLOCKS > 1
+    if (blockAddress - ahead_first < ahead_count) ahead_count = 0;
+  #endif
+
   if (SdCard.CardType != CARD_SDHC_SDXC) { blockAddress *= 512U; }
 
   dma_setup_transfer(SDIO_DMA_DEV, SDIO_DMA_CHANNEL, &SDIO->FIFO, DMA_SIZE_32BITS, (volatile void *) data, DMA_SIZE_32BITS, DMA_MINC_MODE | DMA_FROM_MEM);
@@ -199,7 +251,9 @@ bool SDIO_CmdSelDesel(uint32_t address) { SDIO_SendCommand(CMD7_SEL_DESEL_CARD,
 bool SDIO_CmdOperCond() { SDIO_SendCommand(CMD8_HS_SEND_EXT_CSD, SDMMC_CHECK_PATTERN); return SDIO_GetCmdResp7(); }
 bool SDIO_CmdSendCSD(uint32_t argument) { SDIO_SendCommand(CMD9_SEND_CSD, argument); return SDIO_GetCmdResp2(); }
 bool SDIO_CmdSendStatus(uint32_t argument) { SDIO_SendCommand(CMD13_SEND_STATUS, argument); return SDIO_GetCmdResp1(SDMMC_CMD_SEND_STATUS); }
+bool SDIO_CmdStopTransfer() { SDIO_SendCommand(CMD12_STOP_TRANSMISSION, 0); return SDIO_GetCmdResp1(SDMMC_CMD_STOP_TRANSMISSION); }
 bool SDIO_CmdReadSingleBlock(uint32_t address) { SDIO_SendCommand(CMD17_READ_SINGLE_BLOCK, address); return SDIO_GetCmdResp1(SDMMC_CMD_READ_SINGLE_BLOCK); }
+bool SDIO_CmdReadMultiBlock(uint32_t address) { SDIO_SendCommand(CMD18_READ_MULT_BLOCK, address); return SDIO_GetCmdResp1(SDMMC_CMD_READ_MULT_BLOCK); }
 bool SDIO_CmdWriteSingleBlock(uint32_t address) { SDIO_SendCommand(CMD24_WRITE_SINGLE_BLOCK, address); return SDIO_GetCmdResp1(SDMMC_CMD_WRITE_SINGLE_BLOCK); }
 bool SDIO_CmdAppCommand(uint32_t rsa) { SDIO_SendCommand(CMD55_APP_CMD, rsa); return SDIO_GetCmdResp1(SDMMC_CMD_APP_CMD); }
 
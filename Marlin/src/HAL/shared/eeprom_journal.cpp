@@ -0,0 +1,379 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * eeprom_journal.cpp
+ * Journaling EEPROM emulation for NOR flash, shared by the HALs that use it
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(FLASH_EEPROM_JOURNAL)
+
+#include "eeprom_journal.h"
+#include "../../libs/crc16.h"
+#include <string.h>
+
+FlashJournal flash_journal;
+
+#define PAGE_WORDS      ((EEPROM_PAGE_SIZE) / 2)
+#define HEADER_WORDS    3           // magic, sequence, ~sequence
+#define RECORD_WORDS    3           // address, length and check around the data
+#define MAGIC_LOG       0x4A4C      // 'JL' Page of records
+#define MAGIC_SNAPSHOT  0x4A53      // 'JS' Page that starts a snapshot of the image
+#define END_ADDRESS     0xFFFE      // Record address that ends a snapshot
+#define COMMIT_ADDRESS  0xFFFC      // Record address that ends a save
+#define DISCARD_ADDRESS 0xFFFA      // Record address that drops the records of a save cut short
+#define ERASED          0xFFFF
+#define SKIP_GAP        16          // Runs of erased bytes left out of a snapshot. Saves more than the extra record costs.
+#define SNAPSHOT_PAGES  ((EEPROM_JOURNAL_PAGES) / 2)
+
+static_assert(WITHIN(EEPROM_JOURNAL_PAGES, 2, 16), "EEPROM_JOURNAL_PAGES must be from 2 to 16.");
+static_assert(EEPROM_JOURNAL_CAPACITY > 0 && EEPROM_JOURNAL_CAPACITY < DISCARD_ADDRESS, "EEPROM_PAGE_SIZE is too small or too large for the flash EEPROM journal.");
+
+uint8_t FlashJournal::image[capacity] __attribute__((aligned(4)));
+FlashJournal::stats_t FlashJournal::stats; // = { 0 }
+bool FlashJournal::is_mounted, FlashJournal::formatted, FlashJournal::torn;
+bool FlashJournal::is_pending, FlashJournal::may_erase = true;
+uint8_t FlashJournal::head, FlashJournal::base;
+uint16_t FlashJournal::head_pos, FlashJournal::head_seq, FlashJournal::erased;
+uint8_t FlashJournal::dirty[];
+
+FORCE_INLINE static uint8_t next_page(const uint8_t page) { return (page + 1) % (EEPROM_JOURNAL_PAGES); }
+FORCE_INLINE static uint8_t prev_page(const uint8_t page) { return (page + (EEPROM_JOURNAL_PAGES) - 1) % (EEPROM_JOURNAL_PAGES); }
+
+static bool valid_header(const uint16_t *w) {
+  return (w[0] == MAGIC_LOG || w[0] == MAGIC_SNAPSHOT) && w[1] == uint16_t(~w[2]);
+}
+
+static bool page_erased(const uint16_t *w) {
+  for (uint16_t i = 0; i < PAGE_WORDS; i++) if (w[i] != ERASED) return false;
+  return true;
+}
+
+// The check never reads as erased, so a record cut short has none
+FORCE_INLINE static uint16_t seal(const uint16_t crc) { return crc == ERASED ? 0 : crc; }
+
+// Length in half-words of the record at w[pos], or 0 at the end of the
+// records or a record that was never finished
+static uint16_t record_words(const uint16_t *w, const uint16_t pos) {
+  if (pos + RECORD_WORDS > PAGE_WORDS) return 0;
+  const uint16_t addr = w[pos], len = w[pos + 1];
+  if (addr == ERASED || (len & 1)) return 0;
+  const uint16_t words = RECORD_WORDS + len / 2;
+  if (pos + words > PAGE_WORDS) return 0;
+  if (addr >= DISCARD_ADDRESS ? len != 0 : ((addr & 1) || uint32_t(addr) + len > FlashJournal::capacity)) return 0;
+  uint16_t crc = 0;
+  crc16(&crc, &w[pos], (words - 1) * 2);
+  return w[pos + words - 1] == seal(crc) ? words : 0;
+}
+
+static bool program_record(const uint8_t page, uint16_t pos, const uint16_t addr, const uint8_t *data, const uint16_t len) {
+  uint16_t crc = 0;
+  crc16(&crc, &addr, 2);
+  crc16(&crc, &len, 2);
+  if (len) crc16(&crc, data, len);
+
+  // The check goes last, making the record valid
+  bool ok = flash_journal_program(page, pos++, addr) && flash_journal_program(page, pos++, len);
+  for (uint16_t i = 0; ok && i < len; i += 2)
+    ok = flash_journal_program(page, pos++, data[i] | (data[i + 1] << 8));
+  ok = ok && flash_journal_program(page, pos, seal(crc));
+  FlashJournal::stats.halfwords += RECORD_WORDS + len / 2;
+  return ok;
+}
+
+// Copy the records from one position to another, across pages, into the image
+static void replay(uint8_t page, uint16_t pos, const uint8_t to, const uint16_t to_pos) {
+  for (;; page = next_page(page), pos = HEADER_WORDS) {
+    const uint16_t *w = flash_journal_page(page);
+    while (page != to || pos < to_pos) {
+      const uint16_t words = record_words(w, pos);
+      if (!words) break;
+      memcpy(&FlashJournal::image[w[pos]], &w[pos + 2], w[pos + 1]);
+      pos += words;
+    }
+    if (page == to) return;
+  }
+}
+
+uint8_t FlashJournal::live_pages() {
+  return formatted ? (head + (EEPROM_JOURNAL_PAGES) - base) % (EEPROM_JOURNAL_PAGES) + 1 : 0;
+}
+
+bool FlashJournal::mount() {
+  is_mounted = true;
+  formatted = false;
+  torn = is_pending = false;
+  memset(image, 0xFF, sizeof(image));
+  memset(dirty, 0, sizeof(dirty));
+  erased = 0;
+
+  // The newest page ends the journal
+  int8_t newest = -1;
+  LOOP_L_N(p, EEPROM_JOURNAL_PAGES) {
+    const uint16_t *w = flash_journal_page(p);
+    if (valid_header(w)) {
+      if (newest < 0 || int16_t(w[1] - flash_journal_page(newest)[1]) > 0) newest = p;
+    }
+    else if (page_erased(w))
+      SBI(erased, p);
+  }
+
+  // Without a journal new pages start from page 0
+  head = (EEPROM_JOURNAL_PAGES) - 1;
+  head_pos = PAGE_WORDS;
+  head_seq = newest < 0 ? 0 : flash_journal_page(newest)[1];
+  if (newest < 0) return false;
+
+  // Walk back through consecutive pages to the newest complete snapshot.
+  // A snapshot with no end marker was cut short, so the journal ends before it.
+  const uint16_t newest_seq = head_seq;
+  uint8_t p = newest, end = newest;
+  for (uint16_t n = 0; n < EEPROM_JOURNAL_PAGES; n++, p = prev_page(p)) {
+    const uint16_t *w = flash_journal_page(p);
+    if (!valid_header(w) || w[1] != uint16_t(newest_seq - n)) break;
+    if (w[0] != MAGIC_SNAPSHOT) continue;
+
+    // Replay from the snapshot to the end, applying the records before each marker
+    bool complete = false;
+    uint8_t from = p;
+    uint16_t from_pos = HEADER_WORDS;
+    memset(image, 0xFF, sizeof(image));
+    torn = false;
+    for (uint8_t r = p;; r = next_page(r)) {
+      const uint16_t *rw = flash_journal_page(r);
+      uint16_t pos = HEADER_WORDS;
+      while (const uint16_t words = record_words(rw, pos)) {
+        const uint16_t addr = rw[pos];
+        if (addr < DISCARD_ADDRESS)
+          torn = true;
+        else {
+          if (addr == END_ADDRESS) complete = true;
+          if (complete && addr != DISCARD_ADDRESS) replay(from, from_pos, r, pos);
+          from = r;
+          from_pos = pos + words;
+          torn = false;
+        }
+        pos += words;
+      }
+      if (r == end) {
+        // Don't append after a record that was never finished
+        head_pos = (pos < PAGE_WORDS && rw[pos] == ERASED) ? pos : PAGE_WORDS;
+        break;
+      }
+    }
+
+    if (complete) {
+      // The pages of a torn snapshot would chain onto the page that reuses the
+      // first of them. open_page() erases that one, the rest go now.
+      if (end != newest) for (uint8_t g = next_page(next_page(end)); g != next_page(newest); g = next_page(g)) {
+        if (flash_journal_erase(g)) {
+          SBI(erased, g);
+          stats.erases++;
+        }
+      }
+      head = end;
+      head_seq = flash_journal_page(end)[1];
+      base = p;
+      formatted = true;
+      return true;
+    }
+
+    end = prev_page(p);
+    torn = false;
+  }
+
+  memset(image, 0xFF, sizeof(image));
+  head_pos = PAGE_WORDS;
+  return false;
+}
+
+void FlashJournal::import(const uint8_t *raw, const uint8_t after_page) {
+  is_mounted = true;
+  formatted = false;
+  torn = is_pending = false;
+  memcpy(image, raw, sizeof(image));
+  memset(dirty, 0xFF, sizeof(dirty));
+  head = after_page;
+  head_pos = PAGE_WORDS;
+}
+
+void FlashJournal::write(const int pos, const uint8_t *value, const size_t size) {
+  for (size_t i = 0; i < size; i++) {
+    const uint16_t a = pos + i;
+    if (image[a] != value[i]) {
+      image[a] = value[i];
+      SBI(dirty[a / 64], (a / 8) & 7);
+    }
+  }
+}
+
+// Start the next page. Only a snapshot may use the pages kept for one.
+bool FlashJournal::open_page(const bool snapshot, const bool reserve) {
+  const uint8_t p = next_page(head);
+  if (formatted && (p == base || (!reserve && live_pages() >= (EEPROM_JOURNAL_PAGES) - SNAPSHOT_PAGES))) return false;
+
+  // Normally service() erased it already
+  if (!TEST(erased, p)) {
+    if (!may_erase || !flash_journal_erase(p)) return false;
+    stats.erases++;
+    stats.foreground_erases++;
+  }
+  CBI(erased, p);
+
+  const uint16_t seq = head_seq + 1;
+  head = p;
+  head_seq = seq;
+  head_pos = HEADER_WORDS;
+  stats.halfwords += HEADER_WORDS;
+  return flash_journal_program(p, 0, snapshot ? MAGIC_SNAPSHOT : MAGIC_LOG)
+      && flash_journal_program(p, 1, seq)
+      && flash_journal_program(p, 2, uint16_t(~seq));
+}
+
+// Append image bytes as one or more records, starting pages as needed
+bool FlashJournal::append(uint16_t addr, const uint8_t *data, uint16_t len, const bool reserve) {
+  while (len) {
+    const uint16_t room = PAGE_WORDS - head_pos;
+    if (room <= RECORD_WORDS) {
+      if (!open_page(false, reserve)) return false;
+      continue;
+    }
+    const uint16_t n = _MIN(len, (room - RECORD_WORDS) * 2);
+    if (!program_record(head, head_pos, addr, data, n)) return false;
+    head_pos += RECORD_WORDS + n / 2;
+    addr += n;
+    data += n;
+    len -= n;
+  }
+  return true;
+}
+
+// Write an empty record that ends the records before it
+bool FlashJournal::mark(const uint16_t addr, const bool reserve) {
+  if (PAGE_WORDS - head_pos < RECORD_WORDS && !open_page(false, reserve)) return false;
+  if (!program_record(head, head_pos, addr, nullptr, 0)) return false;
+  head_pos += RECORD_WORDS;
+  return true;
+}
+
+// Write the whole image to fresh pages. Once the end marker is down the
+// pages before it are garbage.
+bool FlashJournal::compact() {
+  const uint8_t first = next_page(head);
+
+  // Without erasing, don't start a snapshot there may not be room to end
+  if (!may_erase) {
+    uint8_t p = head;
+    LOOP_L_N(n, SNAPSHOT_PAGES) if (!TEST(erased, p = next_page(p))) return false;
+  }
+
+  if (!open_page(true, true)) return false;
+
+  for (uint16_t pos = 0; pos < capacity;) {
+    #define ERASED_AT(I) (image[I] == 0xFF && image[(I) + 1] == 0xFF)
+    while (pos < capacity && ERASED_AT(pos)) pos += 2;
+    if (pos >= capacity) break;
+    uint16_t end = pos + 2;
+    for (uint16_t i = end, gap = 0; i < capacity && gap < SKIP_GAP; i += 2) {
+      if (ERASED_AT(i)) gap += 2; else { gap = 0; end = i + 2; }
+    }
+    if (!append(pos, &image[pos], end - pos, true)) return false;
+    pos = end;
+  }
+
+  if (!mark(END_ADDRESS, true)) return false;
+
+  base = first;
+  formatted = true;
+  torn = false;
+  memset(dirty, 0, sizeof(dirty));
+  stats.compactions++;
+  return true;
+}
+
+bool FlashJournal::commit(const bool can_erase/*=true*/) {
+  bool changed = false;
+  for (uint16_t i = 0; i < sizeof(dirty); i++) if (dirty[i]) { changed = true; break; }
+  if (!changed) return true;
+
+  may_erase = can_erase;
+  const bool ok = save();
+  may_erase = true;
+  if (ok) {
+    stats.saves++;
+    is_pending = false;
+    return true;
+  }
+  if (can_erase) return false;
+
+  // It needs a page erased, which would stall the steppers. Keep the changes
+  // for service(), and drop any records already written when it saves them.
+  if (!is_pending) stats.deferred++;
+  is_pending = torn = true;
+  return true;
+}
+
+bool FlashJournal::save() {
+  if (!formatted) return compact();
+
+  // Drop the records of a save cut short before the last boot.
+  // No room left without touching the snapshot reserve? A snapshot holds everything.
+  if (torn && !mark(DISCARD_ADDRESS, false)) return compact();
+  torn = false;
+
+  // Append each run of changed 8-byte chunks, then the marker that makes them count
+  constexpr uint16_t chunks = capacity / 8;
+  for (uint16_t c = 0; c < chunks; c++) {
+    if (!TEST(dirty[c / 8], c & 7)) continue;
+    const uint16_t start = c;
+    while (c + 1 < chunks && TEST(dirty[(c + 1) / 8], (c + 1) & 7)) c++;
+    if (!append(start * 8, &image[start * 8], (c + 1 - start) * 8, false)) return compact();
+  }
+  if (!mark(COMMIT_ADDRESS, false)) return compact();
+  memset(dirty, 0, sizeof(dirty));
+  return true;
+}
+
+void FlashJournal::service(const bool can_erase) {
+  if (!can_erase) return;
+
+  // Write a save held back while the printer was moving
+  if (is_pending) { commit(); return; }
+
+  if (!formatted) return;
+
+  // Erase one garbage page per call
+  const uint8_t live = live_pages();
+  uint8_t p = next_page(head);
+  for (uint8_t n = live; n < EEPROM_JOURNAL_PAGES; n++, p = next_page(p)) {
+    if (TEST(erased, p)) continue;
+    if (flash_journal_erase(p)) {
+      SBI(erased, p);
+      stats.erases++;
+    }
+    return;
+  }
+
+  // All spare pages are erased. If the next save could fill the log, compact now.
+  if (live >= (EEPROM_JOURNAL_PAGES) - SNAPSHOT_PAGES && PAGE_WORDS - head_pos < PAGE_WORDS / 4) compact();
+}
+
+#endif // FLASH_EEPROM_JOURNAL
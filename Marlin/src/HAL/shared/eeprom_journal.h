@@ -0,0 +1,128 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * Journaling EEPROM emulation for NOR flash
+ *
+ * The settings live in a RAM image. Saving appends only the parts of the
+ * image that changed, as checked records, to the page being filled. Pages are
+ * used in turn around a ring, so every page wears at the same rate.
+ *
+ * When the ring fills up the whole image is written to fresh pages as a
+ * snapshot, after which the pages before it are garbage. service() erases
+ * garbage and compacts a nearly full page from the idle loop, while nothing
+ * is moving, so a save during a print normally just programs half-words.
+ * A save during a print that would need a page erased is held in RAM and
+ * written by service() once the printer stops moving.
+ *
+ * Each page starts with a header:  magic, sequence, ~sequence
+ * followed by records:             address, length, data..., check
+ *
+ * A record's check is the CRC16 of everything before it and is written last,
+ * so a record cut short by a power loss is never read. Each save ends with a
+ * commit marker and each snapshot with an end marker, both empty records, and
+ * only the records before a marker are replayed. A save cut short by a power
+ * loss is ignored at the next boot, and the next save drops its records with
+ * a discard marker. A snapshot with no end marker is garbage: the journal is
+ * replayed from the snapshot before it, and the torn pages are reused.
+ */
+
+#include "../../inc/MarlinConfigPre.h"
+
+#ifndef EEPROM_PAGE_SIZE
+  #define EEPROM_PAGE_SIZE 0x800 // 2KB
+#endif
+#ifndef MARLIN_EEPROM_SIZE
+  #define MARLIN_EEPROM_SIZE ((EEPROM_PAGE_SIZE) * 2)
+#endif
+// Pages in the ring. By default the area reserved for flash EEPROM.
+#ifndef EEPROM_JOURNAL_PAGES
+  #define EEPROM_JOURNAL_PAGES ((MARLIN_EEPROM_SIZE) / (EEPROM_PAGE_SIZE))
+#endif
+
+// Half the ring must hold a snapshot of the whole image: one record per page
+// plus the page header, and the end marker.
+#define EEPROM_JOURNAL_CAPACITY ((((EEPROM_JOURNAL_PAGES) / 2) * ((EEPROM_PAGE_SIZE) - 12) - 6) & ~7)
+
+//
+// Flash access, provided by the HAL. Pages are numbered from 0 within the ring.
+//
+const uint16_t* flash_journal_page(const uint8_t page);                                // Memory-mapped page contents
+bool flash_journal_erase(const uint8_t page);                                          // Erase one page
+bool flash_journal_program(const uint8_t page, const uint16_t index, const uint16_t value);  // Program one erased half-word
+
+class FlashJournal {
+public:
+  static constexpr size_t capacity = EEPROM_JOURNAL_CAPACITY;
+
+  // The settings as the firmware sees them
+  static uint8_t image[capacity];
+
+  typedef struct {
+    uint32_t saves,             // Commits that wrote anything
+             halfwords,         // Half-words programmed
+             erases,            // Pages erased
+             foreground_erases, // ...of them, while saving
+             compactions,       // Snapshots written
+             deferred;          // Saves held until nothing was moving, as they needed an erase
+  } stats_t;
+  static stats_t stats;
+
+  // Replay the journal into the image. False if the pages hold no journal.
+  static bool mount();
+  static bool mounted() { return is_mounted; }
+
+  // Start a new journal from a raw image, such as a flat copy of the settings
+  // written by older firmware. It is written out, after the given page, by
+  // the first commit. Until then the pages are left alone.
+  static void import(const uint8_t *raw, const uint8_t after_page);
+
+  // Update the image, noting which parts changed
+  static void write(const int pos, const uint8_t *value, const size_t size);
+
+  // Append everything changed since the last commit. False on a flash error.
+  // Without can_erase a save that needs a page erased is left to service().
+  static bool commit(const bool can_erase=true);
+
+  // Changes are held until nothing is moving
+  static bool pending() { return is_pending; }
+
+  // Erase garbage, write held changes and compact. Call from the idle loop.
+  // Erasing stalls the CPU for tens of milliseconds, so only do it when
+  // nothing is moving.
+  static void service(const bool can_erase);
+
+private:
+  static bool is_mounted, formatted, torn;    // torn: records after the last marker, left by a save cut short
+  static bool is_pending, may_erase;          // A save is held for an erase, and whether this one may erase
+  static uint8_t head, base;                  // Page being filled, and the page the live snapshot starts on
+  static uint16_t head_pos, head_seq;         // Next free half-word in the head page, and its sequence
+  static uint16_t erased;                     // Pages known to be erased
+  static uint8_t dirty[(capacity / 8 + 7) / 8]; // One bit per 8 bytes of image
+
+  static uint8_t live_pages();
+  static bool open_page(const bool snapshot, const bool reserve);
+  static bool append(const uint16_t addr, const uint8_t *data, const uint16_t len, const bool reserve);
+  static bool mark(const uint16_t addr, const bool reserve);
+  static bool compact();
+  static bool save();
+};
+
+extern FlashJournal flash_journal;
@@ -0,0 +1,117 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * Serial receive ring that frames lines as they arrive
+ *
+ * The receive interrupt stores each byte and counts the line ends, so the
+ * command queue only visits a port once it holds a whole line, and then
+ * filters that line straight out of the ring into a command slot.
+ *
+ * Bytes are never overwritten. A byte that finds the ring full is dropped
+ * with the rest of its line, and the line is ended with LINE_LOST instead
+ * of its EOL, so the queue can ask for a resend rather than run a damaged
+ * command. The last free byte is kept for that marker.
+ *
+ * The interrupt is the only writer of 'head' and 'ends_in' and the main
+ * loop the only writer of 'tail' and 'ends_out', so neither side has to
+ * mask interrupts.
+ */
+
+#include <stdint.h>
+
+class SerialLineRing {
+public:
+  static constexpr uint8_t LINE_LOST = 0x18;  // CAN, ends a line that lost bytes
+
+  static inline bool is_end(const uint8_t c) { return c == '\n' || c == '\r' || c == LINE_LOST; }
+
+  SerialLineRing(uint8_t * const buf, const uint16_t size) : buffer(buf), mask(size - 1) {}
+
+  // Called by the receive interrupt for every byte
+  void store(const uint8_t c) {
+    const uint16_t h = head, used = h - tail;
+    const bool end = is_end(c);
+    if (discarding) {
+      if (!end || used > mask) return;    // Still no room to end the line
+      put(h, LINE_LOST);
+      discarding = false;
+      lost++;
+    }
+    else if (used < mask || (end && used == mask))
+      put(h, c);
+    else
+      discarding = true;
+  }
+
+  uint16_t available() const { return uint16_t(head - tail); }
+  uint16_t room() const { return mask - available(); }  // Bytes that can arrive without a loss
+  uint16_t lines() const { return uint16_t(ends_in - ends_out); }
+
+  int peek() const { return available() ? buffer[tail & mask] : -1; }
+
+  int read() {
+    if (!available()) return -1;
+    const uint8_t c = buffer[tail & mask];
+    if (is_end(c)) ends_out++;
+    tail++;
+    return c;
+  }
+
+  void clear() { while (read() >= 0) { /* nada */ } }
+
+  /**
+   * Pass every byte of the next whole line to 'each' and drop the line.
+   * Only call when lines() is non-zero. Return the byte that ended it.
+   */
+  template<typename F>
+  uint8_t take_line(F each) {
+    uint16_t t = tail;
+    uint8_t c;
+    while (!is_end(c = buffer[t++ & mask])) each(char(c));
+    ends_out++;
+    tail = t;
+    return c;
+  }
+
+  uint32_t lost = 0;        // Lines cut short by a full ring
+
+private:
+  void put(const uint16_t h, const uint8_t c) {
+    buffer[h & mask] = c;
+    head = h + 1;
+    if (is_end(c)) ends_in++;
+  }
+
+  uint8_t * const buffer;
+  const uint16_t mask;
+  volatile uint16_t head = 0, tail = 0, ends_in = 0;
+  uint16_t ends_out = 0;
+  bool discarding = false;
+};
+
+template<uint16_t SIZE>
+class SerialLineRingBuffer : public SerialLineRing {
+  static_assert(SIZE >= 2 && SIZE <= 0x8000 && !(SIZE & (SIZE - 1)), "SerialLineRing size must be a power of 2 up to 32768.");
+public:
+  SerialLineRingBuffer() : SerialLineRing(storage, SIZE) {}
+private:
+  uint8_t storage[SIZE];
+};
@@ -84,6 +84,16 @@
   #include "libs/BL24CXX.h"
 #endif
 
+#if ENABLED(FLASH_EEPROM_JOURNAL)
+  #include "HAL/shared/eeprom_journal.h"
+#endif
+
+#include "feature/idle_scheduler.h"
+
+#if ENABLED(ISR_PROFILING)
+  #include "feature/isr_profiler.h"
+#endif
+
 #if ENABLED(DIRECT_STEPPING)
   #include "feature/direct_stepping.h"
 #endif
@@ -703,115 +713,172 @@ inline void manage_inactivity(const bool ignore_stepper_queue=false) {
   #endif
 }
 
+#if ENABLED(ADVANCED_PAUSE_FEATURE)
+  static bool idle_no_stepper_sleep;
+#endif
+
 /**
- * Standard idle routine keeps the machine alive:
- *  - Core Marlin activities
- *  - Manage heaters (and Watchdog)
- *  - Max7219 heartbeat, animation, etc.
- *
- *  Only after setup() is complete:
- *  - Handle filament runout sensors
- *  - Run HAL idle tasks
- *  - Handle Power-Loss Recovery
- *  - Run StallGuard endstop checks
- *  - Handle SD Card insert / remove
- *  - Handle USB Flash Drive insert / remove
- *  - Announce Host Keepalive state (if any)
- *  - Update the Print Job Timer state
- *  - Update the Beeper queue
- *  - Read Buttons and Update the LCD
- *  - Run i2c Position Encoders
- *  - Auto-report Temperatures / SD Status
- *  - Update the Průša MMU2
- *  - Handle Joystick jogging
+ * The tasks of idle(), most urgent first.
+ * Background tasks (with a deadline) give way to motion. See IdleScheduler.
  */
-void idle(TERN_(ADVANCED_PAUSE_FEATURE, bool no_stepper_sleep/*=false*/)) {
-
+const idle_task_t idle_tasks[] = {
+  //  Name            Task                                                  Period Deadline At boot
   // Core Marlin activities
-  manage_inactivity(TERN_(ADVANCED_PAUSE_FEATURE, no_stepper_sleep));
-
+  { "inactivity",     []{ manage_inactivity(TERN_(ADVANCED_PAUSE_FEATURE, idle_no_stepper_sleep)); },
+                                                                                0,      0, true },
   // Manage Heaters (and Watchdog)
-  thermalManager.manage_heater();
+  { "heaters",        []{ thermalManager.manage_heater(); },                    0,      0, true },
 
   // Max7219 heartbeat, animation, etc
-  TERN_(MAX7219_DEBUG, max7219.idle_tasks());
-
-  // Return if setup() isn't completed
-  if (marlin_state == MF_INITIALIZING) return;
+  #if ENABLED(MAX7219_DEBUG)
+    { "max7219",      []{ max7219.idle_tasks(); },                              0,      0, true },
+  #endif
 
   // Handle filament runout sensors
-  TERN_(HAS_FILAMENT_SENSOR, runout.run());
+  #if HAS_FILAMENT_SENSOR
+    { "runout",       []{ runout.run(); },                                      0,      0, false },
+  #endif
 
   // Run HAL idle tasks
   #ifdef HAL_IDLETASK
-    HAL_idletask();
+    { "hal",          []{ HAL_idletask(); },                                    0,      0, false },
   #endif
 
   // Handle Power-Loss Recovery
   #if ENABLED(POWER_LOSS_RECOVERY) && PIN_EXISTS(POWER_LOSS)
-    if(printJobOngoing()) recovery.outage();
+    { "outage",       []{ if (printJobOngoing()) recovery.outage(); },          0,      0, false },
   #endif
 
   // Run StallGuard endstop checks
   #if ENABLED(SPI_ENDSTOPS)
-    if (endstops.tmc_spi_homing.any
-      && TERN1(IMPROVE_HOMING_RELIABILITY, ELAPSED(millis(), sg_guard_period))
-    ) LOOP_L_N(i, 4) // Read SGT 4 times per idle loop
-        if (endstops.tmc_spi_homing_check()) break;
+    { "spi_endstops", []{
+        if (endstops.tmc_spi_homing.any
+          && TERN1(IMPROVE_HOMING_RELIABILITY, ELAPSED(millis(), sg_guard_period))
+        ) LOOP_L_N(i, 4) // Read SGT 4 times per idle loop
+            if (endstops.tmc_spi_homing_check()) break;
+      },                                                                        0,      0, false },
   #endif
 
-  // Handle SD Card insert / remove
-  TERN_(SDSUPPORT, card.manage_media());
-
   // Handle USB Flash Drive insert / remove
-  TERN_(USB_FLASH_DRIVE_SUPPORT, Sd2Card::idle());
+  #if ENABLED(USB_FLASH_DRIVE_SUPPORT)
+    { "usb_drive",    []{ Sd2Card::idle(); },                                   0,      0, false },
+  #endif
 
   // Announce Host Keepalive state (if any)
-  TERN_(HOST_KEEPALIVE_FEATURE, gcode.host_keepalive());
+  #if ENABLED(HOST_KEEPALIVE_FEATURE)
+    { "keepalive",    []{ gcode.host_keepalive(); },                            0,      0, false },
+  #endif
 
   // Update the Print Job Timer state
-  TERN_(PRINTCOUNTER, print_job_timer.tick());
+  #if ENABLED(PRINTCOUNTER)
+    { "print_timer",  []{ print_job_timer.tick(); },                            0,      0, false },
+  #endif
 
   // Update the Beeper queue
-  TERN_(USE_BEEPER, buzzer.tick());
+  #if USE_BEEPER
+    { "buzzer",       []{ buzzer.tick(); },                                     0,      0, false },
+  #endif
 
-  // Handle UI input / draw events
-  ui.update();
-  
   // Run i2c Position Encoders
   #if ENABLED(I2C_POSITION_ENCODERS)
-    static millis_t i2cpem_next_update_ms;
-    if (planner.has_blocks_queued()) {
-      const millis_t ms = millis();
-      if (ELAPSED(ms, i2cpem_next_update_ms)) {
-        I2CPEM.update();
-        i2cpem_next_update_ms = ms + I2CPE_MIN_UPD_TIME_MS;
-      }
-    }
-  #endif
-
-  // Auto-report Temperatures / SD Status
-  #if HAS_AUTO_REPORTING
-    if (!gcode.autoreport_paused) {
-      TERN_(AUTO_REPORT_TEMPERATURES, thermalManager.auto_report_temperatures());
-      TERN_(AUTO_REPORT_SD_STATUS, card.auto_report_sd_status());
-    }
+    { "i2c_encoders", []{
+        static millis_t i2cpem_next_update_ms;
+        if (planner.has_blocks_queued()) {
+          const millis_t ms = millis();
+          if (ELAPSED(ms, i2cpem_next_update_ms)) {
+            I2CPEM.update();
+            i2cpem_next_update_ms = ms + I2CPE_MIN_UPD_TIME_MS;
+          }
+        }
+      },                                                                        0,      0, false },
   #endif
 
   // Update the Průša MMU2
-  TERN_(PRUSA_MMU2, mmu2.mmu_loop());
+  #if ENABLED(PRUSA_MMU2)
+    { "mmu2",         []{ mmu2.mmu_loop(); },                                   0,      0, false },
+  #endif
 
   // Handle Joystick jogging
-  TERN_(POLL_JOG, joystick.inject_jog_moves());
+  #if ENABLED(POLL_JOG)
+    { "joystick",     []{ joystick.inject_jog_moves(); },                       0,      0, false },
+  #endif
 
   // Direct Stepping
-  TERN_(DIRECT_STEPPING, page_manager.write_responses());
+  #if ENABLED(DIRECT_STEPPING)
+    { "direct_step",  []{ page_manager.write_responses(); },                    0,      0, false },
+  #endif
+
+  #if ENABLED(OPTION_REPEAT_PRINTING)
+    { "repeat_print", []{ ReprintManager.RepeatPrinting_process(); },           0,      0, false },
+  #endif
+
+  // Set the multistepping limits from the measured step ISR costs
+  #if ENABLED(MEASURED_STEP_ISR_LIMITS)
+    { "isr_limits",   []{ stepper.update_isr_limits(); },                    1000,      0, false },
+  #endif
+
+  // Erase and compact the flash EEPROM while nothing is moving
+  #if ENABLED(FLASH_EEPROM_JOURNAL)
+    { "eeprom",       []{ flash_journal.service(!planner.has_blocks_queued()); }, 0,    0, false },
+  #endif
+
+  // Auto-report Temperatures / SD Status
+  #if HAS_AUTO_REPORTING
+    { "autoreport",   []{
+        if (!gcode.autoreport_paused) {
+          TERN_(AUTO_REPORT_TEMPERATURES, thermalManager.auto_report_temperatures());
+          TERN_(AUTO_REPORT_SD_STATUS, card.auto_report_sd_status());
+        }
+      },                                                                        0,    500, false },
+  #endif
+
+  // Handle SD Card insert / remove
+  #if ENABLED(SDSUPPORT)
+    { "media",        []{ card.manage_media(); },                             100,   1000, false },
+  #endif
+
+  // Handle UI input / draw events
+  #if HAS_DWIN_LCD
+    // The encoder is only read here, so it's polled on every pass while drawing waits
+    { "ui_input",     []{ DWIN_HandleInput(); },                                0,      0, false },
+    { "ui",           []{ DWIN_Update(false); },                                0,    100, false },
+  #else
+    { "ui",           []{ ui.update(); },                                       0,    100, false },
+  #endif
 
   #if HAS_TFT_LVGL_UI
-    LV_TASK_HANDLER();
+    { "lvgl",         []{ LV_TASK_HANDLER(); },                                 0,    100, false },
+  #endif
+};
+const uint8_t idle_task_count = COUNT(idle_tasks);
+
+#if ENABLED(IDLE_TASK_SCHEDULER)
+  IdleScheduler::task_stats_t IdleScheduler::stats[COUNT(idle_tasks)];
+#endif
+
+/**
+ * Standard idle routine keeps the machine alive by running the tasks
+ * above. Before setup() is complete only the tasks marked "At boot" run.
+ *
+ * With IDLE_TASK_SCHEDULER the tasks keep to their periods and deadlines
+ * and their run times are kept for M577. Otherwise every task runs on
+ * every pass.
+ */
+void idle(TERN_(ADVANCED_PAUSE_FEATURE, bool no_stepper_sleep/*=false*/)) {
+
+  TERN_(ADVANCED_PAUSE_FEATURE, idle_no_stepper_sleep = no_stepper_sleep);
+
+  const bool setup_done = marlin_state != MF_INITIALIZING;
+
+  #if ENABLED(IDLE_TASK_SCHEDULER)
+    idle_scheduler.run(setup_done);
+  #else
+    LOOP_L_N(i, COUNT(idle_tasks))
+      if (setup_done || idle_tasks[i].at_boot) idle_tasks[i].run();
   #endif
 
-	TERN_(OPTION_REPEAT_PRINTING, ReprintManager.RepeatPrinting_process());
+  // Return if setup() isn't completed
+  if (!setup_done) return;
 
   // Refresh watchdog
   TERN_(USE_WATCHDOG, HAL_watchdog_refresh());
@@ -844,6 +911,9 @@ void kill(PGM_P const lcd_error/*=nullptr*/, PGM_P const lcd_component/*=nullptr
   #endif
 
 	#if HAS_DWIN_LCD
+	#if DWIN_TX_BUFFER_SIZE
+	dwinLCD.Flush(); // Get the kill screen out before interrupts stop
+	#endif
 	if(marlin_state == MF_KILLED){
 		LOOP_L_N(i, 5){
 			watchdog_refresh();		
@@ -1125,7 +1195,7 @@ void setup() {
     );
   #endif
   SERIAL_ECHO_MSG("Compiled: " __DATE__);
-  SERIAL_ECHO_MSG(STR_FREE_MEMORY, freeMemory(), STR_PLANNER_BUFFER_BYTES, (int)sizeof(block_t) * (BLOCK_BUFFER_SIZE));
+  SERIAL_ECHO_MSG(STR_FREE_MEMORY, freeMemory(), STR_PLANNER_BUFFER_BYTES, (int)sizeof(block_t) * (BLOCK_BUFFER_SIZE), " (", int(BLOCK_BUFFER_SIZE), " x ", (int)sizeof(block_t), ")");
 
 	setup_powerhold();
   // Init buzzer pin(s)
@@ -1174,6 +1244,10 @@ void setup() {
 
   sync_plan_position();               // Vital to init stepper/planner equivalent for current_position
 
+  #if ENABLED(ISR_PROFILING)
+    SETUP_RUN(isr_profiler.init());   // Start the cycle counter before the ISRs
+  #endif
+
   SETUP_RUN(thermalManager.init());   // Initialize temperature loop
 
   SETUP_RUN(print_job_timer.init());  // Initial setup of print job timer
@@ -117,6 +117,7 @@
 #define STR_ERR_LINE_NO                     "Line Number is not Last Line Number+1, Last Line: "
 #define STR_ERR_CHECKSUM_MISMATCH           "checksum mismatch, Last Line: "
 #define STR_ERR_NO_CHECKSUM                 "No Checksum with line number, Last Line: "
+#define STR_ERR_LINE_LOST                   "Line lost to a full RX buffer, Last Line: "
 #define STR_FILE_PRINTED                    "Done printing file"
 #define STR_NO_MEDIA                        "No media"
 #define STR_BEGIN_FILE_LIST                 "Begin file list"
@@ -240,6 +241,14 @@
 #define STR_PID_DEBUG_ITERM                 " iTerm "
 #define STR_PID_DEBUG_DTERM                 " dTerm "
 #define STR_PID_DEBUG_CTERM                 " cTerm "
+#define STR_MPC_AUTOTUNE_START              "MPC Autotune start for E"
+#define STR_MPC_AUTOTUNE_INTERRUPTED        "MPC Autotune interrupted!"
+#define STR_MPC_AUTOTUNE_FAILED             "MPC Autotune failed! The heater didn't slow down before 200C"
+#define STR_MPC_AUTOTUNE_FINISHED           "MPC Autotune finished! Put the constants below into Configuration.h"
+#define STR_MPC_COOLING_TO_AMBIENT          "Cooling to ambient"
+#define STR_MPC_HEATING_PAST_200            "Heating to 200C"
+#define STR_MPC_MEASURING_AMBIENT           "Measuring ambient heat loss at "
+#define STR_MPC_TEMPERATURE_ERROR           "MPC Autotune failed! Temperature strayed from the target"
 #define STR_INVALID_EXTRUDER_NUM            " - Invalid extruder number !"
 
 #define STR_HEATER_BED                      "bed"
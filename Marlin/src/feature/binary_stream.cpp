@@ -30,6 +30,12 @@
 char* SDFileTransferProtocol::Packet::Open::data = nullptr;
 size_t SDFileTransferProtocol::data_waiting, SDFileTransferProtocol::transfer_timeout, SDFileTransferProtocol::idle_timeout;
 bool SDFileTransferProtocol::transfer_active, SDFileTransferProtocol::dummy_transfer, SDFileTransferProtocol::compression;
+uint8_t SDFileTransferProtocol::sector_buffer[512] __attribute__((aligned(4))); // SDIO DMA needs whole words
+#if ENABLED(BINARY_STREAM_COMPRESSION)
+  heatshrink_decoder SDFileTransferProtocol::hsd;
+#endif
+
+BinaryStream::Slot BinaryStream::slots[BinaryStream::PACKETS];
 
 BinaryStream binaryStream[NUM_SERIAL];
 
@@ -22,13 +22,28 @@
 #pragma once
 
 #include "../inc/MarlinConfig.h"
+#include "../libs/crc16.h"
 
 #define BINARY_STREAM_COMPRESSION
 
 #if ENABLED(BINARY_STREAM_COMPRESSION)
   #include "../libs/heatshrink/heatshrink_decoder.h"
+  static_assert(WITHIN(HEATSHRINK_STATIC_WINDOW_BITS, HEATSHRINK_MIN_WINDOW_BITS, HEATSHRINK_MAX_WINDOW_BITS), "BINARY_STREAM_HEATSHRINK_WINDOW_BITS must be from 4 to 15.");
+  static_assert(HEATSHRINK_STATIC_LOOKAHEAD_BITS >= HEATSHRINK_MIN_LOOKAHEAD_BITS && HEATSHRINK_STATIC_LOOKAHEAD_BITS < HEATSHRINK_STATIC_WINDOW_BITS,
+                "BINARY_STREAM_HEATSHRINK_LOOKAHEAD_BITS must be at least 3 and less than BINARY_STREAM_HEATSHRINK_WINDOW_BITS.");
 #endif
 
+// Packets the host may send ahead of the acks, and the largest payload
+#ifndef BINARY_STREAM_PACKETS
+  #define BINARY_STREAM_PACKETS 1
+#endif
+#ifndef BINARY_STREAM_PACKET_SIZE
+  #define BINARY_STREAM_PACKET_SIZE MAX_CMD_SIZE
+#endif
+static_assert(BINARY_STREAM_PACKETS >= 1 && BINARY_STREAM_PACKETS <= 64 && !((BINARY_STREAM_PACKETS) & ((BINARY_STREAM_PACKETS) - 1)),
+              "BINARY_STREAM_PACKETS must be a power of 2 from 1 to 64.");
+static_assert(BINARY_STREAM_PACKET_SIZE >= 64, "BINARY_STREAM_PACKET_SIZE must be at least 64.");
+
 inline bool bs_serial_data_available(const uint8_t index) {
   switch (index) {	
     case 0: return MYSERIAL0.available();
@@ -63,11 +78,6 @@ inline int bs_read_serial(const uint8_t index) {
   return -1;
 }
 
-#if ENABLED(BINARY_STREAM_COMPRESSION)
-  static heatshrink_decoder hsd;
-  static uint8_t decode_buffer[512] = {};
-#endif
-
 class SDFileTransferProtocol  {
 private:
   struct Packet {
@@ -100,6 +110,14 @@ private:
     return true;
   }
 
+  // Hand the card a whole sector. Written at a sector boundary of the file,
+  // from a word-aligned buffer, it goes straight to the card without a copy.
+  static bool write_sector() {
+    const size_t count = data_waiting;
+    data_waiting = 0;
+    return dummy_transfer || card.write(sector_buffer, count) >= 0;
+  }
+
   static bool file_write(char* buffer, const size_t length) {
     #if ENABLED(BINARY_STREAM_COMPRESSION)
       if (compression) {
@@ -110,32 +128,28 @@ private:
           heatshrink_decoder_sink(&hsd, reinterpret_cast<uint8_t*>(&buffer[total_processed]), length - total_processed, &processed_count);
           total_processed += processed_count;
           do {
-            presult = heatshrink_decoder_poll(&hsd, &decode_buffer[data_waiting], sizeof(decode_buffer) - data_waiting, &processed_count);
+            presult = heatshrink_decoder_poll(&hsd, &sector_buffer[data_waiting], sizeof(sector_buffer) - data_waiting, &processed_count);
             data_waiting += processed_count;
-            if (data_waiting == sizeof(decode_buffer)) {
-              if (!dummy_transfer)
-                if (card.write(decode_buffer, data_waiting) < 0) {
-                  return false;
-                }
-              data_waiting = 0;
-            }
+            if (data_waiting == sizeof(sector_buffer) && !write_sector()) return false;
           } while (presult == HSDR_POLL_MORE);
         }
         return true;
       }
     #endif
-    return (dummy_transfer || card.write(buffer, length) >= 0);
+    for (size_t done = 0; done < length;) {
+      const size_t count = _MIN(length - done, sizeof(sector_buffer) - data_waiting);
+      memcpy(&sector_buffer[data_waiting], &buffer[done], count);
+      data_waiting += count;
+      done += count;
+      if (data_waiting == sizeof(sector_buffer) && !write_sector()) return false;
+    }
+    return true;
   }
 
   static bool file_close() {
+    // flush any buffered data
+    if (data_waiting && !write_sector()) return false;
     if (!dummy_transfer) {
-      #if ENABLED(BINARY_STREAM_COMPRESSION)
-        // flush any buffered data
-        if (data_waiting) {
-          if (card.write(decode_buffer, data_waiting) < 0) return false;
-          data_waiting = 0;
-        }
-      #endif
       card.closefile();
       card.release();
     }
@@ -159,6 +173,10 @@ private:
 
   static size_t data_waiting, transfer_timeout, idle_timeout;
   static bool transfer_active, dummy_transfer, compression;
+  static uint8_t sector_buffer[512];  // Data on its way to the card
+  #if ENABLED(BINARY_STREAM_COMPRESSION)
+    static heatshrink_decoder hsd;
+  #endif
 
 public:
 
@@ -279,17 +297,37 @@ public:
     }
   } packet{};
 
+  /**
+   * The host may send up to PACKETS packets ahead of the acks. Each one is
+   * acked as soon as it checks out and waits in the slot for its sync until
+   * the packets before it have been processed. A gap in the sync numbers
+   * gets a single resend request for the packet that is missing, so only
+   * lost or corrupt packets are sent again.
+   */
+  static constexpr uint8_t PACKETS = BINARY_STREAM_PACKETS;
+  static constexpr uint16_t PACKET_SIZE = BINARY_STREAM_PACKET_SIZE;
+
+  struct Slot {
+    bool ready;
+    uint8_t meta;
+    uint16_t size;
+    char buffer[PACKET_SIZE];
+  };
+  static Slot slots[PACKETS]; // Only one port transfers at a time
+
+  static Slot& slot(const uint8_t sync) { return slots[sync & (PACKETS - 1)]; }
+  static void clear_slots() { LOOP_L_N(i, PACKETS) slots[i].ready = false; }
+
   void reset() {
     sync = 0;
     packet_retries = 0;
     buffer_next_index = 0;
+    gap_reported = false;
+    clear_slots();
   }
 
   // fletchers 16 checksum
-  uint32_t checksum(uint32_t cs, uint8_t value) {
-    uint16_t cs_low = (((cs & 0xFF) + value) % 255);
-    return ((((cs >> 8) + cs_low) % 255) << 8)  | cs_low;
-  }
+  uint16_t checksum(uint16_t cs, uint8_t value) { return fletcher16(cs, &value, 1); }
 
   // read the next byte from the data stream keeping track of
   // whether the stream times out from data starvation
@@ -305,8 +343,7 @@ public:
     return true;
   }
 
-  template<const size_t buffer_size>
-  void receive(char (&buffer)[buffer_size]) {
+  void receive() {
     uint8_t data = 0;
     millis_t transfer_window = millis() + RX_TIMESLICE;
 
@@ -350,22 +387,27 @@ public:
           if (packet.bytes_received == sizeof(Packet::header)) {
             if (packet.header.checksum == packet.header_checksum) {
               // The SYNC control packet is a special case in that it doesn't require the stream sync to be correct
+              // The host learns the packet size and how many packets may be in flight
               if (static_cast<Protocol>(packet.header.protocol()) == Protocol::CONTROL && static_cast<ProtocolControl>(packet.header.type()) == ProtocolControl::SYNC) {
-                  SERIAL_ECHOLNPAIR("ss", sync, ",", buffer_size, ",", VERSION_MAJOR, ".", VERSION_MINOR, ".", VERSION_PATCH);
+                  SERIAL_ECHOLNPAIR("ss", sync, ",", PACKET_SIZE, ",", VERSION_MAJOR, ".", VERSION_MINOR, ".", VERSION_PATCH, ",", PACKETS);
+                  clear_slots();
+                  gap_reported = false;
                   stream_state = StreamState::PACKET_RESET;
                   break;
               }
-              if (packet.header.sync == sync) {
+              const uint8_t ahead = packet.header.sync - sync, behind = sync - packet.header.sync;
+              resend_sync = sync;
+              if (packet.header.size > PACKET_SIZE) {
+                SERIAL_ECHO_MSG("Datastream packet data buffer overrun");
+                stream_state = StreamState::PACKET_ERROR;
+              }
+              else if (ahead < PACKETS && !slot(packet.header.sync).ready) {
                 buffer_next_index = 0;
                 packet.bytes_received = 0;
-                if (packet.header.size) {
-                  stream_state = StreamState::PACKET_DATA;
-                  packet.buffer = static_cast<char *>(&buffer[0]); // multipacket buffering not implemented, always allocate whole buffer to packet
-                }
-                else
-                  stream_state = StreamState::PACKET_PROCESS;
+                packet.buffer = slot(packet.header.sync).buffer;
+                stream_state = packet.header.size ? StreamState::PACKET_DATA : StreamState::PACKET_PROCESS;
               }
-              else if (packet.header.sync == sync - 1) {           // ok response must have been lost
+              else if (ahead < PACKETS || WITHIN(behind, 1, PACKETS)) { // ok response must have been lost
                 SERIAL_ECHOLNPAIR("ok", packet.header.sync);  // transmit valid packet received and drop the payload
                 stream_state = StreamState::PACKET_RESET;
               }
@@ -380,6 +422,7 @@ public:
             else {
               SERIAL_ECHO_START();
               SERIAL_ECHOLNPAIR("Packet header(", packet.header.sync, "?) corrupt");
+              resend_sync = sync;
               stream_state = StreamState::PACKET_RESEND;
             }
           }
@@ -387,19 +430,12 @@ public:
         case StreamState::PACKET_DATA:
           if (!stream_read(data)) break;
 
-          if (buffer_next_index < buffer_size)
-            packet.buffer[buffer_next_index] = data;
-          else {
-            SERIAL_ECHO_MSG("Datastream packet data buffer overrun");
-            stream_state = StreamState::PACKET_ERROR;
-            break;
-          }
-
-          packet.checksum = checksum(packet.checksum, data);
+          packet.buffer[buffer_next_index++] = data;
           packet.bytes_received++;
-          buffer_next_index++;
 
           if (packet.bytes_received == packet.header.size) {
+            // Checksum the whole payload at once
+            packet.checksum = fletcher16(packet.checksum, packet.buffer, packet.header.size);
             stream_state = StreamState::PACKET_FOOTER;
             packet.bytes_received = 0;
           }
@@ -415,32 +451,52 @@ public:
             else {
               SERIAL_ECHO_START();
               SERIAL_ECHOLNPAIR("Packet(", packet.header.sync, ") payload corrupt");
+              resend_sync = packet.header.sync;
               stream_state = StreamState::PACKET_RESEND;
             }
           }
           break;
-        case StreamState::PACKET_PROCESS:
-          sync++;
+        case StreamState::PACKET_PROCESS: {
           packet_retries = 0;
-          bytes_received += packet.header.size;
-
           SERIAL_ECHOLNPAIR("ok", packet.header.sync); // transmit valid packet received
-          dispatch();
+
+          Slot &s = slot(packet.header.sync);
+          s.meta = packet.header.meta;
+          s.size = packet.header.size;
+          s.ready = true;
+
+          // Ask once for the packet that should have come first
+          if (packet.header.sync != sync && !gap_reported) {
+            gap_reported = true;
+            SERIAL_ECHOLNPAIR("rs", sync);
+          }
+
+          // Process every packet that is now in order
+          while (slot(sync).ready) {
+            Slot &next = slot(sync);
+            next.ready = false;
+            sync++;
+            gap_reported = false;
+            bytes_received += next.size;
+            dispatch(next.meta, next.buffer, next.size);
+          }
           stream_state = StreamState::PACKET_RESET;
-          break;
+        } break;
         case StreamState::PACKET_RESEND:
           if (packet_retries < MAX_RETRIES || MAX_RETRIES == 0) {
             packet_retries++;
             stream_state = StreamState::PACKET_RESET;
             SERIAL_ECHO_START();
             SERIAL_ECHOLNPAIR("Resend request ", int(packet_retries));
-            SERIAL_ECHOLNPAIR("rs", sync);
+            SERIAL_ECHOLNPAIR("rs", resend_sync);
+            if (resend_sync == sync) gap_reported = true;
           }
           else
             stream_state = StreamState::PACKET_ERROR;
           break;
         case StreamState::PACKET_TIMEOUT:
           SERIAL_ECHO_MSG("Datastream timeout");
+          resend_sync = sync;
           stream_state = StreamState::PACKET_RESEND;
           break;
         case StreamState::PACKET_ERROR:
@@ -454,10 +510,11 @@ public:
     #pragma GCC diagnostic pop
   }
 
-  void dispatch() {
-    switch (static_cast<Protocol>(packet.header.protocol())) {
+  void dispatch(const uint8_t meta, char* buffer, const uint16_t size) {
+    const uint8_t protocol = (meta >> 4) & 0xF, type = meta & 0xF;
+    switch (static_cast<Protocol>(protocol)) {
       case Protocol::CONTROL:
-        switch (static_cast<ProtocolControl>(packet.header.type())) {
+        switch (static_cast<ProtocolControl>(type)) {
           case ProtocolControl::CLOSE: // revert back to ASCII mode
             card.flag.binary_mode = false;
             break;
@@ -466,7 +523,7 @@ public:
         }
         break;
       case Protocol::FILE_TRANSFER:
-        SDFileTransferProtocol::process(packet.header.type(), packet.buffer, packet.header.size); // send user data to be processed
+        SDFileTransferProtocol::process(type, buffer, size); // send user data to be processed
       break;
       default:
         SERIAL_ECHO_MSG("Unsupported Binary Protocol");
@@ -478,8 +535,9 @@ public:
     SDFileTransferProtocol::idle();
   }
 
-  static const uint16_t PACKET_MAX_WAIT = 500, RX_TIMESLICE = 20, MAX_RETRIES = 0, VERSION_MAJOR = 0, VERSION_MINOR = 1, VERSION_PATCH = 0;
-  uint8_t  packet_retries, sync;
+  static const uint16_t PACKET_MAX_WAIT = 500, RX_TIMESLICE = 20, MAX_RETRIES = 0, VERSION_MAJOR = 0, VERSION_MINOR = 2, VERSION_PATCH = 0;
+  uint8_t  packet_retries, sync, resend_sync;
+  bool gap_reported;
   uint16_t buffer_next_index;
   uint32_t bytes_received;
   StreamState stream_state = StreamState::PACKET_RESET;
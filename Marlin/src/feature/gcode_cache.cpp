@@ -0,0 +1,322 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * feature/gcode_cache.cpp - Pre-parsed G-code cache for repeated SD prints
+ *
+ * Cache file layout:
+ *
+ *   Header:  "BGC2", size (u32), date (u16), time (u16) of the G-code file.
+ *            The magic is written last, so an unfinished cache never matches.
+ *   Records: File position delta (varint), length (byte), command.
+ *            Bit 7 of the length is set for a parser record, clear for text.
+ *
+ * The position delta moves card.sdpos to the end of the line that held the
+ * command, so M27, the progress display and power-loss recovery all report
+ * the same positions as a print from the G-code file itself.
+ */
+
+#include "../inc/MarlinConfigPre.h"
+
+#if ENABLED(SD_GCODE_CACHE)
+
+#include "gcode_cache.h"
+#include "../sd/cardreader.h"
+#include "../gcode/parser.h"
+
+#define CACHE_MAGIC "BGC2"
+#define CACHE_RECORD_BIT 0x80
+
+static_assert(MAX_CMD_SIZE <= CACHE_RECORD_BIT, "MAX_CMD_SIZE is too large for the G-code cache.");
+
+GCodeCache gcode_cache;
+
+GCodeCache::CacheState GCodeCache::state; // = CACHE_IDLE
+SdFile GCodeCache::dir, GCodeCache::file;
+char GCodeCache::name[13];
+GCodeCache::cache_header_t GCodeCache::header;
+uint8_t GCodeCache::buffer[512] __attribute__((aligned(4))); // SDIO DMA needs whole words
+uint16_t GCodeCache::buffer_pos, GCodeCache::buffer_len;
+uint32_t GCodeCache::last_sdpos;
+
+static uint8_t* store_varint(uint8_t *q, uint32_t v) {
+  for (; v >= 0x80; v >>= 7) *q++ = uint8_t(v) | 0x80;
+  *q++ = uint8_t(v);
+  return q;
+}
+
+/**
+ * Remember the folder and name of the cache for a G-code file
+ * that was just opened. Cache files themselves are never cached.
+ */
+void GCodeCache::select(SdFile * const fdir, const char * const fname) {
+  abort();
+  name[0] = '\0';
+  const char * const ext = strchr(fname, '.');
+  if (ext && !strcasecmp(ext + 1, "BGC")) return;
+  dir = *fdir;
+  uint8_t i = 0;
+  for (; i < 8 && fname[i] && fname[i] != '.'; i++) name[i] = fname[i];
+  strcpy(name + i, ".BGC");
+}
+
+/**
+ * Start a print of the selected file from the beginning. Replay
+ * a cache that matches the file, otherwise record a new one.
+ */
+void GCodeCache::begin(SdFile &src) {
+  dir_t entry;
+  if (active() || !name[0] || !src.dirEntry(&entry)) return;
+
+  memcpy(header.magic, CACHE_MAGIC, sizeof(header.magic));
+  header.size = src.fileSize();
+  header.date = entry.lastWriteDate;
+  header.time = entry.lastWriteTime;
+  last_sdpos = 0;
+
+  if (file.open(&dir, name, O_READ)) {
+    const int16_t n = file.read(buffer, sizeof(buffer));
+    if (n >= int16_t(sizeof(header)) && !memcmp(buffer, &header, sizeof(header))) {
+      buffer_pos = sizeof(header);
+      buffer_len = n;
+      state = CACHE_REPLAY;
+      SERIAL_ECHO_MSG("Replaying ", name);
+      return;
+    }
+    file.close();
+  }
+
+  if (file.open(&dir, name, O_CREAT | O_WRITE | O_TRUNC)) {
+    memset(buffer, 0, sizeof(header));  // Placeholder until finish()
+    buffer_len = sizeof(header);
+    state = CACHE_RECORD;
+  }
+}
+
+/**
+ * The G-code file printed to the end. Complete the recording.
+ */
+void GCodeCache::finish() {
+  if (recording()) {
+    if (!flush() || !file.seekSet(0) || file.write(&header, sizeof(header)) != sizeof(header) || !file.close())
+      return abort();
+  }
+  else if (replaying())
+    file.close();
+  state = CACHE_IDLE;
+}
+
+/**
+ * The print was stopped or moved. Discard a partial recording.
+ */
+void GCodeCache::abort() {
+  if (recording()) {
+    file.close();
+    SdBaseFile::remove(&dir, name);
+  }
+  else if (replaying())
+    file.close();
+  state = CACHE_IDLE;
+}
+
+/**
+ * The cache is damaged. Remove it and go on printing from the G-code file.
+ */
+void GCodeCache::fail() {
+  SERIAL_ERROR_MSG("Bad G-code cache ", name);
+  file.close();
+  SdBaseFile::remove(&dir, name);
+  state = CACHE_IDLE;
+  card.setIndex(card.sdpos);
+}
+
+int16_t GCodeCache::get() {
+  if (buffer_pos >= buffer_len) {
+    const int16_t n = file.read(buffer, sizeof(buffer));
+    if (n <= 0) return -1;
+    buffer_pos = 0;
+    buffer_len = n;
+  }
+  return buffer[buffer_pos++];
+}
+
+bool GCodeCache::put(const uint8_t c) {
+  buffer[buffer_len++] = c;
+  return buffer_len < sizeof(buffer) || flush();
+}
+
+bool GCodeCache::flush() {
+  const bool ok = !buffer_len || file.write(buffer, buffer_len) == int16_t(buffer_len);
+  buffer_len = 0;
+  return ok;
+}
+
+/**
+ * Copy the next command into the queue buffer and
+ * advance card.sdpos to the end of its line.
+ * Set 'record' for a pre-parsed record.
+ * Return its size with the terminator, or 0 at the
+ * end of the cache or on an error.
+ */
+uint16_t GCodeCache::read(char * const dst, bool &record) {
+  if (!replaying()) return 0;
+
+  int16_t c = get();
+  if (c < 0) {                          // The cache ends where the file does
+    card.sdpos = card.filesize;
+    return 0;
+  }
+
+  uint32_t delta = 0;
+  for (uint8_t shift = 0; ; shift += 7) {
+    if (c < 0 || shift > 28) { fail(); return 0; }
+    delta |= uint32_t(c & 0x7F) << shift;
+    if (c < 0x80) break;
+    c = get();
+  }
+
+  int16_t len = get();
+  if (len < 0) { fail(); return 0; }
+  record = TEST(len, 7);
+  len &= ~CACHE_RECORD_BIT;
+  if (len >= MAX_CMD_SIZE || (record && len < GCODE_RECORD_MIN_SIZE)) { fail(); return 0; }
+  LOOP_L_N(i, len) {
+    if ((c = get()) < 0) { fail(); return 0; }
+    dst[i] = c;
+  }
+  dst[len] = '\0';
+
+  card.sdpos += delta;
+  return len + 1;
+}
+
+/**
+ * Append a command just queued from the G-code file,
+ * with the position of the end of its line.
+ */
+void GCodeCache::write(const char * const cmd, const uint32_t sdpos) {
+  if (!recording()) return;
+
+  uint8_t rec[6 + MAX_CMD_SIZE + 24], *q = store_varint(rec, sdpos - last_sdpos);
+  uint8_t * const lenp = q++;
+  uint8_t len = encode(q, cmd);
+  if (len)
+    *lenp = len | CACHE_RECORD_BIT;
+  else {                                // Keep it as text
+    len = strlen(cmd);
+    memcpy(q, cmd, len);
+    *lenp = len;
+  }
+  q += len;
+
+  for (uint8_t *r = rec; r < q; r++)
+    if (!put(*r)) {
+      SERIAL_ERROR_MSG("G-code cache write failed");
+      return abort();
+    }
+
+  last_sdpos = sdpos;
+}
+
+/**
+ * Encode a command as a parser record (see GCodeParser::parse_record).
+ * Return 0 for anything the record can't reproduce exactly as the text
+ * parser would see it, so it goes into the cache as text instead.
+ */
+uint8_t GCodeCache::encode(uint8_t * const dst, const char *p) {
+  const char letter = *p++;
+  if ((letter != 'G' && letter != 'M' && letter != 'T') || !NUMERIC(*p)) return 0;
+
+  uint16_t codenum = 0;
+  do {
+    codenum = codenum * 10 + *p++ - '0';
+    if (codenum > 9999) return 0;
+  } while (NUMERIC(*p));
+
+  uint8_t subcode = 0;
+  #if ENABLED(USE_GCODE_SUBCODES)
+    if (*p == '.') {
+      uint16_t sub = 0;
+      for (p++; NUMERIC(*p); p++) if ((sub = sub * 10 + *p - '0') > 255) return 0;
+      subcode = sub;
+    }
+  #endif
+
+  // Commands that take a string argument
+  if (letter == 'M') switch (codenum) {
+    case 0 ... 1: case 16: case 23: case 28: case 30: case 32: case 33:
+    case 117 ... 118: case 180 ... 183: case 810 ... 819: case 928:
+      return 0;
+    default: break;
+  }
+
+  uint32_t bits = 0, value[26];
+  for (;;) {
+    if (*p && *p != ' ' && !WITHIN(*p, 'A', 'Z')) return 0;
+    while (*p == ' ') p++;
+    if (!*p) break;
+
+    const char param = *p++;
+    if (!WITHIN(param, 'A', 'Z') || param == 'G' || param == 'M') return 0;
+    const uint8_t ind = LETTER_BIT(param);
+    if (TEST32(bits, ind)) return 0;
+    SBI32(bits, ind);
+
+    while (*p == ' ') p++;
+    if (!NUMERIC_SIGNED(*p) && *p != '.') return 0; // The parser would make it string_arg
+
+    // [-+]?[0-9]*.?[0-9]* with at least one digit
+    const bool neg = *p == '-';
+    if (NUMERIC_SIGNED(*p) && !NUMERIC(*p)) p++;
+    uint32_t mantissa = 0;
+    uint8_t decimals = 0;
+    bool digits = false, point = false;
+    for (;; p++) {
+      if (NUMERIC(*p)) {
+        if (point && ++decimals > 7) return 0;
+        mantissa = mantissa * 10 + *p - '0';
+        if (mantissa >= 0x1000000UL) return 0;
+        digits = true;
+      }
+      else if (*p == '.' && !point)
+        point = true;
+      else
+        break;
+    }
+    if (!digits || (neg && !mantissa)) return 0;  // strtof keeps -0
+
+    const uint32_t zigzag = neg ? (mantissa << 1) - 1 : mantissa << 1;
+    value[ind] = ((zigzag << 3) | decimals) + 1;
+  }
+
+  uint8_t *q = dst;
+  *q++ = letter;
+  q = store_varint(q, codenum);
+  *q++ = subcode;
+  q = store_varint(q, bits);
+  LOOP_L_N(i, 26) if (TEST32(bits, i)) q = store_varint(q, value[i]);
+
+  const uint8_t len = q - dst;
+  return len < MAX_CMD_SIZE ? len : 0;
+}
+
+#endif // SD_GCODE_CACHE
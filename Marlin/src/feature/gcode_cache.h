@@ -0,0 +1,75 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * feature/gcode_cache.h - Pre-parsed G-code cache for repeated SD prints
+ *
+ * The first print of a file records every command it queues to a sidecar
+ * file (FILENAME.BGC) in the same folder. Commands the parser can take as
+ * fixed-point records are stored that way, the rest are stored as text.
+ * Later prints of the unchanged file replay the sidecar instead, so the
+ * queue skips comment stripping and the parser skips all number scanning.
+ */
+
+#include "../inc/MarlinConfigPre.h"
+#include "../sd/SdFile.h"
+
+class GCodeCache {
+public:
+  static void select(SdFile * const dir, const char * const fname);
+  static void begin(SdFile &src);
+  static void finish();
+  static void abort();
+
+  static inline bool active() { return state != CACHE_IDLE; }
+  static inline bool recording() { return state == CACHE_RECORD; }
+  static inline bool replaying() { return state == CACHE_REPLAY; }
+
+  static uint16_t read(char * const dst, bool &record);
+  static void write(const char * const cmd, const uint32_t sdpos);
+
+private:
+  enum CacheState : uint8_t { CACHE_IDLE, CACHE_RECORD, CACHE_REPLAY };
+
+  typedef struct {
+    char magic[4];
+    uint32_t size;                      // Size of the G-code file
+    uint16_t date, time;                // Last write of the G-code file
+  } cache_header_t;
+
+  static CacheState state;
+  static SdFile dir, file;
+  static char name[13];                 // 8.3 name of the cache file
+  static cache_header_t header;
+  static uint8_t buffer[512];
+  static uint16_t buffer_pos, buffer_len;
+  static uint32_t last_sdpos;           // File position of the last command
+
+  static int16_t get();
+  static bool put(const uint8_t c);
+  static bool flush();
+  static void fail();
+  static uint8_t encode(uint8_t * const dst, const char *p);
+};
+
+extern GCodeCache gcode_cache;
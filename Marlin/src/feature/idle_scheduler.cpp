@@ -0,0 +1,119 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * idle_scheduler.cpp - Run the idle() tasks to periods, deadlines and a time budget
+ *
+ * idle() used to run every task on every pass, so a slow LCD redraw or a
+ * media check held up the queue and the planner just as much while the
+ * planner was running dry as while it was full. Tasks now declare how often
+ * they need to run and, for work that can wait, how long it may be put off.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(IDLE_TASK_SCHEDULER)
+
+#include "idle_scheduler.h"
+#include "../gcode/queue.h"
+#include "../module/planner.h"
+
+IdleScheduler idle_scheduler;
+
+millis_t IdleScheduler::stats_start_ms; // = 0
+uint32_t IdleScheduler::passes,         // = 0
+         IdleScheduler::over_budget,    // = 0
+         IdleScheduler::max_pass_us;    // = 0
+
+void IdleScheduler::run(const bool setup_done) {
+  const millis_t ms = millis();
+  const uint32_t pass_start_us = micros();
+
+  // Hold background tasks while the planner is running low on moves it could have.
+  // Waits with nothing moving (M109, M190, G28, G29 probing) never hold them.
+  const bool starved = planner.has_blocks_queued() && queue.has_commands_queued() && planner.movesplanned() < (IDLE_MIN_PLANNED_MOVES);
+  bool spent = false;
+
+  LOOP_L_N(i, idle_task_count) {
+    const idle_task_t &task = idle_tasks[i];
+    if (!setup_done && !task.at_boot) continue;
+
+    task_stats_t &st = stats[i];
+    if (task.period_ms && PENDING(ms, st.last_ms + task.period_ms)) continue;
+    if (task.deadline_ms && (starved || spent) && PENDING(ms, st.last_ms + task.deadline_ms)) {
+      st.held++;
+      continue;
+    }
+
+    st.last_ms = ms;
+    const uint32_t start_us = micros();
+    task.run();
+    const uint32_t end_us = micros(), us = end_us - start_us;
+    st.runs++;
+    st.total_us += us;
+    NOLESS(st.max_us, us);
+
+    // Later background tasks wait for the next pass once this one has had its time
+    if (!spent && end_us - pass_start_us >= (IDLE_TIME_BUDGET_US)) {
+      spent = true;
+      over_budget++;
+    }
+  }
+
+  passes++;
+  NOLESS(max_pass_us, micros() - pass_start_us);
+}
+
+/**
+ * Report the time taken by each task since the last reset:
+ * runs, average and longest run, passes held, and share of the time.
+ */
+void IdleScheduler::report() {
+  const millis_t elapsed_ms = _MAX(millis() - stats_start_ms, 1UL);
+  SERIAL_ECHO_START();
+  SERIAL_ECHOLNPAIR("Idle ", passes, " passes in ", elapsed_ms, " ms, longest ", max_pass_us,
+                    " us, over budget ", over_budget, ", ", int(planner.movesplanned()), " moves planned");
+  uint64_t total_us = 0;
+  LOOP_L_N(i, idle_task_count) {
+    const task_stats_t &st = stats[i];
+    total_us += st.total_us;
+    SERIAL_ECHO_START();
+    SERIAL_ECHOPAIR(" ", idle_tasks[i].name, ": runs ", st.runs,
+                    " avg ", st.runs ? uint32_t(st.total_us / st.runs) : 0UL, " us max ", st.max_us, " us");
+    if (idle_tasks[i].deadline_ms) SERIAL_ECHOPAIR(" held ", st.held);
+    SERIAL_ECHOLNPAIR(" load ", float(st.total_us) / (elapsed_ms * 10), "%");
+  }
+  SERIAL_ECHO_START();
+  SERIAL_ECHOLNPAIR(" Total load ", float(total_us) / (elapsed_ms * 10), "%");
+}
+
+void IdleScheduler::reset_stats() {
+  LOOP_L_N(i, idle_task_count) {
+    task_stats_t &st = stats[i];
+    st.runs = st.held = st.max_us = 0;
+    st.total_us = 0;
+  }
+  passes = over_budget = max_pass_us = 0;
+  stats_start_ms = millis();
+}
+
+#endif // IDLE_TASK_SCHEDULER
@@ -0,0 +1,74 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * idle_scheduler.h - Run the idle() tasks to periods, deadlines and a time budget
+ */
+
+#include "../inc/MarlinConfigPre.h"
+#include "../core/millis_t.h"
+
+/**
+ * One task of idle(), in the table in MarlinCore.cpp. The table is in order of
+ * priority. A foreground task (deadline_ms = 0) runs whenever it's due. A
+ * background task (deadline_ms > 0) waits while moves and commands are queued
+ * and the planner holds fewer than IDLE_MIN_PLANNED_MOVES, or once the pass
+ * has used IDLE_TIME_BUDGET_US, until it's deadline_ms since it last ran.
+ */
+typedef struct {
+  const char *name;
+  void (*run)();
+  uint16_t period_ms;     // Run at most this often, 0 for every pass
+  uint16_t deadline_ms;   // Longest a background task may wait, 0 for a foreground task
+  bool at_boot;           // Run before setup() is complete
+} idle_task_t;
+
+extern const idle_task_t idle_tasks[];
+extern const uint8_t idle_task_count;
+
+#if ENABLED(IDLE_TASK_SCHEDULER)
+
+class IdleScheduler {
+public:
+  typedef struct {
+    millis_t last_ms;     // When the task last ran
+    uint32_t runs,        // Times the task ran
+             held,        // Passes the task was due but held for motion or the budget
+             max_us;      // Longest run
+    uint64_t total_us;    // Time spent in the task
+  } task_stats_t;
+
+  static task_stats_t stats[];   // One for each of idle_tasks[]
+
+  static void run(const bool setup_done);
+  static void report();
+  static void reset_stats();
+
+private:
+  static millis_t stats_start_ms;
+  static uint32_t passes, over_budget, max_pass_us;
+};
+
+extern IdleScheduler idle_scheduler;
+
+#endif // IDLE_TASK_SCHEDULER
@@ -0,0 +1,84 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * input_shaping.cpp - Cancel X and Y ringing by shaping the step timeline
+ *
+ * An axis that rings at frequency f with damping ratio zeta, hit by an impulse,
+ * swings with the damped period Td = 1 / (f * sqrt(1 - zeta^2)). A second impulse
+ * half a period later, scaled by the decay K over that half period, cancels the
+ * swing (ZV). ZVD convolves that pair with itself, and EI spreads three impulses
+ * to leave 5% of the ringing, both to cope with a frequency that's a little out.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(INPUT_SHAPING)
+
+#include "input_shaping.h"
+
+void ShapedAxis::configure() {
+  head = tail[0] = tail[1] = 0;
+  head_time = tail_time[0] = tail_time[1] = 0;
+  overflows = 0;
+
+  enabled = params.frequency > 0;
+  if (!enabled) {
+    echoes = 1;
+    amplitude[0] = SHAPING_UNIT;
+    amplitude[1] = amplitude[2] = 0;
+    delay[0] = delay[1] = 0;
+    max_rate = 0;
+    return;
+  }
+
+  const float df = SQRT(1.0f - sq(params.zeta)),
+              K = expf(-params.zeta * float(M_PI) / df),      // Decay over half a period
+              td = 1.0f / (params.frequency * df);            // Damped period in seconds
+
+  float a[3];
+  switch (params.type) {
+    case SHAPER_ZV:  a[0] = 1.0f; a[1] = K; a[2] = 0; break;
+    default:
+    case SHAPER_ZVD: a[0] = 1.0f; a[1] = 2.0f * K; a[2] = sq(K); break;
+    case SHAPER_EI: {
+      constexpr float v = 0.05f;                              // Vibration left at the design frequency
+      a[0] = 0.25f * (1.0f + v); a[1] = 0.5f * (1.0f - v) * K; a[2] = a[0] * sq(K);
+    } break;
+  }
+  echoes = params.type == SHAPER_ZV ? 1 : 2;
+
+  // Round the echoes and give the first impulse the rest, so the sum is one step exactly
+  const float scale = SHAPING_UNIT / (a[0] + a[1] + a[2]);
+  amplitude[1] = LROUND(a[1] * scale);
+  amplitude[2] = LROUND(a[2] * scale);
+  amplitude[0] = SHAPING_UNIT - amplitude[1] - amplitude[2];
+
+  delay[0] = LROUND(0.5f * td * (STEPPER_TIMER_RATE));
+  delay[1] = LROUND(td * (STEPPER_TIMER_RATE));
+
+  // A step stays queued until the last echo, plus a filler for each long gap between steps
+  const uint32_t d = delay[echoes - 1];
+  max_rate = float(SHAPING_BUFFER_SIZE - 2 - d / SHAPING_MAX_GAP) * (STEPPER_TIMER_RATE) / d;
+}
+
+#endif // INPUT_SHAPING
@@ -0,0 +1,244 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * input_shaping.h - Cancel X and Y ringing by shaping the step timeline
+ */
+
+#include "../inc/MarlinConfig.h"
+
+enum ShaperType : uint8_t { SHAPER_ZV, SHAPER_ZVD, SHAPER_EI };
+
+typedef struct {
+  float frequency;          // (Hz) Ringing frequency to cancel, 0 for no shaping
+  float zeta;               // Damping ratio of the ringing
+  ShaperType type;
+} shaping_params_t;
+
+#if ENABLED(INPUT_SHAPING)
+
+#define SHAPING_ONE       0x10000L    // One motor step in the shaping accumulators
+#define SHAPING_NEVER     0xFFFFFFFF
+#define SHAPING_MAX_GAP   0x3FFF      // Longest time between steps one queue entry holds
+#define SHAPING_DOUBLE    0x4000      // Two steps at once in a queue entry
+#define SHAPING_REVERSE   0x8000      // Direction bit of a queue entry
+#define SHAPING_FILLER    0xFFFF      // Queue entry for SHAPING_MAX_GAP ticks without a step
+
+// A step of an XY motor moves X and Y a step each on a Cartesian machine, half a step each on CoreXY
+#if CORE_IS_XY
+  #define SHAPING_UNIT (SHAPING_ONE / 2)
+#else
+  #define SHAPING_UNIT SHAPING_ONE
+#endif
+
+/**
+ * The shaping of X or Y
+ *
+ * Each step of the axis is split into impulses: the first moves the axis right
+ * away and the echoes move it half a ringing period and a whole period later,
+ * the amplitudes summing to one step. The steps are queued for the echoes as the
+ * ticks since the previous step plus the direction, and steps taken at the same
+ * time share an entry.
+ */
+class ShapedAxis {
+public:
+  shaping_params_t params;
+  bool enabled;             // Steps are shaped, not just passed on
+  uint8_t echoes = 1;       // 1 for ZV, 2 for ZVD and EI
+  int32_t amplitude[3];     // Impulses in SHAPING_ONE units, summing to SHAPING_UNIT
+  uint32_t delay[2];        // Echo delays in stepper timer ticks
+  float max_rate;           // Queue entries per second the queue holds over the last echo's delay
+  uint16_t overflows;       // Steps passed on unshaped because the queue was full
+
+  // Work out the impulses for params, with nothing queued.
+  // Only call this while the axis isn't moving.
+  void configure();
+
+  // Echoes are still to come
+  FORCE_INLINE bool busy() const { return tail[echoes - 1] != head; }
+
+  // Queue a step taken at the given time, returning the move of its first impulse
+  FORCE_INLINE int32_t command(const bool neg, const uint32_t now) {
+    const int32_t unit = neg ? -SHAPING_UNIT : SHAPING_UNIT;
+    if (!enabled) return unit;
+
+    const int32_t first = neg ? -amplitude[0] : amplitude[0];
+    if (!busy())
+      head_time = tail_time[0] = tail_time[1] = now;
+    else if (head_time == now && tail[0] != head) {
+      // Fold the step into the one queued at the same time, which no echo has reached yet
+      const uint16_t i = prev(head), e = buffer[i];
+      if ((e & SHAPING_MAX_GAP) != SHAPING_MAX_GAP) {
+        if (bool(e & SHAPING_REVERSE) != neg) {   // The other way: one step or both go
+          if (e & SHAPING_DOUBLE)
+            buffer[i] = e & ~SHAPING_DOUBLE;
+          else {
+            head = i;
+            head_time -= e & SHAPING_MAX_GAP;
+          }
+          return first;
+        }
+        if (!(e & SHAPING_DOUBLE)) { buffer[i] = e | SHAPING_DOUBLE; return first; }
+      }
+    }
+
+    uint32_t gap = now - head_time;
+    const uint16_t fillers = gap / SHAPING_MAX_GAP;
+    if (free_count() <= fillers) {                // No room for the echoes: take the whole step now
+      overflows++;
+      return unit;
+    }
+    for (; gap >= SHAPING_MAX_GAP; gap -= SHAPING_MAX_GAP) push(SHAPING_FILLER);
+    push(uint16_t(gap) | (neg ? SHAPING_REVERSE : 0));
+    head_time = now;
+    return first;
+  }
+
+  // Apply the echoes due by the given time, returning their move
+  FORCE_INLINE int32_t echo(const uint32_t now) {
+    int32_t move = 0;
+    LOOP_L_N(k, echoes) {
+      while (tail[k] != head && int32_t(now - due(k)) >= 0) {
+        const uint16_t e = buffer[tail[k]];
+        tail_time[k] += e & SHAPING_MAX_GAP;
+        if (e != SHAPING_FILLER) {
+          const int32_t a = (e & SHAPING_DOUBLE) ? 2 * amplitude[k + 1] : amplitude[k + 1];
+          move += (e & SHAPING_REVERSE) ? -a : a;
+        }
+        tail[k] = next(tail[k]);
+      }
+    }
+    return move;
+  }
+
+  // Ticks from the given time to the next echo, or SHAPING_NEVER
+  FORCE_INLINE uint32_t next_echo(const uint32_t now) const {
+    uint32_t ticks = SHAPING_NEVER;
+    LOOP_L_N(k, echoes) if (tail[k] != head) {
+      const int32_t t = due(k) - now;
+      NOMORE(ticks, uint32_t(_MAX(t, 0)));
+    }
+    return ticks;
+  }
+
+private:
+  uint16_t buffer[SHAPING_BUFFER_SIZE];
+  uint16_t head,            // Where the next step goes
+           tail[2];         // The next step each echo applies
+  uint32_t head_time,       // Time of the last queued step
+           tail_time[2];    // Time of the last step each echo applied
+
+  static FORCE_INLINE uint16_t next(const uint16_t i) { return i + 1 < SHAPING_BUFFER_SIZE ? i + 1 : 0; }
+  static FORCE_INLINE uint16_t prev(const uint16_t i) { return (i ? i : SHAPING_BUFFER_SIZE) - 1; }
+
+  FORCE_INLINE uint16_t free_count() const {
+    const int16_t used = head - tail[echoes - 1];
+    return SHAPING_BUFFER_SIZE - 1 - (used < 0 ? used + SHAPING_BUFFER_SIZE : used);
+  }
+
+  FORCE_INLINE void push(const uint16_t e) { buffer[head] = e; head = next(head); }
+
+  FORCE_INLINE uint32_t due(const uint8_t k) const { return tail_time[k] + (buffer[tail[k]] & SHAPING_MAX_GAP) + delay[k]; }
+};
+
+/**
+ * Input shaping of the XY motors
+ *
+ * The commanded steps of the X and Y motors (A and B on CoreXY) are split into
+ * steps of the X and Y axes and shaped. The shaped moves are added back up for
+ * each motor, and the motor steps whenever its shaped position is half a step
+ * away. Motors end every move on the commanded position, an echo delay later
+ * than they would unshaped.
+ */
+class InputShaper {
+public:
+  ShapedAxis x, y;
+  bool enabled;             // Either axis is shaped: the shaper steps the XY motors and sets their DIR pins
+  xy_long_t error;          // Shaped position less the position of each motor
+  xy_bool_t reverse;        // Each motor's DIR pin is set for negative steps
+
+  FORCE_INLINE ShapedAxis& axis(const AxisEnum a) { return a == Y_AXIS ? y : x; }
+
+  // Set up both axes from their params, with nothing queued
+  void configure() {
+    x.configure();
+    y.configure();
+    enabled = x.enabled || y.enabled;
+    error.reset();
+  }
+
+  FORCE_INLINE bool busy() const { return x.busy() || y.busy(); }
+
+  // The fraction of a move's speed, up to 1, whose steps fit the queues. The move takes
+  // steps_x and steps_y steps of the X and Y motors (A and B on CoreXY) in the given
+  // step events, moves_per_sec times a second. Steps taken in one event share an entry.
+  float speed_limit(const uint32_t steps_x, const uint32_t steps_y, const uint32_t events, const float moves_per_sec) const {
+    #if CORE_IS_XY
+      const float rx = _MIN(steps_x + steps_y, events) * moves_per_sec, ry = rx;  // Both motors queue on both axes
+    #else
+      const float rx = steps_x * moves_per_sec, ry = steps_y * moves_per_sec;
+    #endif
+    float f = 1.0f;
+    if (x.enabled && rx > x.max_rate) f = x.max_rate / rx;
+    if (y.enabled && ry > y.max_rate) NOMORE(f, y.max_rate / ry);
+    return f;
+  }
+
+  // Queue a commanded step of the X or Y motor (A or B on CoreXY)
+  FORCE_INLINE void command(const AxisEnum motor, const bool neg, const uint32_t now) {
+    #if CORE_IS_XY
+      // Half a step on each axis, the same way for A and opposite ways for B
+      const bool b = motor == B_AXIS;
+      move(x.command(neg ^ (b && CORESIGN(1) < 0), now), y.command(neg ^ (b && CORESIGN(1) > 0), now));
+    #else
+      if (motor == Y_AXIS) error.y += y.command(neg, now); else error.x += x.command(neg, now);
+    #endif
+  }
+
+  // Apply the echoes due by the given time
+  FORCE_INLINE void echo(const uint32_t now) { move(x.echo(now), y.echo(now)); }
+
+  // Ticks from the given time to the next echo, or SHAPING_NEVER
+  FORCE_INLINE uint32_t next_echo(const uint32_t now) const { return _MIN(x.next_echo(now), y.next_echo(now)); }
+
+  // Take the step a motor needs, if any: 1, -1 or 0
+  FORCE_INLINE int8_t step(const AxisEnum motor) {
+    int32_t &e = error[motor];
+    if (e >= SHAPING_ONE / 2) { e -= SHAPING_ONE; return 1; }
+    if (e < -SHAPING_ONE / 2) { e += SHAPING_ONE; return -1; }
+    return 0;
+  }
+
+private:
+  FORCE_INLINE void move(const int32_t dx, const int32_t dy) {
+    #if CORE_IS_XY
+      error.a += dx + dy;
+      error.b += CORESIGN(dx - dy);
+    #else
+      error.x += dx;
+      error.y += dy;
+    #endif
+  }
+};
+
+#endif // INPUT_SHAPING
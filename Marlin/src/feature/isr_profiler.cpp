@@ -0,0 +1,114 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * isr_profiler.cpp - Count the CPU cycles taken by the stepper and temperature ISRs
+ *
+ * The step ISR limits in stepper.h are worked out from cycle counts measured
+ * long ago on other processors. This measures the real costs on this board,
+ * with the hardware cycle counter, for M578 and for MEASURED_STEP_ISR_LIMITS.
+ * The counts run from the start to the end of each ISR, so they include
+ * anything that preempts it.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(ISR_PROFILING)
+
+#include "isr_profiler.h"
+
+ISRProfiler isr_profiler;
+
+ISRProfiler::isr_stats_t ISRProfiler::stats[ISR_PROFILE_COUNT];
+
+void ISRProfiler::init() {
+  HAL_cycle_counter_init();
+  reset();
+}
+
+void ISRProfiler::reset() {
+  CRITICAL_SECTION_START();
+  LOOP_L_N(i, ISR_PROFILE_COUNT) {
+    stats[i] = isr_stats_t();
+    stats[i].min = UINT32_MAX;
+  }
+  CRITICAL_SECTION_END();
+}
+
+// The most cycles in the given fraction of runs, from the histogram. Each bucket counts
+// up to twice its lowest count, so this rounds up to the top of its bucket, or the max.
+static uint32_t percentile(const ISRProfiler::isr_stats_t &s, const uint32_t permille) {
+  const uint32_t want = uint64_t(s.count) * permille / 1000;
+  uint32_t seen = 0;
+  LOOP_L_N(b, ISR_PROFILE_BUCKETS - 1) {
+    seen += s.histogram[b];
+    if (seen >= want) return _MIN((2UL << b) - 1, s.max);
+  }
+  return s.max;
+}
+
+bool ISRProfiler::step_isr_costs(uint32_t &base, uint32_t &per_step) {
+  CRITICAL_SECTION_START();
+  const isr_stats_t &o = stats[ISR_PROFILE_OVERHEAD], &s = stats[ISR_PROFILE_STEP];
+  // Wait for enough stepping to go by
+  const bool ok = o.count >= 1000 && s.count >= 1000;
+  if (ok) {
+    base = percentile(o, STEP_ISR_PERCENTILE);
+    per_step = percentile(s, STEP_ISR_PERCENTILE);
+  }
+  CRITICAL_SECTION_END();
+  return ok;
+}
+
+void ISRProfiler::report(const bool histogram) {
+  static const char * const names[ISR_PROFILE_COUNT] = {
+    "stepper", "pulse", "block", "advance", "babystep", "shaping", "temperature", "step", "overhead"
+  };
+
+  SERIAL_ECHO_START();
+  SERIAL_ECHOLNPAIR("ISR cycles at ", int((F_CPU) / 1000000UL), " MHz");
+  LOOP_L_N(i, ISR_PROFILE_COUNT) {
+    // Copy the counts so the ISRs can't change them part way through
+    CRITICAL_SECTION_START();
+    const isr_stats_t s = stats[i];
+    CRITICAL_SECTION_END();
+    if (!s.count) continue;
+
+    SERIAL_ECHO_START();
+    SERIAL_ECHOLNPAIR(" ", names[i], ": runs ", s.count, " min ", s.min,
+                      " avg ", uint32_t(s.total / s.count), " max ", s.max,
+                      " (", s.max / ((F_CPU) / 1000000UL), " us)");
+    if (histogram) {
+      SERIAL_ECHO_START();
+      SERIAL_ECHOPGM("  ");
+      LOOP_L_N(b, ISR_PROFILE_BUCKETS) if (s.histogram[b]) {
+        if (b < ISR_PROFILE_BUCKETS - 1)
+          SERIAL_ECHOPAIR(" <", 2UL << b, ":", s.histogram[b]);
+        else
+          SERIAL_ECHOPAIR(" >=", 1UL << b, ":", s.histogram[b]);
+      }
+      SERIAL_EOL();
+    }
+  }
+}
+
+#endif // ISR_PROFILING
@@ -0,0 +1,84 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * isr_profiler.h - Count the CPU cycles taken by the stepper and temperature ISRs
+ */
+
+#include "../inc/MarlinConfig.h"
+
+enum ISRProfileID : uint8_t {
+  ISR_PROFILE_STEPPER,      // Stepper::isr()
+  ISR_PROFILE_PULSE,        // Stepper::pulse_phase_isr()
+  ISR_PROFILE_BLOCK,        // Stepper::block_phase_isr()
+  ISR_PROFILE_ADVANCE,      // Stepper::advance_isr()
+  ISR_PROFILE_BABYSTEP,     // Stepper::babystepping_isr()
+  ISR_PROFILE_SHAPING,      // Stepper::shaping_isr()
+  ISR_PROFILE_TEMPERATURE,  // Temperature::tick()
+  ISR_PROFILE_STEP,         // Each step of a pulse phase
+  ISR_PROFILE_OVERHEAD,     // Stepper::isr() less its pulse phases, when it steps
+  ISR_PROFILE_COUNT
+};
+
+#define ISR_PROFILE_BUCKETS 16  // Runs counted by log2(cycles), the last for 2^15 cycles and up
+#define STEP_ISR_PERCENTILE 990 // Per mille of step ISR runs the measured costs cover
+
+class ISRProfiler {
+public:
+  typedef struct {
+    uint32_t count, min, max;
+    uint64_t total;
+    uint32_t histogram[ISR_PROFILE_BUCKETS];
+  } isr_stats_t;
+
+  static isr_stats_t stats[ISR_PROFILE_COUNT];
+
+  static void init();
+  static void reset();
+  static void report(const bool histogram);
+
+  static inline uint32_t now() { return HAL_cycle_count(); }
+
+  // Add one run of an ISR, from the cycle count when it started
+  static inline uint32_t record(const ISRProfileID id, const uint32_t start) {
+    const uint32_t cycles = now() - start;
+    add(id, cycles);
+    return cycles;
+  }
+
+  static inline void add(const ISRProfileID id, const uint32_t cycles) {
+    isr_stats_t &s = stats[id];
+    s.count++;
+    s.total += cycles;
+    NOMORE(s.min, cycles);
+    NOLESS(s.max, cycles);
+    s.histogram[_MIN(ISR_PROFILE_BUCKETS - 1, 31 - __builtin_clz(cycles | 1))]++;
+  }
+
+  // The cycles a stepping ISR takes apart from its steps, and for each step, that all
+  // but the slowest runs stay within. Not the max, which counts any run that something
+  // else preempted. False until there are enough samples to go by.
+  static bool step_isr_costs(uint32_t &base, uint32_t &per_step);
+};
+
+extern ISRProfiler isr_profiler;
@@ -34,6 +34,7 @@
   // Use 16-bit (or fastest) data for the integer mix factors
   typedef uint_fast16_t mixer_comp_t;
   typedef uint_fast16_t mixer_accu_t;
+  typedef uint16_t mixer_block_comp_t;  // Planner blocks keep the mix in 16 bits
   #define COLOR_A_MASK 0x8000
   #define COLOR_MASK 0x7FFF
 #else
@@ -42,6 +43,7 @@
   #define MIXER_ACCU_SIGNED
   typedef uint8_t mixer_comp_t;
   typedef int8_t mixer_accu_t;
+  typedef uint8_t mixer_block_comp_t;
   #define COLOR_A_MASK 0x80
   #define COLOR_MASK 0x7F
 #endif
@@ -137,7 +139,7 @@ class Mixer {
   }
 
   // Used when dealing with blocks
-  FORCE_INLINE static void populate_block(mixer_comp_t b_color[MIXING_STEPPERS]) {
+  FORCE_INLINE static void populate_block(mixer_block_comp_t b_color[MIXING_STEPPERS]) {
     #if ENABLED(GRADIENT_MIX)
     if (gradient.enabled) {
       MIXER_STEPPER_LOOP(i) b_color[i] = gradient.color[i];
@@ -147,7 +149,7 @@ class Mixer {
     MIXER_STEPPER_LOOP(i) b_color[i] = color[selected_vtool][i];
   }
 
-  FORCE_INLINE static void stepper_setup(mixer_comp_t b_color[MIXING_STEPPERS]) {
+  FORCE_INLINE static void stepper_setup(mixer_block_comp_t b_color[MIXING_STEPPERS]) {
     MIXER_STEPPER_LOOP(i) s_color[i] = b_color[i];
   }
 
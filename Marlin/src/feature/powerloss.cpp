@@ -39,6 +39,10 @@ const char PrintJobRecovery::filename[5] = "/PLR";
 uint8_t PrintJobRecovery::queue_index_r;
 uint32_t PrintJobRecovery::cmd_sdpos, // = 0
          PrintJobRecovery::sdpos[BUFSIZE];
+uint8_t PrintJobRecovery::slot; // = 0
+uint16_t PrintJobRecovery::records, // = 0
+         PrintJobRecovery::header_crc, // = 0
+         PrintJobRecovery::static_crc; // = 0
 
 #if HAS_DWIN_LCD
   #include "../lcd/dwin/dwin_ui/dwin.h"
@@ -54,6 +58,7 @@ uint32_t PrintJobRecovery::cmd_sdpos, // = 0
 #include "../module/printcounter.h"
 #include "../module/temperature.h"
 #include "../core/serial.h"
+#include "../libs/crc16.h"
 #include "pause.h"
 
 #if ENABLED(FWRETRACT)
@@ -82,7 +87,33 @@ PrintJobRecovery recovery;
 /**
  * Clear the recovery info
  */
-void PrintJobRecovery::init() { memset(&info, 0, sizeof(info)); }
+void PrintJobRecovery::init() {
+  memset(&info, 0, sizeof(info));
+  header_crc = 0;
+}
+
+// CRC of the fields that are only written with a header
+static uint16_t static_fields_crc() {
+  const uint8_t * const start = (const uint8_t*)&recovery.info.print_job_elapsed + sizeof(recovery.info.print_job_elapsed),
+                * const end = (const uint8_t*)&recovery.info.valid_foot;
+  uint16_t crc = 0;
+  crc16(&crc, start, end - start);
+  return crc;
+}
+
+// CRC of a header as written. Never 0, which means no header.
+static uint16_t header_check(const job_recovery_info_t &header) {
+  uint16_t crc = 0;
+  crc16(&crc, &header, sizeof(header));
+  return crc ? crc : 1;
+}
+
+// A delta's check, tying it to the header it follows
+uint16_t PrintJobRecovery::delta_check(const job_recovery_delta_t &delta) {
+  uint16_t crc = header_crc;
+  crc16(&crc, &delta, offsetof(job_recovery_delta_t, check));
+  return crc ? crc : 1;
+}
 
 /**
  * Enable or disable then call changed()
@@ -127,12 +158,47 @@ void PrintJobRecovery::purge() {
 }
 
 /**
- * Load the recovery data, if it exists
+ * Load the recovery data, if it exists: the newer of the two headers,
+ * updated by every complete delta journaled after it
  */
 void PrintJobRecovery::load() {
-  if (exists()) {
-    open(true);
-    (void)file.read(&info, sizeof(info));
+  init();
+  records = 0;
+  if (exists() && open(true)) {
+    job_recovery_info_t header;
+    uint16_t crc;
+    LOOP_L_N(s, 2) {
+      if (file.seekSet(s * slot_size)
+        && file.read(&header, sizeof(header)) == sizeof(header)
+        && file.read(&crc, sizeof(crc)) == sizeof(crc)
+        && crc == header_check(header) && header.valid()
+        && (!header_crc || int8_t(header.valid_head - info.valid_head) > 0)
+      ) {
+        info.valid_head = header.valid_head;
+        header_crc = crc;
+        slot = s;
+      }
+    }
+
+    if (header_crc && file.seekSet(slot * slot_size) && file.read(&info, sizeof(info)) == sizeof(info)) {
+      job_recovery_delta_t delta;
+      file.seekSet(slot * slot_size + header_size);
+      while (records < POWER_LOSS_JOURNAL_RECORDS
+        && file.read(&delta, sizeof(delta)) == sizeof(delta)
+        && delta.check == delta_check(delta)
+      ) {
+        info.current_position = delta.current_position;
+        info.zraise = delta.zraise;
+        info.sdpos = delta.sdpos;
+        info.print_job_elapsed = delta.print_job_elapsed;
+        info.feedrate = delta.feedrate;
+        records++;
+      }
+      static_crc = static_fields_crc();
+    }
+    else
+      init();
+
     close();
   }
   debug(PSTR("Load"));
@@ -144,6 +210,7 @@ void PrintJobRecovery::load() {
 void PrintJobRecovery::prepare() {
   card.getAbsFilename(info.sd_filename);  // SD filename
   cmd_sdpos = 0;
+  header_crc = 0;                         // A new job starts with a header
 }
 
 /**
@@ -177,11 +244,6 @@ void PrintJobRecovery::save(const bool force/*=false*/, const float zraise/*=0*/
       next_save_ms = ms + SAVE_INFO_INTERVAL_MS;
     #endif
 
-    // Set Head and Foot to matching non-zero values
-    if (!++info.valid_head) ++info.valid_head; // non-zero in sequence
-    //if (!IS_SD_PRINTING()) info.valid_head = 0;
-    info.valid_foot = info.valid_head;
-
     // Machine state
     info.current_position = current_position;
     info.zraise = zraise;
@@ -329,19 +391,71 @@ void PrintJobRecovery::save(const bool force/*=false*/, const float zraise/*=0*/
 #endif
 
 /**
- * Save the recovery info the recovery file
+ * Save the recovery info to the recovery file. Usually only the head has
+ * moved, so a small delta is journaled after the current header. A new
+ * header is written for a new job, when anything else has changed, or
+ * when the journal is full.
  */
 void PrintJobRecovery::write() {
 
   debug(PSTR("Write"));
 
-  open(false);
-  file.seekSet(0);
-  const int16_t ret = file.write(&info, sizeof(info));
-  if (ret == -1) DEBUG_ECHOLNPGM("Power-loss file write failed.");
+  if (!open(false)) return;
+
+  const uint16_t crc = static_fields_crc();
+  bool ok;
+  if (!header_crc || crc != static_crc || records >= POWER_LOSS_JOURNAL_RECORDS) {
+    ok = write_header();
+    if (ok) static_crc = crc;               // Until a header is written, deltas can't stand for it
+  }
+  else
+    ok = write_delta();
+
+  if (!ok) DEBUG_ECHOLNPGM("Power-loss file write failed.");
   if (!file.close()) DEBUG_ECHOLNPGM("Power-loss file close failed.");
 }
 
+/**
+ * Write all the recovery info as a header in the other slot, starting a new
+ * journal. Until it's complete the previous header and journal are intact,
+ * and they stay current if it fails, so a retry goes to the same slot.
+ */
+bool PrintJobRecovery::write_header() {
+  const uint8_t s = slot ^ 1;
+
+  // Set Head and Foot to matching non-zero values
+  if (!++info.valid_head) ++info.valid_head; // non-zero in sequence
+  info.valid_foot = info.valid_head;
+
+  const uint16_t crc = header_check(info);
+  if (!file.seekSet(s * slot_size)
+    || file.write(&info, sizeof(info)) != sizeof(info)
+    || file.write(&crc, sizeof(crc)) != sizeof(crc)
+  ) return false;
+  slot = s;
+  records = 0;
+  header_crc = crc;
+  return true;
+}
+
+/**
+ * Append the fields that change with every save to the journal
+ */
+bool PrintJobRecovery::write_delta() {
+  job_recovery_delta_t delta;
+  delta.current_position = info.current_position;
+  delta.zraise = info.zraise;
+  delta.sdpos = info.sdpos;
+  delta.print_job_elapsed = info.print_job_elapsed;
+  delta.feedrate = info.feedrate;
+  delta.check = delta_check(delta);
+  if (!file.seekSet(slot * slot_size + header_size + records * sizeof(delta))
+    || file.write(&delta, sizeof(delta)) != sizeof(delta)
+  ) return false;
+  records++;
+  return true;
+}
+
 /**
  * Resume the saved print job
  */
@@ -606,7 +720,8 @@ void PrintJobRecovery::resume() {
 void PrintJobRecovery::debug(PGM_P const prefix) {
   DEBUG_PRINT_P(prefix);
   DEBUG_ECHOLNPAIR(" Job Recovery Info...\nvalid_head:", int(info.valid_head), " valid_foot:", int(info.valid_foot));
-	DEBUG_ECHOLNPAIR(" Size of Recovery file = ", sizeof(info));
+	DEBUG_ECHOLNPAIR(" Size of Recovery file = ", journal_size);
+  DEBUG_ECHOLNPAIR(" Header slot:", int(slot), " records:", records);
   if (info.valid_head) {
     if (info.valid_head == info.valid_foot) {
       DEBUG_ECHOPGM("current_position: ");
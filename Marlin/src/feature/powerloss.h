@@ -42,12 +42,26 @@
 //#define SAVE_EACH_CMD_MODE
 //#define SAVE_INFO_INTERVAL_MS 0
 
+// Saves journaled after each header before a new header is written
+#ifndef POWER_LOSS_JOURNAL_RECORDS
+  #define POWER_LOSS_JOURNAL_RECORDS 64
+#endif
+
 typedef struct {
   uint8_t valid_head;
 
-  // Machine state
+  // Machine state. These change with every save and are journaled.
   xyze_pos_t current_position;
   float zraise;
+  uint16_t feedrate;
+
+  // SD position
+  volatile uint32_t sdpos;
+
+  // Job elapsed time
+  millis_t print_job_elapsed;
+
+  // The rest is only written with a header, when it changes
 
   #if HAS_HOME_OFFSET
     xyz_pos_t home_offset;
@@ -56,8 +70,6 @@ typedef struct {
     xyz_pos_t position_shift;
   #endif
 
-  uint16_t feedrate;
-
   #if HAS_MULTI_EXTRUDER || ENABLED(MIXING_EXTRUDER)
     uint8_t active_extruder;
   #endif
@@ -102,12 +114,8 @@ typedef struct {
   // Relative axis modes
   uint8_t axis_relative;
 
-  // SD Filename and position
+  // SD Filename
   char sd_filename[MAXPATHNAMELENGTH];
-  volatile uint32_t sdpos;
-
-  // Job elapsed time
-  millis_t print_job_elapsed;
 
   // Misc. Marlin flags
   struct {
@@ -126,6 +134,20 @@ typedef struct {
 
 } job_recovery_info_t;
 
+/**
+ * A save that only moved the head, appended to the journal after a header.
+ * The check is seeded with the header's CRC, so records left over from an
+ * earlier header never match.
+ */
+typedef struct {
+  xyze_pos_t current_position;
+  float zraise;
+  uint32_t sdpos;
+  millis_t print_job_elapsed;
+  uint16_t feedrate;
+  uint16_t check;
+} job_recovery_delta_t;
+
 class PrintJobRecovery {
   public:
     static const char filename[5];
@@ -167,7 +189,7 @@ class PrintJobRecovery {
     static void changed();
 
     static inline bool exists() { return card.jobRecoverFileExists(); }
-    static inline void open(const bool read) { card.openJobRecoveryFile(read); }
+    static inline bool open(const bool read) { return card.openJobRecoveryFile(read); }
     static inline void close() { file.close(); }
 
     static void check();
@@ -197,8 +219,23 @@ class PrintJobRecovery {
       static inline void debug(PGM_P const) {}
     #endif
 
+    // The recovery file holds two slots, each a header and its journal.
+    // A new header goes in the other slot, so the last one stays valid
+    // until it is complete.
+    static constexpr uint16_t header_size = (sizeof(job_recovery_info_t) + sizeof(uint16_t) + 511) / 512 * 512;
+    static constexpr uint32_t slot_size = header_size + (POWER_LOSS_JOURNAL_RECORDS) * sizeof(job_recovery_delta_t),
+                              journal_size = 2 * slot_size;
+
   private:
+    static uint8_t slot;            //!< Slot holding the current header
+    static uint16_t records,        //!< Records journaled after it
+                    header_crc,     //!< CRC of the whole header, 0 if there is none yet
+                    static_crc;     //!< CRC of the fields only written with the header
+
     static void write();
+    static bool write_header();
+    static bool write_delta();
+    static uint16_t delta_check(const job_recovery_delta_t &delta);
 
     #if ENABLED(BACKUP_POWER_SUPPLY)
       static void retract_and_lift(const float &zraise);
@@ -34,9 +34,9 @@
 #include "../MarlinCore.h"
 
 #if HAS_DWIN_LCD
-#include "../lcd/dwin/dwin_lcd.h"
+#include "../lcd/dwin/DWIN_LCD.h"
 #include "../lcd/dwin/dwin_ui/dwin.h"
-#include "../lcd/dwin/dwin_ui/dwinmenu_repeatprint.h"
+#include "../lcd/dwin/dwin_ui/DwinMenu_RepeatPrint.h"
 #endif
 
 RePrint ReprintManager;
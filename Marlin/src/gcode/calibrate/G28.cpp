@@ -274,6 +274,13 @@ void GcodeSuite::G28() {
     #endif
   #endif
 
+  #if ENABLED(INPUT_SHAPING)
+    // Home unshaped, so the axes stop right where the endstops trigger
+    const shaping_params_t shaping_x = stepper.shaper.x.params, shaping_y = stepper.shaper.y.params;
+    stepper.set_shaping(X_AXIS, { 0, shaping_x.zeta, shaping_x.type });
+    stepper.set_shaping(Y_AXIS, { 0, shaping_y.zeta, shaping_y.type });
+  #endif
+
   TERN_(IMPROVE_HOMING_RELIABILITY, slow_homing_t slow_homing = begin_slow_homing());
 
   // Always home with tool 0 active
@@ -426,6 +433,11 @@ void GcodeSuite::G28() {
 
   endstops.not_homing();
 
+  #if ENABLED(INPUT_SHAPING)
+    stepper.set_shaping(X_AXIS, shaping_x);
+    stepper.set_shaping(Y_AXIS, shaping_y);
+  #endif
+
   // Clear endstop state for polled stallGuard endstops
   TERN_(SPI_ENDSTOPS, endstops.clear_endstop_state());
 
@@ -0,0 +1,86 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../../inc/MarlinConfig.h"
+
+#if ENABLED(INPUT_SHAPING)
+
+#include "../../gcode.h"
+#include "../../../module/stepper.h"
+
+void M593_report(const AxisEnum axis) {
+  const shaping_params_t &p = stepper.shaper.axis(axis).params;
+  SERIAL_ECHOPAIR("  M593 ", XYZ_CHAR(axis));
+  SERIAL_ECHOLNPAIR(" F", p.frequency, " D", p.zeta, " T", int(p.type));
+}
+
+/**
+ * M593: Set the input shaping of X and Y
+ *
+ *   X         Set X (with neither X nor Y, set both)
+ *   Y         Set Y
+ *   F<hz>     Ringing frequency to cancel, SHAPING_MIN_FREQ and up. F0 turns shaping off.
+ *   D<zeta>   Damping ratio of the ringing (0 to 0.99)
+ *   T<type>   Shaper: 0 = ZV, 1 = ZVD, 2 = EI
+ *
+ * Without F, D or T report the shaping, and the steps that moved unshaped
+ * because the echo queue was full since the axis was last set.
+ */
+void GcodeSuite::M593() {
+  const bool seen_x = parser.seen_test('X'), seen_y = parser.seen_test('Y'),
+             do_x = seen_x || !seen_y, do_y = seen_y || !seen_x;
+
+  if (!parser.seen("FDT")) {
+    LOOP_L_N(a, XY) if (a == X_AXIS ? do_x : do_y) {
+      M593_report(AxisEnum(a));
+      const uint16_t overflows = stepper.shaper.axis(AxisEnum(a)).overflows;
+      if (overflows) SERIAL_ECHOLNPAIR("  ", XYZ_CHAR(a), " steps past the echo queue: ", overflows);
+    }
+    return;
+  }
+
+  if (parser.seenval('F')) {
+    const float f = parser.value_float();
+    if (f != 0 && f < SHAPING_MIN_FREQ) {
+      SERIAL_ECHO_MSG("?(F)requency must be 0 or at least " STRINGIFY(SHAPING_MIN_FREQ) ".");
+      return;
+    }
+  }
+  if (parser.seenval('D') && !WITHIN(parser.value_float(), 0, 0.99f)) {
+    SERIAL_ECHO_MSG("?(D)amping ratio must be from 0 to 0.99.");
+    return;
+  }
+  if (parser.seenval('T') && !WITHIN(parser.value_int(), SHAPER_ZV, SHAPER_EI)) {
+    SERIAL_ECHO_MSG("?(T)ype must be 0 (ZV), 1 (ZVD) or 2 (EI).");
+    return;
+  }
+
+  LOOP_L_N(a, XY) if (a == X_AXIS ? do_x : do_y) {
+    shaping_params_t p = stepper.shaper.axis(AxisEnum(a)).params;
+    if (parser.seenval('F')) p.frequency = parser.value_float();
+    if (parser.seenval('D')) p.zeta = parser.value_float();
+    if (parser.seenval('T')) p.type = ShaperType(parser.value_int());
+    stepper.set_shaping(AxisEnum(a), p);
+  }
+}
+
+#endif // INPUT_SHAPING
@@ -36,6 +36,10 @@ GcodeSuite gcode;
 #include "queue.h"
 #include "../module/motion.h"
 
+#if ENABLED(HEATUP_LOOKAHEAD)
+  #include "../module/temperature.h"
+#endif
+
 #if ENABLED(PRINTCOUNTER)
   #include "../module/printcounter.h"
 #endif
@@ -690,6 +694,10 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
         case 305: M305(); break;                                  // M305: Set user thermistor parameters
       #endif
 
+      #if ENABLED(MPCTEMP)
+        case 306: M306(); break;                                  // M306: MPC settings and autotune
+      #endif
+
       #if ENABLED(REPETIER_GCODE_M360)
         case 360: M360(); break;                                  // M360: Firmware settings
       #endif
@@ -785,6 +793,22 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
         case 575: M575(); break;                                  // M575: Set serial baudrate
       #endif
 
+      #if ENABLED(COMMAND_QUEUE_STATS)
+        case 576: M576(); break;                                  // M576: Report command queue statistics
+      #endif
+
+      #if ENABLED(IDLE_TASK_SCHEDULER)
+        case 577: M577(); break;                                  // M577: Report idle task load
+      #endif
+
+      #if ENABLED(ISR_PROFILING)
+        case 578: M578(); break;                                  // M578: Report ISR cycle counts
+      #endif
+
+      #if ENABLED(INPUT_SHAPING)
+        case 593: M593(); break;                                  // M593: Set input shaping
+      #endif
+
       #if ENABLED(ADVANCED_PAUSE_FEATURE)
         case 600: M600(); break;                                  // M600: Pause for Filament Change
         case 603: M603(); break;                                  // M603: Configure Filament Change
@@ -963,7 +987,8 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
  * This is called from the main loop()
  */
 void GcodeSuite::process_next_command() {
-  char * const current_command = queue.command_buffer[queue.index_r];
+  char * const current_command = queue.command(queue.index_r);
+  const bool record = queue.is_record(queue.index_r);
 
   PORT_REDIRECT(queue.port[queue.index_r]);
 
@@ -973,15 +998,22 @@ void GcodeSuite::process_next_command() {
 
   if (DEBUGGING(ECHO)) {
     SERIAL_ECHO_START();
-    SERIAL_ECHOLN(current_command);
+    #if ENABLED(SD_GCODE_CACHE)
+      if (record) {
+        parser.print_record(current_command);
+        SERIAL_EOL();
+      }
+      else
+    #endif
+        SERIAL_ECHOLN(current_command);
     #if ENABLED(M100_FREE_MEMORY_DUMPER)
       SERIAL_ECHOPAIR("slot:", queue.index_r);
-      M100_dump_routine(PSTR("   Command Queue:"), &queue.command_buffer[0][0], &queue.command_buffer[BUFSIZE - 1][MAX_CMD_SIZE - 1]);
+      M100_dump_routine(PSTR("   Command Queue:"), queue.command_buffer, &queue.command_buffer[BUFSIZE_BYTES - 1]);
     #endif
   }
 
   // Parse the next command in the queue
-  parser.parse(current_command);
+  parser.parse(current_command, record);
   process_parsed_command();
 }
 
@@ -992,6 +1024,7 @@ void GcodeSuite::process_next_command() {
 
 void GcodeSuite::process_subcommands_now_P(PGM_P pgcode) {
   char * const saved_cmd = parser.command_ptr;        // Save the parser state
+  const bool saved_record = parser.is_record();
   for (;;) {
     PGM_P const delim = strchr_P(pgcode, '\n');       // Get address of next newline
     const size_t len = delim ? delim - pgcode : strlen_P(pgcode); // Get the command length
@@ -1003,11 +1036,12 @@ void GcodeSuite::process_subcommands_now_P(PGM_P pgcode) {
     if (!delim) break;                                // Last command?
     pgcode = delim + 1;                               // Get the next command
   }
-  parser.parse(saved_cmd);                            // Restore the parser state
+  parser.parse(saved_cmd, saved_record);              // Restore the parser state
 }
 
 void GcodeSuite::process_subcommands_now(char * gcode) {
   char * const saved_cmd = parser.command_ptr;        // Save the parser state
+  const bool saved_record = parser.is_record();
   for (;;) {
     char * const delim = strchr(gcode, '\n');         // Get address of next newline
     if (delim) *delim = '\0';                         // Replace with nul
@@ -1017,9 +1051,51 @@ void GcodeSuite::process_subcommands_now(char * gcode) {
     if (!delim) break;                                // Last command?
     gcode = delim + 1;                                // Get the next command
   }
-  parser.parse(saved_cmd);                            // Restore the parser state
+  parser.parse(saved_cmd, saved_record);              // Restore the parser state
 }
 
+#if ENABLED(HEATUP_LOOKAHEAD)
+
+  /**
+   * Set the targets of the M104, M109, M140 and M190 queued right behind the
+   * command being run, so a M190 and the M109 after it heat at the same time.
+   * Targets are only raised here. The commands still run and wait as usual.
+   */
+  void GcodeSuite::heat_ahead() {
+    char * const saved_cmd = parser.command_ptr;        // Save the parser state
+    const bool saved_record = parser.is_record();
+
+    // Injected commands and subcommands don't run from the queue
+    const char * const current = queue.peek(0);
+    if (!current || !WITHIN(saved_cmd, current, current + strlen(current))) return;
+
+    for (uint8_t n = 1; char * const cmd = queue.peek(n); ++n) {
+      const bool record = queue.is_record(queue.slot(n));
+      if (!record && strpbrk(cmd, "!\"")) break;       // Parsing writes into M32 paths and quoted strings
+      parser.parse(cmd, record);
+      if (parser.command_letter != 'M') break;
+      const bool hotend = parser.codenum == 104 || parser.codenum == 109;
+      if (!hotend && parser.codenum != 140 && parser.codenum != 190) {
+        if (parser.codenum == 105) continue;            // Hosts ask for temperatures in between
+        break;
+      }
+      if (!parser.seenval('S') && !parser.seenval('R')) continue;
+      const int16_t temp = parser.value_celsius();
+      if (hotend) {
+        const uint8_t e = TERN0(HAS_MULTI_HOTEND, parser.byteval('T', active_extruder));
+        if (e < HOTENDS && temp > thermalManager.degTargetHotend(e)) thermalManager.setTargetHotend(temp, e);
+      }
+      #if HAS_HEATED_BED
+        else if (temp > thermalManager.degTargetBed())
+          thermalManager.setTargetBed(temp);
+      #endif
+    }
+
+    parser.parse(saved_cmd, saved_record);              // Restore the parser state
+  }
+
+#endif // HEATUP_LOOKAHEAD
+
 #if ENABLED(HOST_KEEPALIVE_FEATURE)
 
   /**
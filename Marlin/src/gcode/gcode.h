@@ -198,6 +198,7 @@
  * M303 - PID relay autotune S<temperature> sets the target temperature. Default 150C. (Requires PIDTEMP)
  * M304 - Set bed PID parameters P I and D. (Requires PIDTEMPBED)
  * M305 - Set user thermistor parameters R T and P. (Requires TEMP_SENSOR_x 1000)
+ * M306 - Set MPC constants P C R A F H, or autotune them with T. (Requires MPCTEMP)
  * M350 - Set microstepping mode. (Requires digital microstepping pins.)
  * M351 - Toggle MS1 MS2 pins directly. (Requires digital microstepping pins.)
  * M355 - Set Case Light on/off and set brightness. (Requires CASE_LIGHT_PIN)
@@ -232,6 +233,10 @@
  * M524 - Abort the current SD print job started with M24. (Requires SDSUPPORT)
  * M540 - Enable/disable SD card abort on endstop hit: "M540 S<state>". (Requires SD_ABORT_ON_ENDSTOP_HIT)
  * M569 - Enable stealthChop on an axis. (Requires at least one _DRIVER_TYPE to be TMC2130/2160/2208/2209/5130/5160)
+ * M576 - Report command queue statistics. (Requires COMMAND_QUEUE_STATS)
+ * M577 - Report the time taken by idle tasks: "M577 [R]". (Requires IDLE_TASK_SCHEDULER)
+ * M578 - Report the CPU cycles taken by the stepper and temperature ISRs: "M578 [H] [R]". (Requires ISR_PROFILING)
+ * M593 - Set the input shaping of X and Y: "M593 [X] [Y] [F<hz>] [D<zeta>] [T<type>]". (Requires INPUT_SHAPING)
  * M600 - Pause for filament change: "M600 X<pos> Y<pos> Z<raise> E<first_retract> L<later_retract>". (Requires ADVANCED_PAUSE_FEATURE)
  * M603 - Configure filament change: "M603 T<tool> U<unload_length> L<load_length>". (Requires ADVANCED_PAUSE_FEATURE)
  * M605 - Set Dual X-Carriage movement mode: "M605 S<mode> [X<x_offset>] [R<temp_offset>]". (Requires DUAL_X_CARRIAGE)
@@ -366,6 +371,9 @@ public:
   static void process_subcommands_now_P(PGM_P pgcode);
   static void process_subcommands_now(char * gcode);
 
+  // Start the heat-ups queued behind the command being run
+  TERN_(HEATUP_LOOKAHEAD, static void heat_ahead());
+
   static inline void home_all_axes() {
     extern const char G28_STR[];
     process_subcommands_now_P(G28_STR);
@@ -714,6 +722,8 @@ private:
 
   TERN_(HAS_USER_THERMISTORS, static void M305());
 
+  TERN_(MPCTEMP, static void M306());
+
   #if HAS_MICROSTEPS
     static void M350();
     static void M351();
@@ -791,6 +801,14 @@ private:
 
   TERN_(BAUD_RATE_GCODE, static void M575());
 
+  TERN_(COMMAND_QUEUE_STATS, static void M576());
+
+  TERN_(IDLE_TASK_SCHEDULER, static void M577());
+
+  TERN_(ISR_PROFILING, static void M578());
+
+  TERN_(INPUT_SHAPING, static void M593());
+
   #if ENABLED(ADVANCED_PAUSE_FEATURE)
     static void M600();
     static void M603();
@@ -0,0 +1,51 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(ISR_PROFILING)
+
+#include "../gcode.h"
+#include "../../feature/isr_profiler.h"
+#include "../../module/stepper.h"
+
+/**
+ * M578: Report the CPU cycles taken by the stepper and temperature ISRs
+ *
+ *   H  Include a histogram of the runs by powers of 2 cycles
+ *   R  Reset the counts after the report
+ */
+void GcodeSuite::M578() {
+  isr_profiler.report(parser.seen('H'));
+
+  #if ENABLED(MEASURED_STEP_ISR_LIMITS)
+    SERIAL_ECHO_START();
+    SERIAL_ECHOPGM("Step ISR limits (Hz)");
+    LOOP_L_N(i, COUNT(stepper.isr_rate_limit))
+      SERIAL_ECHOPAIR(" ", 1 << i, "x:", stepper.isr_rate_limit[i]);
+    SERIAL_EOL();
+  #endif
+
+  if (parser.seen('R')) isr_profiler.reset();
+}
+
+#endif // ISR_PROFILING
@@ -44,7 +44,8 @@
  * Plan an arc in 2 dimensions
  *
  * The arc is approximated by generating many small linear segments.
- * The length of each segment is configured in MM_PER_ARC_SEGMENT (Default 1mm)
+ * The length of each segment is configured in MM_PER_ARC_SEGMENT (Default 1mm),
+ * or with ARC_SEGMENT_TOLERANCE chosen for the radius and feedrate of the arc.
  * Arcs should only be made relatively large (over 5mm), as larger arcs with
  * larger segments will tend to be more efficient. Your slicer should have
  * options for G2/G3 arc generation. In future these options may be GCode tunable.
@@ -75,8 +76,9 @@ void plan_arc(
               rt_X = cart[p_axis] - center_P,
               rt_Y = cart[q_axis] - center_Q,
               start_L = current_position[l_axis],
+              start_E = current_position.e,
               linear_travel = cart[l_axis] - start_L,
-              extruder_travel = cart.e - current_position.e;
+              extruder_travel = cart.e - start_E;
 
   // CCW angle of rotation between position and target from the circle center. Only one atan2() trig computation required.
   float angular_travel = ATAN2(rvec.a * rt_Y - rvec.b * rt_X, rvec.a * rt_X + rvec.b * rt_Y);
@@ -107,6 +109,12 @@ void plan_arc(
   float seg_length = (
     #ifdef ARC_SEGMENTS_PER_R
       constrain(MM_PER_ARC_SEGMENT * radius, MM_PER_ARC_SEGMENT, ARC_SEGMENTS_PER_R)
+    #elif defined(ARC_SEGMENT_TOLERANCE)
+      // The longest chord within the tolerance of the arc (its sagitta is length^2 / 8r),
+      // but long enough for the planner buffer to hold the distance to stop from the feedrate
+      _MAX(SQRT(8 * radius * (ARC_SEGMENT_TOLERANCE)),
+           sq(scaled_fr_mm_s) / (2 * (BLOCK_BUFFER_SIZE - 1) * planner.settings.acceleration),
+           MM_PER_ARC_SEGMENT)
     #elif ARC_SEGMENTS_PER_SEC
       _MAX(scaled_fr_mm_s * RECIPROCAL(ARC_SEGMENTS_PER_SEC), MM_PER_ARC_SEGMENT)
     #else
@@ -116,42 +124,41 @@ void plan_arc(
   // Divide total travel by nominal segment length
   uint16_t segments = FLOOR(mm_of_travel / seg_length);
   NOLESS(segments, min_segments);         // At least some segments
+  NOLESS(segments, uint16_t(CEIL(ABS(angular_travel) * (4 / RADIANS(180))))); // No more than 45° each, for the rotation below
   seg_length = mm_of_travel / segments;
 
   /**
-   * Vector rotation by transformation matrix: r is the original vector, r_T is the rotated vector,
-   * and phi is the angle of rotation. Based on the solution approach by Jens Geisler.
-   *     r_T = [cos(phi) -sin(phi);
-   *            sin(phi)  cos(phi)] * r ;
+   * Successive points on a circle follow the recurrence
+   *     r[i+1] = 2 cos(phi) r[i] - r[i-1]
+   * on each axis, where phi is the angle of rotation per segment. Unlike rotating by a
+   * matrix this needs only one multiply-add per axis, and unlike the small angle
+   * approximation it holds for any angle. It's run in fixed point (ARC_FIXED_ONE units
+   * per mm) as r[i+1] = r[i] + (r[i] - r[i-1]) - k r[i], with k = 2 - 2 cos(phi) as a
+   * 2.30 fraction, which keeps the precision of k for the smallest angles.
    *
    * For arc generation, the center of the circle is the axis of rotation and the radius vector is
-   * defined from the circle center to the initial position. Each line segment is formed by successive
-   * vector rotations. This requires only two cos() and sin() computations to form the rotation
-   * matrix for the duration of the entire arc. Error may accumulate from numerical round-off, since
-   * all double numbers are single precision on the Arduino. (True double precision will not have
-   * round off issues for CNC applications.) Single precision error can accumulate to be greater than
-   * tool precision in some cases. Therefore, arc path correction is implemented.
-   *
-   * Small angle approximation may be used to reduce computation overhead further. This approximation
-   * holds for everything, but very small circles and large MM_PER_ARC_SEGMENT values. In other words,
-   * theta_per_segment would need to be greater than 0.1 rad and N_ARC_CORRECTION would need to be large
-   * to cause an appreciable drift error. N_ARC_CORRECTION~=25 is more than small enough to correct for
-   * numerical drift error. N_ARC_CORRECTION may be on the order a hundred(s) before error becomes an
-   * issue for CNC machines with the single precision Arduino calculations.
-   *
-   * This approximation also allows plan_arc to immediately insert a line segment into the planner
-   * without the initial overhead of computing cos() or sin(). By the time the arc needs to be applied
-   * a correction, the planner should have caught up to the lag caused by the initial plan_arc overhead.
-   * This is important when there are successive arc motions.
+   * defined from the circle center to the initial position. Rounding still accumulates, so every
+   * N_ARC_CORRECTION segments the radius vector is set exactly with cos() and sin(). The linear
+   * axis and the extruder are set from the segment number, so they don't accumulate error at all.
    */
-  // Vector rotation matrix values
+  #define ARC_FIXED_ONE 65536
+  #define ARC_FIXED(F) int32_t(LROUND((F) * (ARC_FIXED_ONE)))
+
   xyze_pos_t raw;
   const float theta_per_segment = angular_travel / segments,
               linear_per_segment = linear_travel / segments,
               extruder_per_segment = extruder_travel / segments,
-              sq_theta_per_segment = sq(theta_per_segment),
-              sin_T = theta_per_segment - sq_theta_per_segment*theta_per_segment/6,
-              cos_T = 1 - 0.5f * sq_theta_per_segment; // Small angle approximation
+              sin_T = sin(theta_per_segment),
+              sin_half_T = sin(0.5f * theta_per_segment),
+              cos_T = 1.0f - 2.0f * sq(sin_half_T);
+  // 2 - 2 cos(phi) = 4 sin^2(phi / 2), without the cancellation for small angles
+  const int32_t k = LROUND(sq(sin_half_T) * 4294967296.0f);
+  const auto k_times = [k](const int32_t r) { return int32_t((int64_t(r) * k + (int64_t(1) << 29)) >> 30); };
+
+  // The radius vector and the one before it, to start the recurrence
+  int32_t r_P = ARC_FIXED(rvec.a), r_Q = ARC_FIXED(rvec.b),
+          prev_P = ARC_FIXED(rvec.a * cos_T + rvec.b * sin_T),
+          prev_Q = ARC_FIXED(rvec.b * cos_T - rvec.a * sin_T);
 
   // Initialize the linear axis
   raw[l_axis] = current_position[l_axis];
@@ -179,10 +186,11 @@ void plan_arc(
 
     #if N_ARC_CORRECTION > 1
       if (--arc_recalc_count) {
-        // Apply vector rotation matrix to previous rvec.a / 1
-        const float r_new_Y = rvec.a * sin_T + rvec.b * cos_T;
-        rvec.a = rvec.a * cos_T - rvec.b * sin_T;
-        rvec.b = r_new_Y;
+        // Step the radius vector
+        const int32_t next_P = r_P + (r_P - prev_P) - k_times(r_P),
+                      next_Q = r_Q + (r_Q - prev_Q) - k_times(r_Q);
+        prev_P = r_P; r_P = next_P;
+        prev_Q = r_Q; r_Q = next_Q;
       }
       else
     #endif
@@ -192,24 +200,27 @@ void plan_arc(
       #endif
 
       // Arc correction to radius vector. Computed only every N_ARC_CORRECTION increments.
-      // Compute exact location by applying transformation matrix from initial radius vector(=-offset).
-      // To reduce stuttering, the sin and cos could be computed at different times.
-      // For now, compute both at the same time.
+      // Compute exact location by applying transformation matrix from initial radius vector(=-offset),
+      // and the one before it to carry on from there.
       const float cos_Ti = cos(i * theta_per_segment), sin_Ti = sin(i * theta_per_segment);
       rvec.a = -offset[0] * cos_Ti + offset[1] * sin_Ti;
       rvec.b = -offset[0] * sin_Ti - offset[1] * cos_Ti;
+      r_P = ARC_FIXED(rvec.a);
+      r_Q = ARC_FIXED(rvec.b);
+      prev_P = ARC_FIXED(rvec.a * cos_T + rvec.b * sin_T);
+      prev_Q = ARC_FIXED(rvec.b * cos_T - rvec.a * sin_T);
     }
 
     // Update raw location
-    raw[p_axis] = center_P + rvec.a;
-    raw[q_axis] = center_Q + rvec.b;
+    raw[p_axis] = center_P + r_P * (1.0f / (ARC_FIXED_ONE));
+    raw[q_axis] = center_Q + r_Q * (1.0f / (ARC_FIXED_ONE));
     #if ENABLED(AUTO_BED_LEVELING_UBL)
       raw[l_axis] = start_L;
       UNUSED(linear_per_segment);
     #else
-      raw[l_axis] += linear_per_segment;
+      raw[l_axis] = start_L + i * linear_per_segment;
     #endif
-    raw.e += extruder_per_segment;
+    raw.e = start_E + i * extruder_per_segment;
 
     apply_motion_limits(raw);
 
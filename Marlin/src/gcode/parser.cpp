@@ -70,6 +70,10 @@ int GCodeParser::codenum;
   char *GCodeParser::command_args; // start of parameters
 #endif
 
+#if ENABLED(SD_GCODE_CACHE)
+  bool GCodeParser::cached;        // values are fixed-point, not text
+#endif
+
 // Create a global instance of the GCode parser singleton
 GCodeParser parser;
 
@@ -84,6 +88,7 @@ void GCodeParser::reset() {
   command_letter = '?';                 // No command letter
   codenum = 0;                          // No command code
   TERN_(USE_GCODE_SUBCODES, subcode = 0); // No command sub-code
+  TERN_(SD_GCODE_CACHE, cached = false);  // Not a pre-parsed record
   #if ENABLED(FASTER_GCODE_PARSER)
     codebits = 0;                       // No codes yet
     //ZERO(param);                      // No parameters (should be safe to comment out this line)
@@ -112,10 +117,16 @@ void GCodeParser::reset() {
 
 // Populate all fields by parsing a single line of GCode
 // 58 bytes of SRAM are used to speed up seen/value
-void GCodeParser::parse(char *p) {
+void GCodeParser::parse(char *p, const bool record/*=false*/) {
 
   reset(); // No codes to report
 
+  #if ENABLED(SD_GCODE_CACHE)
+    if (record) return parse_record(p);
+  #else
+    UNUSED(record);
+  #endif
+
   auto uppercase = [](char c) {
     if (TERN0(GCODE_CASE_INSENSITIVE, WITHIN(c, 'a', 'z')))
       c += 'A' - 'a';
@@ -345,6 +356,7 @@ void GCodeParser::parse(char *p) {
 
   // Parse the next parameter as a new command
   bool GCodeParser::chain() {
+    if (TERN0(SD_GCODE_CACHE, cached)) return false;  // Records never hold a second command
     #if ENABLED(FASTER_GCODE_PARSER)
       char *next_command = command_ptr;
       if (next_command) {
@@ -361,7 +373,103 @@ void GCodeParser::parse(char *p) {
 
 #endif // CNC_COORDINATE_SYSTEMS
 
+#if ENABLED(GCODE_FIXED_POINT_VALUES)
+
+  /**
+   * Convert [-+]?[0-9]*.?[0-9]* with integer math and one division.
+   * Return false for a value with too many digits to convert exactly,
+   * leaving it to strtof.
+   */
+  bool GCodeParser::decimal_float(const char *p, float &out) {
+    const bool neg = *p == '-';
+    if (neg || *p == '+') p++;
+    uint32_t m = 0;
+    uint8_t decimals = 0;
+    bool point = false;
+    for (;; p++) {
+      const char c = *p;
+      if (NUMERIC(c)) {
+        if (point && ++decimals > 7) return false;
+        m = m * 10 + c - '0';
+        if (m > 0xFFFFFFUL) return false;
+      }
+      else if (c == '.' && !point)
+        point = true;
+      else
+        break;
+    }
+    const float v = scaled_float(m, decimals);
+    out = neg ? -v : v;
+    return true;
+  }
+
+#endif // GCODE_FIXED_POINT_VALUES
+
+#if ENABLED(SD_GCODE_CACHE)
+
+  // Populate all fields from a pre-parsed record. No numbers are converted until used.
+  // string_arg stays nullptr, as GCodeCache::encode only takes commands whose text leaves it unset.
+  void GCodeParser::parse_record(char *p) {
+    command_ptr = p;
+    cached = true;
+
+    const char *r = p;
+    command_letter = *r++;
+    codenum = read_varint(r);
+    TERN_(USE_GCODE_SUBCODES, subcode = *r);
+    r++;
+
+    #if ENABLED(GCODE_MOTION_MODES)
+      if (command_letter == 'G'
+        && (codenum <= TERN(ARC_SUPPORT, 3, 1) || codenum == 5 || TERN0(G38_PROBE_TARGET, codenum == 38))
+      ) {
+        motion_mode_codenum = codenum;
+        TERN_(USE_GCODE_SUBCODES, motion_mode_subcode = subcode);
+      }
+    #endif
+
+    codebits = read_varint(r);
+    LOOP_L_N(i, COUNT(param)) if (TEST32(codebits, i)) {
+      param[i] = *r ? r - command_ptr : 0;  // Value offset or 0
+      read_varint(r);
+    }
+  }
+
+  // Print a record as the G-code it came from
+  void GCodeParser::print_record(const char *p) {
+    SERIAL_CHAR(*p++);
+    SERIAL_ECHO(read_varint(p));
+    const uint8_t sub = *p++;
+    if (sub) { SERIAL_CHAR('.'); SERIAL_ECHO(int(sub)); }
+    const uint32_t bits = read_varint(p);
+    LOOP_L_N(i, 26) if (TEST32(bits, i)) {
+      SERIAL_CHAR(' ', 'A' + i);
+      if (*p) {
+        uint8_t decimals;
+        const int32_t m = record_mantissa(p, decimals);
+        if (m < 0) SERIAL_CHAR('-');
+        uint32_t u = ABS(m);
+        char frac[8];
+        for (uint8_t d = decimals; d--; u /= 10) frac[d] = '0' + u % 10;
+        SERIAL_ECHO(u);
+        if (decimals) { SERIAL_CHAR('.'); LOOP_L_N(d, decimals) SERIAL_CHAR(frac[d]); }
+      }
+      read_varint(p);
+    }
+  }
+
+#endif // SD_GCODE_CACHE
+
 void GCodeParser::unknown_command_warning() {
+  #if ENABLED(SD_GCODE_CACHE)
+    if (cached) {
+      SERIAL_ECHO_START();
+      SERIAL_ECHOPGM(STR_UNKNOWN_COMMAND);
+      print_record(command_ptr);
+      SERIAL_ECHOLNPGM("\"");
+      return;
+    }
+  #endif
   SERIAL_ECHO_MSG(STR_UNKNOWN_COMMAND, command_ptr, "\"");
 }
 
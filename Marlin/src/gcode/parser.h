@@ -66,6 +66,10 @@ private:
     static char *command_args;      // Args start here, for slow scan
   #endif
 
+  #if ENABLED(SD_GCODE_CACHE)
+    static bool cached;             // The command is a pre-parsed record, values are fixed-point
+  #endif
+
 public:
 
   // Global states for GCode-level units features
@@ -149,7 +153,7 @@ public:
       if (b) {
         if (param[ind]) {
           char * const ptr = command_ptr + param[ind];
-          value_ptr = valid_number(ptr) ? ptr : nullptr;
+          value_ptr = (TERN0(SD_GCODE_CACHE, cached) || valid_number(ptr)) ? ptr : nullptr;
         }
         else
           value_ptr = nullptr;
@@ -237,7 +241,74 @@ public:
 
   // Populate all fields by parsing a single line of GCode
   // This uses 54 bytes of SRAM to speed up seen/value
-  static void parse(char * p);
+  // A 'record' is a pre-parsed command from the SD G-code cache
+  static void parse(char * p, const bool record=false);
+
+  #if ENABLED(SD_GCODE_CACHE)
+    static inline bool is_record() { return cached; }
+  #else
+    static constexpr bool is_record() { return false; }
+  #endif
+
+  #if EITHER(SD_GCODE_CACHE, GCODE_FIXED_POINT_VALUES)
+    // Exact for mantissas up to 2^24, so the result matches a correctly rounded strtof
+    static inline float scaled_float(const int32_t m, const uint8_t decimals) {
+      static constexpr float scale[] = { 1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f };
+      return decimals ? float(m) / scale[decimals] : float(m);
+    }
+  #endif
+
+  #if ENABLED(GCODE_FIXED_POINT_VALUES)
+    static bool decimal_float(const char *p, float &out);
+  #endif
+
+  #if ENABLED(SD_GCODE_CACHE)
+
+    /**
+     * Pre-parsed command record, as stored by the SD G-code cache
+     *
+     *   letter, codenum, subcode (byte), codebits,
+     *   then one value per bit in codebits, from A to Z
+     *
+     * Numbers are LEB128 varints. A value of 0 means "no value", otherwise it
+     * holds (zigzag(mantissa) << 3 | decimals) + 1 for mantissa / 10^decimals.
+     * Nothing in the bytes marks a record. Only the cache reader can make one,
+     * and the queue keeps that flag beside the command (GCodeQueue::record).
+     */
+    #define GCODE_RECORD_MIN_SIZE 4
+
+    static inline uint32_t read_varint(const char * &p) {
+      uint32_t v = 0;
+      for (uint8_t shift = 0; ; shift += 7) {
+        const uint8_t b = *p++;
+        v |= uint32_t(b & 0x7F) << shift;
+        if (b < 0x80) return v;
+      }
+    }
+
+    static inline int32_t record_mantissa(const char *p, uint8_t &decimals) {
+      const uint32_t v = read_varint(p) - 1, z = v >> 3;
+      decimals = v & 0x07;
+      return int32_t(z >> 1) ^ -int32_t(z & 1);
+    }
+
+    static inline float record_float(const char * const p) {
+      uint8_t decimals;
+      const int32_t m = record_mantissa(p, decimals);
+      return scaled_float(m, decimals);
+    }
+
+    static inline int32_t record_long(const char * const p) {
+      static constexpr int32_t scale[] = { 1, 10, 100, 1000, 10000, 100000, 1000000, 10000000 };
+      uint8_t decimals;
+      const int32_t m = record_mantissa(p, decimals);
+      return decimals ? m / scale[decimals] : m;
+    }
+
+    static void parse_record(char * p);
+    static void print_record(const char * p);
+
+  #endif
 
   #if ENABLED(CNC_COORDINATE_SYSTEMS)
     // Parse the next parameter as a new command
@@ -255,7 +326,14 @@ public:
 
   // Float removes 'E' to prevent scientific notation interpretation
   static inline float value_float() {
+    #if ENABLED(SD_GCODE_CACHE)
+      if (cached) return value_ptr ? record_float(value_ptr) : 0;
+    #endif
     if (value_ptr) {
+      #if ENABLED(GCODE_FIXED_POINT_VALUES)
+        float ret;
+        if (decimal_float(value_ptr, ret)) return ret;
+      #endif
       char *e = value_ptr;
       for (;;) {
         const char c = *e;
@@ -274,8 +352,18 @@ public:
   }
 
   // Code value as a long or ulong
-  static inline int32_t value_long() { return value_ptr ? strtol(value_ptr, nullptr, 10) : 0L; }
-  static inline uint32_t value_ulong() { return value_ptr ? strtoul(value_ptr, nullptr, 10) : 0UL; }
+  static inline int32_t value_long() {
+    #if ENABLED(SD_GCODE_CACHE)
+      if (cached) return value_ptr ? record_long(value_ptr) : 0L;
+    #endif
+    return value_ptr ? strtol(value_ptr, nullptr, 10) : 0L;
+  }
+  static inline uint32_t value_ulong() {
+    #if ENABLED(SD_GCODE_CACHE)
+      if (cached) return value_ptr ? uint32_t(record_long(value_ptr)) : 0UL;
+    #endif
+    return value_ptr ? strtoul(value_ptr, nullptr, 10) : 0UL;
+  }
 
   // Code value for use as time
   static inline millis_t value_millis() { return value_ulong(); }
@@ -34,6 +34,7 @@ GCodeQueue queue;
 #include "../module/planner.h"
 #include "../module/temperature.h"
 #include "../MarlinCore.h"
+#include "../HAL/shared/serial_line_ring.h"
 
 #if ENABLED(BABYSTEPPING)
 #include "../feature/babystep.h"
@@ -71,7 +72,7 @@ long GCodeQueue::last_N[NUM_SERIAL];
 
 /**
  * GCode Command Queue
- * A simple ring buffer of BUFSIZE command strings.
+ * A ring of up to BUFSIZE commands packed into a buffer of BUFSIZE_BYTES.
  *
  * Commands are copied into this buffer by the command injectors
  * (immediate, serial, sd card) and they are processed sequentially by
@@ -82,13 +83,24 @@ uint8_t GCodeQueue::length = 0,  // Count of commands in the queue
         GCodeQueue::index_r = 0, // Ring buffer read position
         GCodeQueue::index_w = 0; // Ring buffer write position
 
-char GCodeQueue::command_buffer[BUFSIZE][MAX_CMD_SIZE];
+char GCodeQueue::command_buffer[BUFSIZE_BYTES];
+uint16_t GCodeQueue::command_start[BUFSIZE],
+         GCodeQueue::buffer_w = 0;
 
 /*
  * The port that the command was received on
  */
 #if HAS_MULTI_SERIAL
   int16_t GCodeQueue::port[BUFSIZE];
+  uint8_t GCodeQueue::port_length[NUM_SERIAL];
+#endif
+
+#if ENABLED(SD_GCODE_CACHE)
+  bool GCodeQueue::record[BUFSIZE];
+#endif
+
+#if ENABLED(COMMAND_QUEUE_STATS)
+  GCodeQueue::stats_t GCodeQueue::stats;
 #endif
 
 /**
@@ -98,6 +110,9 @@ char GCodeQueue::command_buffer[BUFSIZE][MAX_CMD_SIZE];
 // Number of characters read in the current line of serial input
 static int serial_count[NUM_SERIAL] = { 0 };
 
+// A whole line is waiting on the port to be queued
+static bool serial_line_waiting[NUM_SERIAL] = { false };
+
 bool send_ok[BUFSIZE];
 
 /**
@@ -128,21 +143,57 @@ bool GCodeQueue::has_commands_queued() {
  */
 void GCodeQueue::clear() {
   index_r = index_w = length = 0;
+  buffer_w = 0;
+  TERN_(HAS_MULTI_SERIAL, ZERO(port_length));
 }
 
 /**
- * Once a new command is in the ring buffer, call this to commit it
+ * Where to write the next command, with room for MAX_CMD_SIZE bytes,
+ * or nullptr if the queue is full. Commands follow one another around
+ * the buffer and go back to the start when too little is left at the end.
  */
-void GCodeQueue::_commit_command(bool say_ok
+char* GCodeQueue::next_command() {
+  if (length >= BUFSIZE) return nullptr;
+  uint16_t w = 0;
+  if (length) {
+    const uint16_t r = command_start[index_r];
+    w = buffer_w;
+    if (w > r) {                                      // Free at the end and ahead of 'r'
+      if (BUFSIZE_BYTES - w < MAX_CMD_SIZE) {
+        if (r < MAX_CMD_SIZE) return nullptr;
+        w = 0;
+      }
+    }
+    else if (r - w < MAX_CMD_SIZE)                    // Free between 'w' and 'r'
+      return nullptr;
+  }
+  command_start[index_w] = w;
+  return &command_buffer[w];
+}
+
+/**
+ * Once a new command is at next_command(), call this to commit it
+ * with its size, including the terminator
+ */
+void GCodeQueue::_commit_command(const uint16_t size, bool say_ok
   #if HAS_MULTI_SERIAL
     , int16_t p/*=-1*/
   #endif
 ) {
+  buffer_w = command_start[index_w] + size;
   send_ok[index_w] = say_ok;
-  TERN_(HAS_MULTI_SERIAL, port[index_w] = p);
+  TERN_(SD_GCODE_CACHE, record[index_w] = false);
+  #if HAS_MULTI_SERIAL
+    port[index_w] = p;
+    if (p >= 0) port_length[p]++;
+  #endif
   TERN_(POWER_LOSS_RECOVERY, recovery.commit_sdpos(index_w));
   if (++index_w >= BUFSIZE) index_w = 0;
   length++;
+  #if ENABLED(COMMAND_QUEUE_STATS)
+    NOLESS(stats.peak_length, length);
+    NOLESS(stats.peak_bytes, bytes_used());
+  #endif
 }
 
 /**
@@ -155,9 +206,13 @@ bool GCodeQueue::_enqueue(const char* cmd, bool say_ok/*=false*/
     , int16_t pn/*=-1*/
   #endif
 ) {
-  if (*cmd == ';' || length >= BUFSIZE) return false;
-  strcpy(command_buffer[index_w], cmd);
-  _commit_command(say_ok
+  if (*cmd == ';') return false;
+  char * const dst = next_command();
+  if (!dst) return false;
+  const uint16_t size = _MIN(strlen(cmd), size_t(MAX_CMD_SIZE - 1)) + 1;
+  memcpy(dst, cmd, size - 1);
+  dst[size - 1] = '\0';
+  _commit_command(size, say_ok
     #if HAS_MULTI_SERIAL
       , pn
     #endif
@@ -165,6 +220,32 @@ bool GCodeQueue::_enqueue(const char* cmd, bool say_ok/*=false*/
   return true;
 }
 
+#if ENABLED(COMMAND_QUEUE_STATS)
+
+  /**
+   * Bytes of the buffer taken from the oldest command to the end of the newest,
+   * including any left unused at the end of the buffer where commands wrap
+   */
+  uint16_t GCodeQueue::bytes_used() {
+    if (!length) return 0;
+    const uint16_t r = command_start[index_r];
+    return buffer_w > r ? buffer_w - r : BUFSIZE_BYTES - r + buffer_w;
+  }
+
+  void GCodeQueue::report_stats() {
+    SERIAL_ECHO_START();
+    SERIAL_ECHOPAIR("Queue ", int(length), "/", int(BUFSIZE), " commands ", bytes_used(), "/", int(BUFSIZE_BYTES),
+                    " bytes, peak ", int(stats.peak_length), " commands ", stats.peak_bytes,
+                    " bytes, full ", stats.full);
+    #if HAS_MULTI_SERIAL
+      SERIAL_ECHOPAIR(", ports held to share ", stats.held, ", commands per port");
+      LOOP_L_N(i, NUM_SERIAL) SERIAL_ECHOPAIR(" ", int(port_length[i]));
+    #endif
+    SERIAL_EOL();
+  }
+
+#endif
+
 #define ISEOL(C) ((C) == '\n' || (C) == '\r')
 
 /**
@@ -297,7 +378,7 @@ void GCodeQueue::ok_to_send() {
   if (!send_ok[index_r]) return;
   SERIAL_ECHOPGM(STR_OK);
   #if ENABLED(ADVANCED_OK)
-    char* p = command_buffer[index_r];
+    char* p = command(index_r);
     if (*p == 'N') {
       SERIAL_ECHO(' ');
       SERIAL_ECHO(*p++);
@@ -326,8 +407,33 @@ void GCodeQueue::flush_and_request_resend() {
   ok_to_send();
 }
 
-inline bool serial_data_available() {	
-  return MYSERIAL0.available() || TERN0(HAS_MYSERIAL1, MYSERIAL1.available()) || TERN0(HAS_WIFI_SERIAL, WIFI_SERIAL.available());
+// A port whose receive ring frames lines (HAL/shared/serial_line_ring.h)
+// is read a whole line at a time. Other ports are read a byte at a time.
+template<typename T> inline auto port_line_ring(T &port, int) -> decltype(port.line_ring()) { return port.line_ring(); }
+template<typename T> inline SerialLineRing* port_line_ring(T&, long) { return nullptr; }
+
+inline SerialLineRing* serial_line_ring(const uint8_t index) {
+  switch (index) {
+    case ID_SERIAL_USB: return port_line_ring(MYSERIAL0, 0);
+    #if HAS_MULTI_SERIAL
+      #if HAS_MYSERIAL1
+        case ID_SERIAL_MYSERIAL1: return port_line_ring(MYSERIAL1, 0);
+      #endif
+      #if HAS_WIFI_SERIAL
+        case ID_SERIAL_WIFI: return port_line_ring(WIFI_SERIAL, 0);
+      #endif
+    #endif
+    default: return nullptr;
+  }
+}
+
+template<typename T> inline bool port_data_available(T &port) {
+  SerialLineRing * const ring = port_line_ring(port, 0);
+  return ring ? ring->lines() : port.available();
+}
+
+inline bool serial_data_available() {
+  return port_data_available(MYSERIAL0) || TERN0(HAS_MYSERIAL1, port_data_available(MYSERIAL1)) || TERN0(HAS_WIFI_SERIAL, port_data_available(WIFI_SERIAL));
 }
 
 inline int read_serial(const uint8_t index) {
@@ -366,7 +472,7 @@ FORCE_INLINE bool is_M29(const char * const cmd) {  // matches "M29" & "M29 ", b
 #define PS_PAREN  3
 #define PS_ESC    4
 
-inline void process_stream_char(const char c, uint8_t &sis, char (&buff)[MAX_CMD_SIZE], int &ind) {
+inline void process_stream_char(const char c, uint8_t &sis, char * const buff, int &ind) {
 
   if (sis == PS_EOL) return;    // EOL comment or overflow
 
@@ -422,7 +528,7 @@ inline void process_stream_char(const char c, uint8_t &sis, char (&buff)[MAX_CMD
  * Handle a line being completed. For an empty line
  * keep sensor readings going and watchdog alive.
  */
-inline bool process_line_done(uint8_t &sis, char (&buff)[MAX_CMD_SIZE], int &ind) {
+inline bool process_line_done(uint8_t &sis, char * const buff, int &ind) {
   sis = PS_NORMAL;
   buff[ind] = 0;
   if (ind) { ind = 0; return false; }
@@ -430,24 +536,176 @@ inline bool process_line_done(uint8_t &sis, char (&buff)[MAX_CMD_SIZE], int &ind
   return true;
 }
 
+#if NO_TIMEOUTS > 0
+  static millis_t last_command_time = 0;
+#endif
+
+/**
+ * Check a command line that came in on a serial port and add it to the queue.
+ * The line may already be in the next queue slot, filtered there straight
+ * from the port's receive ring. Return false after a line error.
+ */
+bool GCodeQueue::queue_serial_line(const uint8_t pn, char * const line) {
+  char* command = line;
+
+  while (*command == ' ') command++;                   // Skip leading spaces
+  char *npos = (*command == 'N') ? command : nullptr;  // Require the N parameter to start the line
+
+  if (npos) {
+
+    bool M110 = strstr_P(command, PSTR("M110")) != nullptr;
+
+    if (M110) {
+      char* n2pos = strchr(command + 4, 'N');
+      if (n2pos) npos = n2pos;
+    }
+
+    const long gcode_N = strtol(npos + 1, nullptr, 10);
+
+    if (gcode_N != last_N[pn] + 1 && !M110) {
+      gcode_line_error(PSTR(STR_ERR_LINE_NO), pn);
+      return false;
+    }
+
+    char *apos = strrchr(command, '*');
+    if (apos) {
+      uint8_t checksum = 0, count = uint8_t(apos - command);
+      while (count) checksum ^= command[--count];
+      if (strtol(apos + 1, nullptr, 10) != checksum) {
+        gcode_line_error(PSTR(STR_ERR_CHECKSUM_MISMATCH), pn);
+        return false;
+      }
+    }
+    else {
+      gcode_line_error(PSTR(STR_ERR_NO_CHECKSUM), pn);
+      return false;
+    }
+
+    last_N[pn] = gcode_N;
+  }
+  #if ENABLED(SDSUPPORT)
+    // Pronterface "M29" and "M29 " has no line number
+    else if (card.flag.saving && !is_M29(command)) {
+      gcode_line_error(PSTR(STR_ERR_NO_CHECKSUM), pn);
+      return false;
+    }
+  #endif
+
+  //
+  // Movement commands give an alert when the machine is stopped
+  //
+
+  if (IsStopped()) {
+    char* gpos = strchr(command, 'G');
+    if (gpos) {
+      switch (strtol(gpos + 1, nullptr, 10)) {
+        case 0: case 1:
+        #if ENABLED(ARC_SUPPORT)
+          case 2: case 3:
+        #endif
+        #if ENABLED(BEZIER_CURVE_SUPPORT)
+          case 5:
+        #endif
+          PORT_REDIRECT(pn);                    // Reply to the serial port that sent the command
+          SERIAL_ECHOLNPGM(STR_ERR_STOPPED);
+          LCD_MESSAGEPGM(MSG_STOPPED);
+          break;
+      }
+    }
+  }
+
+  #if DISABLED(EMERGENCY_PARSER)
+    // Process critical commands early
+    if (strcmp_P(command, PSTR("M108")) == 0) {
+      wait_for_heatup = false;
+      TERN_(HAS_LCD_MENU, wait_for_user = false);
+    }
+    if (strcmp_P(command, PSTR("M112")) == 0) kill(M112_KILL_STR, nullptr, true);
+    if (strcmp_P(command, PSTR("M410")) == 0) quickstop_stepper();
+  #endif
+
+				#if ENABLED(PROCESS_M290_ASAP)
+				  if (strstr_P(command, PSTR("M290")) != nullptr){
+				  	char* zpos = strchr(command + 4, 'Z');
+						if(zpos){
+							const float offs = constrain(strtof(zpos + 1, nullptr),-2,2);
+							babystep.add_mm(Z_AXIS, offs);
+							// Acknowledge it here. Committing a queue slot would run what the slot held before.
+							PORT_REDIRECT(pn);
+							SERIAL_ECHOLNPGM(STR_OK);
+							return true;
+						}
+				  }
+				#endif
+
+				//Check if WiFi is connected 
+				#if (HAS_MULTI_SERIAL && HAS_WIFI_SERIAL)
+					if(pn == ID_SERIAL_WIFI){
+				  	if (strstr_P(command, PSTR("M117")) != nullptr)		wifi_M117_message = true;
+				  }
+				#endif			
+
+  #if NO_TIMEOUTS > 0
+    last_command_time = millis();
+  #endif
+
+  // Add the command to the queue
+  if (line == GCodeQueue::command(index_w))
+    _commit_command(strlen(line) + 1, true
+      #if HAS_MULTI_SERIAL
+        , pn
+      #endif
+    );
+  else
+    _enqueue(line, true
+      #if HAS_MULTI_SERIAL
+        , pn
+      #endif
+    );
+
+  return true;
+}
+
+#if HAS_MULTI_SERIAL
+
+  /**
+   * A port may fill the queue while it is the only one with a line waiting.
+   * Otherwise it gets an equal share, so one chatty port can't starve the rest.
+   */
+  bool GCodeQueue::port_has_share(const uint8_t pn) {
+    uint8_t waiting = 1;
+    LOOP_L_N(i, NUM_SERIAL) if (i != pn && serial_line_waiting[i]) waiting++;
+    return port_length[pn] < _MAX(BUFSIZE / waiting, 1);
+  }
+
+#endif
+
 /**
  * Get all commands waiting on the serial port and queue them.
  * Exit when the buffer is full or when no more characters are
  * left on the serial port.
+ *
+ * Each port collects a line in a slot of its own, or in its receive ring if
+ * that frames lines. Whole lines then go into the queue from each port in
+ * turn, each port held to its share of the queue while others are waiting.
  */
 void GCodeQueue::get_serial_commands() {
   static char serial_line_buffer[NUM_SERIAL][MAX_CMD_SIZE];
 
   static uint8_t serial_input_state[NUM_SERIAL] = { PS_NORMAL };
 
+  #if HAS_MULTI_SERIAL
+    static uint8_t first_port = 0;  // The port served first, in rotation
+  #endif
+
   #if ENABLED(BINARY_FILE_TRANSFER)
     if (card.flag.binary_mode) {
       /**
-       * For binary stream file transfer, use serial_line_buffer as the working
-       * receive buffer (which limits the packet size to MAX_CMD_SIZE).
-       * The receive buffer also limits the packet size for reliable transmission.
+       * For binary stream file transfer, packets go into the stream's own
+       * slots, which set the packet size (BINARY_STREAM_PACKET_SIZE) and how
+       * many packets the host may have in flight (BINARY_STREAM_PACKETS).
        */
-      binaryStream[card.transfer_port_index].receive(serial_line_buffer[card.transfer_port_index]);
+      binaryStream[card.transfer_port_index].receive();
       return;
     }
   #endif
@@ -455,7 +713,6 @@ void GCodeQueue::get_serial_commands() {
   // If the command buffer is empty for too long,
   // send "wait" to indicate Marlin is still waiting.
   #if NO_TIMEOUTS > 0
-    static millis_t last_command_time = 0;
     const millis_t ms = millis();
     if (length == 0 && !serial_data_available() && ELAPSED(ms, last_command_time + NO_TIMEOUTS)) {
       SERIAL_ECHOLNPGM(STR_WAIT);
@@ -463,131 +720,70 @@ void GCodeQueue::get_serial_commands() {
     }
   #endif
 
-  /**
-   * Loop while serial characters are incoming and the queue is not full
-   */
-  while (length < BUFSIZE && serial_data_available()) {
-    LOOP_L_N(i, NUM_SERIAL) {
-
-      const int c = read_serial(i);
-      if (c < 0) continue;
-
-      const char serial_char = c;
-
-      if (ISEOL(serial_char)) {
-
-        // Reset our state, continue if the line was empty
-        if (process_line_done(serial_input_state[i], serial_line_buffer[i], serial_count[i]))
-          continue;
-
-        char* command = serial_line_buffer[i];
-
-        while (*command == ' ') command++;                   // Skip leading spaces
-        char *npos = (*command == 'N') ? command : nullptr;  // Require the N parameter to start the line
-
-        if (npos) {
-
-          bool M110 = strstr_P(command, PSTR("M110")) != nullptr;
-
-          if (M110) {
-            char* n2pos = strchr(command + 4, 'N');
-            if (n2pos) npos = n2pos;
-          }
-
-          const long gcode_N = strtol(npos + 1, nullptr, 10);
-
-          if (gcode_N != last_N[i] + 1 && !M110)
-            return gcode_line_error(PSTR(STR_ERR_LINE_NO), i);
+  for (;;) {
 
-          char *apos = strrchr(command, '*');
-          if (apos) {
-            uint8_t checksum = 0, count = uint8_t(apos - command);
-            while (count) checksum ^= command[--count];
-            if (strtol(apos + 1, nullptr, 10) != checksum)
-              return gcode_line_error(PSTR(STR_ERR_CHECKSUM_MISMATCH), i);
+    // Read each port up to the end of a line, unless it has one waiting
+    bool any_waiting = false;
+    LOOP_L_N(i, NUM_SERIAL) {
+      SerialLineRing * const ring = serial_line_ring(i);
+      if (ring)
+        serial_line_waiting[i] = ring->lines();
+      else if (!serial_line_waiting[i]) {
+        for (int c; (c = read_serial(i)) >= 0;) {
+          const char serial_char = c;
+          if (ISEOL(serial_char)) {
+            // Reset our state, keep reading if the line was empty
+            if (!process_line_done(serial_input_state[i], serial_line_buffer[i], serial_count[i])) {
+              serial_line_waiting[i] = true;
+              break;
+            }
           }
           else
-            return gcode_line_error(PSTR(STR_ERR_NO_CHECKSUM), i);
-
-          last_N[i] = gcode_N;
+            process_stream_char(serial_char, serial_input_state[i], serial_line_buffer[i], serial_count[i]);
         }
-        #if ENABLED(SDSUPPORT)
-          // Pronterface "M29" and "M29 " has no line number
-          else if (card.flag.saving && !is_M29(command))
-            return gcode_line_error(PSTR(STR_ERR_NO_CHECKSUM), i);
-        #endif
+      }
+      any_waiting |= serial_line_waiting[i];
+    }
+    if (!any_waiting) return;
+
+    // Queue a line from each port that has one waiting and its share to spare
+    bool queued = false;
+    LOOP_L_N(n, NUM_SERIAL) {
+      const uint8_t i = TERN(HAS_MULTI_SERIAL, (first_port + n) % NUM_SERIAL, n);
+      if (!serial_line_waiting[i]) continue;
+
+      char * const slot = next_command();
+      if (!slot) {
+        TERN_(COMMAND_QUEUE_STATS, stats.full++);
+        return;
+      }
 
-        //
-        // Movement commands give an alert when the machine is stopped
-        //
-
-        if (IsStopped()) {
-          char* gpos = strchr(command, 'G');
-          if (gpos) {
-            switch (strtol(gpos + 1, nullptr, 10)) {
-              case 0: case 1:
-              #if ENABLED(ARC_SUPPORT)
-                case 2: case 3:
-              #endif
-              #if ENABLED(BEZIER_CURVE_SUPPORT)
-                case 5:
-              #endif
-                PORT_REDIRECT(i);                      // Reply to the serial port that sent the command
-                SERIAL_ECHOLNPGM(STR_ERR_STOPPED);
-                LCD_MESSAGEPGM(MSG_STOPPED);
-                break;
-            }
-          }
+      #if HAS_MULTI_SERIAL
+        if (!port_has_share(i)) {
+          TERN_(COMMAND_QUEUE_STATS, stats.held++);
+          continue;
         }
-
-        #if DISABLED(EMERGENCY_PARSER)
-          // Process critical commands early
-          if (strcmp_P(command, PSTR("M108")) == 0) {
-            wait_for_heatup = false;
-            TERN_(HAS_LCD_MENU, wait_for_user = false);
-          }
-          if (strcmp_P(command, PSTR("M112")) == 0) kill(M112_KILL_STR, nullptr, true);
-          if (strcmp_P(command, PSTR("M410")) == 0) quickstop_stepper();
-        #endif
-
-				#if ENABLED(PROCESS_M290_ASAP)
-				  if (strstr_P(command, PSTR("M290")) != nullptr){
-				  	char* zpos = strchr(command + 4, 'Z');
-						if(zpos){
-							const float offs = constrain(strtof(zpos + 1, nullptr),-2,2);
-							babystep.add_mm(Z_AXIS, offs);
-							_commit_command(true
-				    		#if HAS_MULTI_SERIAL
-				      		, i
-				    		#endif
-				  			);
-						  	continue;
-						}
-				  }
-				#endif
-
-				//Check if WiFi is connected 
-				#if (HAS_MULTI_SERIAL && HAS_WIFI_SERIAL)
-					if(i == ID_SERIAL_WIFI){
-				  	if (strstr_P(command, PSTR("M117")) != nullptr)		wifi_M117_message = true;
-				  }
-				#endif			
-
-        #if defined(NO_TIMEOUTS) && NO_TIMEOUTS > 0
-          last_command_time = ms;
-        #endif
-
-        // Add the command to the queue
-        _enqueue(serial_line_buffer[i], true
-          #if HAS_MULTI_SERIAL
-            , i
-          #endif
-        );
+        first_port = (i + 1) % NUM_SERIAL;
+      #endif
+
+      serial_line_waiting[i] = false;
+      queued = true;
+
+      // A line in a receive ring is filtered straight into the queue
+      SerialLineRing * const ring = serial_line_ring(i);
+      if (ring) {
+        uint8_t sis = PS_NORMAL;
+        int count = 0;
+        if (ring->take_line([&](const char c){ process_stream_char(c, sis, slot, count); }) == SerialLineRing::LINE_LOST)
+          return gcode_line_error(PSTR(STR_ERR_LINE_LOST), i);
+        if (process_line_done(sis, slot, count)) continue;
+        if (!queue_serial_line(i, slot)) return;
       }
-      else
-        process_stream_char(serial_char, serial_input_state[i], serial_line_buffer[i], serial_count[i]);
-    } // for NUM_SERIAL
-  } // queue has space, serial has data
+      else if (!queue_serial_line(i, serial_line_buffer[i]))
+        return;
+    }
+    if (!queued) return;
+  }
 }
 
 #if ENABLED(SDSUPPORT)
@@ -603,9 +799,31 @@ void GCodeQueue::get_serial_commands() {
 
     if (!IS_SD_PRINTING()) return;
 
+    #if ENABLED(SD_GCODE_CACHE)
+      if (gcode_cache.replaying()) {
+        char *command;
+        while (!card.eof() && (command = next_command())) {
+          bool rec;
+          const uint16_t size = gcode_cache.read(command, rec);
+          if (!size) {
+            if (card.eof()) card.fileHasFinished();   // Else fall back to the G-code file
+            break;
+          }
+          const uint8_t i = index_w;
+          _commit_command(size, false);
+          record[i] = rec;                            // The only way a record enters the queue
+          #if ENABLED(POWER_LOSS_RECOVERY)
+            recovery.cmd_sdpos = card.getIndex();     // Prime for the NEXT _commit_command
+          #endif
+        }
+        return;
+      }
+    #endif
+
     int sd_count = 0;
     bool card_eof = card.eof();
-    while (length < BUFSIZE && !card_eof) {
+    char *command = next_command();
+    while (command && !card_eof) {
       const int16_t n = card.get();
       card_eof = card.eof();
       if (n < 0 && !card_eof) { SERIAL_ERROR_MSG(STR_SD_ERR_READ); continue; }
@@ -616,17 +834,19 @@ void GCodeQueue::get_serial_commands() {
 
         // Reset stream state, terminate the buffer, and commit a non-empty command
         if (!is_eol && sd_count) ++sd_count;          // End of file with no newline
-        if (!process_line_done(sd_input_state, command_buffer[index_w], sd_count)) {
-          _commit_command(false);
+        if (!process_line_done(sd_input_state, command, sd_count)) {
+          TERN_(SD_GCODE_CACHE, gcode_cache.write(command, card.getIndex()));
+          _commit_command(strlen(command) + 1, false);
           #if ENABLED(POWER_LOSS_RECOVERY)
             recovery.cmd_sdpos = card.getIndex();     // Prime for the NEXT _commit_command
           #endif
+          command = next_command();
         }
 
         if (card_eof) card.fileHasFinished();         // Handle end of file reached
       }
       else
-        process_stream_char(sd_char, sd_input_state, command_buffer[index_w], sd_count);
+        process_stream_char(sd_char, sd_input_state, command, sd_count);
 
     }
   }
@@ -660,7 +880,7 @@ void GCodeQueue::advance() {
   #if ENABLED(SDSUPPORT)
 
     if (card.flag.saving) {
-      char* command = command_buffer[index_r];
+      char* command = GCodeQueue::command(index_r);
       if (is_M29(command)) {
         // M29 closes the file
         card.closefile();
@@ -678,8 +898,8 @@ void GCodeQueue::advance() {
         ok_to_send();
       }
       else {
-        // Write the string from the read buffer to SD
-        card.write_command(command);
+        // Write the string from the read buffer to SD. A log skips cached records.
+        if (!is_record(index_r)) card.write_command(command);
         if (card.flag.logging)
           gcode.process_next_command(); // The card is saving because it's logging
         else
@@ -696,6 +916,10 @@ void GCodeQueue::advance() {
   #endif // SDSUPPORT
 
   // The queue may be reset by a command handler or by code invoked by idle() within a handler
+  #if HAS_MULTI_SERIAL
+    const int16_t p = port[index_r];
+    if (p >= 0 && port_length[p]) port_length[p]--;
+  #endif
   --length;
   if (++index_r >= BUFSIZE) index_r = 0;
 
@@ -62,7 +62,8 @@ public:
 
   /**
    * GCode Command Queue
-   * A simple ring buffer of BUFSIZE command strings.
+   * A ring of up to BUFSIZE commands whose text is packed end to end in a
+   * buffer of BUFSIZE_BYTES, so a short command takes only the bytes it needs.
    *
    * Commands are copied into this buffer by the command injectors
    * (immediate, serial, sd card) and they are processed sequentially by
@@ -72,19 +73,52 @@ public:
   static uint8_t length,  // Count of commands in the queue
                  index_r; // Ring buffer read position
 
-  static char command_buffer[BUFSIZE][MAX_CMD_SIZE];
+  static char command_buffer[BUFSIZE_BYTES];
+  static uint16_t command_start[BUFSIZE];   // Where each command starts in the buffer
+
+  static inline char* command(const uint8_t i) { return &command_buffer[command_start[i]]; }
+
+  // The slot 'n' places from the read position
+  static inline uint8_t slot(const uint8_t n) {
+    const uint8_t i = index_r + n;
+    return i < BUFSIZE ? i : i - BUFSIZE;
+  }
+
+  // The command 'n' places from the read position, or nullptr if fewer are queued
+  static inline char* peek(const uint8_t n) { return n < length ? command(slot(n)) : nullptr; }
+
+  #if ENABLED(SD_GCODE_CACHE)
+    // Set only for the pre-parsed records read from a G-code cache
+    static bool record[BUFSIZE];
+  #endif
+
+  static inline bool is_record(const uint8_t i) { return TERN0(SD_GCODE_CACHE, record[i]); }
 
   /**
    * The port that the command was received on
    */
   #if HAS_MULTI_SERIAL
     static int16_t port[BUFSIZE];
+    static uint8_t port_length[NUM_SERIAL]; // Count of commands in the queue from each port
   #endif
 
   static int16_t command_port() {
     return TERN0(HAS_MULTI_SERIAL, port[index_r]);
   }
 
+  #if ENABLED(COMMAND_QUEUE_STATS)
+    typedef struct {
+      uint8_t  peak_length;     // Most commands queued at once
+      uint16_t peak_bytes;      // Most of the buffer in use at once
+      uint32_t full,            // Times a line waited for room in the queue
+               held;            // Times a port was held to its share of the queue
+    } stats_t;
+    static stats_t stats;
+
+    static uint16_t bytes_used();
+    static void report_stats();
+  #endif
+
   GCodeQueue();
 
   /**
@@ -172,14 +206,23 @@ public:
 private:
 
   static uint8_t index_w;  // Ring buffer write position
+  static uint16_t buffer_w; // End of the last command in the buffer
+
+  static char* next_command();
 
   static void get_serial_commands();
 
+  static bool queue_serial_line(const uint8_t pn, char * const line);
+
+  #if HAS_MULTI_SERIAL
+    static bool port_has_share(const uint8_t pn);
+  #endif
+
   #if ENABLED(SDSUPPORT)
     static void get_sdcard_commands();
   #endif
 
-  static void _commit_command(bool say_ok
+  static void _commit_command(const uint16_t size, bool say_ok
     #if HAS_MULTI_SERIAL
       , int16_t p=-1
     #endif
@@ -196,8 +196,10 @@ void GcodeSuite::M109() {
 
   TERN_(AUTOTEMP, planner.autotemp_M104_M109());
 
-  if (got_temp)
+  if (got_temp) {
+    TERN_(HEATUP_LOOKAHEAD, heat_ahead());
     (void)thermalManager.wait_for_hotend(target_extruder, no_wait_for_cooling);
+  }
 }
 
 #endif // EXTRUDERS
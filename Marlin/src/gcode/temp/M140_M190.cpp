@@ -132,6 +132,8 @@ void GcodeSuite::M190() {
 
   ui.set_status_P(thermalManager.isHeatingBed() ? GET_TEXT(MSG_BED_HEATING) : GET_TEXT(MSG_BED_COOLING));
 
+  TERN_(HEATUP_LOOKAHEAD, heat_ahead());
+
   thermalManager.wait_for_bed(no_wait_for_cooling);
 }
 
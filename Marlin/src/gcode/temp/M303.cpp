@@ -33,7 +33,7 @@
 #endif
 
 #if HAS_DWIN_LCD
-#include "../../lcd/dwin/dwin_lcd.h"
+#include "../../lcd/dwin/DWIN_LCD.h"
 #include "../../lcd/dwin/dwin_ui/dwin.h"
 #endif
 
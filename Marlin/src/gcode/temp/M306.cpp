@@ -0,0 +1,93 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(MPCTEMP)
+
+#include "../gcode.h"
+#include "../../lcd/ultralcd.h"
+#include "../../module/motion.h"
+#include "../../module/temperature.h"
+
+void M306_report(const uint8_t e) {
+  const MPC_t &mpc = thermalManager.temp_hotend[e].constants;
+  SERIAL_ECHOPAIR("  M306 E", int(e));
+  SERIAL_ECHOPAIR_F(" P", mpc.heater_power, 2);
+  SERIAL_ECHOPAIR_F(" C", mpc.block_heat_capacity, 2);
+  SERIAL_ECHOPAIR_F(" R", mpc.sensor_responsiveness, 4);
+  SERIAL_ECHOPAIR_F(" A", mpc.ambient_xfer_coeff_fan0, 4);
+  SERIAL_ECHOPAIR_F(" F", mpc.ambient_xfer_coeff_fan0 + mpc.fan255_adjustment, 4);
+  SERIAL_ECHOLNPAIR_F(" H", mpc.filament_heat_capacity_permm, 4);
+}
+
+/**
+ * M306: Set or measure the model constants of a hotend (MPCTEMP)
+ *
+ *  E<extruder>  Hotend to set or tune. (Default: the active extruder)
+ *  T            Autotune: measure C, R, A and F with the nozzle where it prints
+ *
+ *  P<watts>     Heater power
+ *  C<J/K>       Block heat capacity
+ *  R<K/s/K>     Sensor responsiveness
+ *  A<W/K>       Heat loss to the air with the fan off
+ *  F<W/K>       Heat loss to the air with the fan on full
+ *  H<J/K/mm>    Filament heat capacity per mm
+ *
+ * With none of these report the constants.
+ */
+void GcodeSuite::M306() {
+  const uint8_t e = parser.seenval('E') ? parser.value_byte() : active_extruder;
+  if (e >= HOTENDS) {
+    SERIAL_ERROR_MSG(STR_INVALID_EXTRUDER);
+    return;
+  }
+
+  if (parser.seen_test('T')) {
+    #if DISABLED(BUSY_WHILE_HEATING)
+      KEEPALIVE_STATE(NOT_BUSY);
+    #endif
+    ui.set_status(GET_TEXT(MSG_MPC_AUTOTUNE));
+    thermalManager.MPC_autotune(e);
+    ui.reset_status();
+    return;
+  }
+
+  if (!parser.seen("PCRAFH")) {
+    M306_report(e);
+    return;
+  }
+
+  MPC_t &mpc = thermalManager.temp_hotend[e].constants;
+  if (parser.seenval('P')) mpc.heater_power = parser.value_float();
+  if (parser.seenval('C')) mpc.block_heat_capacity = parser.value_float();
+  if (parser.seenval('R')) mpc.sensor_responsiveness = parser.value_float();
+  if (parser.seenval('F')) mpc.fan255_adjustment = parser.value_float() - mpc.ambient_xfer_coeff_fan0;
+  if (parser.seenval('A')) {
+    const float fan255 = mpc.ambient_xfer_coeff_fan0 + mpc.fan255_adjustment;
+    mpc.ambient_xfer_coeff_fan0 = parser.value_float();
+    mpc.fan255_adjustment = fan255 - mpc.ambient_xfer_coeff_fan0;   // F stays as it was set
+  }
+  if (parser.seenval('H')) mpc.filament_heat_capacity_permm = parser.value_float();
+}
+
+#endif // MPCTEMP
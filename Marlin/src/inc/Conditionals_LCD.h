@@ -538,6 +538,10 @@
   #endif
 #endif
 
+#if EXTRUDERS
+  #define HAS_EXTRUDERS 1
+#endif
+
 #if ENABLED(SWITCHING_EXTRUDER)   // One stepper for every two EXTRUDERS
   #if EXTRUDERS > 4
     #define E_STEPPERS    3
@@ -83,6 +83,7 @@
   #undef TEMP_SENSOR_7
   #undef FWRETRACT
   #undef PIDTEMP
+  #undef MPCTEMP
   #undef AUTOTEMP
   #undef PID_EXTRUSION_SCALING
   #undef LIN_ADVANCE
@@ -208,6 +209,10 @@
   #define NEEDS_HARDWARE_PWM 1
 #endif
 
+#ifndef BUFSIZE_BYTES
+  #define BUFSIZE_BYTES ((BUFSIZE) * (MAX_CMD_SIZE))
+#endif
+
 #if !defined(__AVR__) || !defined(USBCON)
   // Define constants and variables for buffering serial data.
   // Use only 0 or powers of 2 greater than 1
@@ -629,6 +629,12 @@
 /**
  * Serial
  */
+#if BUFSIZE < 2 || BUFSIZE > 255
+  #error "BUFSIZE must be from 2 to 255."
+#elif BUFSIZE_BYTES < 2 * (MAX_CMD_SIZE) || BUFSIZE_BYTES > 0xFFFF
+  #error "BUFSIZE_BYTES must be at least 2 * MAX_CMD_SIZE and under 65536."
+#endif
+
 #if !(defined(__AVR__) && defined(USBCON))
   #if ENABLED(SERIAL_XON_XOFF) && RX_BUFFER_SIZE < 1024
     #error "SERIAL_XON_XOFF requires RX_BUFFER_SIZE >= 1024 for reliable transfers without drops."
@@ -1192,6 +1198,15 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
   #error "You must set DISPLAY_CHARSET_HD44780 to JAPANESE, WESTERN or CYRILLIC for your LCD controller."
 #endif
 
+/**
+ * Hotend temperature control
+ */
+#if BOTH(PIDTEMP, MPCTEMP)
+  #error "Only enable one of PIDTEMP or MPCTEMP."
+#elif ENABLED(MPCTEMP)
+  static_assert(WITHIN(MPC_SMOOTHING_FACTOR, 0, 1), "MPC_SMOOTHING_FACTOR must be from 0 to 1.");
+#endif
+
 /**
  * Bed Heating Options - PID vs Limit Switching
  */
@@ -1199,6 +1214,19 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
   #error "To use BED_LIMIT_SWITCHING you must disable PIDTEMPBED."
 #endif
 
+/**
+ * Heater Power Budget
+ */
+#if ENABLED(HEATER_POWER_BUDGET)
+  #if !defined(HEATER_BUDGET_WATTS) || HEATER_BUDGET_WATTS <= 0
+    #error "HEATER_POWER_BUDGET requires HEATER_BUDGET_WATTS above 0."
+  #elif HAS_HEATED_BED && !defined(BED_HEATER_WATTS)
+    #error "HEATER_POWER_BUDGET requires BED_HEATER_WATTS for the heated bed."
+  #elif DISABLED(MPCTEMP) && !defined(HOTEND_HEATER_WATTS)
+    #error "HEATER_POWER_BUDGET requires HOTEND_HEATER_WATTS, or MPCTEMP for MPC_HEATER_POWER."
+  #endif
+#endif
+
 /**
  * Kinematics
  */
@@ -1238,6 +1266,49 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
   #error "CLASSIC_JERK is required for DELTA and SCARA."
 #endif
 
+/**
+ * ISR Profiling
+ */
+#if ENABLED(ISR_PROFILING) && !defined(HAL_CYCLE_COUNTER)
+  #error "ISR_PROFILING requires a cycle counter, which this platform's HAL doesn't provide."
+#elif ENABLED(MEASURED_STEP_ISR_LIMITS) && DISABLED(ISR_PROFILING)
+  #error "MEASURED_STEP_ISR_LIMITS requires ISR_PROFILING."
+#endif
+#if ENABLED(MEASURED_STEP_ISR_LIMITS)
+  static_assert(WITHIN(STEP_ISR_MAX_LOAD, 0.1, 0.9), "STEP_ISR_MAX_LOAD must be from 0.1 to 0.9.");
+#endif
+
+/**
+ * Input Shaping
+ */
+#if ENABLED(INPUT_SHAPING)
+  #if IS_KINEMATIC || CORE_IS_XZ || CORE_IS_YZ || ENABLED(MARKFORGED_XY)
+    #error "INPUT_SHAPING requires Cartesian or CoreXY kinematics."
+  #elif ENABLED(DIRECT_STEPPING)
+    #error "INPUT_SHAPING is incompatible with DIRECT_STEPPING."
+  #elif ENABLED(BABYSTEP_XY)
+    #error "INPUT_SHAPING is incompatible with BABYSTEP_XY."
+  #elif !WITHIN(SHAPING_BUFFER_SIZE, 16, 0x3FFF)
+    #error "SHAPING_BUFFER_SIZE must be from 16 to 16383."
+  #endif
+  static_assert(SHAPING_MIN_FREQ > 0, "SHAPING_MIN_FREQ must be greater than 0.");
+  static_assert(SHAPING_FREQ_X == 0 || SHAPING_FREQ_X >= SHAPING_MIN_FREQ, "SHAPING_FREQ_X must be 0 or at least SHAPING_MIN_FREQ.");
+  static_assert(SHAPING_FREQ_Y == 0 || SHAPING_FREQ_Y >= SHAPING_MIN_FREQ, "SHAPING_FREQ_Y must be 0 or at least SHAPING_MIN_FREQ.");
+  static_assert(WITHIN(SHAPING_ZETA_X, 0, 0.99), "SHAPING_ZETA_X must be from 0 to 0.99.");
+  static_assert(WITHIN(SHAPING_ZETA_Y, 0, 0.99), "SHAPING_ZETA_Y must be from 0 to 0.99.");
+#endif
+
+/**
+ * Arc segment length
+ */
+#if ENABLED(ARC_SUPPORT)
+  #if defined(ARC_SEGMENTS_PER_R) + defined(ARC_SEGMENT_TOLERANCE) + (ARC_SEGMENTS_PER_SEC > 0) > 1
+    #error "Enable only one of ARC_SEGMENTS_PER_R, ARC_SEGMENT_TOLERANCE, or ARC_SEGMENTS_PER_SEC."
+  #elif defined(ARC_SEGMENT_TOLERANCE)
+    static_assert(ARC_SEGMENT_TOLERANCE > 0, "ARC_SEGMENT_TOLERANCE must be greater than 0.");
+  #endif
+#endif
+
 /**
  * Probes
  */
@@ -2246,6 +2317,19 @@ static_assert(hbm[Z_AXIS] >= 0, "HOMING_BUMP_MM.Z must be greater than or equal
   #endif
 #endif
 
+/**
+ * Pre-parsed G-code cache requirements
+ */
+#if ENABLED(SD_GCODE_CACHE)
+  #if DISABLED(SDSUPPORT)
+    #error "SD_GCODE_CACHE requires SDSUPPORT."
+  #elif DISABLED(FASTER_GCODE_PARSER)
+    #error "SD_GCODE_CACHE requires FASTER_GCODE_PARSER."
+  #elif ENABLED(SDCARD_READONLY)
+    #error "SD_GCODE_CACHE is incompatible with SDCARD_READONLY."
+  #endif
+#endif
+
 /**
  * Make sure features that need to write to the SD card can
  */
@@ -2794,6 +2878,10 @@ static_assert(   _ARR_TEST(3,0) && _ARR_TEST(3,1) && _ARR_TEST(3,2)
   #error "BLOCK_BUFFER_SIZE must be a power of 2."
 #endif
 
+#if DWIN_TX_BUFFER_SIZE && (DWIN_TX_BUFFER_SIZE < 128 || !IS_POWER_OF_2(DWIN_TX_BUFFER_SIZE))
+  #error "DWIN_TX_BUFFER_SIZE must be a power of 2 of at least 128."
+#endif
+
 #if ENABLED(LED_CONTROL_MENU) && !IS_ULTIPANEL
   #error "LED_CONTROL_MENU requires an LCD controller."
 #endif
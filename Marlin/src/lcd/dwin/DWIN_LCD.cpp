@@ -32,11 +32,14 @@
 
 #if HAS_DWIN_LCD
 #include "dwin_ui/dwin.h"
-#include "dwin_lcd.h"
+#include "DWIN_LCD.h"
 #include <string.h> // for memset
 
 DWINLCD dwinLCD;
 
+uint32_t DWINLCD::bytes_sent; // = 0
+uint16_t DWINLCD::bytes_per_second; // = 0
+
 uint8_t DWIN_SendBuf[DWIN_SENDBUF_SIZE] = { 0xAA };
 uint8_t DWIN_BufTail[4] = { 0xCC, 0x33, 0xC3, 0x3C };
 uint8_t databuf[26] = { 0 };
@@ -73,12 +76,75 @@ FORCE_INLINE static void DWIN_String(size_t &i, const __FlashStringHelper * stri
 	i += len;
 }
 
-// Send the data in the buffer and the packet end
-FORCE_INLINE static void DWIN_Send(size_t &i) {
-	++i;
-	LOOP_L_N(n, i) { LCD_SERIAL.write(DWIN_SendBuf[n]); delayMicroseconds(1); }
-	LOOP_L_N(n, 4) { LCD_SERIAL.write(DWIN_BufTail[n]); delayMicroseconds(1); }
-}
+#if DWIN_TX_BUFFER_SIZE
+
+  /**
+   * Transmit queue
+   *
+   * DWIN_Send() appends each command to a ring and returns. Service() hands
+   * the queued bytes to the UART: all at once by DMA where the port has it,
+   * otherwise DWIN_TX_SLICE bytes per call so the serial TX buffer never
+   * blocks. Commands queued during a transfer go out together in the next.
+   */
+  #define DWIN_TX_MASK (DWIN_TX_BUFFER_SIZE - 1)
+  #define DWIN_TX_SLICE 32
+
+  static uint8_t tx_ring[DWIN_TX_BUFFER_SIZE];
+  static uint16_t tx_head, tx_tail, tx_sending; // tx_sending bytes from tx_tail are in a DMA transfer
+
+  FORCE_INLINE static uint16_t tx_free() { return DWIN_TX_MASK - ((tx_head - tx_tail) & DWIN_TX_MASK); }
+
+  static void tx_queue(const uint8_t *data, const size_t len) {
+    while (tx_free() < len) DWINLCD::Service();
+    LOOP_L_N(n, len) {
+      tx_ring[tx_head] = data[n];
+      tx_head = (tx_head + 1) & DWIN_TX_MASK;
+    }
+  }
+
+  void DWINLCD::Service(void) {
+    if (tx_sending) {
+      #if LCD_SERIAL_TX_DMA
+        if (LCD_SERIAL.txDMABusy()) return;
+      #endif
+      tx_tail = (tx_tail + tx_sending) & DWIN_TX_MASK;
+      tx_sending = 0;
+    }
+    if (tx_head == tx_tail) return;
+
+    // Bytes up to the head or the end of the ring
+    const uint16_t len = (tx_head > tx_tail ? tx_head : DWIN_TX_BUFFER_SIZE) - tx_tail;
+    #if LCD_SERIAL_TX_DMA
+      if (LCD_SERIAL.writeDMA(&tx_ring[tx_tail], len)) { tx_sending = len; return; }
+    #endif
+    const uint16_t slice = _MIN(len, DWIN_TX_SLICE);
+    LOOP_L_N(n, slice) LCD_SERIAL.write(tx_ring[tx_tail + n]);
+    tx_tail = (tx_tail + slice) & DWIN_TX_MASK;
+  }
+
+  void DWINLCD::Flush(void) {
+    while (tx_head != tx_tail || tx_sending) Service();
+  }
+
+  // Queue the data in the buffer and the packet end
+  FORCE_INLINE static void DWIN_Send(size_t &i) {
+    ++i;
+    tx_queue(DWIN_SendBuf, i);
+    tx_queue(DWIN_BufTail, 4);
+    DWINLCD::bytes_sent += i + 4;
+  }
+
+#else
+
+  // Send the data in the buffer and the packet end
+  FORCE_INLINE static void DWIN_Send(size_t &i) {
+    ++i;
+    LOOP_L_N(n, i) { LCD_SERIAL.write(DWIN_SendBuf[n]); delayMicroseconds(1); }
+    LOOP_L_N(n, 4) { LCD_SERIAL.write(DWIN_BufTail[n]); delayMicroseconds(1); }
+    DWINLCD::bytes_sent += i + 4;
+  }
+
+#endif
 
 /*-------------------------------------- System variable function --------------------------------------*/
 
@@ -89,6 +155,9 @@ bool DWINLCD::Handshake(void) {
   size_t i = 0;
   DWIN_Byte(i, 0x00);
   DWIN_Send(i);
+  #if DWIN_TX_BUFFER_SIZE
+    Flush();
+  #endif
 
   while (LCD_SERIAL.available() > 0 && recnum < (signed)sizeof(databuf)) {
     databuf[recnum] = LCD_SERIAL.read();
@@ -136,6 +205,9 @@ void DWINLCD::UpdateLCD(void) {
   size_t i = 0;
   DWIN_Byte(i, 0x3D);
   DWIN_Send(i);
+  #if DWIN_TX_BUFFER_SIZE
+    Service(); // Start sending the frame
+  #endif
 }
 
 /*---------------------------------------- Drawing functions ----------------------------------------*/
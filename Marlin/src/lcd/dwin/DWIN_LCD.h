@@ -80,7 +80,16 @@ class DWINLCD{
 		//  dir: 0=0°, 1=90°, 2=180°, 3=270°
 		static void Frame_SetDir(uint8_t dir);
 		// Update display
-		static void UpdateLCD(void);		
+		static void UpdateLCD(void);
+		#if DWIN_TX_BUFFER_SIZE
+			// Send queued commands in the background. Call often.
+			static void Service(void);
+			// Wait until every queued command has been sent
+			static void Flush(void);
+		#endif
+		// Bytes sent to the panel since startup, and in the last full second
+		static uint32_t bytes_sent;
+		static uint16_t bytes_per_second;
 		/*---------------------------------------- Drawing functions ----------------------------------------*/
 		// Clear screen
 		//	color: Clear screen color
@@ -431,15 +431,20 @@ void Draw_Print_ProgressBar() {
  dwinLCD.Draw_String(false, false, font8x16, COLOR_BG_RED, BARFILL_COLOR, 133, 65, PSTR("%"));
 }
 
-void Draw_Print_ElapsedTime() {
+void Draw_Print_ElapsedTime(const bool redraw/*=true*/) {
 	#define	ELAPSEDTIME_STAR_X	40
+	static char shown_string[20] = { 0 };
 	duration_t elapsed = print_job_timer.duration(); // print timer	
 	char elapsed_string[20];
 	//if(elapsed.hour() < 100)
 		sprintf_P(elapsed_string, PSTR("%02d:%02d:%02d"), (int)(elapsed.hour()%100), (uint8_t)(elapsed.minute()%60), (uint8_t)(elapsed.second()%60));
 	//else
 	//	sprintf_P(elapsed_string, PSTR("%03d:%02d:%02d"), (int)(elapsed.hour()%1000), (uint8_t)(elapsed.minute()%60), (uint8_t)(elapsed.second()%60));	
-	DWIN_Draw_MaskString_Default(ELAPSEDTIME_STAR_X, 212, elapsed_string);
+	// Only send the characters from the first one that changed
+	uint8_t i = 0;
+	if (!redraw) while (elapsed_string[i] && elapsed_string[i] == shown_string[i]) i++;
+	if (elapsed_string[i]) DWIN_Draw_MaskString_Default(ELAPSEDTIME_STAR_X + i * 8, 212, &elapsed_string[i]);
+	strcpy(shown_string, elapsed_string);
 }
 
 void Draw_Print_RemainTime() {
@@ -25,7 +25,7 @@
 #include "../../../inc/MarlinConfig.h"
 #if HAS_DWIN_LCD
 #include "../rotary_encoder.h"
-#include "../dwin_lcd.h"
+#include "../DWIN_LCD.h"
 #include "dwin_comm.h"
 #include "dwin.h"
 #include "../../../feature/pause.h"
@@ -80,7 +80,7 @@ void DWIN_Refresh_ExtruerFAN_State();
 void Redraw_SD_List();
 void Draw_Printing_Menu(const uint8_t MenuItem = 0, const bool with_update = false);
 void Draw_Print_ProgressBar();
-void Draw_Print_ElapsedTime();
+void Draw_Print_ElapsedTime(const bool redraw=true);
 void Draw_Print_RemainTime();
 void DWIN_Draw_PrintDone_Confirm();
 void Draw_Print_ProgressMixModel();
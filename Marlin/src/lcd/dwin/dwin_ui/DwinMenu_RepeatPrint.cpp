@@ -29,7 +29,7 @@
 #if (HAS_DWIN_LCD && ENABLED(OPTION_REPEAT_PRINTING))
 #include "dwin.h"
 #include "../../../feature/repeat_printing.h"
-#include "dwinmenu_repeatprint.h"
+#include "DwinMenu_RepeatPrint.h"
 
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -25,7 +25,7 @@
 #include "../../../inc/MarlinConfig.h"
 #if (HAS_DWIN_LCD && ENABLED(OPTION_REPEAT_PRINTING))
 #include "../rotary_encoder.h"
-#include "../dwin_lcd.h"
+#include "../DWIN_LCD.h"
 #include "dwin_comm.h"
 #include "dwin.h"
 
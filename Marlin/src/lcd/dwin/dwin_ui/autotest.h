@@ -28,7 +28,7 @@
 #include "dwin.h"
 
 #if (HAS_DWIN_LCD && ENABLED(DWIN_AUTO_TEST))
-#include "../dwin_lcd.h"
+#include "../DWIN_LCD.h"
 #include "../rotary_encoder.h"
 
 enum {
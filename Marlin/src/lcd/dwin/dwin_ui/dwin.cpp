@@ -32,15 +32,15 @@
 #include <string.h>
 
 #include "../language/dwin_multi_language.h"
-#include "../dwin_lcd.h"
+#include "../DWIN_LCD.h"
 #include "../rotary_encoder.h"
 #include "dwin_comm.h"
 #include "autotest.h"
-#include "dwinmenu_main.h"
-#include "dwinmenu_print.h"
-#include "dwinmenu_prepare.h"
-#include "dwinmenu_control.h"
-#include "dwinmenu_infor.h"
+#include "DwinMenu_Main.h"
+#include "DwinMenu_Print.h"
+#include "DwinMenu_Prepare.h"
+#include "DwinMenu_Control.h"
+#include "DwinMenu_Infor.h"
 
 #if ENABLED(MIXING_EXTRUDER)
   #include "../../../feature/mixing.h"
@@ -48,7 +48,7 @@
 
 #if ENABLED(OPTION_REPEAT_PRINTING)
   #include "../../../feature/repeat_printing.h"
-	#include "dwinmenu_repeatprint.h"
+	#include "DwinMenu_RepeatPrint.h"
 #endif
 
 #include "../../fontutils.h"
@@ -162,7 +162,7 @@ inline void _Update_printing_Timer(){
 		const uint16_t seconds = elapsed.value % 3600;
 		if (last_Printtime != seconds) { // 1 second update
 			last_Printtime = seconds;
-			if(DwinMenuID == DWMENU_PRINTING) Draw_Print_ElapsedTime();
+			if(DwinMenuID == DWMENU_PRINTING) Draw_Print_ElapsedTime(false);
 
 		#if HAS_PRINT_PROGRESS_PERMYRIAD
 			// Update remaining time
@@ -405,26 +405,22 @@ inline void DWIN_Show_Extruder_status() {
 #endif
 
 inline void DWIN_Update_Variable() {
- #if HAS_HOTEND
-  static float last_temp_hotend_target = 0, last_temp_hotend_current = 0;
- #endif
- #if HAS_HEATED_BED
-  static float last_temp_bed_target = 0, last_temp_bed_current = 0;
- #endif
  #if HAS_FAN
   static uint8_t last_fan_speed = 0;
  #endif
 
- static uint8_t flash_mask = 0;
+ /* Bottom status area, only the fields that changed */
+	const uint8_t changed = Update_Status_Area();
+	UNUSED(changed);
 
  /* Tune page temperature update */
 	if (DwinMenuID == DWMENU_TUNE){
 #if HAS_HOTEND
-		if(last_temp_hotend_target != thermalManager.degTargetHotend(0))
+		if (TEST(changed, STATUS_HOTEND_TARGET))
 		  DWIN_Draw_IntValue_Default(3, MENUVALUE_X+8, MBASE(TUNE_CASE_ETEMP + MROWS - DwinMenu_tune.index), thermalManager.degTargetHotend(0));
 #endif
 #if HAS_HEATED_BED
-		if(last_temp_bed_target != thermalManager.degTargetBed())
+		if (TEST(changed, STATUS_BED_TARGET))
 		  DWIN_Draw_IntValue_Default(3, MENUVALUE_X+8, MBASE(TUNE_CASE_BTEMP + MROWS - DwinMenu_tune.index), thermalManager.degTargetBed());
 #endif
 #if HAS_FAN
@@ -438,11 +434,11 @@ inline void DWIN_Update_Variable() {
  /* Temperature page temperature update */
 	if (DwinMenuID == DWMENU_TEMPERATURE) {
 #if HAS_HOTEND
-		if (last_temp_hotend_target != thermalManager.degTargetHotend(0))
+		if (TEST(changed, STATUS_HOTEND_TARGET))
 			DWIN_Draw_IntValue_Default(3, MENUVALUE_X+8, MBASE(TEMP_CASE_ETEMP + MROWS - DwinMenu_temp.index), thermalManager.degTargetHotend(0));
 #endif
 #if HAS_HEATED_BED
-		if (last_temp_bed_target != thermalManager.degTargetBed())
+		if (TEST(changed, STATUS_BED_TARGET))
 			DWIN_Draw_IntValue_Default(3, MENUVALUE_X+8, MBASE(TEMP_CASE_BTEMP + MROWS - DwinMenu_temp.index), thermalManager.degTargetBed());
 #endif
 #if HAS_FAN
@@ -453,50 +449,6 @@ inline void DWIN_Update_Variable() {
 #endif
 	}
 
- /* Bottom temperature update */
-#if HAS_HOTEND
-	//HOTEND temperature
-	if (last_temp_hotend_current != thermalManager.degHotend(0)) {
-		DWIN_Draw_IntValue_FONT10((thermalManager.degHotend(0) > HOTEND_WARNNING_TEMP)? COLOR_RED : COLOR_WHITE, State_text_extruder_num, State_text_extruder_X, State_text_extruder_Y, thermalManager.degHotend(0));
-		last_temp_hotend_current = thermalManager.degHotend(0);
-	}
-	//HOTEND targe temperature
-	if(DWIN_status == ID_SM_PIDAUTOTUNING){
-		if (last_temp_hotend_target != HMI_Value.PIDAutotune_Temp) {
-			DWIN_Draw_IntValue_FONT10(COLOR_RED, State_text_extruder_num, State_text_extruder_X + (State_text_extruder_num + 1) * STAT_CHR_W, State_text_extruder_Y, HMI_Value.PIDAutotune_Temp);	
-			last_temp_hotend_target = HMI_Value.PIDAutotune_Temp;
-		}
-	}
-	else if (last_temp_hotend_target != thermalManager.degTargetHotend(0)) {
-		if(DwinMenuID == DWMENU_POP_FROD_HEAT && ((++flash_mask&0x01) == 0x01))
-			DWIN_Draw_UnMaskString_FONT10(State_text_extruder_X + (State_text_extruder_num + 1) * STAT_CHR_W, State_text_extruder_Y, PSTR("    "));		
-		else 
-			DWIN_Draw_IntValue_FONT10((thermalManager.degTargetHotend(0) > HOTEND_WARNNING_TEMP) ? COLOR_RED : COLOR_WHITE, State_text_extruder_num, State_text_extruder_X + (State_text_extruder_num + 1) * STAT_CHR_W, State_text_extruder_Y, thermalManager.degTargetHotend(0));					
-		last_temp_hotend_target = thermalManager.degTargetHotend(0);
-	}
-#endif
- 
- #if HAS_HEATED_BED
-	if (last_temp_bed_current != thermalManager.degBed()) {
-		DWIN_Draw_IntValue_FONT10(COLOR_WHITE, State_text_bed_num, State_text_bed_X, State_text_bed_Y, thermalManager.degBed());
-		last_temp_bed_current = thermalManager.degBed();
-	}
-	if (last_temp_bed_target != thermalManager.degTargetBed()) {
-		DWIN_Draw_IntValue_FONT10(COLOR_WHITE, State_text_bed_num, State_text_bed_X + (State_text_bed_num + 1) * STAT_CHR_W, State_text_bed_Y, thermalManager.degTargetBed());
-		last_temp_bed_target = thermalManager.degTargetBed();
-	}
- #endif
- 
- 	/* printing speed*/
-	static int16_t last_speed = 0;
-	if (last_speed != feedrate_percentage) {
-		DWIN_Draw_IntValue_FONT10(COLOR_WHITE, 3, State_text_speed_X, State_text_speed_Y, feedrate_percentage);
-		last_speed = feedrate_percentage;
-	}
-	
-	/*Z postion*/
-	DWIN_Show_Z_Position(true);
-
 	/*Mixing*/
 	TERN_(MIXING_EXTRUDER, DWIN_Show_Extruder_status());
 }
@@ -947,6 +899,10 @@ void EachMomentUpdate() {
 	if (PENDING(ms, next_rts_update_ms)) 	return;
 	next_rts_update_ms = ms + 1000;
 	//do it per second
+	//LCD serial load over the last second
+	static uint32_t last_bytes_sent = 0;
+	dwinLCD.bytes_per_second = _MIN(dwinLCD.bytes_sent - last_bytes_sent, uint32_t(UINT16_MAX));
+	last_bytes_sent = dwinLCD.bytes_sent;
 	#if ENABLED(DEBUG_DWIN_LCD)
 	if(old_DwinMenuID != DwinMenuID || old_DwinStatus != DWIN_status){
 		SERIAL_ECHOLNPAIR("DwinMenuID = ", DwinMenuID);
@@ -954,6 +910,7 @@ void EachMomentUpdate() {
 		old_DwinMenuID = DwinMenuID;
 		old_DwinStatus = DWIN_status;
 	}
+	if(dwinLCD.bytes_per_second) SERIAL_ECHOLNPAIR("DWIN bytes/s = ", dwinLCD.bytes_per_second);
 	#endif
 
 	//variable update
@@ -1040,7 +997,10 @@ void EachMomentUpdate() {
 	dwinLCD.UpdateLCD();
 }
 
-void DWIN_Update() {
+void DWIN_Update(const bool handle_input/*=true*/) {
+#if DWIN_TX_BUFFER_SIZE
+	dwinLCD.Service();   // Keep the panel transmit queue moving
+#endif
 #if ENABLED(DWIN_AUTO_TEST)
 	if(HMI_flag.auto_test_flag == 0xaa){
 		if(autotest.DWIN_AutoTesting()){
@@ -1056,7 +1016,7 @@ void DWIN_Update() {
 #endif		
 	{				
 		EachMomentUpdate();  // Status update		
-		DWIN_HandleScreen(); // Rotary encoder update
+		if (handle_input) DWIN_HandleScreen(); // Rotary encoder update
 		HMI_SDCardUpdate();	 // SD card update
 #if BOTH(CASE_LIGHT_ENABLE, CASE_LIGHT_SMART)
 		SmartCaselightUpdate();
@@ -1064,4 +1024,12 @@ void DWIN_Update() {
 	}
 }
 
+// Poll the rotary encoder and run the screen it acts on, without the redraw
+void DWIN_HandleInput() {
+#if ENABLED(DWIN_AUTO_TEST)
+	if (HMI_flag.auto_test_flag == 0xaa) return;
+#endif
+	DWIN_HandleScreen();
+}
+
 #endif // HAS_DWIN_LCD
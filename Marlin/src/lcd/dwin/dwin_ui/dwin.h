@@ -76,11 +76,11 @@
 //#define	OPTION_TEST_MENU
 
 #include "../language/dwin_multi_language.h"
-#include "../dwin_lcd.h"
+#include "../DWIN_LCD.h"
 #include "../rotary_encoder.h"
 #include "dwin_comm.h"
 #include "autotest.h"
-#include "DwinMenu_main.h"
+#include "DwinMenu_Main.h"
 #include "DwinMenu_Infor.h"
 #include "DwinMenu_Control.h"
 #include "DwinMenu_Prepare.h"
@@ -642,9 +642,10 @@ uint8_t get_title_picID();
 void Popup_Window_Temperature(const char *msg, int8_t heaterid);
 void Stop_and_return_mainmenu();
 void HMI_DWIN_Init();
-void DWIN_Update();
+void DWIN_Update(const bool handle_input=true);
 void EachMomentUpdate();
 void DWIN_HandleScreen();
+void DWIN_HandleInput();
 void DWIN_Show_M117(const char * const message);
 
 #endif
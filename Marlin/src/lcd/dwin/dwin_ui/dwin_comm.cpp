@@ -224,18 +224,86 @@ void Erase_Menu_Text(const uint8_t line){
 	dwinLCD.Draw_Rectangle(1, COLOR_BG_BLACK, LBLX, MBASE(line) - 14, 271, MBASE(line) + 28);
 }
 
-//updata Z position
-void DWIN_Show_Z_Position(bool bshowICON){	
-	static float last_z_pos = -9999.99;	
-	if(bshowICON) DWIN_Show_ICON(ICON_HOME_Z, State_icon_Zoffset_X, State_icon_Zoffset_Y);
-	if(TEST(axis_known_position, Z_AXIS)){
-		if(last_z_pos != current_position.z || bshowICON){
-			dwinLCD.Draw_SignedFloatValue(DWIN_FONT_STAT, COLOR_WHITE, COLOR_BG_BLACK, State_text_Zoffset_inum, State_text_Zoffset_fnum, State_text_Zoffset_X, State_text_Zoffset_Y, MAXUNITMULT*current_position.z);
-			last_z_pos = current_position.z;
+//////////////////////////////////////////////////////
+// The status area keeps what each field shows on the panel: the integer
+// value as drawn, with its color in the upper half. Update_Status_Area()
+// compares the live values against it and only sends the fields that
+// changed, so an idle screen costs nothing on the LCD serial.
+//
+#define STATUS_BLANK	0x80000000UL		// Erased or unknown. No drawn value produces it.
+
+static uint32_t status_shown[STATUS_FIELDS];
+static uint8_t status_dirty = 0;
+
+FORCE_INLINE static uint32_t Status_Value(const uint16_t color, const int16_t value) {
+	return (uint32_t(color) << 16) | uint16_t(value);
+}
+
+static void Set_Status_Field(const StatusField field, const uint32_t value) {
+	if (status_shown[field] != value) {
+		status_shown[field] = value;
+		SBI(status_dirty, field);
+	}
+}
+
+static void Draw_Status_Int(const StatusField field, const uint8_t num, const uint16_t x, const uint16_t y) {
+	const uint32_t value = status_shown[field];
+	DWIN_Draw_IntValue_FONT10(uint16_t(value >> 16), num, x, y, int16_t(value & 0xFFFF));
+}
+
+uint8_t Update_Status_Area() {
+#if HAS_HOTEND
+	const int16_t hotend = thermalManager.degHotend(0);
+	Set_Status_Field(STATUS_HOTEND, Status_Value(hotend > HOTEND_WARNNING_TEMP ? COLOR_RED : COLOR_WHITE, hotend));
+	// PID autotune shows its own target in red
+#if ENABLED(PID_AUTOTUNE_MENU)
+	const bool autotune = DWIN_status == ID_SM_PIDAUTOTUNING;
+	const int16_t target = autotune ? HMI_Value.PIDAutotune_Temp : thermalManager.degTargetHotend(0);
+#else
+	constexpr bool autotune = false;
+	const int16_t target = thermalManager.degTargetHotend(0);
+#endif
+	Set_Status_Field(STATUS_HOTEND_TARGET, Status_Value((autotune || target > HOTEND_WARNNING_TEMP) ? COLOR_RED : COLOR_WHITE, target));
+#endif
+#if HAS_HEATED_BED
+	Set_Status_Field(STATUS_BED, Status_Value(COLOR_WHITE, thermalManager.degBed()));
+	Set_Status_Field(STATUS_BED_TARGET, Status_Value(COLOR_WHITE, thermalManager.degTargetBed()));
+#endif
+	Set_Status_Field(STATUS_SPEED, Status_Value(COLOR_WHITE, feedrate_percentage));
+	Set_Status_Field(STATUS_Z, TEST(axis_known_position, Z_AXIS) ? uint32_t(long(MAXUNITMULT * current_position.z)) : STATUS_BLANK);
+
+	const uint8_t changed = status_dirty;
+	status_dirty = 0;
+
+#if HAS_HOTEND
+	if (TEST(changed, STATUS_HOTEND))
+		Draw_Status_Int(STATUS_HOTEND, State_text_extruder_num, State_text_extruder_X, State_text_extruder_Y);
+	if (TEST(changed, STATUS_HOTEND_TARGET)) {
+		// Blink a new target once while the runout popup reheats the hotend
+		static uint8_t flash_mask = 0;
+		if (DwinMenuID == DWMENU_POP_FROD_HEAT && ((++flash_mask & 0x01) == 0x01)) {
+			DWIN_Draw_UnMaskString_FONT10(State_text_extruder_X + (State_text_extruder_num + 1) * STAT_CHR_W, State_text_extruder_Y, PSTR("    "));
+			status_shown[STATUS_HOTEND_TARGET] = STATUS_BLANK;
 		}
+		else
+			Draw_Status_Int(STATUS_HOTEND_TARGET, State_text_extruder_num, State_text_extruder_X + (State_text_extruder_num + 1) * STAT_CHR_W, State_text_extruder_Y);
 	}
-	else
-		dwinLCD.Draw_String(false, true, DWIN_FONT_STAT, COLOR_WHITE, COLOR_BG_BLACK, State_text_Zoffset_X,State_text_Zoffset_Y, PSTR("---.-- "));
+#endif
+#if HAS_HEATED_BED
+	if (TEST(changed, STATUS_BED))
+		Draw_Status_Int(STATUS_BED, State_text_bed_num, State_text_bed_X, State_text_bed_Y);
+	if (TEST(changed, STATUS_BED_TARGET))
+		Draw_Status_Int(STATUS_BED_TARGET, State_text_bed_num, State_text_bed_X + (State_text_bed_num + 1) * STAT_CHR_W, State_text_bed_Y);
+#endif
+	if (TEST(changed, STATUS_SPEED))
+		Draw_Status_Int(STATUS_SPEED, State_text_speed_num, State_text_speed_X, State_text_speed_Y);
+	if (TEST(changed, STATUS_Z)) {
+		if (status_shown[STATUS_Z] == STATUS_BLANK)
+			dwinLCD.Draw_String(false, true, DWIN_FONT_STAT, COLOR_WHITE, COLOR_BG_BLACK, State_text_Zoffset_X, State_text_Zoffset_Y, PSTR("---.-- "));
+		else
+			dwinLCD.Draw_SignedFloatValue(DWIN_FONT_STAT, COLOR_WHITE, COLOR_BG_BLACK, State_text_Zoffset_inum, State_text_Zoffset_fnum, State_text_Zoffset_X, State_text_Zoffset_Y, long(status_shown[STATUS_Z]));
+	}
+	return changed;
 }
 
 //////////////////////////////////////////////////////
@@ -250,9 +318,7 @@ void Draw_Status_Area() {
 	//
 #if HAS_HOTEND
 	DWIN_Show_ICON(ICON_HOTENDTEMP, State_icon_extruder_X, State_icon_extruder_Y);
-	DWIN_Draw_IntValue_FONT10((thermalManager.degHotend(0) > HOTEND_WARNNING_TEMP ? COLOR_RED : COLOR_WHITE), State_text_extruder_num, State_text_extruder_X, State_text_extruder_Y, thermalManager.degHotend(0));
 	DWIN_Draw_UnMaskString_FONT10(State_string_extruder_X, State_string_extruder_Y, PSTR("/"));
-	DWIN_Draw_IntValue_FONT10((thermalManager.degTargetHotend(0) > HOTEND_WARNNING_TEMP ? COLOR_RED : COLOR_WHITE), State_text_extruder_num, State_text_extruder_X + (State_text_extruder_num + 1) * STAT_CHR_W, State_text_extruder_Y, thermalManager.degTargetHotend(0));
 #endif
 #if HOTENDS > 1
 	// dwinLCD.ICON_Show(ICON_IMAGE_ID,ICON_HOTENDTEMP, 13, 381);
@@ -260,17 +326,17 @@ void Draw_Status_Area() {
 
 #if HAS_HEATED_BED
 	DWIN_Show_ICON(ICON_BEDTEMP, State_icon_bed_X, State_icon_bed_Y);
-	DWIN_Draw_IntValue_FONT10(COLOR_WHITE, State_text_bed_num, State_text_bed_X, State_text_bed_Y, thermalManager.degBed());
 	DWIN_Draw_UnMaskString_FONT10(State_string_bed_X, State_string_bed_Y, PSTR("/"));
-	DWIN_Draw_IntValue_FONT10(COLOR_WHITE, State_text_bed_num, State_text_bed_X + (State_text_extruder_num + 1) * STAT_CHR_W, State_text_bed_Y, thermalManager.degTargetBed());
 #endif
 
 	DWIN_Show_ICON(ICON_SPEED, State_icon_speed_X, State_icon_speed_Y);
-	DWIN_Draw_IntValue_FONT10(COLOR_WHITE, 3, State_text_speed_X, State_text_speed_Y, feedrate_percentage);
 	DWIN_Draw_UnMaskString_FONT10(State_string_speed_X, State_string_speed_Y, PSTR("%"));
 
-	//	
-	DWIN_Show_Z_Position(true);
+	DWIN_Show_ICON(ICON_HOME_Z, State_icon_Zoffset_X, State_icon_Zoffset_Y);
+
+	// The area was cleared, so every value needs drawing
+	status_dirty = _BV(STATUS_FIELDS) - 1;
+	Update_Status_Area();
 }
 
 void HMI_AudioFeedback(const bool success/*=true*/){
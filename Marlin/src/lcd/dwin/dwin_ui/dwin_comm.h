@@ -24,7 +24,7 @@
 
 #ifdef HAS_DWIN_LCD
 #include "../rotary_encoder.h"
-#include "../dwin_lcd.h"
+#include "../DWIN_LCD.h"
 #if ANY(HAS_HOTEND, HAS_HEATED_BED, HAS_FAN) && PREHEAT_COUNT
   #define HAS_PREHEAT 1
   #if PREHEAT_COUNT < 2
@@ -207,7 +207,14 @@ void DWIN_Show_Status_Message(const uint16_t color, PGM_P string, const uint16_t
 void Draw_Popup_Bkgd_105();
 void Add_Menu_Line();
 void Erase_Menu_Text(const uint8_t line);
-void DWIN_Show_Z_Position(bool bshowICON);
+
+// Status area fields, each redrawn only when its value changes
+enum StatusField : uint8_t {
+	STATUS_HOTEND, STATUS_HOTEND_TARGET, STATUS_BED, STATUS_BED_TARGET, STATUS_SPEED, STATUS_Z,
+	STATUS_FIELDS
+};
+// Redraw the status area fields that changed. Returns a StatusField bitmask of them.
+uint8_t Update_Status_Area();
 void Draw_Status_Area();
 
 void HMI_AudioFeedback(const bool success=true);
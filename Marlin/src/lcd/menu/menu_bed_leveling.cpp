@@ -26,7 +26,7 @@
 
 #include "../../inc/MarlinConfigPre.h"
 
-#if ENABLED(LCD_BED_LEVELING)
+#if BOTH(HAS_LCD_MENU, LCD_BED_LEVELING)
 
 #include "menu_item.h"
 #include "../../module/planner.h"
@@ -23,4 +23,8 @@
 
 #include <stdint.h>
 
+// Update a CRC-16/XMODEM with the given data
 void crc16(uint16_t *crc, const void * const data, uint16_t cnt);
+
+// Return a Fletcher-16 checksum updated with the given data
+uint16_t fletcher16(uint16_t cs, const void * const data, uint16_t cnt);
@@ -13,10 +13,23 @@
   #define HEATSHRINK_MALLOC(SZ) malloc(SZ)
   #define HEATSHRINK_FREE(P, SZ) free(P)
 #else
-  // Required parameters for static configuration
-  #define HEATSHRINK_STATIC_INPUT_BUFFER_SIZE 32
-  #define HEATSHRINK_STATIC_WINDOW_BITS 8
-  #define HEATSHRINK_STATIC_LOOKAHEAD_BITS 4
+  // Required parameters for static configuration. The host is told the
+  // window and lookahead and compresses to suit.
+  #ifdef __AVR__
+    #define HEATSHRINK_STATIC_INPUT_BUFFER_SIZE 32
+  #else
+    #define HEATSHRINK_STATIC_INPUT_BUFFER_SIZE 128
+  #endif
+  #ifdef BINARY_STREAM_HEATSHRINK_WINDOW_BITS
+    #define HEATSHRINK_STATIC_WINDOW_BITS BINARY_STREAM_HEATSHRINK_WINDOW_BITS
+  #else
+    #define HEATSHRINK_STATIC_WINDOW_BITS 8
+  #endif
+  #ifdef BINARY_STREAM_HEATSHRINK_LOOKAHEAD_BITS
+    #define HEATSHRINK_STATIC_LOOKAHEAD_BITS BINARY_STREAM_HEATSHRINK_LOOKAHEAD_BITS
+  #else
+    #define HEATSHRINK_STATIC_LOOKAHEAD_BITS 4
+  #endif
 #endif
 
 // Turn on logging for debugging
@@ -766,23 +766,9 @@ block_t* Planner::get_current_block() {
 }
 
 /**
- * Calculate trapezoid parameters, multiplying the entry- and exit-speeds
- * by the provided factors.
- **
- * ############ VERY IMPORTANT ############
- * NOTE that the PRECONDITION to call this function is that the block is
- * NOT BUSY and it is marked as RECALCULATE. That WARRANTIES the Stepper ISR
- * is not and will not use the block while we modify it, so it is safe to
- * alter its values.
+ * Set the block's trapezoid for the given entry and exit rates with float math
  */
-void Planner::calculate_trapezoid_for_block(block_t* const block, const float &entry_factor, const float &exit_factor) {
-
-  uint32_t initial_rate = CEIL(block->nominal_rate * entry_factor),
-           final_rate = CEIL(block->nominal_rate * exit_factor); // (steps per second)
-
-  // Limit minimal step rate (Otherwise the timer will overflow.)
-  NOLESS(initial_rate, uint32_t(MINIMAL_STEP_RATE));
-  NOLESS(final_rate, uint32_t(MINIMAL_STEP_RATE));
+void Planner::trapezoid_float(block_t* const block, const uint32_t initial_rate, const uint32_t final_rate) {
 
   #if ENABLED(S_CURVE_ACCELERATION)
     uint32_t cruise_rate = initial_rate;
@@ -836,6 +822,111 @@ void Planner::calculate_trapezoid_for_block(block_t* const block, const float &e
     block->cruise_rate = cruise_rate;
   #endif
   block->final_rate = final_rate;
+}
+
+// Ceiling of n / d, in 32-bit math when n fits
+FORCE_INLINE static uint32_t div_ceil(const uint64_t n, const uint32_t d) {
+  if (n >> 32) return (n + d - 1) / d;
+  const uint32_t n32 = n;
+  return n32 / d + (n32 % d != 0);
+}
+
+// Floor of n / d, in 32-bit math when n fits
+FORCE_INLINE static uint32_t div_floor(const uint64_t n, const uint32_t d) {
+  return (n >> 32) ? uint32_t(n / d) : uint32_t(n) / d;
+}
+
+#if ENABLED(S_CURVE_ACCELERATION)
+  // Square root, rounded down
+  static uint32_t isqrt(uint64_t n) {
+    if (!n) return 0;
+    uint64_t root = 0, bit = uint64_t(1) << ((63 - __builtin_clzll(n)) & ~1); // Highest power of 4 <= n
+    for (; bit; bit >>= 2) {
+      if (n >= root + bit) { n -= root + bit; root = (root >> 1) + bit; }
+      else root >>= 1;
+    }
+    return root;
+  }
+#endif
+
+/**
+ * Set the block's trapezoid for the given entry and exit rates with integer
+ * math. Rates squared need 64 bits, but divisions are done in 32 bits when
+ * the dividend fits, as it does for most moves. The results agree with
+ * trapezoid_float() to within a step (or a timer tick).
+ */
+void Planner::trapezoid_integer(block_t* const block, const uint32_t initial_rate, const uint32_t final_rate) {
+  const uint32_t nominal_rate = block->nominal_rate,
+                 accel = block->acceleration_steps_per_s2,
+                 step_event_count = block->step_event_count;
+
+  #if ENABLED(S_CURVE_ACCELERATION)
+    uint32_t cruise_rate = nominal_rate;
+  #endif
+
+  // Steps required for acceleration, deceleration to/from nominal rate
+  uint32_t accelerate_steps = 0, decelerate_steps = 0;
+  if (accel) {
+    if (nominal_rate > initial_rate)
+      accelerate_steps = div_ceil(uint64_t(nominal_rate - initial_rate) * (nominal_rate + initial_rate), accel * 2);
+    if (nominal_rate > final_rate)
+      decelerate_steps = div_floor(uint64_t(nominal_rate - final_rate) * (nominal_rate + final_rate), accel * 2);
+  }
+
+  // Steps between acceleration and deceleration, if any
+  int32_t plateau_steps = step_event_count - accelerate_steps - decelerate_steps;
+
+  // No room to reach the nominal rate. Accelerate up to the point where
+  // braking at the same rate reaches the final rate at the end of the block.
+  if (plateau_steps < 0) {
+    const int64_t twice_distance = int64_t(accel) * 2 * step_event_count + int64_t(final_rate) * final_rate - int64_t(initial_rate) * initial_rate;
+    accelerate_steps = (accel && twice_distance > 0) ? _MIN(div_ceil(twice_distance, accel * 4), step_event_count) : 0;
+    plateau_steps = 0;
+
+    #if ENABLED(S_CURVE_ACCELERATION)
+      // We won't reach the cruising rate. Let's calculate the speed we will reach
+      cruise_rate = isqrt(uint64_t(initial_rate) * initial_rate + uint64_t(accel) * 2 * accelerate_steps);
+    #endif
+  }
+
+  #if ENABLED(S_CURVE_ACCELERATION)
+    // Jerk controlled speed requires to express speed versus time, NOT steps
+    uint32_t acceleration_time = accel ? div_floor(uint64_t(cruise_rate - initial_rate) * (STEPPER_TIMER_RATE), accel) : 0,
+             deceleration_time = accel ? div_floor(uint64_t(cruise_rate - final_rate) * (STEPPER_TIMER_RATE), accel) : 0;
+
+    block->acceleration_time = acceleration_time;
+    block->deceleration_time = deceleration_time;
+    block->acceleration_time_inverse = get_period_inverse(acceleration_time);
+    block->deceleration_time_inverse = get_period_inverse(deceleration_time);
+    block->cruise_rate = cruise_rate;
+  #endif
+
+  block->accelerate_until = accelerate_steps;
+  block->decelerate_after = accelerate_steps + plateau_steps;
+  block->initial_rate = initial_rate;
+  block->final_rate = final_rate;
+}
+
+/**
+ * Calculate trapezoid parameters, multiplying the entry- and exit-speeds
+ * by the provided factors.
+ **
+ * ############ VERY IMPORTANT ############
+ * NOTE that the PRECONDITION to call this function is that the block is
+ * NOT BUSY and it is marked as RECALCULATE. That WARRANTIES the Stepper ISR
+ * is not and will not use the block while we modify it, so it is safe to
+ * alter its values.
+ */
+void Planner::calculate_trapezoid_for_block(block_t* const block, const float &entry_factor, const float &exit_factor) {
+
+  uint32_t initial_rate = CEIL(block->nominal_rate * entry_factor),
+           final_rate = CEIL(block->nominal_rate * exit_factor); // (steps per second)
+
+  // Limit minimal step rate (Otherwise the timer will overflow.)
+  NOLESS(initial_rate, uint32_t(MINIMAL_STEP_RATE));
+  NOLESS(final_rate, uint32_t(MINIMAL_STEP_RATE));
+
+  TERN(TRAPEZOID_INTEGER_MATH, trapezoid_integer, trapezoid_float)(block, initial_rate, final_rate);
 
   /**
    * Laser trapezoid calculations
@@ -854,7 +945,7 @@ void Planner::calculate_trapezoid_for_block(block_t* const block, const float &e
         // Speedup power
         const uint8_t entry_power_diff = block->laser.power - entry_power;
         if (entry_power_diff) {
-          block->laser.entry_per = accelerate_steps / entry_power_diff;
+          block->laser.entry_per = block->accelerate_until / entry_power_diff;
           block->laser.power_entry = entry_power;
         }
         else {
@@ -1127,13 +1218,19 @@ void Planner::forward_pass() {
 }
 
 /**
- * Recalculate the trapezoid speed profiles for all blocks in the plan
+ * Recalculate the trapezoid speed profiles for the blocks in the plan
  * according to the entry_factor for each junction. Must be called by
  * recalculate() after updating the blocks.
+ *
+ * Only blocks from first_block_index onward are visited. Passing the planned
+ * pointer as it was before the reverse and forward passes limits the work to
+ * the blocks whose entry or exit speed may have changed, so the cost of adding
+ * a block no longer grows with BLOCK_BUFFER_SIZE.
  */
-void Planner::recalculate_trapezoids() {
-  // The tail may be changed by the ISR so get a local copy.
-  uint8_t block_index = block_buffer_tail,
+void Planner::recalculate_trapezoids(const uint8_t first_block_index) {
+  // The ISR may have consumed blocks since the caller read the index. As
+  // with a stale tail, that only revisits blocks that are no longer used.
+  uint8_t block_index = first_block_index,
           head_block_index = block_buffer_head;
   // Since there could be a sync block in the head of the queue, and the
   // next loop must not recalculate the head block (as it needs to be
@@ -1238,14 +1335,17 @@ void Planner::recalculate_trapezoids() {
 }
 
 void Planner::recalculate() {
+  // Blocks before the planned pointer are optimal and can't be changed by a
+  // new block. Read it once, before the passes below move it forward.
+  const uint8_t planned_block_index = block_buffer_planned;
   // Initialize block index to the last block in the planner buffer.
   const uint8_t block_index = prev_block_index(block_buffer_head);
   // If there is just one block, no planning can be done. Avoid it!
-  if (block_index != block_buffer_planned) {
+  if (block_index != planned_block_index) {
     reverse_pass();
     forward_pass();
   }
-  recalculate_trapezoids();
+  recalculate_trapezoids(planned_block_index);
 }
 
 #if ENABLED(AUTOTEMP)
@@ -1663,6 +1763,7 @@ float Planner::get_axis_position_mm(const AxisEnum axis) {
  */
 void Planner::synchronize() {
   while (has_blocks_queued() || cleaning_buffer_counter
+      || TERN0(INPUT_SHAPING, stepper.shaping_busy())
       || TERN0(EXTERNAL_CLOSED_LOOP_CONTROLLER, CLOSED_LOOP_WAITING())
   ) idle();
 }
@@ -1732,6 +1833,72 @@ bool Planner::_buffer_steps(const xyze_long_t &target
   return true;
 }
 
+/**
+ * The angle in radians between two unit vectors, given the chord between
+ * them squared (2 - 2 cos(theta), so 0 to 4). Good for angles up to 45°.
+ *
+ * theta = 2 asin(chord / 2), with asin(x) / x as a polynomial in x^2 fitted by
+ * buildroot/share/scripts/createJunctionAnglePolynomial.py for a relative
+ * error under 6e-6.
+ */
+float Planner::junction_theta(const float &chord_sq) {
+  const float chord = SQRT(chord_sq);
+  #if ENABLED(JD_USE_MATH_ACOS)
+    return 2.0f * asinf(0.5f * chord);
+  #else
+    static constexpr float jd_theta_poly[] = { 1.00000536f, 0.166028097f, 0.086124368f };
+    const float s = 0.25f * chord_sq;
+    return chord * (jd_theta_poly[0] + s * (jd_theta_poly[1] + s * jd_theta_poly[2]));
+  #endif
+}
+
+/**
+ * The maximum speed squared through the junction between two unit vectors
+ * for the given acceleration and junction deviation. Each axis is visited
+ * once, for the difference and sum of the vectors. Their lengths give the
+ * junction angle without the cancellation of 1 - cos(theta) for nearly
+ * straight or reversing paths, and the difference gives the direction of
+ * the change, which limits the acceleration.
+ */
+float Planner::junction_speed_sqr(const xyze_float_t &prev_unit_vec, const xyze_float_t &unit_vec, const float &accel, const float &millimeters, const float &deviation_mm) {
+  xyze_float_t junction_unit_vec;
+  float chord_sq = 0, sum_sq = 0;
+  LOOP_XYZE(i) {
+    junction_unit_vec[i] = unit_vec[i] - prev_unit_vec[i];
+    chord_sq += sq(junction_unit_vec[i]);
+    sum_sq += sq(unit_vec[i] + prev_unit_vec[i]);
+  }
+
+  // For a 0 degree acute junction, just set minimum junction speed.
+  if (sum_sq < 0.000002f) return sq(float(MINIMUM_PLANNER_SPEED));
+
+  // Convert delta vector to unit vector
+  junction_unit_vec *= RSQRT(chord_sq);
+
+  // Nearly a straight line. Limit the angle to avoid dividing by zero.
+  NOLESS(chord_sq, 0.000002f);
+
+  // For the angle theta between -prev_unit_vec and unit_vec, sin(theta / 2) is half
+  // the length of their sum and cos(theta / 2) half the length of their difference.
+  // So 1 - sin(theta / 2) = (chord^2 / 4) / (1 + sin(theta / 2)).
+  const float junction_acceleration = limit_value_by_axis_maximum(accel, junction_unit_vec),
+              sin_theta_d2 = 0.5f * SQRT(sum_sq);
+
+  float vmax_junction_sqr = junction_acceleration * deviation_mm * sin_theta_d2 * (1.0f + sin_theta_d2) * 4.0f / chord_sq;
+
+  #if ENABLED(JD_HANDLE_SMALL_SEGMENTS)
+    // For small moves with >135° junction (octagon) find speed for approximate arc
+    if (millimeters < 1 && chord_sq < 0.5857864f) { // 2 - 2 cos(45°)
+      const float limit_sqr = (millimeters * junction_acceleration) / junction_theta(chord_sq);
+      NOMORE(vmax_junction_sqr, limit_sqr);
+    }
+  #else
+    UNUSED(millimeters);
+  #endif
+
+  return vmax_junction_sqr;
+}
+
 /**
  * Planner::_populate_block
  *
@@ -2170,6 +2337,12 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
     }
   #endif
 
+  // Keep the XY steps within the input shaping queues, so every step gets its echoes
+  #if ENABLED(INPUT_SHAPING)
+    if (stepper.shaper.enabled)
+      NOMORE(speed_factor, stepper.shaper.speed_limit(block->steps.a, block->steps.b, block->step_event_count, inverse_secs));
+  #endif
+
   #ifdef XY_FREQUENCY_LIMIT
 
     static uint8_t old_direction_bits; // = 0
@@ -2368,116 +2541,7 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
 
     // Skip first block or when previous_nominal_speed is used as a flag for homing and offset cycles.
     if (moves_queued && !UNEAR_ZERO(previous_nominal_speed_sqr)) {
-      // Compute cosine of angle between previous and current path. (prev_unit_vec is negative)
-      // NOTE: Max junction velocity is computed without sin() or acos() by trig half angle identity.
-      float junction_cos_theta = (-prev_unit_vec.x * unit_vec.x) + (-prev_unit_vec.y * unit_vec.y)
-                               + (-prev_unit_vec.z * unit_vec.z) + (-prev_unit_vec.e * unit_vec.e);
-
-      // NOTE: Computed without any expensive trig, sin() or acos(), by trig half angle identity of cos(theta).
-      if (junction_cos_theta > 0.999999f) {
-        // For a 0 degree acute junction, just set minimum junction speed.
-        vmax_junction_sqr = sq(float(MINIMUM_PLANNER_SPEED));
-      }
-      else {
-        NOLESS(junction_cos_theta, -0.999999f); // Check for numerical round-off to avoid divide by zero.
-
-        // Convert delta vector to unit vector
-        xyze_float_t junction_unit_vec = unit_vec - prev_unit_vec;
-        normalize_junction_vector(junction_unit_vec);
-
-        const float junction_acceleration = limit_value_by_axis_maximum(block->acceleration, junction_unit_vec),
-                    sin_theta_d2 = SQRT(0.5f * (1.0f - junction_cos_theta)); // Trig half angle identity. Always positive.
-
-        vmax_junction_sqr = junction_acceleration * junction_deviation_mm * sin_theta_d2 / (1.0f - sin_theta_d2);
-
-        #if ENABLED(JD_HANDLE_SMALL_SEGMENTS)
-
-          // For small moves with >135° junction (octagon) find speed for approximate arc
-          if (block->millimeters < 1 && junction_cos_theta < -0.7071067812f) {
-
-            #if ENABLED(JD_USE_MATH_ACOS)
-
-              #error "TODO: Inline maths with the MCU / FPU."
-
-            #elif ENABLED(JD_USE_LOOKUP_TABLE)
-
-              // Fast acos approximation (max. error +-0.01 rads)
-              // Based on LUT table and linear interpolation
-
-              /**
-               *  // Generate the JD Lookup Table
-               *  constexpr float c = 1.00751495f; // Correction factor to center error around 0
-               *  for (int i = 0; i < jd_lut_count - 1; ++i) {
-               *    const float x0 = (sq(i) - 1) / sq(i),
-               *                y0 = acos(x0) * (i == 0 ? 1 : c),
-               *                x1 = i < jd_lut_count - 1 ?  0.5 * x0 + 0.5 : 0.999999f,
-               *                y1 = acos(x1) * (i < jd_lut_count - 1 ? c : 1);
-               *    jd_lut_k[i] = (y0 - y1) / (x0 - x1);
-               *    jd_lut_b[i] = (y1 * x0 - y0 * x1) / (x0 - x1);
-               *  }
-               *
-               *  // Compute correction factor (Set c to 1.0f first!)
-               *  float min = INFINITY, max = -min;
-               *  for (float t = 0; t <= 1; t += 0.0003f) {
-               *    const float e = acos(t) / approx(t);
-               *    if (isfinite(e)) {
-               *      if (e < min) min = e;
-               *      if (e > max) max = e;
-               *    }
-               *  }
-               *  fprintf(stderr, "%.9gf, ", (min + max) / 2);
-               */
-              static constexpr int16_t  jd_lut_count = 16;
-              static constexpr uint16_t jd_lut_tll   = _BV(jd_lut_count - 1);
-              static constexpr int16_t  jd_lut_tll0  = __builtin_clz(jd_lut_tll) + 1; // i.e., 16 - jd_lut_count + 1
-              static constexpr float jd_lut_k[jd_lut_count] PROGMEM = {
-                -1.03145837f, -1.30760646f, -1.75205851f, -2.41705704f,
-                -3.37769222f, -4.74888992f, -6.69649887f, -9.45661736f,
-                -13.3640480f, -18.8928222f, -26.7136841f, -37.7754593f,
-                -53.4201813f, -75.5458374f, -106.836761f, -218.532821f };
-              static constexpr float jd_lut_b[jd_lut_count] PROGMEM = {
-                 1.57079637f,  1.70887053f,  2.04220939f,  2.62408352f,
-                 3.52467871f,  4.85302639f,  6.77020454f,  9.50875854f,
-                 13.4009285f,  18.9188995f,  26.7321243f,  37.7885055f,
-                 53.4293975f,  75.5523529f,  106.841369f,  218.534011f };
-
-              const float neg = junction_cos_theta < 0 ? -1 : 1,
-                          t = neg * junction_cos_theta;
-
-              const int16_t idx = (t < 0.00000003f) ? 0 : __builtin_clz(uint16_t((1.0f - t) * jd_lut_tll)) - jd_lut_tll0;
-
-              float junction_theta = t * pgm_read_float(&jd_lut_k[idx]) + pgm_read_float(&jd_lut_b[idx]);
-              if (neg > 0) junction_theta = RADIANS(180) - junction_theta; // acos(-t)
-
-            #else
-
-              // Fast acos(-t) approximation (max. error +-0.033rad = 1.89°)
-              // Based on MinMax polynomial published by W. Randolph Franklin, see
-              // https://wrf.ecse.rpi.edu/Research/Short_Notes/arcsin/onlyelem.html
-              //  acos( t) = pi / 2 - asin(x)
-              //  acos(-t) = pi - acos(t) ... pi / 2 + asin(x)
-
-              const float neg = junction_cos_theta < 0 ? -1 : 1,
-                          t = neg * junction_cos_theta,
-                          asinx =       0.032843707f
-                                + t * (-1.451838349f
-                                + t * ( 29.66153956f
-                                + t * (-131.1123477f
-                                + t * ( 262.8130562f
-                                + t * (-242.7199627f
-                                + t * ( 84.31466202f ) ))))),
-                          junction_theta = RADIANS(90) + neg * asinx; // acos(-t)
-
-              // NOTE: junction_theta bottoms out at 0.033 which avoids divide by 0.
-
-            #endif
-
-            const float limit_sqr = (block->millimeters * junction_acceleration) / junction_theta;
-            NOMORE(vmax_junction_sqr, limit_sqr);
-          }
-
-        #endif // JD_HANDLE_SMALL_SEGMENTS
-      }
+      vmax_junction_sqr = junction_speed_sqr(prev_unit_vec, unit_vec, block->acceleration, block->millimeters, junction_deviation_mm);
 
       // Get the lowest speed
       vmax_junction_sqr = _MIN(vmax_junction_sqr, block->nominal_speed_sqr, previous_nominal_speed_sqr);
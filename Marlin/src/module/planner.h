@@ -36,11 +36,6 @@
   // Enable this option for perfect accuracy but maximum
   // computation. Should be fine on ARM processors.
   //#define JD_USE_MATH_ACOS
-
-  // Disable this option to save 120 bytes of PROGMEM,
-  // but incur increased computation and a reduction
-  // in accuracy.
-  #define JD_USE_LOOKUP_TABLE
 #endif
 
 #include "motion.h"
@@ -146,23 +141,20 @@ enum BlockFlag : char {
  *
  * The "nominal" values are as-specified by gcode, and
  * may never actually be reached due to acceleration limits.
+ *
+ * The fields read by the Stepper ISR come first and the planner's own
+ * fields follow. Byte and half-word fields are grouped ahead of the
+ * words so that optional fields cost little or nothing in padding.
  */
 typedef struct block_t {
 
-  volatile uint8_t flag;                    // Block flags (See BlockFlag enum above) - Modified by ISR and main thread!
+  //
+  // Read by the Stepper ISR
+  //
 
-  // Fields used by the motion planner to manage acceleration
-  float nominal_speed_sqr,                  // The nominal speed for this block in (mm/sec)^2
-        entry_speed_sqr,                    // Entry speed at previous-current junction in (mm/sec)^2
-        max_entry_speed_sqr,                // Maximum allowable junction entry speed in (mm/sec)^2
-        millimeters,                        // The total travel of this block in mm
-        acceleration;                       // acceleration mm/sec^2
+  volatile uint8_t flag;                    // Block flags (See BlockFlag enum above) - Modified by ISR and main thread!
 
-  union {
-    abce_ulong_t steps;                     // Step count along each axis
-    abce_long_t position;                   // New position to force when this sync block is executed
-  };
-  uint32_t step_event_count;                // The number of step events required to complete this block
+  uint8_t direction_bits;                   // The direction bit set for this block (refers to *_DIRECTION_BIT in config.h)
 
   #if HAS_MULTI_EXTRUDER
     uint8_t extruder;                       // The extruder to move (if E move)
@@ -170,7 +162,36 @@ typedef struct block_t {
     static constexpr uint8_t extruder = 0;
   #endif
 
-  TERN_(MIXING_EXTRUDER, mixer_comp_t b_color[MIXING_STEPPERS]); // Normalized color for the mixing steppers
+  #if HAS_FAN
+    uint8_t fan_speed[FAN_COUNT];
+  #endif
+
+  #if ENABLED(BARICUDA)
+    uint8_t valve_pressure, e_to_p_pressure;
+  #endif
+
+  #if ENABLED(LIN_ADVANCE)
+    bool use_advance_lead;
+    uint16_t advance_speed,                 // STEP timer value for extruder speed offset ISR
+             max_adv_steps,                 // max. advance steps to get cruising speed pressure (not always nominal_speed!)
+             final_adv_steps;               // advance steps due to exit speed
+  #endif
+
+  #if HAS_CUTTER
+    cutter_power_t cutter_power;            // Power level for Spindle, Laser, etc.
+  #endif
+
+  TERN_(MIXING_EXTRUDER, mixer_block_comp_t b_color[MIXING_STEPPERS]); // Normalized color for the mixing steppers
+
+  #if ENABLED(DIRECT_STEPPING)
+    page_idx_t page_idx;                    // Page index used for direct stepping
+  #endif
+
+  union {
+    abce_ulong_t steps;                     // Step count along each axis
+    abce_long_t position;                   // New position to force when this sync block is executed
+  };
+  uint32_t step_event_count;                // The number of step events required to complete this block
 
   // Settings for the trapezoid generator
   uint32_t accelerate_until,                // The index of the step event on which to stop acceleration
@@ -186,48 +207,36 @@ typedef struct block_t {
     uint32_t acceleration_rate;             // The acceleration rate used for acceleration calculation
   #endif
 
-  uint8_t direction_bits;                   // The direction bit set for this block (refers to *_DIRECTION_BIT in config.h)
-
-  // Advance extrusion
-  #if ENABLED(LIN_ADVANCE)
-    bool use_advance_lead;
-    uint16_t advance_speed,                 // STEP timer value for extruder speed offset ISR
-             max_adv_steps,                 // max. advance steps to get cruising speed pressure (not always nominal_speed!)
-             final_adv_steps;               // advance steps due to exit speed
-    float e_D_ratio;
-  #endif
-
   uint32_t nominal_rate,                    // The nominal step rate for this block in step_events/sec
            initial_rate,                    // The jerk-adjusted step rate at start of block
-           final_rate,                      // The minimal rate at exit
-           acceleration_steps_per_s2;       // acceleration steps/sec^2
+           final_rate;                      // The minimal rate at exit
 
-  #if ENABLED(DIRECT_STEPPING)
-    page_idx_t page_idx;                    // Page index used for direct stepping
+  #if ENABLED(POWER_LOSS_RECOVERY)
+    uint32_t sdpos;
   #endif
 
-  #if HAS_CUTTER
-    cutter_power_t cutter_power;            // Power level for Spindle, Laser, etc.
+  #if ENABLED(LASER_POWER_INLINE)
+    block_laser_t laser;
   #endif
 
-  #if HAS_FAN
-    uint8_t fan_speed[FAN_COUNT];
-  #endif
+  //
+  // Planner only
+  //
 
-  #if ENABLED(BARICUDA)
-    uint8_t valve_pressure, e_to_p_pressure;
-  #endif
+  float nominal_speed_sqr,                  // The nominal speed for this block in (mm/sec)^2
+        entry_speed_sqr,                    // Entry speed at previous-current junction in (mm/sec)^2
+        max_entry_speed_sqr,                // Maximum allowable junction entry speed in (mm/sec)^2
+        millimeters,                        // The total travel of this block in mm
+        acceleration;                       // acceleration mm/sec^2
 
-  #if HAS_WIRED_LCD
-    uint32_t segment_time_us;
-  #endif
+  uint32_t acceleration_steps_per_s2;       // acceleration steps/sec^2
 
-  #if ENABLED(POWER_LOSS_RECOVERY)
-    uint32_t sdpos;
+  #if ENABLED(LIN_ADVANCE)
+    float e_D_ratio;
   #endif
 
-  #if ENABLED(LASER_POWER_INLINE)
-    block_laser_t laser;
+  #if HAS_WIRED_LCD
+    uint32_t segment_time_us;
   #endif
 
 } block_t;
@@ -892,6 +901,21 @@ class Planner {
       }
     #endif
 
+    /**
+     * Fill in the block's acceleration and deceleration steps for the given
+     * entry and exit rates. TRAPEZOID_INTEGER_MATH selects which is used by
+     * the planner; both are built so the host simulator can compare them.
+     */
+    static void trapezoid_float(block_t* const block, const uint32_t initial_rate, const uint32_t final_rate);
+    static void trapezoid_integer(block_t* const block, const uint32_t initial_rate, const uint32_t final_rate);
+
+    /**
+     * Junction deviation speed limit and the small segment junction angle.
+     * Built with CLASSIC_JERK too, so the host simulator can check them.
+     */
+    static float junction_theta(const float &chord_sq);
+    static float junction_speed_sqr(const xyze_float_t &prev_unit_vec, const xyze_float_t &unit_vec, const float &accel, const float &millimeters, const float &deviation_mm);
+
   private:
 
     /**
@@ -948,30 +972,31 @@ class Planner {
     static void reverse_pass();
     static void forward_pass();
 
-    static void recalculate_trapezoids();
+    static void recalculate_trapezoids(const uint8_t first_block_index);
 
     static void recalculate();
 
     #if HAS_JUNCTION_DEVIATION
-
       FORCE_INLINE static void normalize_junction_vector(xyze_float_t &vector) {
         float magnitude_sq = 0;
         LOOP_XYZE(idx) if (vector[idx]) magnitude_sq += sq(vector[idx]);
         vector *= RSQRT(magnitude_sq);
       }
+    #endif
 
-      FORCE_INLINE static float limit_value_by_axis_maximum(const float &max_value, xyze_float_t &unit_vec) {
-        float limit_value = max_value;
-        LOOP_XYZE(idx) {
-          if (unit_vec[idx]) {
-            if (limit_value * ABS(unit_vec[idx]) > settings.max_acceleration_mm_per_s2[idx])
-              limit_value = ABS(settings.max_acceleration_mm_per_s2[idx] / unit_vec[idx]);
-          }
+    // Keep the limit as a fraction, comparing by cross-multiplication,
+    // so there's one division however many axes it passes through
+    FORCE_INLINE static float limit_value_by_axis_maximum(const float &max_value, const xyze_float_t &unit_vec) {
+      float limit_value = max_value, component = 1;
+      LOOP_XYZE(idx) {
+        const float c = ABS(unit_vec[idx]);
+        if (limit_value * c > settings.max_acceleration_mm_per_s2[idx] * component) {
+          limit_value = settings.max_acceleration_mm_per_s2[idx];
+          component = c;
         }
-        return limit_value;
       }
-
-    #endif // !CLASSIC_JERK
+      return limit_value / component;
+    }
 };
 
 #define PLANNER_XY_FEEDRATE() (_MIN(planner.settings.max_feedrate_mm_s[X_AXIS], planner.settings.max_feedrate_mm_s[Y_AXIS]))
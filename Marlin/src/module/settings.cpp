@@ -121,6 +121,15 @@
   void M217_report(const bool eeprom);
 #endif
 
+#if ENABLED(MPCTEMP)
+  void M306_report(const uint8_t e);
+#endif
+
+#include "../feature/input_shaping.h"
+#if ENABLED(INPUT_SHAPING)
+  void M593_report(const AxisEnum axis);
+#endif
+
 #if ENABLED(BLTOUCH)
   #include "../feature/bltouch.h"
 #endif
@@ -349,6 +358,11 @@ typedef struct SettingsDataStruct {
   //
   PID_t bedPID;                                         // M304 PID / M303 E-1 U
 
+  //
+  // MPCTEMP
+  //
+  MPC_t hotendMPC[HOTENDS];                             // M306 En P C R A F H / M306 En T
+
   //
   // User-defined Thermistors
   //
@@ -441,6 +455,11 @@ typedef struct SettingsDataStruct {
   uint8_t backlash_correction;                          // M425 F
   float backlash_smoothing_mm;                          // M425 S
 
+  //
+  // INPUT_SHAPING
+  //
+  shaping_params_t shaping_params[XY];                  // M593 X Y F D T
+
   //
   // EXTENSIBLE_UI
   //
@@ -475,6 +494,11 @@ typedef struct SettingsDataStruct {
 
 //static_assert(sizeof(SettingsData) <= MARLIN_EEPROM_SIZE, "EEPROM too small to contain SettingsData!");
 
+#if ENABLED(FLASH_EEPROM_JOURNAL)
+  #include "../HAL/shared/eeprom_journal.h"
+  static_assert(EEPROM_OFFSET + sizeof(SettingsData) <= EEPROM_JOURNAL_CAPACITY, "The flash EEPROM journal is too small to contain SettingsData!");
+#endif
+
 MarlinSettings settings;
 
 uint16_t MarlinSettings::datasize() { return sizeof(SettingsData); }
@@ -1002,6 +1026,21 @@ void MarlinSettings::postprocess() {
       EEPROM_WRITE(bed_pid);
     }
 
+    //
+    // MPCTEMP
+    //
+    {
+      _FIELD_TEST(hotendMPC);
+      HOTEND_LOOP() {
+        #if ENABLED(MPCTEMP)
+          const MPC_t &mpc = thermalManager.temp_hotend[e].constants;
+        #else
+          const MPC_t mpc = { NAN, NAN, NAN, NAN, NAN, NAN };
+        #endif
+        EEPROM_WRITE(mpc);
+      }
+    }
+
     //
     // User-defined Thermistors
     //
@@ -1452,6 +1491,19 @@ void MarlinSettings::postprocess() {
       EEPROM_WRITE(backlash_smoothing_mm);
     }
 
+    //
+    // Input Shaping
+    //
+    {
+      shaping_params_t shaping_params[XY] = { { 0, 0, SHAPER_ZVD }, { 0, 0, SHAPER_ZVD } };
+      #if ENABLED(INPUT_SHAPING)
+        shaping_params[X_AXIS] = stepper.shaper.x.params;
+        shaping_params[Y_AXIS] = stepper.shaper.y.params;
+      #endif
+      _FIELD_TEST(shaping_params);
+      EEPROM_WRITE(shaping_params);
+    }
+
     //
     // Extensible UI User Data
     //
@@ -1949,6 +2001,20 @@ void MarlinSettings::postprocess() {
         #endif
       }
 
+      //
+      // Hotend MPC
+      //
+      {
+        _FIELD_TEST(hotendMPC);
+        HOTEND_LOOP() {
+          MPC_t mpc;
+          EEPROM_READ(mpc);
+          #if ENABLED(MPCTEMP)
+            if (!validating && !isnan(mpc.heater_power)) thermalManager.temp_hotend[e].constants = mpc;
+          #endif
+        }
+      }
+
       //
       // User-defined Thermistors
       //
@@ -2374,6 +2440,21 @@ void MarlinSettings::postprocess() {
         EEPROM_READ(backlash_smoothing_mm);
       }
 
+      //
+      // Input Shaping
+      //
+      {
+        shaping_params_t shaping_params[XY];
+        _FIELD_TEST(shaping_params);
+        EEPROM_READ(shaping_params);
+        if (!validating) {
+          #if ENABLED(INPUT_SHAPING)
+            stepper.set_shaping(X_AXIS, shaping_params[X_AXIS]);
+            stepper.set_shaping(Y_AXIS, shaping_params[Y_AXIS]);
+          #endif
+        }
+      }
+
       //
       // Extensible UI User Data
       //
@@ -2723,6 +2804,11 @@ void MarlinSettings::reset() {
     #endif
   #endif
 
+  #if ENABLED(INPUT_SHAPING)
+    stepper.set_shaping(X_AXIS, { SHAPING_FREQ_X, SHAPING_ZETA_X, SHAPING_TYPE });
+    stepper.set_shaping(Y_AXIS, { SHAPING_FREQ_Y, SHAPING_ZETA_Y, SHAPING_TYPE });
+  #endif
+
   TERN_(EXTENSIBLE_UI, ExtUI::onFactoryReset());
 
   //
@@ -2946,6 +3032,34 @@ void MarlinSettings::reset() {
     thermalManager.temp_bed.pid.Kd = scalePID_d(DEFAULT_bedKd);
   #endif
 
+  //
+  // Hotend MPC
+  //
+
+  #if ENABLED(MPCTEMP)
+    constexpr float mpc_heater_power[] = MPC_HEATER_POWER,
+                    mpc_block_heat_capacity[] = MPC_BLOCK_HEAT_CAPACITY,
+                    mpc_sensor_responsiveness[] = MPC_SENSOR_RESPONSIVENESS,
+                    mpc_ambient_xfer_coeff[] = MPC_AMBIENT_XFER_COEFF,
+                    mpc_ambient_xfer_coeff_fan255[] = MPC_AMBIENT_XFER_COEFF_FAN255,
+                    filament_heat_capacity_permm[] = FILAMENT_HEAT_CAPACITY_PERMM;
+    static_assert(WITHIN(COUNT(mpc_heater_power), 1, HOTENDS), "MPC_HEATER_POWER must have between 1 and HOTENDS items.");
+    static_assert(WITHIN(COUNT(mpc_block_heat_capacity), 1, HOTENDS), "MPC_BLOCK_HEAT_CAPACITY must have between 1 and HOTENDS items.");
+    static_assert(WITHIN(COUNT(mpc_sensor_responsiveness), 1, HOTENDS), "MPC_SENSOR_RESPONSIVENESS must have between 1 and HOTENDS items.");
+    static_assert(WITHIN(COUNT(mpc_ambient_xfer_coeff), 1, HOTENDS), "MPC_AMBIENT_XFER_COEFF must have between 1 and HOTENDS items.");
+    static_assert(WITHIN(COUNT(mpc_ambient_xfer_coeff_fan255), 1, HOTENDS), "MPC_AMBIENT_XFER_COEFF_FAN255 must have between 1 and HOTENDS items.");
+    static_assert(WITHIN(COUNT(filament_heat_capacity_permm), 1, HOTENDS), "FILAMENT_HEAT_CAPACITY_PERMM must have between 1 and HOTENDS items.");
+    HOTEND_LOOP() {
+      MPC_t &mpc = thermalManager.temp_hotend[e].constants;
+      mpc.heater_power = mpc_heater_power[ALIM(e, mpc_heater_power)];
+      mpc.block_heat_capacity = mpc_block_heat_capacity[ALIM(e, mpc_block_heat_capacity)];
+      mpc.sensor_responsiveness = mpc_sensor_responsiveness[ALIM(e, mpc_sensor_responsiveness)];
+      mpc.ambient_xfer_coeff_fan0 = mpc_ambient_xfer_coeff[ALIM(e, mpc_ambient_xfer_coeff)];
+      mpc.fan255_adjustment = mpc_ambient_xfer_coeff_fan255[ALIM(e, mpc_ambient_xfer_coeff_fan255)] - mpc.ambient_xfer_coeff_fan0;
+      mpc.filament_heat_capacity_permm = filament_heat_capacity_permm[ALIM(e, filament_heat_capacity_permm)];
+    }
+  #endif
+
   //
   // User-Defined Thermistors
   //
@@ -3529,6 +3643,14 @@ void MarlinSettings::reset() {
 
     #endif // PIDTEMP || PIDTEMPBED
 
+    #if ENABLED(MPCTEMP)
+      CONFIG_ECHO_HEADING("Model predictive control:");
+      HOTEND_LOOP() {
+        CONFIG_ECHO_START();
+        M306_report(e);
+      }
+    #endif
+
     #if HAS_USER_THERMISTORS
       CONFIG_ECHO_HEADING("User thermistors:");
       LOOP_L_N(i, USER_THERMISTORS)
@@ -3980,6 +4102,14 @@ void MarlinSettings::reset() {
       );
     #endif
 
+    #if ENABLED(INPUT_SHAPING)
+      CONFIG_ECHO_HEADING("Input Shaping:");
+      CONFIG_ECHO_START();
+      M593_report(X_AXIS);
+      CONFIG_ECHO_START();
+      M593_report(Y_AXIS);
+    #endif
+
     #if HAS_FILAMENT_SENSOR
       CONFIG_ECHO_HEADING("Filament runout sensor:");
       CONFIG_ECHO_START();
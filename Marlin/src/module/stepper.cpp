@@ -128,6 +128,10 @@ Stepper stepper; // Singleton
   #include "../feature/powerloss.h"
 #endif
 
+#if ENABLED(ISR_PROFILING)
+  #include "../feature/isr_profiler.h"
+#endif
+
 #if HAS_CUTTER
   #include "../feature/spindle_laser.h"
 #endif
@@ -180,6 +184,19 @@ bool Stepper::abort_current_block;
 uint32_t Stepper::acceleration_time, Stepper::deceleration_time;
 uint8_t Stepper::steps_per_isr;
 
+#if ENABLED(MEASURED_STEP_ISR_LIMITS)
+  uint32_t Stepper::isr_rate_limit[8] = {   // The estimates, until there are measurements
+    (  MAX_STEP_ISR_FREQUENCY_1X     ),
+    (  MAX_STEP_ISR_FREQUENCY_2X >> 1),
+    (  MAX_STEP_ISR_FREQUENCY_4X >> 2),
+    (  MAX_STEP_ISR_FREQUENCY_8X >> 3),
+    ( MAX_STEP_ISR_FREQUENCY_16X >> 4),
+    ( MAX_STEP_ISR_FREQUENCY_32X >> 5),
+    ( MAX_STEP_ISR_FREQUENCY_64X >> 6),
+    (MAX_STEP_ISR_FREQUENCY_128X >> 7)
+  };
+#endif
+
 TERN(ADAPTIVE_STEP_SMOOTHING,,constexpr) uint8_t Stepper::oversampling_factor;
 
 xyze_long_t Stepper::delta_error{0};
@@ -227,6 +244,11 @@ uint32_t Stepper::advance_divisor = 0,
   uint32_t Stepper::nextBabystepISR = BABYSTEP_NEVER;
 #endif
 
+#if ENABLED(INPUT_SHAPING)
+  uint32_t Stepper::shaping_now; // = 0
+  InputShaper Stepper::shaper;
+#endif
+
 #if ENABLED(DIRECT_STEPPING)
   page_step_state_t Stepper::page_step_state;
 #endif
@@ -447,6 +469,23 @@ xyze_int8_t Stepper::count_direction{0};
   #define DIR_WAIT_AFTER()
 #endif
 
+#if ENABLED(INPUT_SHAPING)
+  // A shaped motor changes direction right before its step, not an ISR ahead of it
+  #define SHAPED_DIR_WAIT() DELAY_NS(_MAX(MINIMUM_STEPPER_POST_DIR_DELAY, 200))
+
+  // Take the step a shaped motor needs, if any, setting DIR for it
+  #define SHAPED_STEP(AXIS) do{ \
+    const int8_t dir = shaper.step(_AXIS(AXIS)); \
+    step_needed[_AXIS(AXIS)] = (dir != 0); \
+    if (dir && (dir < 0) != shaper.reverse[_AXIS(AXIS)]) { \
+      shaper.reverse[_AXIS(AXIS)] = (dir < 0); \
+      DIR_WAIT_BEFORE(); \
+      AXIS##_APPLY_DIR(dir < 0 ? INVERT_##AXIS##_DIR : !INVERT_##AXIS##_DIR, false); \
+      SHAPED_DIR_WAIT(); \
+    } \
+  }while(0)
+#endif
+
 /**
  * Set the stepper direction of each axis
  *
@@ -468,8 +507,18 @@ void Stepper::set_directions() {
       count_direction[_AXIS(A)] = 1;            \
     }
 
-    TERN_(HAS_X_DIR, SET_STEP_DIR(X)); // A
-    TERN_(HAS_Y_DIR, SET_STEP_DIR(Y)); // B
+    #if ENABLED(INPUT_SHAPING)
+      // The shaper sets the DIR pins of shaped motors as each of their steps needs
+      if (shaper.enabled) {
+        count_direction.x = motor_direction(X_AXIS) ? -1 : 1;
+        count_direction.y = motor_direction(Y_AXIS) ? -1 : 1;
+      }
+      else
+    #endif
+    {
+      TERN_(HAS_X_DIR, SET_STEP_DIR(X)); // A
+      TERN_(HAS_Y_DIR, SET_STEP_DIR(Y)); // B
+    }
     TERN_(HAS_Z_DIR, SET_STEP_DIR(Z)); // C
 
   #if ENABLED(MIXING_EXTRUDER)
@@ -1324,6 +1373,15 @@ HAL_STEP_TIMER_ISR() {
 void Stepper::isr() {
 
   static uint32_t nextMainISR = 0;  // Interval until the next main Stepper Pulse phase (0 = Now)
+  #if ENABLED(INPUT_SHAPING)
+    static uint32_t nextShapingISR = SHAPING_NEVER; // Interval until the next input shaping echo
+  #endif
+
+  #if ENABLED(ISR_PROFILING)
+    const uint32_t isr_start = isr_profiler.now();
+    uint32_t pulse_cycles = 0;      // Cycles in pulse phases, to leave the ISR's own overhead
+    bool stepped = false;
+  #endif
 
   #ifndef __AVR__
     // Disable interrupts, to avoid ISR preemption while we reprogram the period
@@ -1348,20 +1406,56 @@ void Stepper::isr() {
     // Enable ISRs to reduce USART processing latency
     ENABLE_ISRS();
 
-    if (!nextMainISR) pulse_phase_isr();                            // 0 = Do coordinated axes Stepper pulses
+    #if ENABLED(ISR_PROFILING)
+      if (!nextMainISR) {
+        const uint32_t start = isr_profiler.now(), events = step_events_completed;
+        pulse_phase_isr();
+        const uint32_t cycles = isr_profiler.record(ISR_PROFILE_PULSE, start),
+                       steps = step_events_completed - events;
+        pulse_cycles += cycles;
+        if (WITHIN(steps, 1, 128)) {
+          isr_profiler.add(ISR_PROFILE_STEP, cycles / steps);
+          stepped = true;
+        }
+      }
+    #else
+      if (!nextMainISR) pulse_phase_isr();                          // 0 = Do coordinated axes Stepper pulses
+    #endif
+
+    #if ENABLED(INPUT_SHAPING)
+      if (!nextShapingISR) {                                        // 0 = Do Input Shaping echo pulses
+        TERN_(ISR_PROFILING, const uint32_t start = isr_profiler.now());
+        shaping_isr(!nextMainISR);
+        TERN_(ISR_PROFILING, isr_profiler.record(ISR_PROFILE_SHAPING, start));
+      }
+    #endif
 
     #if ENABLED(LIN_ADVANCE)
-      if (!nextAdvanceISR) nextAdvanceISR = advance_isr();          // 0 = Do Linear Advance E Stepper pulses
+      if (!nextAdvanceISR) {                                        // 0 = Do Linear Advance E Stepper pulses
+        TERN_(ISR_PROFILING, const uint32_t start = isr_profiler.now());
+        nextAdvanceISR = advance_isr();
+        TERN_(ISR_PROFILING, isr_profiler.record(ISR_PROFILE_ADVANCE, start));
+      }
     #endif
 
     #if ENABLED(INTEGRATED_BABYSTEPPING)
       const bool is_babystep = (nextBabystepISR == 0);              // 0 = Do Babystepping (XY)Z pulses
-      if (is_babystep) nextBabystepISR = babystepping_isr();
+      if (is_babystep) {
+        TERN_(ISR_PROFILING, const uint32_t start = isr_profiler.now());
+        nextBabystepISR = babystepping_isr();
+        TERN_(ISR_PROFILING, isr_profiler.record(ISR_PROFILE_BABYSTEP, start));
+      }
     #endif
 
     // ^== Time critical. NOTHING besides pulse generation should be above here!!!
 
-    if (!nextMainISR) nextMainISR = block_phase_isr();  // Manage acc/deceleration, get next block
+    if (!nextMainISR) {                                 // Manage acc/deceleration, get next block
+      TERN_(ISR_PROFILING, const uint32_t start = isr_profiler.now());
+      nextMainISR = block_phase_isr();
+      TERN_(ISR_PROFILING, isr_profiler.record(ISR_PROFILE_BLOCK, start));
+    }
+
+    TERN_(INPUT_SHAPING, nextShapingISR = shaper.next_echo(shaping_now)); // Come back for the steps just queued, too
 
     #if ENABLED(INTEGRATED_BABYSTEPPING)
       if (is_babystep)                                  // Avoid ANY stepping too soon after baby-stepping
@@ -1380,6 +1474,9 @@ void Stepper::isr() {
       #if ENABLED(INTEGRATED_BABYSTEPPING)
         , nextBabystepISR                               // Come back early for Babystepping?
       #endif
+      #if ENABLED(INPUT_SHAPING)
+        , nextShapingISR                                // Come back early for Input Shaping echoes?
+      #endif
       , uint32_t(HAL_TIMER_TYPE_MAX)                    // Come back in a very long time
     );
 
@@ -1400,6 +1497,11 @@ void Stepper::isr() {
       if (nextBabystepISR != BABYSTEP_NEVER) nextBabystepISR -= interval;
     #endif
 
+    #if ENABLED(INPUT_SHAPING)
+      if (nextShapingISR != SHAPING_NEVER) nextShapingISR -= interval;
+      shaping_now += interval;
+    #endif
+
     /**
      * This needs to avoid a race-condition caused by interleaving
      * of interrupts required by both the LA and Stepper algorithms.
@@ -1468,6 +1570,11 @@ void Stepper::isr() {
   // Set the next ISR to fire at the proper time
   HAL_timer_set_compare(STEP_TIMER_NUM, hal_timer_t(next_isr_ticks));
 
+  #if ENABLED(ISR_PROFILING)
+    const uint32_t cycles = isr_profiler.record(ISR_PROFILE_STEPPER, isr_start);
+    if (stepped) isr_profiler.add(ISR_PROFILE_OVERHEAD, cycles - pulse_cycles);
+  #endif
+
   // Don't forget to finally reenable interrupts
   ENABLE_ISRS();
 }
@@ -1649,14 +1756,38 @@ void Stepper::pulse_phase_isr() {
 
     #endif // DIRECT_STEPPING
 
+    #if ENABLED(INPUT_SHAPING)
+      // Queue a commanded step for its echoes
+      #define PULSE_PREP_SHAPING(AXIS) do{ \
+        delta_error[_AXIS(AXIS)] += advance_dividend[_AXIS(AXIS)]; \
+        if (delta_error[_AXIS(AXIS)] >= 0) { \
+          count_position[_AXIS(AXIS)] += count_direction[_AXIS(AXIS)]; \
+          delta_error[_AXIS(AXIS)] -= advance_divisor; \
+          shaper.command(_AXIS(AXIS), count_direction[_AXIS(AXIS)] < 0, shaping_now); \
+        } \
+      }while(0)
+    #endif
+
     if (!is_page) {
       // Determine if pulses are needed
-      #if HAS_X_STEP
-        PULSE_PREP(X);
-      #endif
-      #if HAS_Y_STEP
-        PULSE_PREP(Y);
+      #if ENABLED(INPUT_SHAPING)
+        if (shaper.enabled) {
+          // A step of either motor can move both on CoreXY, so step them once both are queued
+          PULSE_PREP_SHAPING(X);
+          PULSE_PREP_SHAPING(Y);
+          SHAPED_STEP(X);
+          SHAPED_STEP(Y);
+        }
+        else
       #endif
+      {
+        #if HAS_X_STEP
+          PULSE_PREP(X);
+        #endif
+        #if HAS_Y_STEP
+          PULSE_PREP(Y);
+        #endif
+      }
       #if HAS_Z_STEP
         PULSE_PREP(Z);
       #endif
@@ -1743,6 +1874,65 @@ void Stepper::pulse_phase_isr() {
   } while (--events_to_do);
 }
 
+#if ENABLED(INPUT_SHAPING)
+
+  /**
+   * Apply the input shaping echoes that are due and step the XY motors to follow
+   * them. Echoes of steps taken together fall due together, so this can take
+   * several steps, with the same pulse timing as the pulse phase.
+   */
+  void Stepper::shaping_isr(const bool after_pulse) {
+    shaper.echo(shaping_now);
+
+    #if ISR_MULTI_STEPS
+      USING_TIMED_PULSE();
+      bool await_low = after_pulse;               // The pulse phase may have just stepped X or Y
+      if (await_low) START_LOW_PULSE();
+    #else
+      UNUSED(after_pulse);
+    #endif
+
+    xyze_bool_t step_needed{0};
+    for (;;) {
+      SHAPED_STEP(X);
+      SHAPED_STEP(Y);
+      if (!step_needed.x && !step_needed.y) break;
+
+      #if ISR_MULTI_STEPS
+        if (await_low) AWAIT_LOW_PULSE();
+        await_low = true;
+      #endif
+
+      PULSE_START(X);
+      PULSE_START(Y);
+
+      #if ISR_MULTI_STEPS
+        START_HIGH_PULSE();
+        AWAIT_HIGH_PULSE();
+      #endif
+
+      PULSE_STOP(X);
+      PULSE_STOP(Y);
+
+      #if ISR_MULTI_STEPS
+        START_LOW_PULSE();
+      #endif
+    }
+  }
+
+  void Stepper::set_shaping(const AxisEnum axis, const shaping_params_t &params) {
+    planner.synchronize();                        // Let the echoes play out
+    const bool was_enabled = suspend();
+    shaper.axis(axis).params = params;
+    shaper.enabled = false;
+    set_directions();                             // Set the DIR pins the usual way...
+    shaper.reverse.set(motor_direction(X_AXIS), motor_direction(Y_AXIS));
+    shaper.configure();                           // ...and hand them over if either axis is shaped
+    if (was_enabled) wake_up();
+  }
+
+#endif // INPUT_SHAPING
+
 // This is the last half of the stepper interrupt: This one processes and
 // properly schedules blocks from the planner. This is executed after creating
 // the step pulses, so it is not time critical, as pulses are already done.
@@ -2322,6 +2512,27 @@ uint32_t Stepper::block_phase_isr() {
 
 #endif
 
+#if ENABLED(MEASURED_STEP_ISR_LIMITS)
+
+  /**
+   * An ISR taking R steps costs the measured overhead plus R times the
+   * measured cost of a step, so at F_CPU / (overhead + R * step) ISRs per
+   * second it takes all of the CPU. The limits leave the ISR STEP_ISR_MAX_LOAD
+   * of that, so the main loop and the other ISRs keep the rest. A step never
+   * takes less than the minimum pulse. Called from idle(). The ISR reads each
+   * limit in one word, so it can keep running while they change.
+   */
+  void Stepper::update_isr_limits() {
+    uint32_t base, per_step;
+    if (!isr_profiler.step_isr_costs(base, per_step)) return;
+    NOLESS(per_step, uint32_t(MIN_STEPPER_PULSE_CYCLES));
+    constexpr uint32_t budget = (F_CPU) * (STEP_ISR_MAX_LOAD);
+    LOOP_L_N(i, COUNT(isr_rate_limit))
+      isr_rate_limit[i] = budget / (base + (per_step << i));
+  }
+
+#endif
+
 // Check if the given block is busy or not - Must not be called from ISR contexts
 // The current_block could change in the middle of the read by an Stepper ISR, so
 // we must explicitly prevent that!
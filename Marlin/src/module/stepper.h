@@ -45,6 +45,9 @@
 
 #include "planner.h"
 #include "stepper/indirection.h"
+#if ENABLED(INPUT_SHAPING)
+  #include "../feature/input_shaping.h"
+#endif
 #ifdef __AVR__
   #include "speed_lookuptable.h"
 #endif
@@ -62,6 +65,9 @@
  * only to estimate a maximum step rate based on the user's configuration.
  * As 32-bit processors continue to diverge, maintaining cycle counts
  * will become increasingly difficult and error-prone.
+ *
+ * With MEASURED_STEP_ISR_LIMITS the multistepping limits start out from
+ * these estimates and are then set from the costs ISR_PROFILING measures.
  */
 
 #ifdef CPU_32_BIT
@@ -341,6 +347,10 @@ class Stepper {
       static uint32_t nextBabystepISR;
     #endif
 
+    #if ENABLED(INPUT_SHAPING)
+      static uint32_t shaping_now;  // Stepper timer ticks run so far, the clock for the echo queues
+    #endif
+
     #if ENABLED(DIRECT_STEPPING)
       static page_step_state_t page_step_state;
     #endif
@@ -422,6 +432,26 @@ class Stepper {
       }
     #endif
 
+    #if ENABLED(INPUT_SHAPING)
+      static InputShaper shaper;
+
+      // The input shaping ISR phase, stepping the XY motors for the echoes that are due
+      static void shaping_isr(const bool after_pulse);
+
+      // Echoes are still to come - The motors aren't on the commanded position yet
+      static inline bool shaping_busy() { return shaper.busy(); }
+
+      // Change the shaping of an axis, once it has stopped
+      static void set_shaping(const AxisEnum axis, const shaping_params_t &params);
+    #endif
+
+    #if ENABLED(MEASURED_STEP_ISR_LIMITS)
+      static uint32_t isr_rate_limit[8];  // Highest ISR rate for 1x to 128x stepping, from the measured ISR costs
+
+      // Set the multistepping limits from the ISR costs measured so far
+      static void update_isr_limits();
+    #endif
+
     // Check if the given block is busy or not - Must not be called from ISR contexts
     static bool is_block_busy(const block_t* const block);
 
@@ -538,26 +568,32 @@ class Stepper {
       #if DISABLED(DISABLE_MULTI_STEPPING)
 
         // The stepping frequency limits for each multistepping rate
-        static const uint32_t limit[] PROGMEM = {
-          (  MAX_STEP_ISR_FREQUENCY_1X     ),
-          (  MAX_STEP_ISR_FREQUENCY_2X >> 1),
-          (  MAX_STEP_ISR_FREQUENCY_4X >> 2),
-          (  MAX_STEP_ISR_FREQUENCY_8X >> 3),
-          ( MAX_STEP_ISR_FREQUENCY_16X >> 4),
-          ( MAX_STEP_ISR_FREQUENCY_32X >> 5),
-          ( MAX_STEP_ISR_FREQUENCY_64X >> 6),
-          (MAX_STEP_ISR_FREQUENCY_128X >> 7)
-        };
+        #if ENABLED(MEASURED_STEP_ISR_LIMITS)
+          #define STEP_ISR_LIMIT(I) isr_rate_limit[I]
+        #else
+          static const uint32_t limit[] PROGMEM = {
+            (  MAX_STEP_ISR_FREQUENCY_1X     ),
+            (  MAX_STEP_ISR_FREQUENCY_2X >> 1),
+            (  MAX_STEP_ISR_FREQUENCY_4X >> 2),
+            (  MAX_STEP_ISR_FREQUENCY_8X >> 3),
+            ( MAX_STEP_ISR_FREQUENCY_16X >> 4),
+            ( MAX_STEP_ISR_FREQUENCY_32X >> 5),
+            ( MAX_STEP_ISR_FREQUENCY_64X >> 6),
+            (MAX_STEP_ISR_FREQUENCY_128X >> 7)
+          };
+          #define STEP_ISR_LIMIT(I) (uint32_t)pgm_read_dword(&limit[I])
+        #endif
 
         // Select the proper multistepping
         uint8_t idx = 0;
-        while (idx < 7 && step_rate > (uint32_t)pgm_read_dword(&limit[idx])) {
+        while (idx < 7 && step_rate > STEP_ISR_LIMIT(idx)) {
           step_rate >>= 1;
           multistep <<= 1;
           ++idx;
         };
+        #undef STEP_ISR_LIMIT
       #else
-        NOMORE(step_rate, uint32_t(MAX_STEP_ISR_FREQUENCY_1X));
+        NOMORE(step_rate, TERN(MEASURED_STEP_ISR_LIMITS, isr_rate_limit[0], uint32_t(MAX_STEP_ISR_FREQUENCY_1X)));
       #endif
       *loops = multistep;
 
@@ -77,7 +77,7 @@
   #include "../libs/private_spi.h"
 #endif
 
-#if ENABLED(PID_EXTRUSION_SCALING)
+#if EITHER(PID_EXTRUSION_SCALING, MPCTEMP)
   #include "stepper.h"
 #endif
 
@@ -118,15 +118,29 @@
 #if HAS_SERVOS
   #include "./servo.h"
 #endif
+
+#if ENABLED(ISR_PROFILING)
+  #include "../feature/isr_profiler.h"
+#endif
 #if HOTEND_USES_THERMISTOR
   #if ENABLED(TEMP_SENSOR_1_AS_REDUNDANT)
     static const temp_entry_t* heater_ttbl_map[2] = { HEATER_0_TEMPTABLE, HEATER_1_TEMPTABLE };
     static constexpr uint8_t heater_ttbllen_map[2] = { HEATER_0_TEMPTABLE_LEN, HEATER_1_TEMPTABLE_LEN };
+    #if ENABLED(THERMISTOR_UNIFORM_TABLES)
+      static const int16_t* heater_utbl_map[2] = { HEATER_0_UNIFORM_TABLE, HEATER_1_UNIFORM_TABLE };
+      static constexpr uint8_t heater_ushift_map[2] = { HEATER_0_UNIFORM_SHIFT, HEATER_1_UNIFORM_SHIFT };
+    #endif
   #else
     #define NEXT_TEMPTABLE(N) ,HEATER_##N##_TEMPTABLE
     #define NEXT_TEMPTABLE_LEN(N) ,HEATER_##N##_TEMPTABLE_LEN
     static const temp_entry_t* heater_ttbl_map[HOTENDS] = ARRAY_BY_HOTENDS(HEATER_0_TEMPTABLE REPEAT_S(1, HOTENDS, NEXT_TEMPTABLE));
     static constexpr uint8_t heater_ttbllen_map[HOTENDS] = ARRAY_BY_HOTENDS(HEATER_0_TEMPTABLE_LEN REPEAT_S(1, HOTENDS, NEXT_TEMPTABLE_LEN));
+    #if ENABLED(THERMISTOR_UNIFORM_TABLES)
+      #define NEXT_UNIFORM_TABLE(N) ,HEATER_##N##_UNIFORM_TABLE
+      #define NEXT_UNIFORM_SHIFT(N) ,HEATER_##N##_UNIFORM_SHIFT
+      static const int16_t* heater_utbl_map[HOTENDS] = ARRAY_BY_HOTENDS(HEATER_0_UNIFORM_TABLE REPEAT_S(1, HOTENDS, NEXT_UNIFORM_TABLE));
+      static constexpr uint8_t heater_ushift_map[HOTENDS] = ARRAY_BY_HOTENDS(HEATER_0_UNIFORM_SHIFT REPEAT_S(1, HOTENDS, NEXT_UNIFORM_SHIFT));
+    #endif
   #endif
 #endif
 
@@ -331,6 +345,10 @@ volatile bool Temperature::raw_temps_ready = false;
   lpq_ptr_t Temperature::lpq_ptr = 0;
 #endif
 
+#if ENABLED(MPCTEMP)
+  int32_t Temperature::mpc_e_position; // = 0
+#endif
+
 #define TEMPDIR(N) ((HEATER_##N##_RAW_LO_TEMP) < (HEATER_##N##_RAW_HI_TEMP) ? 1 : -1)
 
 #if HAS_HOTEND
@@ -675,6 +693,204 @@ volatile bool Temperature::raw_temps_ready = false;
 
 #endif // HAS_PID_HEATING
 
+#if ENABLED(MPCTEMP)
+
+  /**
+   * Measure the model constants of a hotend
+   *
+   * With the part fan on, wait for the hotend to cool to the room. Heat at full
+   * power to 200°C, fitting an exponential approach to an asymptote through
+   * samples taken from 100°C up. The asymptote gives the heat loss, its rate
+   * the heat capacity, and the lag at the first sample the sensor response.
+   * Then hold the temperature with MPC and measure the power it takes with the
+   * fan off and on full, for a better heat loss and the fan's share of it.
+   */
+  void Temperature::MPC_autotune(const uint8_t e) {
+    MPCHeaterInfo &hotend = temp_hotend[e];
+    MPC_t &constants = hotend.constants;
+    #if HAS_FAN
+      const uint8_t fan = e < FAN_COUNT ? e : 0;
+    #endif
+
+    float current_temp = hotend.celsius;
+    millis_t next_report_ms = millis();
+
+    // Wait for the next temperature sample, keeping the UI alive. False if M108 ended the tune.
+    auto next_sample = [&]() {
+      for (;;) {
+        if (!wait_for_heatup) {
+          SERIAL_ECHOLNPGM(STR_MPC_AUTOTUNE_INTERRUPTED);
+          return false;
+        }
+        const millis_t ms = millis();
+        if (ELAPSED(ms, next_report_ms)) {
+          print_heater_states(e);
+          SERIAL_EOL();
+          next_report_ms = ms + 2000UL;
+        }
+        planner.check_axes_activity();  // Apply fan changes
+        TERN_(HAL_IDLETASK, HAL_idletask());
+        ui.update();
+        if (raw_temps_ready) {
+          updateTemperaturesFromRawValues();
+          current_temp = hotend.celsius;
+          #if HAS_AUTO_FAN
+            if (ELAPSED(ms, next_auto_fan_check_ms)) {
+              checkExtruderAutoFans();
+              next_auto_fan_check_ms = ms + 2500UL;
+            }
+          #endif
+          return true;
+        }
+      }
+    };
+
+    auto set_fan = [&](const uint8_t speed) {
+      #if HAS_FAN
+        set_fan_speed(fan, speed);
+      #else
+        UNUSED(speed);
+      #endif
+    };
+
+    SERIAL_ECHOLNPAIR(STR_MPC_AUTOTUNE_START, int(e));
+    disable_all_heaters();
+    TERN_(AUTO_POWER_CONTROL, powerManager.power_on());
+    wait_for_heatup = true;   // Can be interrupted with M108
+
+    const bool done = [&]() {
+      // Cool to the room with the fan on full, until the temperature stops falling
+      SERIAL_ECHOLNPGM(STR_MPC_COOLING_TO_AMBIENT);
+      set_fan(255);
+      float ambient_temp = current_temp;
+      for (millis_t next_test_ms = millis() + 10000UL;;) {
+        if (!next_sample()) return false;
+        if (ELAPSED(millis(), next_test_ms)) {
+          if (current_temp >= ambient_temp) {
+            ambient_temp = (ambient_temp + current_temp) / 2.0f;
+            break;
+          }
+          ambient_temp = current_temp;
+          next_test_ms += 10000UL;
+        }
+      }
+      set_fan(0);
+
+      // Heat at full power to 200°C, sampling once a second from 100°C up.
+      // When the samples fill up, drop every other one and sample half as often.
+      SERIAL_ECHOLNPGM(STR_MPC_HEATING_PAST_200);
+      hotend.target = 200;                    // For the status reports
+      hotend.soft_pwm_amount = (MPC_MAX) >> 1;
+      const millis_t heat_start_ms = millis();
+      millis_t next_test_ms = heat_start_ms;
+      float temp_samples[16], t1_time = 0;
+      uint8_t sample_count = 0;
+      uint16_t sample_distance = 1;           // Seconds between samples
+      for (;;) {
+        if (!next_sample()) return false;
+        const millis_t ms = millis();
+        if (ELAPSED(ms, next_test_ms)) {
+          if (current_temp >= 100) {
+            if (sample_count == COUNT(temp_samples)) {
+              LOOP_L_N(i, COUNT(temp_samples) / 2) temp_samples[i] = temp_samples[i * 2];
+              sample_count /= 2;
+              sample_distance *= 2;
+            }
+            if (sample_count == 0) t1_time = (ms - heat_start_ms) * 0.001f;
+            temp_samples[sample_count++] = current_temp;
+          }
+          if (current_temp >= 200) break;
+          next_test_ms += 1000UL * sample_distance;
+        }
+      }
+      hotend.soft_pwm_amount = 0;
+
+      // The approach to the asymptote through three equally spaced samples
+      sample_count = (sample_count + 1) / 2 * 2 - 1;
+      if (sample_count < 3) {
+        SERIAL_ECHOLNPGM(STR_MPC_AUTOTUNE_FAILED);
+        return false;
+      }
+      const float full_power = constants.heater_power * ((MPC_MAX) >> 1) * RECIPROCAL(127),
+                  sample_span = float(sample_distance) * (sample_count >> 1),
+                  t1 = temp_samples[0],
+                  t2 = temp_samples[sample_count >> 1],
+                  t3 = temp_samples[sample_count - 1];
+      auto fit = [&](const float asymp_temp) {
+        const float block_responsiveness = -logf((t2 - asymp_temp) / (t1 - asymp_temp)) / sample_span;
+        constants.block_heat_capacity = constants.ambient_xfer_coeff_fan0 / block_responsiveness;
+        constants.sensor_responsiveness = block_responsiveness
+          / (1.0f - (ambient_temp - asymp_temp) * expf(-block_responsiveness * t1_time) / (t1 - asymp_temp));
+        return block_responsiveness;
+      };
+      const float curve = 2 * t2 - t1 - t3;
+      if (curve <= 0) {                       // Not slowing down: the heater is too strong to measure this way
+        SERIAL_ECHOLNPGM(STR_MPC_AUTOTUNE_FAILED);
+        return false;
+      }
+      float asymp_temp = (t2 * t2 - t1 * t3) / curve;
+      constants.ambient_xfer_coeff_fan0 = full_power / (asymp_temp - ambient_temp);
+      constants.fan255_adjustment = 0;
+      const float block_responsiveness = fit(asymp_temp);
+
+      // Hold where the block is now with MPC and measure the power it takes,
+      // first with the fan off then on full, after 20 seconds to settle each time
+      hotend.modeled_ambient_temp = ambient_temp;
+      hotend.modeled_block_temp = asymp_temp + (ambient_temp - asymp_temp) * expf(-block_responsiveness * (millis() - heat_start_ms) * 0.001f);
+      hotend.modeled_sensor_temp = current_temp;
+      hotend.target = LROUND(hotend.modeled_block_temp);
+      SERIAL_ECHOLNPAIR(STR_MPC_MEASURING_AMBIENT, hotend.target);
+
+      constexpr uint16_t settle_samples = 20 / (MPC_dT), test_samples = 20 / (MPC_dT);
+      float energy[2] = { 0 };
+      float last_temp = current_temp;
+      LOOP_L_N(f, 1 + ENABLED(HAS_FAN)) {
+        set_fan(f ? 255 : 0);
+        LOOP_L_N(i, settle_samples + test_samples) {
+          if (!next_sample()) return false;
+          hotend.soft_pwm_amount = (int)get_pid_output_hotend(e) >> 1;
+          if (i >= settle_samples)
+            energy[f] += constants.heater_power * hotend.soft_pwm_amount * RECIPROCAL(127) * (MPC_dT)
+                       + (last_temp - current_temp) * constants.block_heat_capacity;
+          last_temp = current_temp;
+          if (!WITHIN(current_temp, hotend.target - 15, hotend.target + 15)) {
+            SERIAL_ECHOLNPGM(STR_MPC_TEMPERATURE_ERROR);
+            return false;
+          }
+        }
+      }
+      set_fan(0);
+
+      const float held = hotend.target - ambient_temp;
+      constants.ambient_xfer_coeff_fan0 = energy[0] / (test_samples * (MPC_dT)) / held;
+      #if HAS_FAN
+        constants.fan255_adjustment = energy[1] / (test_samples * (MPC_dT)) / held - constants.ambient_xfer_coeff_fan0;
+      #endif
+
+      // The measured loss puts the asymptote where it really is
+      asymp_temp = ambient_temp + full_power / constants.ambient_xfer_coeff_fan0;
+      fit(asymp_temp);
+      return true;
+    }();
+
+    wait_for_heatup = false;
+    hotend.target = 0;
+    hotend.soft_pwm_amount = 0;
+    set_fan(0);
+
+    if (!done) return;
+
+    SERIAL_ECHOLNPGM(STR_MPC_AUTOTUNE_FINISHED);
+    SERIAL_ECHOLNPAIR_F("MPC_BLOCK_HEAT_CAPACITY ", constants.block_heat_capacity, 2);
+    SERIAL_ECHOLNPAIR_F("MPC_SENSOR_RESPONSIVENESS ", constants.sensor_responsiveness, 4);
+    SERIAL_ECHOLNPAIR_F("MPC_AMBIENT_XFER_COEFF ", constants.ambient_xfer_coeff_fan0, 4);
+    #if HAS_FAN
+      SERIAL_ECHOLNPAIR_F("MPC_AMBIENT_XFER_COEFF_FAN255 ", constants.ambient_xfer_coeff_fan0 + constants.fan255_adjustment, 4);
+    #endif
+  }
+
+#endif // MPCTEMP
+
 /**
  * Class and Instance Methods
  */
@@ -849,6 +1065,14 @@ void Temperature::min_temp_error(const heater_id_t heater_id) {
   _temp_error(heater_id, PSTR(STR_T_MINTEMP), GET_TEXT(MSG_ERR_MINTEMP));
 }
 
+#if ENABLED(HEATER_POWER_BUDGET)
+  #define BUDGET_HEATERS (HOTENDS + ENABLED(HAS_HEATED_BED))
+  #define BED_BUDGET_INDEX HOTENDS
+
+  // Each heater's PWM as its controller asks, before the budget cuts it back
+  static uint8_t pwm_request[BUDGET_HEATERS];
+#endif
+
 #if HAS_HOTEND
   #if ENABLED(PID_DEBUG)
     extern bool pid_debug_flag;
@@ -886,7 +1110,9 @@ void Temperature::min_temp_error(const heater_id_t heater_id) {
 
           work_pid[ee].Kd = work_pid[ee].Kd + PID_K2 * (PID_PARAM(Kd, ee) * (temp_dState[ee] - temp_hotend[ee].celsius) - work_pid[ee].Kd);
           const float max_power_over_i_gain = float(PID_MAX) / PID_PARAM(Ki, ee) - float(MIN_POWER);
-          temp_iState[ee] = constrain(temp_iState[ee] + pid_error, 0, max_power_over_i_gain);
+          // Don't wind up while the power budget gives the heater less than it asked for
+          if (!TERN0(HEATER_POWER_BUDGET, (temp_hotend[ee].soft_pwm_amount < pwm_request[ee])))
+            temp_iState[ee] = constrain(temp_iState[ee] + pid_error, 0, max_power_over_i_gain);
           work_pid[ee].Kp = PID_PARAM(Kp, ee) * pid_error;
           work_pid[ee].Ki = PID_PARAM(Ki, ee) * temp_iState[ee];
 
@@ -951,6 +1177,67 @@ void Temperature::min_temp_error(const heater_id_t heater_id) {
         }
       #endif // PID_DEBUG
 
+    #elif ENABLED(MPCTEMP)
+
+      MPCHeaterInfo &hotend = temp_hotend[ee];
+      const MPC_t &constants = hotend.constants;
+
+      // Start the model on the sensor, in a room no warmer than 30°C
+      if (isnan(hotend.modeled_block_temp)) {
+        hotend.modeled_ambient_temp = _MIN(30.0f, hotend.celsius);
+        hotend.modeled_block_temp = hotend.modeled_sensor_temp = hotend.celsius;
+      }
+
+      // Heat goes to the air, faster with the part fan on...
+      float ambient_xfer_coeff = constants.ambient_xfer_coeff_fan0;
+      #if HAS_FAN
+        ambient_xfer_coeff += scaledFanSpeed(ee < FAN_COUNT ? ee : 0) * RECIPROCAL(255) * constants.fan255_adjustment;
+      #endif
+
+      // ...and into the filament the active hotend melts
+      #if HOTENDS == 1
+        constexpr bool this_hotend = true;
+      #else
+        const bool this_hotend = (ee == active_extruder);
+      #endif
+      if (this_hotend) {
+        const int32_t e_position = stepper.position(E_AXIS);
+        const float e_speed = (e_position - mpc_e_position) * planner.steps_to_mm[E_AXIS_N(ee)] / (MPC_dT);
+        if (ABS(e_speed) > planner.settings.max_feedrate_mm_s[E_AXIS_N(ee)])
+          mpc_e_position = e_position;      // A jump from G92 or homing, not extrusion
+        else if (e_speed > 0) {             // Retracts and their recovery melt nothing
+          ambient_xfer_coeff += e_speed * constants.filament_heat_capacity_permm;
+          mpc_e_position = e_position;
+        }
+      }
+
+      // Advance the model by the power applied since the last update
+      const float blocktempdelta = (hotend.soft_pwm_amount * constants.heater_power * RECIPROCAL(127)
+                                    + (hotend.modeled_ambient_temp - hotend.modeled_block_temp) * ambient_xfer_coeff
+                                   ) * (MPC_dT) / constants.block_heat_capacity;
+      hotend.modeled_block_temp += blocktempdelta;
+      hotend.modeled_sensor_temp += (hotend.modeled_block_temp - hotend.modeled_sensor_temp) * constants.sensor_responsiveness * (MPC_dT);
+
+      // Pull the model towards the reading, so sensor noise averages out and model error can't build up
+      const float delta_to_apply = (hotend.celsius - hotend.modeled_sensor_temp) * (MPC_SMOOTHING_FACTOR);
+      hotend.modeled_block_temp += delta_to_apply;
+      hotend.modeled_sensor_temp += delta_to_apply;
+
+      // Near a steady state what error is left comes from the heat loss, so blame the ambient for it
+      if (WITHIN(hotend.soft_pwm_amount, 1, ((MPC_MAX) >> 1) - 1) || ABS(blocktempdelta + delta_to_apply) < (MPC_STEADYSTATE) * (MPC_dT))
+        hotend.modeled_ambient_temp += delta_to_apply > 0
+          ? _MAX(delta_to_apply,  (MPC_MIN_AMBIENT_CHANGE) * (MPC_dT))
+          : _MIN(delta_to_apply, -(MPC_MIN_AMBIENT_CHANGE) * (MPC_dT));
+
+      // The power to bring the block to the target in two seconds and to hold it there
+      float power = 0;
+      if (hotend.target && !TERN0(HEATER_IDLE_HANDLER, heater_idle[ee].timed_out))
+        power = (hotend.target - hotend.modeled_block_temp) * constants.block_heat_capacity / 2.0f
+              + (hotend.modeled_block_temp - hotend.modeled_ambient_temp) * ambient_xfer_coeff;
+
+      float pid_output = power * 254.0f / constants.heater_power + 1.0f; // + 1 so the >> 1 rounds
+      LIMIT(pid_output, 0, MPC_MAX);
+
     #else // No PID enabled
 
       const bool is_idling = TERN0(HEATER_IDLE_HANDLER, heater_idle[ee].timed_out);
@@ -1027,6 +1314,84 @@ void Temperature::min_temp_error(const heater_id_t heater_id) {
 
 #endif // PIDTEMPBED
 
+#if ENABLED(HEATER_POWER_BUDGET)
+
+  #if DISABLED(MPCTEMP)
+    constexpr float hotend_watts[] = HOTEND_HEATER_WATTS;
+    static_assert(COUNT(hotend_watts) == HOTENDS, "HOTEND_HEATER_WATTS must have HOTENDS items.");
+  #endif
+
+  /**
+   * Share HEATER_BUDGET_WATTS between the heaters
+   *
+   * A heat-up runs from a rise of the target until the heater is first within
+   * its window of it. Heaters not heating up are holding or cooling and are
+   * served first. The rest share what's left, the one with the largest part of
+   * its heat-up still ahead first. With SYNC_HEATUP a heater further along than
+   * that one waits for it, so the heaters arrive together and the power goes to
+   * the heater that decides when.
+   */
+  void Temperature::apply_power_budget() {
+    constexpr float sync_lead = 0.02f;          // Part of a heat-up a heater may get ahead before it waits
+
+    static int16_t last_target[BUDGET_HEATERS];
+    static float start[BUDGET_HEATERS];         // Where each heat-up began
+    static bool heating_up[BUDGET_HEATERS];
+
+    struct {
+      uint8_t *amount;                          // The PWM the heater gets
+      float watts;                              // Power at full PWM
+      float progress;                           // Part of the heat-up done, or NAN if not heating up
+    } h[BUDGET_HEATERS];
+
+    auto add = [&](const uint8_t i, HeaterInfo &heater, const float watts, const float window) {
+      if (heater.target != last_target[i]) {
+        heating_up[i] = heater.target > last_target[i];
+        start[i] = heater.celsius;
+        last_target[i] = heater.target;
+      }
+      if (heater.celsius >= heater.target - window) heating_up[i] = false;
+      if (!heater.target) pwm_request[i] = 0;   // The bed's request may be a few seconds old
+      h[i].amount = &heater.soft_pwm_amount;
+      h[i].watts = watts;
+      h[i].progress = heating_up[i] ? (heater.celsius - start[i]) / _MAX(heater.target - start[i], 1.0f) : NAN;
+    };
+
+    HOTEND_LOOP() add(e, temp_hotend[e], TERN(MPCTEMP, temp_hotend[e].constants.heater_power, hotend_watts[e]), TEMP_WINDOW);
+    TERN_(HAS_HEATED_BED, add(BED_BUDGET_INDEX, temp_bed, BED_HEATER_WATTS, TEMP_BED_WINDOW));
+
+    float budget = HEATER_BUDGET_WATTS;
+    auto grant = [&](const uint8_t i) {
+      uint8_t pwm = pwm_request[i];
+      const float watts = pwm * h[i].watts * RECIPROCAL(127);
+      if (watts > budget) {
+        pwm = budget * 127 / h[i].watts;
+        budget = 0;
+      }
+      else
+        budget -= watts;
+      *h[i].amount = pwm;
+    };
+
+    LOOP_L_N(i, BUDGET_HEATERS) if (isnan(h[i].progress)) grant(i);
+
+    float behind = NAN;
+    for (;;) {
+      int8_t next = -1;
+      LOOP_L_N(i, BUDGET_HEATERS)
+        if (!isnan(h[i].progress) && (next < 0 || h[i].progress < h[next].progress)) next = i;
+      if (next < 0) break;
+      if (isnan(behind)) behind = h[next].progress;
+      if (ENABLED(SYNC_HEATUP) && h[next].progress > behind + sync_lead)
+        *h[next].amount = 0;
+      else
+        grant(next);
+      h[next].progress = NAN;
+    }
+  }
+
+#endif // HEATER_POWER_BUDGET
+
 /**
  * Manage heating activities for extruder hot-ends and a heated bed
  *  - Acquire updated temperature readings
@@ -1077,7 +1442,7 @@ void Temperature::manage_heater() {
         tr_state_machine[e].run(temp_hotend[e].celsius, temp_hotend[e].target, (heater_id_t)e, THERMAL_PROTECTION_PERIOD, THERMAL_PROTECTION_HYSTERESIS);
       #endif
 
-      temp_hotend[e].soft_pwm_amount = (temp_hotend[e].celsius > temp_range[e].mintemp || is_preheating(e)) && temp_hotend[e].celsius < temp_range[e].maxtemp ? (int)get_pid_output_hotend(e) >> 1 : 0;
+      TERN(HEATER_POWER_BUDGET, pwm_request[e], temp_hotend[e].soft_pwm_amount) = (temp_hotend[e].celsius > temp_range[e].mintemp || is_preheating(e)) && temp_hotend[e].celsius < temp_range[e].maxtemp ? (int)get_pid_output_hotend(e) >> 1 : 0;
 
       #if WATCH_HOTENDS
         // Make sure temperature is increasing
@@ -1160,9 +1525,12 @@ void Temperature::manage_heater() {
         tr_state_machine[RUNAWAY_IND_BED].run(temp_bed.celsius, temp_bed.target, H_BED, THERMAL_PROTECTION_BED_PERIOD, THERMAL_PROTECTION_BED_HYSTERESIS);
       #endif
 
+      // The PWM the bed control wants
+      uint8_t &bed_pwm = TERN(HEATER_POWER_BUDGET, pwm_request[BED_BUDGET_INDEX], temp_bed.soft_pwm_amount);
+
       #if HEATER_IDLE_HANDLER
         if (heater_idle[IDLE_INDEX_BED].timed_out) {
-          temp_bed.soft_pwm_amount = 0;
+          bed_pwm = 0;
           #if DISABLED(PIDTEMPBED)
             WRITE_HEATER_BED(LOW);
           #endif
@@ -1171,21 +1539,21 @@ void Temperature::manage_heater() {
       #endif
       {
         #if ENABLED(PIDTEMPBED)
-          temp_bed.soft_pwm_amount = WITHIN(temp_bed.celsius, BED_MINTEMP, BED_MAXTEMP) ? (int)get_pid_output_bed() >> 1 : 0;
+          bed_pwm = WITHIN(temp_bed.celsius, BED_MINTEMP, BED_MAXTEMP) ? (int)get_pid_output_bed() >> 1 : 0;
         #else
           // Check if temperature is within the correct band
           if (WITHIN(temp_bed.celsius, BED_MINTEMP, BED_MAXTEMP)) {
             #if ENABLED(BED_LIMIT_SWITCHING)
               if (temp_bed.celsius >= temp_bed.target + BED_HYSTERESIS)
-                temp_bed.soft_pwm_amount = 0;
+                bed_pwm = 0;
               else if (temp_bed.celsius <= temp_bed.target - (BED_HYSTERESIS))
-                temp_bed.soft_pwm_amount = MAX_BED_POWER >> 1;
+                bed_pwm = MAX_BED_POWER >> 1;
             #else // !PIDTEMPBED && !BED_LIMIT_SWITCHING
-              temp_bed.soft_pwm_amount = temp_bed.celsius < temp_bed.target ? MAX_BED_POWER >> 1 : 0;
+              bed_pwm = temp_bed.celsius < temp_bed.target ? MAX_BED_POWER >> 1 : 0;
             #endif
           }
           else {
-            temp_bed.soft_pwm_amount = 0;
+            bed_pwm = 0;
             WRITE_HEATER_BED(LOW);
           }
         #endif
@@ -1195,6 +1563,8 @@ void Temperature::manage_heater() {
 
   #endif // HAS_HEATED_BED
 
+  TERN_(HEATER_POWER_BUDGET, apply_power_budget());
+
   #if HAS_HEATED_CHAMBER
 
     #ifndef CHAMBER_CHECK_INTERVAL
@@ -1337,6 +1707,32 @@ void Temperature::manage_heater() {
   }                                                                   \
 }while(0)
 
+#if ENABLED(THERMISTOR_UNIFORM_TABLES)
+
+  // Raw readings are 10-bit ADC counts times OVERSAMPLENR and the table scale
+  constexpr uint8_t thermistor_raw_shift(const uint16_t n) { return n > 1 ? 1 + thermistor_raw_shift(n >> 1) : 0; }
+  constexpr uint16_t THERMISTOR_RAW_SCALE = (OVERSAMPLENR) * (THERMISTOR_TABLE_SCALE);
+  constexpr uint8_t THERMISTOR_RAW_SHIFT = thermistor_raw_shift(THERMISTOR_RAW_SCALE);
+  static_assert((THERMISTOR_RAW_SCALE & (THERMISTOR_RAW_SCALE - 1)) == 0, "THERMISTOR_UNIFORM_TABLES requires a power-of-2 OVERSAMPLENR.");
+
+  /**
+   * Clamp 'raw' to the range of the original table, index the uniform table
+   * by its offset from the first entry, then interpolate in 1/16 °C.
+   */
+  #define UNIFORM_THERMISTOR_TABLE(TBL,LEN,UTBL,SHIFT) do{            \
+    const int16_t lo = pgm_read_word(&TBL[0].value),                  \
+                  hi = pgm_read_word(&TBL[LEN-1].value);              \
+    const uint16_t r = constrain(raw, lo, hi) - lo;                   \
+    const uint8_t s = (SHIFT) + THERMISTOR_RAW_SHIFT;                 \
+    const uint16_t i = r >> s;                                        \
+    const int32_t f = r & ((1 << s) - 1);                             \
+    const int16_t t0 = pgm_read_word(&UTBL[i]),                       \
+                  t1 = pgm_read_word(&UTBL[i + 1]);                   \
+    return (t0 + (((t1 - t0) * f + ((1 << s) >> 1)) >> s)) * (1.0f / 16); \
+  }while(0)
+
+#endif
+
 #if HAS_USER_THERMISTORS
 
   user_thermistor_t Temperature::user_thermistor[USER_THERMISTORS]; // Initialized by settings.load()
@@ -1564,6 +1960,9 @@ void Temperature::manage_heater() {
     #if HOTEND_USES_THERMISTOR
       // Thermistor with conversion table?   
       const temp_entry_t(*tt)[] = (temp_entry_t(*)[])(heater_ttbl_map[e]);
+      #if ENABLED(THERMISTOR_UNIFORM_TABLES)
+        if (heater_utbl_map[e]) UNIFORM_THERMISTOR_TABLE((*tt), heater_ttbllen_map[e], heater_utbl_map[e], heater_ushift_map[e]);
+      #endif
       SCAN_THERMISTOR_TABLE((*tt), heater_ttbllen_map[e]);
     #endif
 
@@ -1578,7 +1977,11 @@ void Temperature::manage_heater() {
     #if ENABLED(HEATER_BED_USER_THERMISTOR)
       return user_thermistor_to_deg_c(CTI_BED, raw);
     #elif ENABLED(HEATER_BED_USES_THERMISTOR)
-      SCAN_THERMISTOR_TABLE(BED_TEMPTABLE, BED_TEMPTABLE_LEN);
+      #ifdef BED_UNIFORM_TABLE
+        UNIFORM_THERMISTOR_TABLE(BED_TEMPTABLE, BED_TEMPTABLE_LEN, BED_UNIFORM_TABLE, BED_UNIFORM_SHIFT);
+      #else
+        SCAN_THERMISTOR_TABLE(BED_TEMPTABLE, BED_TEMPTABLE_LEN);
+      #endif
     #elif ENABLED(HEATER_BED_USES_AD595)
       return TEMP_AD595(raw);
     #elif ENABLED(HEATER_BED_USES_AD8495)
@@ -1597,7 +2000,11 @@ void Temperature::manage_heater() {
     #if ENABLED(HEATER_CHAMBER_USER_THERMISTOR)
       return user_thermistor_to_deg_c(CTI_CHAMBER, raw);
     #elif ENABLED(HEATER_CHAMBER_USES_THERMISTOR)
-      SCAN_THERMISTOR_TABLE(CHAMBER_TEMPTABLE, CHAMBER_TEMPTABLE_LEN);
+      #ifdef CHAMBER_UNIFORM_TABLE
+        UNIFORM_THERMISTOR_TABLE(CHAMBER_TEMPTABLE, CHAMBER_TEMPTABLE_LEN, CHAMBER_UNIFORM_TABLE, CHAMBER_UNIFORM_SHIFT);
+      #else
+        SCAN_THERMISTOR_TABLE(CHAMBER_TEMPTABLE, CHAMBER_TEMPTABLE_LEN);
+      #endif
     #elif ENABLED(HEATER_CHAMBER_USES_AD595)
       return TEMP_AD595(raw);
     #elif ENABLED(HEATER_CHAMBER_USES_AD8495)
@@ -1616,7 +2023,11 @@ void Temperature::manage_heater() {
     #if ENABLED(PROBE_USER_THERMISTOR)
       return user_thermistor_to_deg_c(CTI_PROBE, raw);
     #elif ENABLED(PROBE_USES_THERMISTOR)
-      SCAN_THERMISTOR_TABLE(PROBE_TEMPTABLE, PROBE_TEMPTABLE_LEN);
+      #ifdef PROBE_UNIFORM_TABLE
+        UNIFORM_THERMISTOR_TABLE(PROBE_TEMPTABLE, PROBE_TEMPTABLE_LEN, PROBE_UNIFORM_TABLE, PROBE_UNIFORM_SHIFT);
+      #else
+        SCAN_THERMISTOR_TABLE(PROBE_TEMPTABLE, PROBE_TEMPTABLE_LEN);
+      #endif
     #elif ENABLED(PROBE_USES_AD595)
       return TEMP_AD595(raw);
     #elif ENABLED(PROBE_USES_AD8495)
@@ -1727,6 +2138,10 @@ void Temperature::init() {
     last_e_position = 0;
   #endif
 
+  #if ENABLED(MPCTEMP)
+    HOTEND_LOOP() temp_hotend[e].modeled_block_temp = NAN; // Start the model on the first reading
+  #endif
+
   #if HAS_HEATER_0
     #ifdef ALFAWISE_UX0
       OUT_WRITE_OD(HEATER_0_PIN, HEATER_0_INVERTING);
@@ -2414,7 +2829,7 @@ void Temperature::readings_ready() {
       if (tdir) {
         const int16_t rawtemp = temp_hotend[e].raw * tdir; // normal direction, +rawtemp, else -rawtemp
         const bool heater_on = (temp_hotend[e].target > 0
-          || TERN0(PIDTEMP, temp_hotend[e].soft_pwm_amount) > 0
+          || (EITHER(PIDTEMP, MPCTEMP) && temp_hotend[e].soft_pwm_amount > 0)
         );
         if (rawtemp > temp_range[e].raw_max * tdir) max_temp_error((heater_id_t)e);
         if (heater_on && rawtemp < temp_range[e].raw_min * tdir && !is_preheating(e)) {
@@ -2473,7 +2888,9 @@ void Temperature::readings_ready() {
 HAL_TEMP_TIMER_ISR() {
   HAL_timer_isr_prologue(TEMP_TIMER_NUM);
 
+  TERN_(ISR_PROFILING, const uint32_t start = isr_profiler.now());
   Temperature::tick();
+  TERN_(ISR_PROFILING, isr_profiler.record(ISR_PROFILE_TEMPERATURE, start));
 
   HAL_timer_isr_epilogue(TEMP_TIMER_NUM);
 }
@@ -59,6 +59,16 @@ typedef struct { float Kp, Ki, Kd, Kc; } PIDC_t;
 typedef struct { float Kp, Ki, Kd, Kf; } PIDF_t;
 typedef struct { float Kp, Ki, Kd, Kc, Kf; } PIDCF_t;
 
+// MPC storage
+typedef struct {
+  float heater_power;                 // M306 P (W)
+  float block_heat_capacity;          // M306 C (J/K)
+  float sensor_responsiveness;        // M306 R (K/s per K)
+  float ambient_xfer_coeff_fan0;      // M306 A (W/K)
+  float fan255_adjustment;            // M306 F (W/K) Added to the above with the fan at full speed
+  float filament_heat_capacity_permm; // M306 H (J/K/mm)
+} MPC_t;
+
 typedef
   #if BOTH(PID_EXTRUSION_SCALING, PID_FAN_SCALING)
     PIDCF_t
@@ -170,6 +180,10 @@ enum ADCSensorState : char {
   #define unscalePID_d(d) ( float(d) * PID_dT )
 #endif
 
+#if ENABLED(MPCTEMP)
+  #define MPC_dT ((OVERSAMPLENR * float(ACTUAL_ADC_SAMPLES)) / TEMP_TIMER_FREQUENCY)
+#endif
+
 #if BOTH(HAS_LCD_MENU, G26_MESH_VALIDATION)
   #define G26_CLICK_CAN_CANCEL 1
 #endif
@@ -196,8 +210,18 @@ struct PIDHeaterInfo : public HeaterInfo {
   T pid;  // Initialized by settings.load()
 };
 
+// A heater with a model of its block and sensor
+struct MPCHeaterInfo : public HeaterInfo {
+  MPC_t constants;              // Initialized by settings.load()
+  float modeled_ambient_temp,
+        modeled_block_temp,
+        modeled_sensor_temp;
+};
+
 #if ENABLED(PIDTEMP)
   typedef struct PIDHeaterInfo<hotend_pid_t> hotend_info_t;
+#elif ENABLED(MPCTEMP)
+  typedef struct MPCHeaterInfo hotend_info_t;
 #else
   typedef heater_info_t hotend_info_t;
 #endif
@@ -398,6 +422,8 @@ class Temperature {
       static lpq_ptr_t lpq_ptr;
     #endif
 
+    TERN_(MPCTEMP, static int32_t mpc_e_position);
+
     TERN_(HAS_HOTEND, static temp_range_t temp_range[HOTENDS]);
 
     #if HAS_HEATED_BED
@@ -769,6 +795,11 @@ class Temperature {
 
     #endif
 
+    /**
+     * Measure the model constants of a hotend in response to M306 T
+     */
+    TERN_(MPCTEMP, static void MPC_autotune(const uint8_t e));
+
     #if ENABLED(PROBING_HEATERS_OFF)
       static void pause(const bool p);
       FORCE_INLINE static bool is_paused() { return paused; }
@@ -840,6 +871,8 @@ class Temperature {
 
     TERN_(HAS_HEATED_CHAMBER, static float get_pid_output_chamber());
 
+    TERN_(HEATER_POWER_BUDGET, static void apply_power_budget());
+
     static void _temp_error(const heater_id_t e, PGM_P const serial_msg, PGM_P const lcd_msg);
     static void min_temp_error(const heater_id_t e);
     static void max_temp_error(const heater_id_t e);
@@ -321,6 +321,89 @@ static_assert(
   "Temperature conversion tables over 255 entries need special consideration."
 );
 
+#if ENABLED(THERMISTOR_UNIFORM_TABLES)
+
+  #include "thermistors_uniform.h"
+
+  #define _UTT_HAS(_N) HAS_UNIFORM_TEMPTABLE_ ## _N
+  #define UTT_HAS(_N) _UTT_HAS(_N)
+  #define _UTT_NAME(_N) uniform_temptable_ ## _N
+  #define UTT_NAME(_N) _UTT_NAME(_N)
+  #define _UTT_SHIFT(_N) UNIFORM_TEMPTABLE_ ## _N ## _SHIFT
+  #define UTT_SHIFT(_N) _UTT_SHIFT(_N)
+
+  // Heaters without a uniform table fall back to the bisect search
+  #if UTT_HAS(THERMISTOR_HEATER_0)
+    #define HEATER_0_UNIFORM_TABLE UTT_NAME(THERMISTOR_HEATER_0)
+    #define HEATER_0_UNIFORM_SHIFT UTT_SHIFT(THERMISTOR_HEATER_0)
+  #else
+    #define HEATER_0_UNIFORM_TABLE nullptr
+    #define HEATER_0_UNIFORM_SHIFT 0
+  #endif
+  #if UTT_HAS(THERMISTOR_HEATER_1)
+    #define HEATER_1_UNIFORM_TABLE UTT_NAME(THERMISTOR_HEATER_1)
+    #define HEATER_1_UNIFORM_SHIFT UTT_SHIFT(THERMISTOR_HEATER_1)
+  #else
+    #define HEATER_1_UNIFORM_TABLE nullptr
+    #define HEATER_1_UNIFORM_SHIFT 0
+  #endif
+  #if UTT_HAS(THERMISTOR_HEATER_2)
+    #define HEATER_2_UNIFORM_TABLE UTT_NAME(THERMISTOR_HEATER_2)
+    #define HEATER_2_UNIFORM_SHIFT UTT_SHIFT(THERMISTOR_HEATER_2)
+  #else
+    #define HEATER_2_UNIFORM_TABLE nullptr
+    #define HEATER_2_UNIFORM_SHIFT 0
+  #endif
+  #if UTT_HAS(THERMISTOR_HEATER_3)
+    #define HEATER_3_UNIFORM_TABLE UTT_NAME(THERMISTOR_HEATER_3)
+    #define HEATER_3_UNIFORM_SHIFT UTT_SHIFT(THERMISTOR_HEATER_3)
+  #else
+    #define HEATER_3_UNIFORM_TABLE nullptr
+    #define HEATER_3_UNIFORM_SHIFT 0
+  #endif
+  #if UTT_HAS(THERMISTOR_HEATER_4)
+    #define HEATER_4_UNIFORM_TABLE UTT_NAME(THERMISTOR_HEATER_4)
+    #define HEATER_4_UNIFORM_SHIFT UTT_SHIFT(THERMISTOR_HEATER_4)
+  #else
+    #define HEATER_4_UNIFORM_TABLE nullptr
+    #define HEATER_4_UNIFORM_SHIFT 0
+  #endif
+  #if UTT_HAS(THERMISTOR_HEATER_5)
+    #define HEATER_5_UNIFORM_TABLE UTT_NAME(THERMISTOR_HEATER_5)
+    #define HEATER_5_UNIFORM_SHIFT UTT_SHIFT(THERMISTOR_HEATER_5)
+  #else
+    #define HEATER_5_UNIFORM_TABLE nullptr
+    #define HEATER_5_UNIFORM_SHIFT 0
+  #endif
+  #if UTT_HAS(THERMISTOR_HEATER_6)
+    #define HEATER_6_UNIFORM_TABLE UTT_NAME(THERMISTOR_HEATER_6)
+    #define HEATER_6_UNIFORM_SHIFT UTT_SHIFT(THERMISTOR_HEATER_6)
+  #else
+    #define HEATER_6_UNIFORM_TABLE nullptr
+    #define HEATER_6_UNIFORM_SHIFT 0
+  #endif
+  #if UTT_HAS(THERMISTOR_HEATER_7)
+    #define HEATER_7_UNIFORM_TABLE UTT_NAME(THERMISTOR_HEATER_7)
+    #define HEATER_7_UNIFORM_SHIFT UTT_SHIFT(THERMISTOR_HEATER_7)
+  #else
+    #define HEATER_7_UNIFORM_TABLE nullptr
+    #define HEATER_7_UNIFORM_SHIFT 0
+  #endif
+  #if UTT_HAS(THERMISTORBED)
+    #define BED_UNIFORM_TABLE UTT_NAME(THERMISTORBED)
+    #define BED_UNIFORM_SHIFT UTT_SHIFT(THERMISTORBED)
+  #endif
+  #if UTT_HAS(THERMISTORCHAMBER)
+    #define CHAMBER_UNIFORM_TABLE UTT_NAME(THERMISTORCHAMBER)
+    #define CHAMBER_UNIFORM_SHIFT UTT_SHIFT(THERMISTORCHAMBER)
+  #endif
+  #if UTT_HAS(THERMISTORPROBE)
+    #define PROBE_UNIFORM_TABLE UTT_NAME(THERMISTORPROBE)
+    #define PROBE_UNIFORM_SHIFT UTT_SHIFT(THERMISTORPROBE)
+  #endif
+
+#endif // THERMISTOR_UNIFORM_TABLES
+
 // Set the high and low raw values for the heaters
 // For thermistors the highest temperature results in the lowest ADC value
 // For thermocouples the highest temperature results in the highest ADC value
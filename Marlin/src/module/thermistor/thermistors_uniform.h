@@ -0,0 +1,2961 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+//
+// Uniform thermistor tables, generated from the thermistor_*.h tables by
+// buildroot/share/scripts/createTemperatureLookupMarlin.py --uniform --tolerance=0.25
+//
+// uniform_temptable_N[i] is the temperature in 1/16 degC at ADC count (i << SHIFT)
+// above the first entry of temptable_N. Readings outside temptable_N are clamped.
+// Regenerate this file after changing a table.
+//
+
+#if ANY_THERMISTOR_IS(1)
+  #define HAS_UNIFORM_TEMPTABLE_1 1
+  #define UNIFORM_TEMPTABLE_1_SHIFT 0 // max error 0.06 degC
+  const int16_t uniform_temptable_1[] PROGMEM = {
+     4800,  4760,  4720,  4680,  4640,  4560,  4533,  4507,  4480,  4440,  4400,  4360,
+     4320,  4293,  4267,  4240,  4213,  4187,  4160,  4133,  4107,  4080,  4060,  4040,
+     4020,  4000,  3980,  3960,  3940,  3920,  3900,  3880,  3860,  3840,  3824,  3808,
+     3792,  3776,  3760,  3744,  3728,  3712,  3696,  3680,  3664,  3648,  3632,  3616,
+     3600,  3589,  3577,  3566,  3554,  3543,  3531,  3520,  3507,  3493,  3480,  3467,
+     3453,  3440,  3430,  3420,  3410,  3400,  3390,  3380,  3370,  3360,  3350,  3340,
+     3330,  3320,  3310,  3300,  3290,  3280,  3271,  3262,  3253,  3244,  3236,  3227,
+     3218,  3209,  3200,  3193,  3185,  3178,  3171,  3164,  3156,  3149,  3142,  3135,
+     3127,  3120,  3113,  3105,  3098,  3091,  3084,  3076,  3069,  3062,  3055,  3047,
+     3040,  3033,  3027,  3020,  3013,  3007,  3000,  2993,  2987,  2980,  2973,  2967,
+     2960,  2954,  2948,  2942,  2935,  2929,  2923,  2917,  2911,  2905,  2898,  2892,
+     2886,  2880,  2875,  2869,  2864,  2859,  2853,  2848,  2843,  2837,  2832,  2827,
+     2821,  2816,  2811,  2805,  2800,  2795,  2790,  2785,  2780,  2775,  2770,  2765,
+     2760,  2755,  2750,  2745,  2740,  2735,  2730,  2725,  2720,  2716,  2711,  2707,
+     2702,  2698,  2693,  2689,  2684,  2680,  2676,  2671,  2667,  2662,  2658,  2653,
+     2649,  2644,  2640,  2636,  2632,  2627,  2623,  2619,  2615,  2611,  2606,  2602,
+     2598,  2594,  2589,  2585,  2581,  2577,  2573,  2568,  2564,  2560,  2556,  2552,
+     2549,  2545,  2541,  2537,  2533,  2530,  2526,  2522,  2518,  2514,  2510,  2507,
+     2503,  2499,  2495,  2491,  2488,  2484,  2480,  2477,  2473,  2470,  2466,  2463,
+     2459,  2456,  2452,  2449,  2445,  2442,  2438,  2435,  2431,  2428,  2424,  2421,
+     2417,  2414,  2410,  2407,  2403,  2400,  2397,  2394,  2390,  2387,  2384,  2381,
+     2378,  2374,  2371,  2368,  2365,  2362,  2358,  2355,  2352,  2349,  2346,  2342,
+     2339,  2336,  2333,  2330,  2326,  2323,  2320,  2317,  2314,  2311,  2308,  2305,
+     2302,  2299,  2296,  2293,  2290,  2287,  2284,  2281,  2279,  2276,  2273,  2270,
+     2267,  2264,  2261,  2258,  2255,  2252,  2249,  2246,  2243,  2240,  2237,  2234,
+     2231,  2229,  2226,  2223,  2220,  2217,  2214,  2211,  2209,  2206,  2203,  2200,
+     2197,  2194,  2191,  2189,  2186,  2183,  2180,  2177,  2174,  2171,  2169,  2166,
+     2163,  2160,  2157,  2155,  2152,  2150,  2147,  2145,  2142,  2139,  2137,  2134,
+     2132,  2129,  2126,  2124,  2121,  2119,  2116,  2114,  2111,  2108,  2106,  2103,
+     2101,  2098,  2095,  2093,  2090,  2088,  2085,  2083,  2080,  2078,  2075,  2072,
+     2070,  2068,  2065,  2062,  2060,  2058,  2055,  2052,  2050,  2048,  2045,  2042,
+     2040,  2038,  2035,  2032,  2030,  2028,  2025,  2022,  2020,  2018,  2015,  2012,
+     2010,  2008,  2005,  2002,  2000,  1998,  1995,  1993,  1991,  1988,  1986,  1984,
+     1981,  1979,  1976,  1974,  1972,  1969,  1967,  1965,  1962,  1960,  1958,  1955,
+     1953,  1951,  1948,  1946,  1944,  1941,  1939,  1936,  1934,  1932,  1929,  1927,
+     1925,  1922,  1920,  1918,  1915,  1913,  1911,  1909,  1906,  1904,  1902,  1899,
+     1897,  1895,  1893,  1890,  1888,  1886,  1883,  1881,  1879,  1877,  1874,  1872,
+     1870,  1867,  1865,  1863,  1861,  1858,  1856,  1854,  1851,  1849,  1847,  1845,
+     1842,  1840,  1838,  1836,  1833,  1831,  1829,  1827,  1824,  1822,  1820,  1818,
+     1816,  1813,  1811,  1809,  1807,  1804,  1802,  1800,  1798,  1796,  1793,  1791,
+     1789,  1787,  1784,  1782,  1780,  1778,  1776,  1773,  1771,  1769,  1767,  1764,
+     1762,  1760,  1758,  1756,  1754,  1751,  1749,  1747,  1745,  1743,  1741,  1738,
+     1736,  1734,  1732,  1730,  1728,  1725,  1723,  1721,  1719,  1717,  1715,  1712,
+     1710,  1708,  1706,  1704,  1702,  1699,  1697,  1695,  1693,  1691,  1689,  1686,
+     1684,  1682,  1680,  1678,  1676,  1674,  1672,  1669,  1667,  1665,  1663,  1661,
+     1659,  1657,  1655,  1653,  1651,  1648,  1646,  1644,  1642,  1640,  1638,  1636,
+     1634,  1632,  1629,  1627,  1625,  1623,  1621,  1619,  1617,  1615,  1613,  1611,
+     1608,  1606,  1604,  1602,  1600,  1598,  1596,  1594,  1591,  1589,  1587,  1585,
+     1583,  1581,  1578,  1576,  1574,  1572,  1570,  1568,  1565,  1563,  1561,  1559,
+     1557,  1555,  1552,  1550,  1548,  1546,  1544,  1542,  1539,  1537,  1535,  1533,
+     1531,  1529,  1526,  1524,  1522,  1520,  1518,  1516,  1514,  1511,  1509,  1507,
+     1505,  1503,  1501,  1498,  1496,  1494,  1492,  1490,  1488,  1485,  1483,  1481,
+     1479,  1477,  1475,  1472,  1470,  1468,  1466,  1464,  1462,  1459,  1457,  1455,
+     1453,  1451,  1449,  1446,  1444,  1442,  1440,  1438,  1436,  1434,  1431,  1429,
+     1427,  1425,  1423,  1421,  1418,  1416,  1414,  1412,  1410,  1408,  1405,  1403,
+     1401,  1399,  1397,  1395,  1392,  1390,  1388,  1386,  1384,  1382,  1379,  1377,
+     1375,  1373,  1371,  1369,  1366,  1364,  1362,  1360,  1358,  1355,  1353,  1351,
+     1349,  1346,  1344,  1342,  1339,  1337,  1335,  1333,  1330,  1328,  1326,  1323,
+     1321,  1319,  1317,  1314,  1312,  1310,  1307,  1305,  1303,  1301,  1298,  1296,
+     1294,  1291,  1289,  1287,  1285,  1282,  1280,  1278,  1275,  1273,  1270,  1268,
+     1265,  1263,  1261,  1258,  1256,  1253,  1251,  1248,  1246,  1244,  1241,  1239,
+     1236,  1234,  1232,  1229,  1227,  1224,  1222,  1219,  1217,  1215,  1212,  1210,
+     1207,  1205,  1202,  1200,  1197,  1195,  1192,  1190,  1187,  1185,  1182,  1179,
+     1177,  1174,  1172,  1169,  1166,  1164,  1161,  1159,  1156,  1154,  1151,  1148,
+     1146,  1143,  1141,  1138,  1135,  1133,  1130,  1128,  1125,  1123,  1120,  1117,
+     1114,  1112,  1109,  1106,  1103,  1101,  1098,  1095,  1092,  1090,  1087,  1084,
+     1081,  1079,  1076,  1073,  1070,  1068,  1065,  1062,  1059,  1057,  1054,  1051,
+     1048,  1046,  1043,  1040,  1037,  1034,  1031,  1028,  1025,  1022,  1019,  1016,
+     1013,  1010,  1007,  1004,  1001,   999,   996,   993,   990,   987,   984,   981,
+      978,   975,   972,   969,   966,   963,   960,   957,   953,   950,   947,   943,
+      940,   937,   933,   930,   927,   923,   920,   917,   913,   910,   907,   903,
+      900,   897,   893,   890,   887,   883,   880,   876,   873,   869,   865,   862,
+      858,   855,   851,   847,   844,   840,   836,   833,   829,   825,   822,   818,
+      815,   811,   807,   804,   800,   796,   792,   787,   783,   779,   775,   771,
+      766,   762,   758,   754,   749,   745,   741,   737,   733,   728,   724,   720,
+      715,   711,   706,   701,   696,   692,   687,   682,   678,   673,   668,   664,
+      659,   654,   649,   645,   640,   635,   629,   624,   619,   613,   608,   603,
+      597,   592,   587,   581,   576,   571,   565,   560,   553,   547,   540,   533,
+      527,   520,   513,   507,   500,   493,   487,   480,   473,   465,   458,   451,
+      444,   436,   429,   422,   415,   407,   400,   390,   380,   370,   360,   350,
+      340,   330,   320,   310,   300,   290,   280,   270,   260,   250,   240,   227,
+      213,   200,   187,   173,   160,   144,   128,   112,    96,    80,    60,    40,
+       20,     0,   -20,   -40,   -60,   -80,  -100,  -120,  -140,  -160,  -180,  -200,
+     -220,  -240,  -240
+  };
+#endif
+
+#if ANY_THERMISTOR_IS(2)
+  #define HAS_UNIFORM_TEMPTABLE_2 1
+  #define UNIFORM_TEMPTABLE_2_SHIFT 0 // max error 0.06 degC
+  const int16_t uniform_temptable_2[] PROGMEM = {
+    13568, 13266, 12963, 12661, 12359, 12056, 11754, 11452, 11149, 10847, 10545, 10242,
+     9940,  9638,  9335,  9033,  8730,  8428,  8126,  7823,  7521,  7219,  6916,  6614,
+     6312,  6009,  5707,  5405,  5102,  4800,  4760,  4720,  4680,  4640,  4608,  4576,
+     4544,  4512,  4480,  4457,  4434,  4411,  4389,  4366,  4343,  4320,  4297,  4274,
+     4251,  4229,  4206,  4183,  4160,  4144,  4128,  4112,  4096,  4080,  4064,  4048,
+     4032,  4016,  4000,  3985,  3971,  3956,  3942,  3927,  3913,  3898,  3884,  3869,
+     3855,  3840,  3828,  3815,  3803,  3791,  3778,  3766,  3754,  3742,  3729,  3717,
+     3705,  3692,  3680,  3671,  3661,  3652,  3642,  3633,  3624,  3614,  3605,  3595,
+     3586,  3576,  3567,  3558,  3548,  3539,  3529,  3520,  3512,  3504,  3496,  3488,
+     3480,  3472,  3464,  3456,  3448,  3440,  3432,  3424,  3416,  3408,  3400,  3392,
+     3384,  3376,  3368,  3360,  3353,  3347,  3340,  3333,  3327,  3320,  3313,  3307,
+     3300,  3293,  3287,  3280,  3273,  3267,  3260,  3253,  3247,  3240,  3233,  3227,
+     3220,  3213,  3207,  3200,  3194,  3189,  3183,  3177,  3171,  3166,  3160,  3154,
+     3149,  3143,  3137,  3131,  3126,  3120,  3114,  3109,  3103,  3097,  3091,  3086,
+     3080,  3074,  3069,  3063,  3057,  3051,  3046,  3040,  3035,  3031,  3026,  3022,
+     3017,  3013,  3008,  3003,  2999,  2994,  2990,  2985,  2981,  2976,  2971,  2967,
+     2962,  2958,  2953,  2949,  2944,  2939,  2935,  2930,  2926,  2921,  2917,  2912,
+     2907,  2903,  2898,  2894,  2889,  2885,  2880,  2876,  2872,  2868,  2864,  2860,
+     2857,  2853,  2849,  2845,  2841,  2837,  2833,  2829,  2825,  2821,  2818,  2814,
+     2810,  2806,  2802,  2798,  2794,  2790,  2786,  2782,  2779,  2775,  2771,  2767,
+     2763,  2759,  2755,  2751,  2747,  2743,  2740,  2736,  2732,  2728,  2724,  2720,
+     2717,  2713,  2710,  2707,  2704,  2700,  2697,  2694,  2691,  2687,  2684,  2681,
+     2678,  2674,  2671,  2668,  2664,  2661,  2658,  2655,  2651,  2648,  2645,  2642,
+     2638,  2635,  2632,  2629,  2625,  2622,  2619,  2616,  2612,  2609,  2606,  2602,
+     2599,  2596,  2593,  2589,  2586,  2583,  2580,  2576,  2573,  2570,  2567,  2563,
+     2560,  2557,  2554,  2551,  2549,  2546,  2543,  2540,  2537,  2534,  2531,  2529,
+     2526,  2523,  2520,  2517,  2514,  2511,  2509,  2506,  2503,  2500,  2497,  2494,
+     2491,  2489,  2486,  2483,  2480,  2477,  2474,  2471,  2469,  2466,  2463,  2460,
+     2457,  2454,  2451,  2449,  2446,  2443,  2440,  2437,  2434,  2431,  2429,  2426,
+     2423,  2420,  2417,  2414,  2411,  2409,  2406,  2403,  2400,  2397,  2395,  2392,
+     2390,  2387,  2385,  2382,  2380,  2377,  2375,  2372,  2370,  2367,  2364,  2362,
+     2359,  2357,  2354,  2352,  2349,  2347,  2344,  2342,  2339,  2337,  2334,  2331,
+     2329,  2326,  2324,  2321,  2319,  2316,  2314,  2311,  2309,  2306,  2303,  2301,
+     2298,  2296,  2293,  2291,  2288,  2286,  2283,  2281,  2278,  2276,  2273,  2270,
+     2268,  2265,  2263,  2260,  2258,  2255,  2253,  2250,  2248,  2245,  2243,  2240,
+     2238,  2235,  2233,  2231,  2228,  2226,  2224,  2221,  2219,  2217,  2214,  2212,
+     2210,  2208,  2205,  2203,  2201,  2198,  2196,  2194,  2191,  2189,  2187,  2184,
+     2182,  2180,  2177,  2175,  2173,  2170,  2168,  2166,  2163,  2161,  2159,  2157,
+     2154,  2152,  2150,  2147,  2145,  2143,  2140,  2138,  2136,  2133,  2131,  2129,
+     2126,  2124,  2122,  2119,  2117,  2115,  2112,  2110,  2108,  2106,  2103,  2101,
+     2099,  2096,  2094,  2092,  2089,  2087,  2085,  2082,  2080,  2078,  2076,  2073,
+     2071,  2069,  2067,  2065,  2062,  2060,  2058,  2056,  2054,  2052,  2049,  2047,
+     2045,  2043,  2041,  2038,  2036,  2034,  2032,  2030,  2027,  2025,  2023,  2021,
+     2019,  2016,  2014,  2012,  2010,  2008,  2005,  2003,  2001,  1999,  1997,  1995,
+     1992,  1990,  1988,  1986,  1984,  1981,  1979,  1977,  1975,  1973,  1970,  1968,
+     1966,  1964,  1962,  1959,  1957,  1955,  1953,  1951,  1948,  1946,  1944,  1942,
+     1940,  1938,  1935,  1933,  1931,  1929,  1927,  1924,  1922,  1920,  1918,  1916,
+     1914,  1911,  1909,  1907,  1905,  1903,  1901,  1898,  1896,  1894,  1892,  1890,
+     1888,  1885,  1883,  1881,  1879,  1877,  1875,  1872,  1870,  1868,  1866,  1864,
+     1862,  1859,  1857,  1855,  1853,  1851,  1849,  1846,  1844,  1842,  1840,  1838,
+     1836,  1834,  1831,  1829,  1827,  1825,  1823,  1821,  1818,  1816,  1814,  1812,
+     1810,  1808,  1805,  1803,  1801,  1799,  1797,  1795,  1792,  1790,  1788,  1786,
+     1784,  1782,  1779,  1777,  1775,  1773,  1771,  1769,  1766,  1764,  1762,  1760,
+     1758,  1756,  1753,  1751,  1749,  1747,  1744,  1742,  1740,  1738,  1736,  1733,
+     1731,  1729,  1727,  1724,  1722,  1720,  1718,  1716,  1713,  1711,  1709,  1707,
+     1704,  1702,  1700,  1698,  1696,  1693,  1691,  1689,  1687,  1684,  1682,  1680,
+     1678,  1676,  1673,  1671,  1669,  1667,  1664,  1662,  1660,  1658,  1656,  1653,
+     1651,  1649,  1647,  1644,  1642,  1640,  1638,  1636,  1633,  1631,  1629,  1627,
+     1624,  1622,  1620,  1618,  1616,  1613,  1611,  1609,  1607,  1604,  1602,  1600,
+     1598,  1595,  1593,  1590,  1588,  1586,  1583,  1581,  1579,  1576,  1574,  1571,
+     1569,  1567,  1564,  1562,  1559,  1557,  1555,  1552,  1550,  1547,  1545,  1543,
+     1540,  1538,  1536,  1533,  1531,  1528,  1526,  1524,  1521,  1519,  1516,  1514,
+     1512,  1509,  1507,  1504,  1502,  1500,  1497,  1495,  1493,  1490,  1488,  1485,
+     1483,  1481,  1478,  1476,  1473,  1471,  1469,  1466,  1464,  1461,  1459,  1457,
+     1454,  1452,  1450,  1447,  1445,  1442,  1440,  1437,  1435,  1432,  1429,  1427,
+     1424,  1421,  1419,  1416,  1413,  1411,  1408,  1405,  1403,  1400,  1397,  1395,
+     1392,  1389,  1387,  1384,  1381,  1379,  1376,  1373,  1371,  1368,  1365,  1363,
+     1360,  1357,  1355,  1352,  1349,  1347,  1344,  1341,  1339,  1336,  1333,  1331,
+     1328,  1325,  1323,  1320,  1317,  1315,  1312,  1309,  1307,  1304,  1301,  1299,
+     1296,  1293,  1291,  1288,  1285,  1283,  1280,  1277,  1273,  1270,  1267,  1264,
+     1260,  1257,  1254,  1251,  1247,  1244,  1241,  1238,  1234,  1231,  1228,  1224,
+     1221,  1218,  1215,  1211,  1208,  1205,  1202,  1198,  1195,  1192,  1189,  1185,
+     1182,  1179,  1176,  1172,  1169,  1166,  1162,  1159,  1156,  1153,  1149,  1146,
+     1143,  1140,  1136,  1133,  1130,  1127,  1123,  1120,  1116,  1112,  1108,  1104,
+     1100,  1096,  1092,  1088,  1084,  1080,  1076,  1072,  1068,  1064,  1060,  1056,
+     1052,  1048,  1044,  1040,  1036,  1032,  1028,  1024,  1020,  1016,  1012,  1008,
+     1004,  1000,   996,   992,   988,   984,   980,   976,   972,   968,   964,   960,
+      955,   950,   945,   939,   934,   929,   924,   919,   914,   908,   903,   898,
+      893,   888,   883,   877,   872,   867,   862,   857,   852,   846,   841,   836,
+      831,   826,   821,   815,   810,   805,   800,   793,   785,   778,   771,   764,
+      756,   749,   742,   735,   727,   720,   713,   705,   698,   691,   684,   676,
+      669,   662,   655,   647,   640,   630,   620,   610,   600,   590,   580,   570,
+      560,   550,   540,   530,   520,   510,   500,   490,   480,   465,   451,   436,
+      422,   407,   393,   378,   364,   349,   335,   320,   300,   280,   260,   240,
+      220,   200,   180,   160,   120,    80,    40,     0,     0
+  };
+#endif
+
+#if ANY_THERMISTOR_IS(3)
+  #define HAS_UNIFORM_TEMPTABLE_3 1
+  #define UNIFORM_TEMPTABLE_3_SHIFT 0 // max error 0.06 degC
+  const int16_t uniform_temptable_3[] PROGMEM = {
+    13824, 13373, 12922, 12470, 12019, 11568, 11117, 10666, 10214,  9763,  9312,  8861,
+     8410,  7958,  7507,  7056,  6605,  6154,  5702,  5251,  4800,  4760,  4720,  4680,
+     4640,  4600,  4560,  4520,  4480,  4440,  4400,  4360,  4320,  4293,  4267,  4240,
+     4213,  4187,  4160,  4137,  4114,  4091,  4069,  4046,  4023,  4000,  3980,  3960,
+     3940,  3920,  3900,  3880,  3860,  3840,  3824,  3808,  3792,  3776,  3760,  3744,
+     3728,  3712,  3696,  3680,  3665,  3651,  3636,  3622,  3607,  3593,  3578,  3564,
+     3549,  3535,  3520,  3509,  3499,  3488,  3477,  3467,  3456,  3445,  3435,  3424,
+     3413,  3403,  3392,  3381,  3371,  3360,  3351,  3341,  3332,  3322,  3313,  3304,
+     3294,  3285,  3275,  3266,  3256,  3247,  3238,  3228,  3219,  3209,  3200,  3192,
+     3185,  3177,  3170,  3162,  3154,  3147,  3139,  3131,  3124,  3116,  3109,  3101,
+     3093,  3086,  3078,  3070,  3063,  3055,  3048,  3040,  3034,  3028,  3022,  3015,
+     3009,  3003,  2997,  2991,  2985,  2978,  2972,  2966,  2960,  2954,  2948,  2942,
+     2935,  2929,  2923,  2917,  2911,  2905,  2898,  2892,  2886,  2880,  2875,  2869,
+     2864,  2859,  2853,  2848,  2843,  2837,  2832,  2827,  2821,  2816,  2811,  2805,
+     2800,  2795,  2789,  2784,  2779,  2773,  2768,  2763,  2757,  2752,  2747,  2741,
+     2736,  2731,  2725,  2720,  2716,  2711,  2707,  2703,  2698,  2694,  2690,  2685,
+     2681,  2677,  2672,  2668,  2664,  2659,  2655,  2651,  2646,  2642,  2638,  2634,
+     2629,  2625,  2621,  2616,  2612,  2608,  2603,  2599,  2595,  2590,  2586,  2582,
+     2577,  2573,  2569,  2564,  2560,  2556,  2553,  2549,  2545,  2542,  2538,  2535,
+     2531,  2527,  2524,  2520,  2516,  2513,  2509,  2505,  2502,  2498,  2495,  2491,
+     2487,  2484,  2480,  2476,  2473,  2469,  2465,  2462,  2458,  2455,  2451,  2447,
+     2444,  2440,  2436,  2433,  2429,  2425,  2422,  2418,  2415,  2411,  2407,  2404,
+     2400,  2397,  2394,  2391,  2387,  2384,  2381,  2378,  2375,  2372,  2369,  2365,
+     2362,  2359,  2356,  2353,  2350,  2347,  2344,  2340,  2337,  2334,  2331,  2328,
+     2325,  2322,  2318,  2315,  2312,  2309,  2306,  2303,  2300,  2296,  2293,  2290,
+     2287,  2284,  2281,  2278,  2275,  2271,  2268,  2265,  2262,  2259,  2256,  2253,
+     2249,  2246,  2243,  2240,  2237,  2235,  2232,  2229,  2226,  2224,  2221,  2218,
+     2216,  2213,  2210,  2207,  2205,  2202,  2199,  2197,  2194,  2191,  2188,  2186,
+     2183,  2180,  2178,  2175,  2172,  2169,  2167,  2164,  2161,  2159,  2156,  2153,
+     2151,  2148,  2145,  2142,  2140,  2137,  2134,  2132,  2129,  2126,  2123,  2121,
+     2118,  2115,  2113,  2110,  2107,  2104,  2102,  2099,  2096,  2094,  2091,  2088,
+     2085,  2083,  2080,  2078,  2075,  2073,  2070,  2068,  2065,  2063,  2061,  2058,
+     2056,  2053,  2051,  2048,  2046,  2044,  2041,  2039,  2036,  2034,  2032,  2029,
+     2027,  2024,  2022,  2019,  2017,  2015,  2012,  2010,  2007,  2005,  2002,  2000,
+     1998,  1995,  1993,  1990,  1988,  1985,  1983,  1981,  1978,  1976,  1973,  1971,
+     1968,  1966,  1964,  1961,  1959,  1956,  1954,  1952,  1949,  1947,  1944,  1942,
+     1939,  1937,  1935,  1932,  1930,  1927,  1925,  1922,  1920,  1918,  1916,  1913,
+     1911,  1909,  1907,  1904,  1902,  1900,  1898,  1896,  1893,  1891,  1889,  1887,
+     1884,  1882,  1880,  1878,  1876,  1873,  1871,  1869,  1867,  1864,  1862,  1860,
+     1858,  1856,  1853,  1851,  1849,  1847,  1844,  1842,  1840,  1838,  1836,  1833,
+     1831,  1829,  1827,  1824,  1822,  1820,  1818,  1816,  1813,  1811,  1809,  1807,
+     1804,  1802,  1800,  1798,  1796,  1793,  1791,  1789,  1787,  1784,  1782,  1780,
+     1778,  1776,  1773,  1771,  1769,  1767,  1764,  1762,  1760,  1758,  1756,  1754,
+     1751,  1749,  1747,  1745,  1743,  1741,  1739,  1737,  1734,  1732,  1730,  1728,
+     1726,  1724,  1722,  1719,  1717,  1715,  1713,  1711,  1709,  1707,  1705,  1702,
+     1700,  1698,  1696,  1694,  1692,  1690,  1687,  1685,  1683,  1681,  1679,  1677,
+     1675,  1673,  1670,  1668,  1666,  1664,  1662,  1660,  1658,  1655,  1653,  1651,
+     1649,  1647,  1645,  1643,  1641,  1638,  1636,  1634,  1632,  1630,  1628,  1626,
+     1623,  1621,  1619,  1617,  1615,  1613,  1611,  1609,  1606,  1604,  1602,  1600,
+     1598,  1596,  1593,  1591,  1589,  1587,  1585,  1582,  1580,  1578,  1576,  1574,
+     1572,  1569,  1567,  1565,  1563,  1561,  1558,  1556,  1554,  1552,  1550,  1547,
+     1545,  1543,  1541,  1539,  1536,  1534,  1532,  1530,  1528,  1525,  1523,  1521,
+     1519,  1517,  1515,  1512,  1510,  1508,  1506,  1504,  1501,  1499,  1497,  1495,
+     1493,  1490,  1488,  1486,  1484,  1482,  1479,  1477,  1475,  1473,  1471,  1468,
+     1466,  1464,  1462,  1460,  1458,  1455,  1453,  1451,  1449,  1447,  1444,  1442,
+     1440,  1438,  1436,  1433,  1431,  1429,  1427,  1425,  1422,  1420,  1418,  1416,
+     1414,  1412,  1409,  1407,  1405,  1403,  1401,  1398,  1396,  1394,  1392,  1390,
+     1387,  1385,  1383,  1381,  1379,  1376,  1374,  1372,  1370,  1368,  1365,  1363,
+     1361,  1359,  1357,  1355,  1352,  1350,  1348,  1346,  1344,  1341,  1339,  1337,
+     1335,  1333,  1330,  1328,  1326,  1324,  1322,  1319,  1317,  1315,  1313,  1311,
+     1308,  1306,  1304,  1302,  1300,  1298,  1295,  1293,  1291,  1289,  1287,  1284,
+     1282,  1280,  1277,  1275,  1272,  1270,  1267,  1264,  1262,  1259,  1256,  1254,
+     1251,  1249,  1246,  1243,  1241,  1238,  1235,  1233,  1230,  1228,  1225,  1222,
+     1220,  1217,  1214,  1212,  1209,  1207,  1204,  1201,  1199,  1196,  1193,  1191,
+     1188,  1186,  1183,  1180,  1178,  1175,  1172,  1170,  1167,  1165,  1162,  1159,
+     1157,  1154,  1151,  1149,  1146,  1144,  1141,  1138,  1136,  1133,  1130,  1128,
+     1125,  1123,  1120,  1117,  1115,  1112,  1110,  1107,  1104,  1102,  1099,  1096,
+     1094,  1091,  1089,  1086,  1083,  1081,  1078,  1075,  1073,  1070,  1068,  1065,
+     1062,  1060,  1057,  1054,  1052,  1049,  1047,  1044,  1041,  1039,  1036,  1033,
+     1031,  1028,  1026,  1023,  1020,  1018,  1015,  1012,  1010,  1007,  1005,  1002,
+      999,   997,   994,   991,   989,   986,   984,   981,   978,   976,   973,   970,
+      968,   965,   963,   960,   956,   952,   948,   944,   940,   937,   933,   929,
+      925,   921,   917,   913,   909,   905,   901,   898,   894,   890,   886,   882,
+      878,   874,   870,   866,   862,   859,   855,   851,   847,   843,   839,   835,
+      831,   827,   823,   820,   816,   812,   808,   804,   800,   796,   792,   788,
+      784,   780,   777,   773,   769,   765,   761,   757,   753,   749,   745,   741,
+      738,   734,   730,   726,   722,   718,   714,   710,   706,   702,   699,   695,
+      691,   687,   683,   679,   675,   671,   667,   663,   660,   656,   652,   648,
+      644,   640,   633,   627,   620,   613,   607,   600,   593,   587,   580,   573,
+      567,   560,   553,   547,   540,   533,   527,   520,   513,   507,   500,   493,
+      487,   480,   473,   467,   460,   453,   447,   440,   433,   427,   420,   413,
+      407,   400,   393,   387,   380,   373,   367,   360,   353,   347,   340,   333,
+      327,   320,   305,   291,   276,   262,   247,   233,   218,   204,   189,   175,
+      160,   145,   131,   116,   102,    87,    73,    58,    44,    29,    15,     0,
+      -32,   -64,   -96,  -128,  -160,  -192,  -224,  -256,  -288,  -320,  -320
+  };
+#endif
+
+#if ANY_THERMISTOR_IS(4)
+  #define HAS_UNIFORM_TEMPTABLE_4 1
+  #define UNIFORM_TEMPTABLE_4_SHIFT 0 // max error 0.06 degC
+  const int16_t uniform_temptable_4[] PROGMEM = {
+     6880,  6792,  6703,  6615,  6526,  6438,  6349,  6261,  6172,  6084,  5995,  5907,
+     5819,  5730,  5642,  5553,  5465,  5376,  5288,  5199,  5111,  5022,  4934,  4846,
+     4757,  4669,  4580,  4492,  4403,  4315,  4226,  4138,  4050,  3961,  3873,  3784,
+     3696,  3607,  3519,  3430,  3342,  3253,  3165,  3077,  2988,  2900,  2811,  2723,
+     2634,  2546,  2457,  2369,  2280,  2192,  2183,  2174,  2165,  2156,  2147,  2138,
+     2129,  2120,  2110,  2101,  2092,  2083,  2074,  2065,  2056,  2047,  2038,  2029,
+     2020,  2011,  2002,  1993,  1984,  1975,  1966,  1957,  1947,  1938,  1929,  1920,
+     1911,  1902,  1893,  1884,  1875,  1866,  1857,  1848,  1839,  1830,  1821,  1812,
+     1803,  1794,  1784,  1775,  1766,  1757,  1748,  1739,  1730,  1721,  1712,  1707,
+     1702,  1698,  1693,  1688,  1683,  1678,  1673,  1669,  1664,  1659,  1654,  1649,
+     1644,  1640,  1635,  1630,  1625,  1620,  1615,  1611,  1606,  1601,  1596,  1591,
+     1586,  1582,  1577,  1572,  1567,  1562,  1557,  1553,  1548,  1543,  1538,  1533,
+     1528,  1524,  1519,  1514,  1509,  1504,  1499,  1495,  1490,  1485,  1480,  1475,
+     1470,  1466,  1461,  1456,  1453,  1449,  1446,  1443,  1439,  1436,  1433,  1429,
+     1426,  1423,  1419,  1416,  1413,  1410,  1406,  1403,  1400,  1396,  1393,  1390,
+     1386,  1383,  1380,  1376,  1373,  1370,  1366,  1363,  1360,  1356,  1353,  1350,
+     1346,  1343,  1340,  1336,  1333,  1330,  1326,  1323,  1320,  1317,  1313,  1310,
+     1307,  1303,  1300,  1297,  1293,  1290,  1287,  1283,  1280,  1277,  1275,  1272,
+     1269,  1266,  1264,  1261,  1258,  1256,  1253,  1250,  1247,  1245,  1242,  1239,
+     1237,  1234,  1231,  1228,  1226,  1223,  1220,  1218,  1215,  1212,  1209,  1207,
+     1204,  1201,  1198,  1196,  1193,  1190,  1188,  1185,  1182,  1179,  1177,  1174,
+     1171,  1169,  1166,  1163,  1160,  1158,  1155,  1152,  1150,  1147,  1144,  1141,
+     1139,  1136,  1134,  1132,  1130,  1128,  1125,  1123,  1121,  1119,  1117,  1115,
+     1113,  1111,  1109,  1106,  1104,  1102,  1100,  1098,  1096,  1094,  1092,  1090,
+     1087,  1085,  1083,  1081,  1079,  1077,  1075,  1073,  1070,  1068,  1066,  1064,
+     1062,  1060,  1058,  1056,  1054,  1051,  1049,  1047,  1045,  1043,  1041,  1039,
+     1037,  1035,  1032,  1030,  1028,  1026,  1024,  1022,  1020,  1018,  1016,  1013,
+     1011,  1009,  1007,  1005,  1003,  1001,   999,   997,   994,   992,   990,   988,
+      986,   984,   982,   980,   978,   975,   973,   971,   969,   967,   965,   963,
+      961,   958,   956,   954,   952,   950,   948,   946,   944,   942,   939,   937,
+      935,   933,   931,   929,   927,   925,   923,   920,   918,   916,   914,   912,
+      910,   908,   907,   905,   903,   901,   899,   898,   896,   894,   892,   890,
+      888,   887,   885,   883,   881,   879,   878,   876,   874,   872,   870,   869,
+      867,   865,   863,   861,   859,   858,   856,   854,   852,   850,   849,   847,
+      845,   843,   841,   840,   838,   836,   834,   832,   830,   829,   827,   825,
+      823,   821,   820,   818,   816,   814,   813,   811,   810,   808,   807,   805,
+      804,   802,   801,   799,   798,   796,   795,   793,   792,   790,   789,   787,
+      786,   784,   783,   781,   780,   778,   777,   775,   774,   772,   771,   769,
+      768,   766,   765,   763,   762,   760,   759,   757,   756,   754,   753,   751,
+      750,   748,   747,   745,   744,   742,   741,   739,   738,   736,   734,   733,
+      731,   730,   728,   727,   725,   724,   722,   721,   719,   718,   716,   715,
+      713,   712,   710,   709,   707,   706,   704,   703,   701,   700,   698,   697,
+      695,   694,   692,   691,   689,   688,   686,   685,   683,   682,   680,   679,
+      677,   676,   674,   673,   671,   670,   668,   667,   665,   664,   662,   661,
+      659,   658,   656,   654,   652,   651,   649,   647,   645,   643,   642,   640,
+      638,   636,   634,   632,   631,   629,   627,   625,   623,   622,   620,   618,
+      616,   614,   613,   611,   609,   607,   605,   603,   602,   600,   598,   596,
+      594,   593,   591,   589,   587,   585,   584,   582,   580,   578,   576,   574,
+      573,   571,   569,   567,   565,   564,   562,   560,   558,   557,   555,   554,
+      552,   551,   549,   548,   546,   545,   543,   542,   540,   539,   537,   536,
+      534,   533,   531,   530,   528,   527,   525,   524,   522,   521,   519,   518,
+      516,   515,   513,   512,   510,   509,   507,   506,   504,   503,   501,   500,
+      498,   497,   495,   494,   492,   491,   489,   488,   486,   485,   483,   482,
+      480,   478,   477,   475,   474,   472,   471,   469,   468,   466,   465,   463,
+      462,   460,   459,   457,   456,   454,   453,   451,   450,   448,   447,   445,
+      444,   442,   441,   439,   438,   436,   435,   433,   432,   430,   429,   427,
+      426,   424,   423,   421,   420,   418,   417,   415,   414,   412,   411,   409,
+      408,   406,   405,   403,   402,   400,   398,   397,   395,   394,   392,   391,
+      389,   388,   386,   385,   383,   382,   380,   379,   377,   376,   374,   373,
+      371,   370,   368,   367,   365,   364,   362,   361,   359,   358,   356,   355,
+      353,   352,   350,   349,   347,   346,   344,   343,   341,   340,   338,   337,
+      335,   334,   332,   331,   329,   328,   326,   325,   323,   322,   320,   318,
+      316,   315,   313,   311,   309,   307,   306,   304,   302,   300,   298,   296,
+      295,   293,   291,   289,   287,   286,   284,   282,   280,   278,   277,   275,
+      273,   271,   269,   267,   266,   264,   262,   260,   258,   257,   255,   253,
+      251,   249,   248,   246,   244,   242,   240,   238,   237,   235,   233,   231,
+      229,   228,   226,   224,   222,   220,   218,   216,   213,   211,   209,   207,
+      205,   203,   201,   199,   197,   194,   192,   190,   188,   186,   184,   182,
+      180,   178,   175,   173,   171,   169,   167,   165,   163,   161,   158,   156,
+      154,   152,   150,   148,   146,   144,   142,   139,   137,   135,   133,   131,
+      129,   127,   125,   123,   120,   118,   116,   114,   112,   110,   108,   106,
+      104,   101,    99,    97,    95,    93,    91,    89,    87,    85,    82,    80,
+       78,    76,    74,    72,    70,    68,    66,    63,    61,    59,    57,    55,
+       53,    51,    49,    46,    44,    42,    40,    38,    36,    34,    32,    30,
+       27,    25,    23,    21,    19,    17,    15,    13,    11,     8,     6,     4,
+        2,     0,    -3,    -7,   -10,   -13,   -17,   -20,   -23,   -27,   -30,   -33,
+      -37,   -40,   -43,   -46,   -50,   -53,   -56,   -60,   -63,   -66,   -70,   -73,
+      -76,   -80,   -83,   -86,   -90,   -93,   -96,  -100,  -103,  -106,  -110,  -113,
+     -116,  -120,  -123,  -126,  -130,  -133,  -136,  -139,  -143,  -146,  -149,  -153,
+     -156,  -159,  -163,  -166,  -169,  -173,  -176,  -183,  -190,  -198,  -205,  -212,
+     -219,  -227,  -234,  -241,  -248,  -256,  -263,  -270,  -277,  -285,  -292,  -299,
+     -306,  -314,  -321,  -328,  -335,  -343,  -350,  -357,  -364,  -372,  -379,  -386,
+     -393,  -401,  -408,  -415,  -422,  -430,  -437,  -444,  -451,  -459,  -466,  -473,
+     -480,  -488,  -495,  -502,  -509,  -517,  -524,  -531,  -538,  -546,  -553,  -560,
+     -560
+  };
+#endif
+
+#if ANY_THERMISTOR_IS(5)
+  #define HAS_UNIFORM_TEMPTABLE_5 1
+  #define UNIFORM_TEMPTABLE_5_SHIFT 0 // max error 0.06 degC
+  const int16_t uniform_temptable_5[] PROGMEM = {
+    11408, 10995, 10582, 10169,  9756,  9343,  8930,  8517,  8104,  7691,  7278,  6865,
+     6452,  6039,  5626,  5213,  4800,  4747,  4693,  4640,  4587,  4533,  4480,  4440,
+     4400,  4360,  4320,  4280,  4240,  4200,  4160,  4133,  4107,  4080,  4053,  4027,
+     4000,  3973,  3947,  3920,  3893,  3867,  3840,  3820,  3800,  3780,  3760,  3740,
+     3720,  3700,  3680,  3664,  3648,  3632,  3616,  3600,  3584,  3568,  3552,  3536,
+     3520,  3507,  3493,  3480,  3467,  3453,  3440,  3427,  3413,  3400,  3387,  3373,
+     3360,  3349,  3337,  3326,  3314,  3303,  3291,  3280,  3269,  3257,  3246,  3234,
+     3223,  3211,  3200,  3192,  3183,  3175,  3166,  3158,  3149,  3141,  3133,  3124,
+     3116,  3107,  3099,  3091,  3082,  3074,  3065,  3057,  3048,  3040,  3033,  3025,
+     3018,  3011,  3004,  2996,  2989,  2982,  2975,  2967,  2960,  2953,  2945,  2938,
+     2931,  2924,  2916,  2909,  2902,  2895,  2887,  2880,  2874,  2868,  2862,  2856,
+     2850,  2844,  2839,  2833,  2827,  2821,  2815,  2809,  2803,  2797,  2791,  2785,
+     2779,  2773,  2767,  2761,  2756,  2750,  2744,  2738,  2732,  2726,  2720,  2715,
+     2711,  2706,  2701,  2696,  2692,  2687,  2682,  2678,  2673,  2668,  2664,  2659,
+     2654,  2649,  2645,  2640,  2635,  2631,  2626,  2621,  2616,  2612,  2607,  2602,
+     2598,  2593,  2588,  2584,  2579,  2574,  2569,  2565,  2560,  2556,  2552,  2548,
+     2544,  2540,  2537,  2533,  2529,  2525,  2521,  2517,  2513,  2509,  2505,  2501,
+     2498,  2494,  2490,  2486,  2482,  2478,  2474,  2470,  2466,  2462,  2459,  2455,
+     2451,  2447,  2443,  2439,  2435,  2431,  2427,  2423,  2420,  2416,  2412,  2408,
+     2404,  2400,  2397,  2393,  2390,  2387,  2383,  2380,  2377,  2373,  2370,  2367,
+     2363,  2360,  2357,  2353,  2350,  2347,  2343,  2340,  2337,  2333,  2330,  2327,
+     2323,  2320,  2317,  2313,  2310,  2307,  2303,  2300,  2297,  2293,  2290,  2287,
+     2283,  2280,  2277,  2273,  2270,  2267,  2263,  2260,  2257,  2253,  2250,  2247,
+     2243,  2240,  2237,  2234,  2232,  2229,  2226,  2223,  2221,  2218,  2215,  2212,
+     2210,  2207,  2204,  2201,  2199,  2196,  2193,  2190,  2188,  2185,  2182,  2179,
+     2177,  2174,  2171,  2168,  2166,  2163,  2160,  2157,  2154,  2152,  2149,  2146,
+     2143,  2141,  2138,  2135,  2132,  2130,  2127,  2124,  2121,  2119,  2116,  2113,
+     2110,  2108,  2105,  2102,  2099,  2097,  2094,  2091,  2088,  2086,  2083,  2080,
+     2078,  2075,  2073,  2070,  2068,  2065,  2063,  2061,  2058,  2056,  2053,  2051,
+     2048,  2046,  2044,  2041,  2039,  2036,  2034,  2032,  2029,  2027,  2024,  2022,
+     2019,  2017,  2015,  2012,  2010,  2007,  2005,  2002,  2000,  1998,  1995,  1993,
+     1990,  1988,  1985,  1983,  1981,  1978,  1976,  1973,  1971,  1968,  1966,  1964,
+     1961,  1959,  1956,  1954,  1952,  1949,  1947,  1944,  1942,  1939,  1937,  1935,
+     1932,  1930,  1927,  1925,  1922,  1920,  1918,  1916,  1914,  1911,  1909,  1907,
+     1905,  1903,  1901,  1898,  1896,  1894,  1892,  1890,  1888,  1885,  1883,  1881,
+     1879,  1877,  1875,  1872,  1870,  1868,  1866,  1864,  1862,  1859,  1857,  1855,
+     1853,  1851,  1849,  1846,  1844,  1842,  1840,  1838,  1836,  1834,  1831,  1829,
+     1827,  1825,  1823,  1821,  1818,  1816,  1814,  1812,  1810,  1808,  1805,  1803,
+     1801,  1799,  1797,  1795,  1792,  1790,  1788,  1786,  1784,  1782,  1779,  1777,
+     1775,  1773,  1771,  1769,  1766,  1764,  1762,  1760,  1758,  1756,  1754,  1752,
+     1750,  1748,  1746,  1744,  1742,  1739,  1737,  1735,  1733,  1731,  1729,  1727,
+     1725,  1723,  1721,  1719,  1717,  1715,  1713,  1711,  1709,  1707,  1705,  1703,
+     1701,  1698,  1696,  1694,  1692,  1690,  1688,  1686,  1684,  1682,  1680,  1678,
+     1676,  1674,  1672,  1670,  1668,  1666,  1664,  1662,  1659,  1657,  1655,  1653,
+     1651,  1649,  1647,  1645,  1643,  1641,  1639,  1637,  1635,  1633,  1631,  1629,
+     1627,  1625,  1623,  1621,  1618,  1616,  1614,  1612,  1610,  1608,  1606,  1604,
+     1602,  1600,  1598,  1596,  1594,  1592,  1590,  1588,  1586,  1584,  1582,  1580,
+     1578,  1576,  1574,  1572,  1570,  1568,  1566,  1564,  1562,  1560,  1559,  1557,
+     1555,  1553,  1551,  1549,  1547,  1545,  1543,  1541,  1539,  1537,  1535,  1533,
+     1531,  1529,  1527,  1525,  1523,  1521,  1519,  1517,  1515,  1513,  1511,  1509,
+     1507,  1505,  1503,  1501,  1499,  1497,  1495,  1493,  1491,  1489,  1487,  1485,
+     1483,  1481,  1480,  1478,  1476,  1474,  1472,  1470,  1468,  1466,  1464,  1462,
+     1460,  1458,  1456,  1454,  1452,  1450,  1448,  1446,  1444,  1442,  1440,  1438,
+     1436,  1434,  1432,  1430,  1428,  1426,  1424,  1422,  1419,  1417,  1415,  1413,
+     1411,  1409,  1407,  1405,  1403,  1401,  1399,  1397,  1395,  1393,  1391,  1389,
+     1387,  1385,  1383,  1381,  1378,  1376,  1374,  1372,  1370,  1368,  1366,  1364,
+     1362,  1360,  1358,  1356,  1354,  1352,  1350,  1348,  1346,  1344,  1342,  1339,
+     1337,  1335,  1333,  1331,  1329,  1327,  1325,  1323,  1321,  1319,  1317,  1315,
+     1313,  1311,  1309,  1307,  1305,  1303,  1301,  1298,  1296,  1294,  1292,  1290,
+     1288,  1286,  1284,  1282,  1280,  1278,  1275,  1273,  1271,  1269,  1266,  1264,
+     1262,  1260,  1257,  1255,  1253,  1251,  1248,  1246,  1244,  1242,  1239,  1237,
+     1235,  1233,  1230,  1228,  1226,  1224,  1221,  1219,  1217,  1215,  1212,  1210,
+     1208,  1206,  1203,  1201,  1199,  1197,  1194,  1192,  1190,  1188,  1185,  1183,
+     1181,  1179,  1176,  1174,  1172,  1170,  1167,  1165,  1163,  1161,  1158,  1156,
+     1154,  1152,  1149,  1147,  1145,  1143,  1140,  1138,  1136,  1134,  1131,  1129,
+     1127,  1125,  1122,  1120,  1117,  1115,  1112,  1110,  1107,  1105,  1102,  1099,
+     1097,  1094,  1092,  1089,  1086,  1084,  1081,  1079,  1076,  1074,  1071,  1068,
+     1066,  1063,  1061,  1058,  1055,  1053,  1050,  1048,  1045,  1043,  1040,  1037,
+     1035,  1032,  1030,  1027,  1025,  1022,  1019,  1017,  1014,  1012,  1009,  1006,
+     1004,  1001,   999,   996,   994,   991,   988,   986,   983,   981,   978,   975,
+      973,   970,   968,   965,   963,   960,   957,   954,   951,   947,   944,   941,
+      938,   935,   932,   929,   925,   922,   919,   916,   913,   910,   907,   904,
+      900,   897,   894,   891,   888,   885,   882,   878,   875,   872,   869,   866,
+      863,   860,   856,   853,   850,   847,   844,   841,   838,   835,   831,   828,
+      825,   822,   819,   816,   813,   809,   806,   803,   800,   796,   792,   788,
+      784,   780,   776,   772,   768,   764,   760,   756,   752,   748,   744,   740,
+      736,   732,   728,   724,   720,   716,   712,   708,   704,   700,   696,   692,
+      688,   684,   680,   676,   672,   668,   664,   660,   656,   652,   648,   644,
+      640,   634,   629,   623,   618,   612,   607,   601,   596,   590,   585,   579,
+      574,   568,   563,   557,   552,   546,   541,   535,   530,   524,   519,   513,
+      508,   502,   497,   491,   486,   480,   472,   464,   456,   448,   440,   432,
+      424,   416,   408,   400,   392,   384,   376,   368,   360,   352,   344,   336,
+      328,   320,   309,   297,   286,   274,   263,   251,   240,   229,   217,   206,
+      194,   183,   171,   160,   144,   128,   112,    96,    80,    64,    48,    32,
+       16,     0,     0
+  };
+#endif
+
+// temptable_6 is off by 4.70 degC with an entry every ADC count, so it has no uniform table
+
+#if ANY_THERMISTOR_IS(7)
+  #define HAS_UNIFORM_TEMPTABLE_7 1
+  #define UNIFORM_TEMPTABLE_7_SHIFT 1 // max error 0.06 degC
+  const int16_t uniform_temptable_7[] PROGMEM = {
+    15056, 14027, 12997, 11968, 10939,  9909,  8880,  7851,  6821,  5792,  5680,  5568,
+     5456,  5344,  5232,  5120,  5008,  4896,  4784,  4725,  4667,  4608,  4549,  4491,
+     4432,  4373,  4315,  4256,  4219,  4181,  4144,  4107,  4069,  4032,  3995,  3957,
+     3920,  3892,  3863,  3835,  3806,  3778,  3749,  3721,  3692,  3664,  3641,  3618,
+     3595,  3572,  3548,  3525,  3502,  3479,  3456,  3438,  3420,  3403,  3385,  3367,
+     3349,  3332,  3314,  3296,  3280,  3264,  3248,  3232,  3216,  3200,  3184,  3168,
+     3152,  3140,  3127,  3115,  3102,  3090,  3077,  3065,  3052,  3040,  3028,  3015,
+     3003,  2990,  2978,  2965,  2953,  2940,  2928,  2917,  2907,  2896,  2885,  2875,
+     2864,  2853,  2843,  2832,  2821,  2811,  2800,  2789,  2779,  2768,  2757,  2747,
+     2736,  2727,  2718,  2709,  2700,  2692,  2683,  2674,  2665,  2656,  2649,  2642,
+     2635,  2628,  2620,  2613,  2606,  2599,  2592,  2583,  2574,  2565,  2556,  2548,
+     2539,  2530,  2521,  2512,  2505,  2498,  2491,  2484,  2476,  2469,  2462,  2455,
+     2448,  2441,  2434,  2427,  2420,  2412,  2405,  2398,  2391,  2384,  2379,  2373,
+     2368,  2363,  2357,  2352,  2347,  2341,  2336,  2329,  2322,  2315,  2308,  2300,
+     2293,  2286,  2279,  2272,  2267,  2261,  2256,  2251,  2245,  2240,  2235,  2229,
+     2224,  2217,  2210,  2203,  2196,  2188,  2181,  2174,  2167,  2160,  2155,  2149,
+     2144,  2139,  2133,  2128,  2123,  2117,  2112,  2107,  2101,  2096,  2091,  2085,
+     2080,  2075,  2069,  2064,  2059,  2053,  2048,  2043,  2037,  2032,  2027,  2021,
+     2016,  2011,  2005,  2000,  1995,  1989,  1984,  1979,  1973,  1968,  1964,  1961,
+     1957,  1954,  1950,  1947,  1943,  1940,  1936,  1931,  1925,  1920,  1915,  1909,
+     1904,  1899,  1893,  1888,  1883,  1877,  1872,  1867,  1861,  1856,  1851,  1845,
+     1840,  1835,  1829,  1824,  1819,  1813,  1808,  1803,  1797,  1792,  1788,  1785,
+     1781,  1778,  1774,  1771,  1767,  1764,  1760,  1755,  1749,  1744,  1739,  1733,
+     1728,  1723,  1717,  1712,  1708,  1705,  1701,  1698,  1694,  1691,  1687,  1684,
+     1680,  1675,  1669,  1664,  1659,  1653,  1648,  1643,  1637,  1632,  1627,  1621,
+     1616,  1611,  1605,  1600,  1595,  1589,  1584,  1580,  1577,  1573,  1570,  1566,
+     1563,  1559,  1556,  1552,  1547,  1541,  1536,  1531,  1525,  1520,  1515,  1509,
+     1504,  1500,  1497,  1493,  1490,  1486,  1483,  1479,  1476,  1472,  1467,  1461,
+     1456,  1451,  1445,  1440,  1435,  1429,  1424,  1419,  1413,  1408,  1403,  1397,
+     1392,  1387,  1381,  1376,  1372,  1369,  1365,  1362,  1358,  1355,  1351,  1348,
+     1344,  1339,  1333,  1328,  1323,  1317,  1312,  1307,  1301,  1296,  1291,  1285,
+     1280,  1275,  1269,  1264,  1259,  1253,  1248,  1243,  1237,  1232,  1227,  1221,
+     1216,  1211,  1205,  1200,  1195,  1189,  1184,  1179,  1173,  1168,  1163,  1157,
+     1152,  1147,  1141,  1136,  1131,  1125,  1120,  1115,  1109,  1104,  1099,  1093,
+     1088,  1083,  1077,  1072,  1067,  1061,  1056,  1049,  1042,  1035,  1028,  1020,
+     1013,  1006,   999,   992,   987,   981,   976,   971,   965,   960,   955,   949,
+      944,   937,   930,   923,   916,   908,   901,   894,   887,   880,   873,   866,
+      859,   852,   844,   837,   830,   823,   816,   807,   798,   789,   780,   772,
+      763,   754,   745,   736,   727,   718,   709,   700,   692,   683,   674,   665,
+      656,   645,   635,   624,   613,   603,   592,   581,   571,   560,   546,   532,
+      517,   503,   489,   475,   460,   446,   432,   414,   396,   379,   361,   343,
+      325,   308,   290,   272,   244,   215,   187,   158,   130,   101,    73,    44,
+       16,    14,    11,     9,     7,     5,     2,     0,     0
+  };
+#endif
+
+#if ANY_THERMISTOR_IS(8)
+  #define HAS_UNIFORM_TEMPTABLE_8 1
+  #define UNIFORM_TEMPTABLE_8_SHIFT 0 // max error 0.06 degC
+  const int16_t uniform_temptable_8[] PROGMEM = {
+    11264, 11117, 10969, 10822, 10675, 10527, 10380, 10233, 10085,  9938,  9791,  9643,
+     9496,  9349,  9202,  9054,  8907,  8760,  8612,  8465,  8318,  8170,  8023,  7876,
+     7728,  7581,  7434,  7286,  7139,  6992,  6844,  6697,  6550,  6402,  6255,  6108,
+     5960,  5813,  5666,  5518,  5371,  5224,  5077,  4929,  4782,  4635,  4487,  4340,
+     4193,  4045,  3898,  3751,  3603,  3456,  3444,  3431,  3419,  3406,  3394,  3382,
+     3369,  3357,  3345,  3332,  3320,  3307,  3295,  3283,  3270,  3258,  3246,  3233,
+     3221,  3208,  3196,  3184,  3171,  3159,  3147,  3134,  3122,  3109,  3097,  3085,
+     3072,  3060,  3048,  3035,  3023,  3010,  2998,  2986,  2973,  2961,  2949,  2936,
+     2924,  2911,  2899,  2887,  2874,  2862,  2850,  2837,  2825,  2812,  2800,  2793,
+     2786,  2779,  2772,  2765,  2758,  2751,  2744,  2738,  2731,  2724,  2717,  2710,
+     2703,  2696,  2689,  2682,  2675,  2668,  2661,  2654,  2647,  2640,  2633,  2626,
+     2619,  2613,  2606,  2599,  2592,  2585,  2578,  2571,  2564,  2557,  2550,  2543,
+     2536,  2529,  2522,  2515,  2508,  2501,  2494,  2488,  2481,  2474,  2467,  2460,
+     2453,  2446,  2439,  2432,  2427,  2423,  2418,  2414,  2409,  2405,  2400,  2396,
+     2391,  2387,  2382,  2378,  2373,  2369,  2364,  2360,  2355,  2350,  2346,  2341,
+     2337,  2332,  2328,  2323,  2319,  2314,  2310,  2305,  2301,  2296,  2292,  2287,
+     2283,  2278,  2274,  2269,  2264,  2260,  2255,  2251,  2246,  2242,  2237,  2233,
+     2228,  2224,  2219,  2215,  2210,  2206,  2201,  2197,  2192,  2188,  2185,  2181,
+     2178,  2174,  2170,  2167,  2163,  2159,  2156,  2152,  2149,  2145,  2141,  2138,
+     2134,  2130,  2127,  2123,  2120,  2116,  2112,  2109,  2105,  2101,  2098,  2094,
+     2091,  2087,  2083,  2080,  2076,  2072,  2069,  2065,  2062,  2058,  2054,  2051,
+     2047,  2043,  2040,  2036,  2033,  2029,  2025,  2022,  2018,  2014,  2011,  2007,
+     2004,  2000,  1997,  1994,  1991,  1988,  1985,  1982,  1979,  1976,  1973,  1970,
+     1967,  1964,  1961,  1958,  1955,  1952,  1949,  1946,  1943,  1940,  1937,  1934,
+     1931,  1928,  1925,  1922,  1918,  1915,  1912,  1909,  1906,  1903,  1900,  1897,
+     1894,  1891,  1888,  1885,  1882,  1879,  1876,  1873,  1870,  1867,  1864,  1861,
+     1858,  1855,  1852,  1849,  1846,  1843,  1840,  1837,  1835,  1832,  1829,  1826,
+     1824,  1821,  1818,  1816,  1813,  1810,  1807,  1805,  1802,  1799,  1797,  1794,
+     1791,  1788,  1786,  1783,  1780,  1778,  1775,  1772,  1769,  1767,  1764,  1761,
+     1758,  1756,  1753,  1750,  1748,  1745,  1742,  1739,  1737,  1734,  1731,  1729,
+     1726,  1723,  1720,  1718,  1715,  1712,  1710,  1707,  1704,  1701,  1699,  1696,
+     1694,  1692,  1690,  1688,  1685,  1683,  1681,  1679,  1677,  1675,  1673,  1671,
+     1669,  1666,  1664,  1662,  1660,  1658,  1656,  1654,  1652,  1650,  1647,  1645,
+     1643,  1641,  1639,  1637,  1635,  1633,  1630,  1628,  1626,  1624,  1622,  1620,
+     1618,  1616,  1614,  1611,  1609,  1607,  1605,  1603,  1601,  1599,  1597,  1595,
+     1592,  1590,  1588,  1586,  1584,  1582,  1579,  1577,  1574,  1572,  1570,  1567,
+     1565,  1562,  1560,  1557,  1555,  1553,  1550,  1548,  1545,  1543,  1541,  1538,
+     1536,  1533,  1531,  1528,  1526,  1524,  1521,  1519,  1516,  1514,  1512,  1509,
+     1507,  1504,  1502,  1499,  1497,  1495,  1492,  1490,  1487,  1485,  1483,  1480,
+     1478,  1475,  1473,  1470,  1468,  1466,  1463,  1461,  1458,  1456,  1454,  1452,
+     1451,  1449,  1447,  1445,  1443,  1442,  1440,  1438,  1436,  1434,  1432,  1431,
+     1429,  1427,  1425,  1423,  1422,  1420,  1418,  1416,  1414,  1413,  1411,  1409,
+     1407,  1405,  1403,  1402,  1400,  1398,  1396,  1394,  1393,  1391,  1389,  1387,
+     1385,  1384,  1382,  1380,  1378,  1376,  1374,  1373,  1371,  1369,  1367,  1365,
+     1364,  1362,  1360,  1358,  1356,  1354,  1352,  1349,  1347,  1345,  1343,  1341,
+     1339,  1337,  1335,  1333,  1330,  1328,  1326,  1324,  1322,  1320,  1318,  1316,
+     1314,  1311,  1309,  1307,  1305,  1303,  1301,  1299,  1297,  1294,  1292,  1290,
+     1288,  1286,  1284,  1282,  1280,  1278,  1275,  1273,  1271,  1269,  1267,  1265,
+     1263,  1261,  1259,  1256,  1254,  1252,  1250,  1248,  1246,  1244,  1242,  1240,
+     1237,  1235,  1233,  1231,  1229,  1227,  1225,  1223,  1221,  1218,  1216,  1214,
+     1212,  1210,  1208,  1206,  1204,  1202,  1199,  1197,  1195,  1193,  1191,  1189,
+     1187,  1185,  1182,  1180,  1178,  1176,  1174,  1172,  1170,  1168,  1166,  1163,
+     1161,  1159,  1157,  1155,  1153,  1151,  1149,  1147,  1144,  1142,  1140,  1138,
+     1136,  1134,  1132,  1131,  1129,  1127,  1125,  1123,  1122,  1120,  1118,  1116,
+     1114,  1112,  1111,  1109,  1107,  1105,  1103,  1102,  1100,  1098,  1096,  1094,
+     1093,  1091,  1089,  1087,  1085,  1083,  1082,  1080,  1078,  1076,  1074,  1073,
+     1071,  1069,  1067,  1065,  1064,  1062,  1060,  1058,  1056,  1054,  1053,  1051,
+     1049,  1047,  1045,  1044,  1042,  1040,  1038,  1036,  1034,  1032,  1029,  1027,
+     1025,  1023,  1021,  1019,  1017,  1015,  1013,  1010,  1008,  1006,  1004,  1002,
+     1000,   998,   996,   994,   991,   989,   987,   985,   983,   981,   979,   977,
+      974,   972,   970,   968,   966,   964,   962,   960,   958,   955,   953,   951,
+      949,   947,   945,   943,   941,   939,   936,   934,   932,   930,   928,   926,
+      923,   921,   918,   916,   914,   911,   909,   906,   904,   901,   899,   897,
+      894,   892,   889,   887,   885,   882,   880,   877,   875,   872,   870,   868,
+      865,   863,   860,   858,   856,   853,   851,   848,   846,   843,   841,   839,
+      836,   834,   831,   829,   827,   824,   822,   819,   817,   814,   812,   810,
+      807,   805,   802,   800,   798,   795,   793,   790,   788,   786,   783,   781,
+      778,   776,   773,   771,   769,   766,   764,   761,   759,   757,   754,   752,
+      749,   747,   744,   742,   740,   737,   735,   732,   730,   728,   725,   723,
+      720,   718,   715,   713,   711,   708,   706,   703,   701,   699,   696,   694,
+      691,   689,   686,   684,   682,   679,   677,   674,   672,   669,   665,   662,
+      659,   655,   652,   649,   645,   642,   639,   635,   632,   629,   626,   622,
+      619,   616,   612,   609,   606,   602,   599,   596,   592,   589,   586,   582,
+      579,   576,   572,   569,   566,   562,   559,   556,   552,   549,   546,   542,
+      539,   536,   533,   529,   526,   523,   519,   516,   513,   509,   506,   503,
+      499,   496,   492,   488,   483,   479,   475,   471,   466,   462,   458,   454,
+      450,   445,   441,   437,   433,   428,   424,   420,   416,   411,   407,   403,
+      399,   395,   390,   386,   382,   378,   373,   369,   365,   361,   357,   352,
+      348,   344,   340,   335,   331,   327,   323,   318,   314,   310,   306,   302,
+      297,   293,   289,   285,   280,   276,   272,   267,   262,   257,   251,   246,
+      241,   236,   231,   226,   221,   216,   210,   205,   200,   195,   190,   185,
+      180,   174,   169,   164,   159,   154,   149,   144,   139,   133,   128,   123,
+      118,   113,   108,   103,    98,    92,    87,    82,    77,    72,    67,    62,
+       56,    51,    46,    41,    36,    31,    26,    21,    15,    10,     5,     0,
+        0
+  };
+#endif
+
+#if ANY_THERMISTOR_IS(9)
+  #define HAS_UNIFORM_TEMPTABLE_9 1
+  #define UNIFORM_TEMPTABLE_9_SHIFT 0 // max error 0.06 degC
+  const int16_t uniform_temptable_9[] PROGMEM = {
+    14976, 14685, 14395, 14104, 13813, 13522, 13232, 12941, 12650, 12359, 12069, 11778,
+    11487, 11196, 10906, 10615, 10324, 10033,  9743,  9452,  9161,  8870,  8580,  8289,
+     7998,  7707,  7417,  7126,  6835,  6544,  6254,  5963,  5672,  5381,  5091,  4800,
+     4775,  4751,  4726,  4701,  4677,  4652,  4627,  4603,  4578,  4553,  4528,  4504,
+     4479,  4454,  4430,  4405,  4380,  4356,  4331,  4306,  4282,  4257,  4232,  4208,
+     4183,  4158,  4133,  4109,  4084,  4059,  4035,  4010,  3985,  3961,  3936,  3923,
+     3910,  3898,  3885,  3872,  3859,  3846,  3834,  3821,  3808,  3795,  3782,  3770,
+     3757,  3744,  3731,  3718,  3706,  3693,  3680,  3667,  3654,  3642,  3629,  3616,
+     3603,  3590,  3578,  3565,  3552,  3539,  3526,  3514,  3501,  3488,  3479,  3471,
+     3462,  3453,  3445,  3436,  3427,  3419,  3410,  3401,  3392,  3384,  3375,  3366,
+     3358,  3349,  3340,  3332,  3323,  3314,  3306,  3297,  3288,  3280,  3271,  3262,
+     3253,  3245,  3236,  3227,  3219,  3210,  3201,  3193,  3184,  3178,  3171,  3165,
+     3158,  3152,  3146,  3139,  3133,  3126,  3120,  3114,  3107,  3101,  3094,  3088,
+     3082,  3075,  3069,  3062,  3056,  3050,  3043,  3037,  3030,  3024,  3018,  3011,
+     3005,  2998,  2992,  2986,  2979,  2973,  2966,  2960,  2955,  2949,  2944,  2938,
+     2933,  2927,  2922,  2916,  2911,  2905,  2900,  2894,  2889,  2883,  2878,  2872,
+     2867,  2861,  2856,  2850,  2845,  2839,  2834,  2828,  2823,  2817,  2812,  2806,
+     2801,  2795,  2790,  2784,  2779,  2773,  2768,  2763,  2759,  2754,  2750,  2745,
+     2741,  2736,  2731,  2727,  2722,  2718,  2713,  2709,  2704,  2699,  2695,  2690,
+     2686,  2681,  2677,  2672,  2667,  2663,  2658,  2654,  2649,  2645,  2640,  2635,
+     2631,  2626,  2622,  2617,  2613,  2608,  2604,  2601,  2597,  2593,  2590,  2586,
+     2582,  2579,  2575,  2571,  2568,  2564,  2560,  2557,  2553,  2549,  2546,  2542,
+     2539,  2535,  2531,  2528,  2524,  2520,  2517,  2513,  2509,  2506,  2502,  2498,
+     2495,  2491,  2487,  2484,  2480,  2476,  2473,  2469,  2465,  2462,  2458,  2454,
+     2451,  2447,  2443,  2440,  2436,  2432,  2429,  2425,  2421,  2418,  2414,  2411,
+     2407,  2403,  2400,  2396,  2392,  2389,  2385,  2381,  2378,  2374,  2370,  2367,
+     2363,  2359,  2356,  2352,  2349,  2346,  2342,  2339,  2336,  2333,  2330,  2326,
+     2323,  2320,  2317,  2314,  2310,  2307,  2304,  2301,  2298,  2294,  2291,  2288,
+     2285,  2282,  2278,  2275,  2272,  2269,  2266,  2262,  2259,  2256,  2253,  2250,
+     2246,  2243,  2240,  2237,  2235,  2232,  2229,  2226,  2224,  2221,  2218,  2215,
+     2213,  2210,  2207,  2204,  2202,  2199,  2196,  2193,  2191,  2188,  2185,  2182,
+     2180,  2177,  2174,  2171,  2169,  2166,  2163,  2160,  2158,  2155,  2152,  2149,
+     2147,  2144,  2141,  2139,  2136,  2133,  2130,  2128,  2125,  2122,  2119,  2117,
+     2114,  2111,  2108,  2106,  2103,  2100,  2097,  2095,  2092,  2089,  2086,  2084,
+     2081,  2078,  2075,  2073,  2070,  2067,  2064,  2062,  2059,  2056,  2053,  2051,
+     2048,  2045,  2043,  2040,  2037,  2034,  2032,  2029,  2026,  2023,  2021,  2018,
+     2015,  2012,  2010,  2007,  2004,  2001,  1999,  1996,  1993,  1990,  1988,  1985,
+     1982,  1979,  1977,  1974,  1971,  1968,  1966,  1963,  1960,  1957,  1955,  1952,
+     1950,  1947,  1945,  1943,  1941,  1938,  1936,  1934,  1931,  1929,  1927,  1925,
+     1922,  1920,  1918,  1915,  1913,  1911,  1909,  1906,  1904,  1902,  1899,  1897,
+     1895,  1893,  1890,  1888,  1886,  1883,  1881,  1879,  1877,  1874,  1872,  1870,
+     1867,  1865,  1863,  1861,  1858,  1856,  1854,  1851,  1849,  1847,  1845,  1842,
+     1840,  1838,  1835,  1833,  1831,  1829,  1826,  1824,  1822,  1819,  1817,  1815,
+     1813,  1810,  1808,  1806,  1803,  1801,  1799,  1797,  1794,  1792,  1790,  1787,
+     1785,  1783,  1781,  1778,  1776,  1774,  1771,  1769,  1767,  1765,  1762,  1760,
+     1758,  1755,  1753,  1751,  1749,  1746,  1744,  1742,  1739,  1737,  1735,  1733,
+     1730,  1728,  1726,  1723,  1721,  1719,  1717,  1714,  1712,  1710,  1707,  1705,
+     1703,  1701,  1698,  1696,  1694,  1691,  1689,  1687,  1685,  1682,  1680,  1678,
+     1675,  1673,  1671,  1669,  1666,  1664,  1662,  1659,  1657,  1655,  1653,  1650,
+     1648,  1646,  1643,  1641,  1639,  1637,  1634,  1632,  1630,  1627,  1625,  1623,
+     1621,  1618,  1616,  1614,  1611,  1609,  1607,  1605,  1602,  1600,  1598,  1595,
+     1593,  1591,  1589,  1586,  1584,  1582,  1579,  1577,  1575,  1573,  1570,  1568,
+     1566,  1563,  1561,  1559,  1557,  1554,  1552,  1550,  1547,  1545,  1543,  1541,
+     1538,  1536,  1534,  1531,  1529,  1527,  1525,  1522,  1520,  1518,  1515,  1513,
+     1511,  1509,  1506,  1504,  1502,  1499,  1497,  1495,  1493,  1490,  1488,  1486,
+     1483,  1481,  1479,  1477,  1474,  1472,  1470,  1467,  1465,  1463,  1461,  1458,
+     1456,  1454,  1451,  1449,  1447,  1445,  1442,  1440,  1438,  1435,  1433,  1431,
+     1429,  1426,  1424,  1422,  1419,  1417,  1415,  1413,  1410,  1408,  1406,  1403,
+     1401,  1399,  1397,  1394,  1392,  1389,  1387,  1384,  1381,  1378,  1376,  1373,
+     1370,  1367,  1365,  1362,  1359,  1356,  1354,  1351,  1348,  1345,  1343,  1340,
+     1337,  1334,  1332,  1329,  1326,  1323,  1321,  1318,  1315,  1312,  1310,  1307,
+     1304,  1301,  1299,  1296,  1294,  1291,  1289,  1287,  1285,  1282,  1280,  1278,
+     1275,  1273,  1271,  1269,  1266,  1264,  1262,  1259,  1257,  1255,  1253,  1250,
+     1248,  1246,  1243,  1241,  1239,  1237,  1234,  1232,  1230,  1227,  1225,  1223,
+     1221,  1218,  1216,  1213,  1211,  1208,  1205,  1202,  1200,  1197,  1194,  1191,
+     1189,  1186,  1183,  1180,  1178,  1175,  1172,  1169,  1167,  1164,  1161,  1158,
+     1156,  1153,  1150,  1147,  1145,  1142,  1139,  1136,  1134,  1131,  1128,  1125,
+     1123,  1120,  1117,  1114,  1110,  1107,  1104,  1101,  1098,  1094,  1091,  1088,
+     1085,  1082,  1078,  1075,  1072,  1069,  1066,  1062,  1059,  1056,  1053,  1050,
+     1046,  1043,  1040,  1037,  1034,  1030,  1027,  1024,  1021,  1018,  1014,  1011,
+     1008,  1005,  1002,   998,   995,   992,   989,   986,   982,   979,   976,   973,
+      970,   966,   963,   960,   957,   954,   950,   947,   944,   941,   938,   934,
+      931,   928,   925,   922,   918,   915,   912,   909,   906,   902,   899,   896,
+      892,   889,   885,   881,   878,   874,   870,   867,   863,   859,   856,   852,
+      848,   845,   841,   837,   834,   830,   827,   823,   819,   816,   812,   808,
+      805,   801,   797,   794,   790,   786,   783,   779,   775,   772,   768,   763,
+      759,   754,   750,   745,   741,   736,   731,   727,   722,   718,   713,   709,
+      704,   699,   695,   690,   686,   681,   677,   672,   667,   663,   658,   654,
+      649,   645,   640,   635,   631,   626,   622,   617,   613,   608,   601,   594,
+      587,   581,   574,   567,   560,   553,   546,   539,   533,   526,   519,   512,
+      505,   498,   491,   485,   478,   471,   464,   457,   450,   443,   437,   430,
+      423,   416,   409,   402,   395,   389,   382,   375,   368,   356,   344,   332,
+      320,   308,   296,   284,   272,   260,   248,   236,   224,   212,   200,   188,
+      176,   164,   152,   140,   128,   116,   104,    92,    80,    73,    65,    58,
+       51,    44,    36,    29,    22,    15,     7,     0,     0
+  };
+#endif
+
+#if ANY_THERMISTOR_IS(10)
+  #define HAS_UNIFORM_TEMPTABLE_10 1
+  #define UNIFORM_TEMPTABLE_10_SHIFT 0 // max error 0.06 degC
+  const int16_t uniform_temptable_10[] PROGMEM = {
+    14864, 14576, 14288, 14000, 13712, 13424, 13136, 12848, 12560, 12272, 11984, 11696,
+    11408, 11120, 10832, 10544, 10256,  9968,  9680,  9392,  9104,  8816,  8528,  8240,
+     7952,  7664,  7376,  7088,  6800,  6512,  6224,  5936,  5648,  5360,  5072,  4784,
+     4760,  4736,  4711,  4687,  4663,  4639,  4614,  4590,  4566,  4542,  4517,  4493,
+     4469,  4445,  4421,  4396,  4372,  4348,  4324,  4299,  4275,  4251,  4227,  4203,
+     4178,  4154,  4130,  4106,  4081,  4057,  4033,  4009,  3984,  3960,  3936,  3923,
+     3909,  3896,  3883,  3870,  3856,  3843,  3830,  3817,  3803,  3790,  3777,  3764,
+     3750,  3737,  3724,  3711,  3697,  3684,  3671,  3658,  3644,  3631,  3618,  3605,
+     3591,  3578,  3565,  3552,  3538,  3525,  3512,  3499,  3485,  3472,  3463,  3455,
+     3446,  3437,  3429,  3420,  3411,  3403,  3394,  3385,  3376,  3368,  3359,  3350,
+     3342,  3333,  3324,  3316,  3307,  3298,  3290,  3281,  3272,  3264,  3255,  3246,
+     3237,  3229,  3220,  3211,  3203,  3194,  3185,  3177,  3168,  3162,  3155,  3149,
+     3142,  3136,  3130,  3123,  3117,  3110,  3104,  3098,  3091,  3085,  3078,  3072,
+     3066,  3059,  3053,  3046,  3040,  3034,  3027,  3021,  3014,  3008,  3002,  2995,
+     2989,  2982,  2976,  2970,  2963,  2957,  2950,  2944,  2939,  2934,  2929,  2924,
+     2919,  2914,  2909,  2904,  2899,  2894,  2889,  2884,  2879,  2874,  2869,  2864,
+     2859,  2853,  2848,  2843,  2838,  2833,  2828,  2823,  2818,  2813,  2808,  2803,
+     2798,  2793,  2788,  2783,  2778,  2773,  2768,  2763,  2759,  2754,  2750,  2745,
+     2741,  2736,  2731,  2727,  2722,  2718,  2713,  2709,  2704,  2699,  2695,  2690,
+     2686,  2681,  2677,  2672,  2667,  2663,  2658,  2654,  2649,  2645,  2640,  2635,
+     2631,  2626,  2622,  2617,  2613,  2608,  2604,  2600,  2596,  2592,  2587,  2583,
+     2579,  2575,  2571,  2567,  2563,  2559,  2555,  2550,  2546,  2542,  2538,  2534,
+     2530,  2526,  2522,  2517,  2513,  2509,  2505,  2501,  2497,  2493,  2489,  2485,
+     2480,  2476,  2472,  2468,  2464,  2461,  2458,  2454,  2451,  2448,  2445,  2442,
+     2438,  2435,  2432,  2429,  2426,  2422,  2419,  2416,  2413,  2410,  2406,  2403,
+     2400,  2397,  2394,  2390,  2387,  2384,  2381,  2378,  2374,  2371,  2368,  2365,
+     2362,  2358,  2355,  2352,  2349,  2346,  2342,  2339,  2336,  2333,  2330,  2326,
+     2323,  2320,  2317,  2314,  2310,  2307,  2304,  2301,  2298,  2294,  2291,  2288,
+     2285,  2282,  2278,  2275,  2272,  2269,  2266,  2262,  2259,  2256,  2253,  2250,
+     2246,  2243,  2240,  2237,  2235,  2232,  2229,  2226,  2224,  2221,  2218,  2215,
+     2213,  2210,  2207,  2204,  2202,  2199,  2196,  2193,  2191,  2188,  2185,  2182,
+     2180,  2177,  2174,  2171,  2169,  2166,  2163,  2160,  2158,  2155,  2152,  2149,
+     2147,  2144,  2141,  2139,  2136,  2133,  2130,  2128,  2125,  2122,  2119,  2117,
+     2114,  2111,  2108,  2106,  2103,  2100,  2097,  2095,  2092,  2089,  2086,  2084,
+     2081,  2078,  2075,  2073,  2070,  2067,  2064,  2062,  2059,  2056,  2053,  2051,
+     2048,  2045,  2043,  2040,  2037,  2034,  2032,  2029,  2026,  2023,  2021,  2018,
+     2015,  2012,  2010,  2007,  2004,  2001,  1999,  1996,  1993,  1990,  1988,  1985,
+     1982,  1979,  1977,  1974,  1971,  1968,  1966,  1963,  1960,  1957,  1955,  1952,
+     1950,  1947,  1945,  1943,  1941,  1938,  1936,  1934,  1931,  1929,  1927,  1925,
+     1922,  1920,  1918,  1915,  1913,  1911,  1909,  1906,  1904,  1902,  1899,  1897,
+     1895,  1893,  1890,  1888,  1886,  1883,  1881,  1879,  1877,  1874,  1872,  1870,
+     1867,  1865,  1863,  1861,  1858,  1856,  1854,  1851,  1849,  1847,  1845,  1842,
+     1840,  1838,  1835,  1833,  1831,  1829,  1826,  1824,  1822,  1819,  1817,  1815,
+     1813,  1810,  1808,  1806,  1803,  1801,  1799,  1797,  1794,  1792,  1790,  1787,
+     1785,  1783,  1781,  1778,  1776,  1774,  1771,  1769,  1767,  1765,  1762,  1760,
+     1758,  1755,  1753,  1751,  1749,  1746,  1744,  1742,  1739,  1737,  1735,  1733,
+     1730,  1728,  1726,  1723,  1721,  1719,  1717,  1714,  1712,  1710,  1707,  1705,
+     1703,  1701,  1698,  1696,  1694,  1691,  1689,  1687,  1685,  1682,  1680,  1678,
+     1675,  1673,  1671,  1669,  1666,  1664,  1662,  1659,  1657,  1655,  1653,  1650,
+     1648,  1646,  1643,  1641,  1639,  1637,  1634,  1632,  1630,  1627,  1625,  1623,
+     1621,  1618,  1616,  1614,  1611,  1609,  1607,  1605,  1602,  1600,  1598,  1595,
+     1593,  1591,  1589,  1586,  1584,  1582,  1579,  1577,  1575,  1573,  1570,  1568,
+     1566,  1563,  1561,  1559,  1557,  1554,  1552,  1549,  1547,  1544,  1541,  1538,
+     1536,  1533,  1530,  1527,  1525,  1522,  1519,  1516,  1514,  1511,  1508,  1505,
+     1503,  1500,  1497,  1494,  1492,  1489,  1486,  1483,  1481,  1478,  1475,  1472,
+     1470,  1467,  1464,  1461,  1459,  1456,  1454,  1451,  1449,  1447,  1445,  1442,
+     1440,  1438,  1435,  1433,  1431,  1429,  1426,  1424,  1422,  1419,  1417,  1415,
+     1413,  1410,  1408,  1406,  1403,  1401,  1399,  1397,  1394,  1392,  1390,  1387,
+     1385,  1383,  1381,  1378,  1376,  1374,  1371,  1369,  1367,  1365,  1362,  1360,
+     1358,  1355,  1353,  1351,  1349,  1346,  1344,  1342,  1339,  1337,  1335,  1333,
+     1330,  1328,  1326,  1323,  1321,  1319,  1317,  1314,  1312,  1310,  1307,  1305,
+     1303,  1301,  1298,  1296,  1294,  1291,  1289,  1287,  1285,  1282,  1280,  1278,
+     1275,  1273,  1271,  1269,  1266,  1264,  1262,  1259,  1257,  1255,  1253,  1250,
+     1248,  1246,  1243,  1241,  1239,  1237,  1234,  1232,  1230,  1227,  1225,  1223,
+     1221,  1218,  1216,  1213,  1211,  1208,  1205,  1202,  1200,  1197,  1194,  1191,
+     1189,  1186,  1183,  1180,  1178,  1175,  1172,  1169,  1167,  1164,  1161,  1158,
+     1156,  1153,  1150,  1147,  1145,  1142,  1139,  1136,  1134,  1131,  1128,  1125,
+     1123,  1120,  1117,  1114,  1110,  1107,  1104,  1101,  1098,  1094,  1091,  1088,
+     1085,  1082,  1078,  1075,  1072,  1069,  1066,  1062,  1059,  1056,  1053,  1050,
+     1046,  1043,  1040,  1037,  1034,  1030,  1027,  1024,  1021,  1018,  1014,  1011,
+     1008,  1005,  1002,   998,   995,   992,   989,   986,   982,   979,   976,   973,
+      970,   966,   963,   960,   957,   954,   950,   947,   944,   941,   938,   934,
+      931,   928,   925,   922,   918,   915,   912,   909,   906,   902,   899,   896,
+      892,   889,   885,   881,   878,   874,   870,   867,   863,   859,   856,   852,
+      848,   845,   841,   837,   834,   830,   827,   823,   819,   816,   812,   808,
+      805,   801,   797,   794,   790,   786,   783,   779,   775,   772,   768,   763,
+      759,   754,   750,   745,   741,   736,   731,   727,   722,   718,   713,   709,
+      704,   699,   695,   690,   686,   681,   677,   672,   667,   663,   658,   654,
+      649,   645,   640,   635,   631,   626,   622,   617,   613,   608,   601,   594,
+      587,   581,   574,   567,   560,   553,   546,   539,   533,   526,   519,   512,
+      505,   498,   491,   485,   478,   471,   464,   457,   450,   443,   437,   430,
+      423,   416,   409,   402,   395,   389,   382,   375,   368,   356,   344,   332,
+      320,   308,   296,   284,   272,   260,   248,   236,   224,   212,   200,   188,
+      176,   164,   152,   140,   128,   116,   104,    92,    80,    73,    65,    58,
+       51,    44,    36,    29,    22,    15,     7,     0,     0
+  };
+#endif
+
+#if ANY_THERMISTOR_IS(11)
+  #define HAS_UNIFORM_TEMPTABLE_11 1
+  #define UNIFORM_TEMPTABLE_11_SHIFT 1 // max error 0.06 degC
+  const int16_t uniform_temptable_11[] PROGMEM = {
+    15008, 14342, 13677, 13011, 12346, 11680, 11014, 10349,  9683,  9018,  8352,  7686,
+     7021,  6355,  5690,  5024,  4947,  4870,  4794,  4717,  4640,  4582,  4525,  4467,
+     4410,  4352,  4307,  4262,  4218,  4173,  4128,  4093,  4058,  4022,  3987,  3952,
+     3920,  3888,  3856,  3824,  3792,  3766,  3741,  3715,  3690,  3664,  3638,  3613,
+     3587,  3562,  3536,  3517,  3498,  3478,  3459,  3440,  3421,  3402,  3382,  3363,
+     3344,  3328,  3312,  3296,  3280,  3264,  3248,  3232,  3216,  3200,  3184,  3171,
+     3158,  3146,  3133,  3120,  3104,  3088,  3072,  3056,  3040,  3030,  3021,  3011,
+     3002,  2992,  2979,  2966,  2954,  2941,  2928,  2915,  2902,  2890,  2877,  2864,
+     2854,  2845,  2835,  2826,  2816,  2806,  2797,  2787,  2778,  2768,  2758,  2749,
+     2739,  2730,  2720,  2712,  2704,  2696,  2688,  2680,  2672,  2664,  2656,  2648,
+     2640,  2632,  2624,  2616,  2608,  2600,  2592,  2584,  2576,  2568,  2560,  2552,
+     2544,  2536,  2528,  2520,  2512,  2504,  2496,  2488,  2480,  2472,  2464,  2456,
+     2448,  2440,  2432,  2424,  2416,  2408,  2400,  2394,  2387,  2381,  2374,  2368,
+     2362,  2355,  2349,  2342,  2336,  2330,  2323,  2317,  2310,  2304,  2299,  2293,
+     2288,  2283,  2277,  2272,  2267,  2261,  2256,  2251,  2245,  2240,  2235,  2229,
+     2224,  2218,  2211,  2205,  2198,  2192,  2186,  2179,  2173,  2166,  2160,  2154,
+     2147,  2141,  2134,  2128,  2123,  2117,  2112,  2107,  2101,  2096,  2091,  2085,
+     2080,  2075,  2069,  2064,  2059,  2053,  2048,  2043,  2037,  2032,  2027,  2021,
+     2016,  2011,  2005,  2000,  1995,  1989,  1984,  1979,  1973,  1968,  1963,  1958,
+     1954,  1949,  1944,  1939,  1934,  1930,  1925,  1920,  1915,  1910,  1906,  1901,
+     1896,  1891,  1886,  1882,  1877,  1872,  1867,  1862,  1858,  1853,  1848,  1843,
+     1838,  1834,  1829,  1824,  1819,  1814,  1810,  1805,  1800,  1795,  1790,  1786,
+     1781,  1776,  1771,  1766,  1762,  1757,  1752,  1747,  1742,  1738,  1733,  1728,
+     1723,  1718,  1714,  1709,  1704,  1699,  1694,  1690,  1685,  1680,  1676,  1672,
+     1668,  1664,  1660,  1656,  1652,  1648,  1644,  1640,  1636,  1632,  1628,  1624,
+     1620,  1616,  1612,  1608,  1604,  1600,  1595,  1589,  1584,  1579,  1573,  1568,
+     1563,  1557,  1552,  1547,  1541,  1536,  1531,  1525,  1520,  1516,  1512,  1508,
+     1504,  1500,  1496,  1492,  1488,  1484,  1480,  1476,  1472,  1468,  1464,  1460,
+     1456,  1452,  1448,  1444,  1440,  1435,  1429,  1424,  1419,  1413,  1408,  1403,
+     1397,  1392,  1387,  1381,  1376,  1371,  1365,  1360,  1355,  1350,  1346,  1341,
+     1336,  1331,  1326,  1322,  1317,  1312,  1307,  1302,  1298,  1293,  1288,  1283,
+     1278,  1274,  1269,  1264,  1258,  1253,  1247,  1242,  1236,  1230,  1225,  1219,
+     1214,  1208,  1202,  1197,  1191,  1186,  1180,  1174,  1169,  1163,  1158,  1152,
+     1147,  1142,  1138,  1133,  1128,  1123,  1118,  1114,  1109,  1104,  1098,  1091,
+     1085,  1078,  1072,  1066,  1059,  1053,  1046,  1040,  1034,  1027,  1021,  1014,
+     1008,  1002,   995,   989,   982,   976,   970,   963,   957,   950,   944,   938,
+      931,   925,   918,   912,   906,   899,   893,   886,   880,   874,   867,   861,
+      854,   848,   842,   835,   829,   822,   816,   806,   797,   787,   778,   768,
+      758,   749,   739,   730,   720,   710,   701,   691,   682,   672,   662,   653,
+      643,   634,   624,   612,   601,   589,   577,   565,   554,   542,   530,   518,
+      507,   495,   483,   471,   460,   448,   432,   416,   400,   384,   368,   349,
+      330,   310,   291,   272,   246,   221,   195,   170,   144,    86,    29,   -29,
+      -86,  -144,  -202,  -259,  -317,  -374,  -432,  -432
+  };
+#endif
+
+#if ANY_THERMISTOR_IS(12)
+  #define HAS_UNIFORM_TEMPTABLE_12 1
+  #define UNIFORM_TEMPTABLE_12_SHIFT 0 // max error 0.06 degC
+  const int16_t uniform_temptable_12[] PROGMEM = {
+     2880,  2876,  2873,  2869,  2865,  2862,  2858,  2855,  2851,  2847,  2844,  2840,
+     2836,  2833,  2829,  2825,  2822,  2818,  2815,  2811,  2807,  2804,  2800,  2796,
+     2793,  2789,  2785,  2782,  2778,  2775,  2771,  2767,  2764,  2760,  2756,  2753,
+     2749,  2745,  2742,  2738,  2735,  2731,  2727,  2724,  2720,  2716,  2713,  2709,
+     2705,  2702,  2698,  2695,  2691,  2687,  2684,  2680,  2676,  2673,  2669,  2665,
+     2662,  2658,  2655,  2651,  2647,  2644,  2640,  2636,  2633,  2629,  2625,  2622,
+     2618,  2615,  2611,  2607,  2604,  2600,  2596,  2593,  2589,  2585,  2582,  2578,
+     2575,  2571,  2567,  2564,  2560,  2556,  2553,  2549,  2545,  2542,  2538,  2535,
+     2531,  2527,  2524,  2520,  2516,  2513,  2509,  2505,  2502,  2498,  2495,  2491,
+     2487,  2484,  2480,  2476,  2473,  2469,  2465,  2462,  2458,  2455,  2451,  2447,
+     2444,  2440,  2436,  2433,  2429,  2425,  2422,  2418,  2415,  2411,  2407,  2404,
+     2400,  2396,  2393,  2389,  2385,  2382,  2378,  2375,  2371,  2367,  2364,  2360,
+     2356,  2353,  2349,  2345,  2342,  2338,  2335,  2331,  2327,  2324,  2320,  2316,
+     2313,  2309,  2305,  2302,  2298,  2295,  2291,  2287,  2284,  2280,  2276,  2273,
+     2269,  2265,  2262,  2258,  2255,  2251,  2247,  2244,  2240,  2236,  2233,  2229,
+     2225,  2222,  2218,  2215,  2211,  2207,  2204,  2200,  2196,  2193,  2189,  2185,
+     2182,  2178,  2175,  2171,  2167,  2164,  2160,  2157,  2154,  2151,  2149,  2146,
+     2143,  2140,  2137,  2134,  2131,  2129,  2126,  2123,  2120,  2117,  2114,  2111,
+     2109,  2106,  2103,  2100,  2097,  2094,  2091,  2089,  2086,  2083,  2080,  2077,
+     2074,  2072,  2069,  2066,  2063,  2061,  2058,  2055,  2052,  2050,  2047,  2044,
+     2041,  2039,  2036,  2033,  2030,  2028,  2025,  2022,  2019,  2017,  2014,  2011,
+     2008,  2006,  2003,  2000,  1998,  1996,  1994,  1992,  1989,  1987,  1985,  1983,
+     1981,  1979,  1977,  1975,  1973,  1971,  1968,  1966,  1964,  1962,  1960,  1958,
+     1956,  1954,  1952,  1949,  1947,  1945,  1943,  1941,  1939,  1937,  1935,  1933,
+     1931,  1928,  1926,  1924,  1922,  1920,  1918,  1915,  1913,  1911,  1908,  1906,
+     1904,  1901,  1899,  1896,  1894,  1892,  1889,  1887,  1885,  1882,  1880,  1878,
+     1875,  1873,  1871,  1868,  1866,  1864,  1861,  1859,  1856,  1854,  1852,  1849,
+     1847,  1845,  1842,  1840,  1838,  1836,  1835,  1833,  1831,  1829,  1827,  1825,
+     1824,  1822,  1820,  1818,  1816,  1815,  1813,  1811,  1809,  1807,  1805,  1804,
+     1802,  1800,  1798,  1796,  1795,  1793,  1791,  1789,  1787,  1785,  1784,  1782,
+     1780,  1778,  1776,  1775,  1773,  1771,  1769,  1767,  1765,  1764,  1762,  1760,
+     1758,  1756,  1754,  1752,  1750,  1748,  1746,  1744,  1742,  1740,  1738,  1736,
+     1734,  1732,  1730,  1728,  1726,  1724,  1722,  1720,  1718,  1716,  1714,  1712,
+     1710,  1708,  1706,  1704,  1702,  1700,  1698,  1696,  1694,  1692,  1690,  1688,
+     1686,  1684,  1682,  1680,  1678,  1677,  1675,  1674,  1672,  1670,  1669,  1667,
+     1666,  1664,  1662,  1661,  1659,  1658,  1656,  1654,  1653,  1651,  1650,  1648,
+     1646,  1645,  1643,  1642,  1640,  1638,  1637,  1635,  1634,  1632,  1630,  1629,
+     1627,  1626,  1624,  1622,  1621,  1619,  1618,  1616,  1614,  1613,  1611,  1610,
+     1608,  1606,  1605,  1603,  1602,  1600,  1598,  1596,  1594,  1593,  1591,  1589,
+     1587,  1585,  1583,  1581,  1580,  1578,  1576,  1574,  1572,  1570,  1568,  1567,
+     1565,  1563,  1561,  1559,  1557,  1555,  1553,  1552,  1550,  1548,  1546,  1544,
+     1542,  1540,  1539,  1537,  1535,  1533,  1531,  1529,  1527,  1526,  1524,  1522,
+     1520,  1518,  1517,  1515,  1513,  1511,  1510,  1508,  1506,  1504,  1503,  1501,
+     1499,  1497,  1496,  1494,  1492,  1490,  1489,  1487,  1485,  1483,  1482,  1480,
+     1478,  1477,  1475,  1473,  1471,  1470,  1468,  1466,  1464,  1463,  1461,  1459,
+     1457,  1456,  1454,  1452,  1450,  1449,  1447,  1445,  1443,  1442,  1440,  1438,
+     1436,  1435,  1433,  1431,  1429,  1427,  1425,  1424,  1422,  1420,  1418,  1416,
+     1415,  1413,  1411,  1409,  1407,  1405,  1404,  1402,  1400,  1398,  1396,  1395,
+     1393,  1391,  1389,  1387,  1385,  1384,  1382,  1380,  1378,  1376,  1375,  1373,
+     1371,  1369,  1367,  1365,  1364,  1362,  1360,  1358,  1357,  1355,  1353,  1351,
+     1350,  1348,  1346,  1344,  1343,  1341,  1339,  1337,  1336,  1334,  1332,  1330,
+     1329,  1327,  1325,  1323,  1322,  1320,  1318,  1317,  1315,  1313,  1311,  1310,
+     1308,  1306,  1304,  1303,  1301,  1299,  1297,  1296,  1294,  1292,  1290,  1289,
+     1287,  1285,  1283,  1282,  1280,  1278,  1276,  1274,  1273,  1271,  1269,  1267,
+     1265,  1263,  1261,  1260,  1258,  1256,  1254,  1252,  1250,  1248,  1247,  1245,
+     1243,  1241,  1239,  1237,  1235,  1233,  1232,  1230,  1228,  1226,  1224,  1222,
+     1220,  1219,  1217,  1215,  1213,  1211,  1209,  1207,  1206,  1204,  1202,  1200,
+     1198,  1196,  1194,  1192,  1190,  1188,  1186,  1184,  1182,  1180,  1178,  1176,
+     1174,  1172,  1170,  1168,  1166,  1164,  1162,  1160,  1158,  1156,  1154,  1152,
+     1150,  1148,  1146,  1144,  1142,  1140,  1138,  1136,  1134,  1132,  1130,  1128,
+     1126,  1124,  1122,  1120,  1118,  1115,  1113,  1111,  1109,  1106,  1104,  1102,
+     1099,  1097,  1095,  1093,  1090,  1088,  1086,  1083,  1081,  1079,  1077,  1074,
+     1072,  1070,  1067,  1065,  1063,  1061,  1058,  1056,  1054,  1051,  1049,  1047,
+     1045,  1042,  1040,  1037,  1034,  1032,  1029,  1026,  1023,  1021,  1018,  1015,
+     1012,  1010,  1007,  1004,  1001,   999,   996,   993,   990,   988,   985,   982,
+      979,   977,   974,   971,   968,   966,   963,   960,   956,   952,   947,   943,
+      939,   935,   931,   926,   922,   918,   914,   909,   905,   901,   897,   893,
+      888,   884,   880,   878,   875,   873,   871,   868,   866,   864,   861,   859,
+      856,   854,   852,   849,   847,   845,   842,   840,   838,   835,   833,   831,
+      828,   826,   824,   821,   819,   816,   814,   812,   809,   807,   805,   802,
+      800,   797,   793,   790,   787,   783,   780,   777,   773,   770,   767,   763,
+      760,   757,   753,   750,   747,   743,   740,   737,   733,   730,   727,   723,
+      720,   717,   714,   711,   708,   705,   702,   699,   696,   693,   690,   687,
+      684,   681,   679,   676,   673,   670,   667,   664,   661,   658,   655,   652,
+      649,   646,   643,   640,   636,   632,   628,   624,   620,   616,   612,   608,
+      604,   600,   596,   592,   588,   584,   580,   576,   572,   568,   564,   560,
+      555,   550,   545,   540,   535,   530,   525,   520,   515,   510,   505,   500,
+      495,   490,   485,   480,   475,   469,   464,   459,   453,   448,   443,   437,
+      432,   427,   421,   416,   411,   405,   400,   392,   384,   376,   368,   360,
+      352,   344,   336,   328,   320,   310,   300,   290,   280,   270,   260,   250,
+      240,   227,   213,   200,   187,   173,   160,   142,   124,   107,    89,    71,
+       53,    36,    18,     0,   -49,   -98,  -148,  -197,  -246,  -295,  -345,  -394,
+     -443,  -492,  -542,  -591,  -640,  -640
+  };
+#endif
+
+#if ANY_THERMISTOR_IS(13)
+  #define HAS_UNIFORM_TEMPTABLE_13 1
+  #define UNIFORM_TEMPTABLE_13_SHIFT 0 // max error 0.19 degC
+  const int16_t uniform_temptable_13[] PROGMEM = {
+     4800,  4749,  4698,  4648,  4601,  4556,  4510,  4468,  4433,  4398,  4362,  4327,
+     4296,  4265,  4235,  4205,  4175,  4147,  4121,  4095,  4070,  4044,  4018,  3994,
+     3974,  3954,  3934,  3913,  3893,  3873,  3853,  3834,  3817,  3800,  3784,  3767,
+     3750,  3733,  3717,  3700,  3683,  3669,  3655,  3642,  3628,  3615,  3601,  3588,
+     3574,  3561,  3547,  3533,  3520,  3509,  3498,  3487,  3477,  3466,  3455,  3444,
+     3433,  3423,  3412,  3401,  3390,  3379,  3369,  3358,  3348,  3338,  3328,  3318,
+     3308,  3298,  3288,  3278,  3268,  3258,  3248,  3238,  3228,  3218,  3208,  3198,
+     3191,  3183,  3176,  3169,  3161,  3154,  3146,  3139,  3132,  3124,  3117,  3110,
+     3102,  3095,  3087,  3080,  3073,  3065,  3058,  3050,  3043,  3037,  3030,  3024,
+     3018,  3012,  3006,  3000,  2994,  2988,  2982,  2976,  2970,  2964,  2958,  2952,
+     2946,  2940,  2934,  2928,  2922,  2916,  2910,  2904,  2898,  2892,  2886,  2880,
+     2875,  2870,  2865,  2860,  2855,  2850,  2845,  2840,  2835,  2830,  2825,  2820,
+     2815,  2810,  2805,  2799,  2794,  2789,  2784,  2779,  2774,  2769,  2764,  2759,
+     2754,  2749,  2744,  2739,  2734,  2729,  2724,  2719,  2715,  2711,  2707,  2702,
+     2698,  2694,  2690,  2685,  2681,  2677,  2673,  2669,  2664,  2660,  2656,  2652,
+     2647,  2643,  2639,  2635,  2630,  2626,  2622,  2618,  2614,  2609,  2605,  2601,
+     2597,  2592,  2588,  2584,  2580,  2576,  2571,  2567,  2563,  2559,  2556,  2552,
+     2549,  2546,  2542,  2539,  2536,  2532,  2529,  2526,  2522,  2519,  2516,  2512,
+     2509,  2506,  2502,  2499,  2496,  2492,  2489,  2486,  2482,  2479,  2476,  2472,
+     2469,  2466,  2463,  2459,  2456,  2453,  2449,  2446,  2443,  2439,  2436,  2433,
+     2429,  2426,  2423,  2419,  2416,  2413,  2409,  2406,  2403,  2399,  2396,  2393,
+     2389,  2386,  2383,  2379,  2376,  2373,  2369,  2366,  2363,  2359,  2356,  2353,
+     2349,  2346,  2343,  2339,  2336,  2333,  2330,  2326,  2323,  2320,  2316,  2313,
+     2310,  2306,  2303,  2300,  2296,  2293,  2290,  2286,  2283,  2280,  2276,  2273,
+     2270,  2266,  2263,  2260,  2256,  2253,  2250,  2246,  2243,  2240,  2237,  2235,
+     2232,  2230,  2228,  2225,  2223,  2220,  2218,  2215,  2213,  2210,  2208,  2205,
+     2203,  2200,  2198,  2196,  2193,  2191,  2188,  2186,  2183,  2181,  2178,  2176,
+     2173,  2171,  2169,  2166,  2164,  2161,  2159,  2156,  2154,  2151,  2149,  2146,
+     2144,  2142,  2139,  2137,  2134,  2132,  2129,  2127,  2124,  2122,  2119,  2117,
+     2114,  2112,  2110,  2107,  2105,  2102,  2100,  2097,  2095,  2092,  2090,  2087,
+     2085,  2083,  2080,  2078,  2075,  2073,  2070,  2068,  2065,  2063,  2060,  2058,
+     2055,  2053,  2051,  2048,  2046,  2043,  2041,  2038,  2036,  2033,  2031,  2028,
+     2026,  2024,  2021,  2019,  2016,  2014,  2011,  2009,  2006,  2004,  2001,  1999,
+     1997,  1994,  1992,  1989,  1987,  1984,  1982,  1979,  1977,  1974,  1972,  1969,
+     1967,  1965,  1962,  1960,  1957,  1955,  1952,  1950,  1947,  1945,  1942,  1940,
+     1938,  1935,  1933,  1930,  1928,  1925,  1923,  1920,  1918,  1916,  1914,  1911,
+     1909,  1907,  1905,  1902,  1900,  1898,  1896,  1894,  1891,  1889,  1887,  1885,
+     1882,  1880,  1878,  1876,  1873,  1871,  1869,  1867,  1865,  1862,  1860,  1858,
+     1856,  1853,  1851,  1849,  1847,  1844,  1842,  1840,  1838,  1836,  1833,  1831,
+     1829,  1827,  1824,  1822,  1820,  1818,  1815,  1813,  1811,  1809,  1807,  1804,
+     1802,  1800,  1798,  1795,  1793,  1791,  1789,  1786,  1784,  1782,  1780,  1778,
+     1775,  1773,  1771,  1769,  1766,  1764,  1762,  1760,  1757,  1755,  1753,  1751,
+     1749,  1746,  1744,  1742,  1740,  1737,  1735,  1733,  1731,  1728,  1726,  1724,
+     1722,  1720,  1717,  1715,  1713,  1711,  1708,  1706,  1704,  1702,  1699,  1697,
+     1695,  1693,  1691,  1688,  1686,  1684,  1682,  1679,  1677,  1675,  1673,  1670,
+     1668,  1666,  1664,  1662,  1659,  1657,  1655,  1653,  1650,  1648,  1646,  1644,
+     1641,  1639,  1637,  1635,  1633,  1630,  1628,  1626,  1624,  1621,  1619,  1617,
+     1615,  1612,  1610,  1608,  1606,  1604,  1601,  1599,  1597,  1595,  1593,  1590,
+     1588,  1586,  1584,  1582,  1579,  1577,  1575,  1573,  1571,  1569,  1566,  1564,
+     1562,  1560,  1558,  1555,  1553,  1551,  1549,  1547,  1545,  1542,  1540,  1538,
+     1536,  1534,  1531,  1529,  1527,  1525,  1523,  1521,  1518,  1516,  1514,  1512,
+     1510,  1507,  1505,  1503,  1501,  1499,  1497,  1494,  1492,  1490,  1488,  1486,
+     1483,  1481,  1479,  1477,  1475,  1473,  1470,  1468,  1466,  1464,  1462,  1459,
+     1457,  1455,  1453,  1451,  1449,  1446,  1444,  1442,  1440,  1438,  1435,  1433,
+     1431,  1429,  1427,  1425,  1422,  1420,  1418,  1416,  1414,  1411,  1409,  1407,
+     1405,  1403,  1401,  1398,  1396,  1394,  1392,  1390,  1387,  1385,  1383,  1381,
+     1379,  1377,  1374,  1372,  1370,  1368,  1366,  1363,  1361,  1359,  1357,  1355,
+     1353,  1350,  1348,  1346,  1344,  1342,  1339,  1337,  1335,  1333,  1331,  1329,
+     1326,  1324,  1322,  1320,  1318,  1315,  1313,  1311,  1309,  1307,  1305,  1302,
+     1300,  1298,  1296,  1294,  1291,  1289,  1287,  1285,  1283,  1281,  1278,  1275,
+     1273,  1270,  1267,  1265,  1262,  1259,  1257,  1254,  1251,  1249,  1246,  1244,
+     1241,  1238,  1236,  1233,  1230,  1228,  1225,  1222,  1220,  1217,  1214,  1212,
+     1209,  1206,  1204,  1201,  1198,  1196,  1193,  1190,  1188,  1185,  1182,  1180,
+     1177,  1174,  1172,  1169,  1166,  1164,  1161,  1159,  1156,  1153,  1151,  1148,
+     1145,  1143,  1140,  1137,  1135,  1132,  1129,  1127,  1124,  1121,  1119,  1116,
+     1113,  1111,  1108,  1105,  1103,  1100,  1097,  1095,  1092,  1089,  1087,  1084,
+     1081,  1079,  1076,  1074,  1071,  1068,  1066,  1063,  1060,  1058,  1055,  1052,
+     1050,  1047,  1044,  1042,  1039,  1036,  1034,  1031,  1028,  1026,  1023,  1020,
+     1018,  1015,  1012,  1010,  1007,  1004,  1002,   999,   996,   994,   991,   989,
+      986,   983,   981,   978,   975,   973,   970,   967,   965,   962,   959,   955,
+      951,   947,   943,   939,   935,   932,   928,   924,   920,   916,   912,   908,
+      904,   900,   896,   892,   888,   885,   881,   877,   873,   869,   865,   861,
+      857,   853,   849,   845,   842,   838,   834,   830,   826,   822,   818,   814,
+      810,   806,   802,   798,   795,   791,   787,   783,   779,   775,   771,   767,
+      763,   759,   755,   751,   748,   744,   740,   736,   732,   728,   724,   720,
+      716,   712,   708,   705,   701,   697,   693,   689,   685,   681,   677,   673,
+      669,   665,   661,   658,   654,   650,   646,   642,   636,   630,   623,   616,
+      609,   602,   595,   588,   581,   575,   568,   561,   554,   547,   540,   533,
+      526,   519,   513,   506,   499,   492,   485,   478,   471,   464,   458,   451,
+      444,   437,   430,   423,   416,   409,   402,   396,   389,   382,   375,   368,
+      361,   354,   347,   341,   334,   327,   320,   306,   292,   278,   263,   249,
+      235,   221,   207,   193,   179,   165,   150,   136,   122,   108,    94,    80,
+       66,    52,    38,    23,     9,     0
+  };
+#endif
+
+#if ANY_THERMISTOR_IS(15)
+  #define HAS_UNIFORM_TEMPTABLE_15 1
+  #define UNIFORM_TEMPTABLE_15_SHIFT 0 // max error 0.06 degC
+  const int16_t uniform_temptable_15[] PROGMEM = {
+     4400,  4360,  4320,  4240,  4160,  4123,  4085,  4048,  4021,  3995,  3968,  3947,
+     3927,  3906,  3886,  3865,  3845,  3824,  3810,  3796,  3782,  3768,  3754,  3740,
+     3726,  3712,  3696,  3680,  3664,  3648,  3632,  3616,  3600,  3584,  3568,  3552,
+     3539,  3525,  3512,  3499,  3485,  3472,  3459,  3445,  3432,  3419,  3405,  3392,
+     3386,  3379,  3373,  3366,  3360,  3354,  3347,  3341,  3334,  3328,  3322,  3315,
+     3309,  3302,  3296,  3287,  3279,  3270,  3262,  3253,  3244,  3236,  3227,  3218,
+     3210,  3201,  3193,  3184,  3173,  3163,  3152,  3141,  3131,  3120,  3109,  3099,
+     3088,  3077,  3067,  3056,  3049,  3043,  3036,  3029,  3023,  3016,  3009,  3003,
+     2996,  2989,  2983,  2976,  2970,  2965,  2959,  2953,  2947,  2942,  2936,  2930,
+     2925,  2919,  2913,  2907,  2902,  2896,  2890,  2885,  2879,  2873,  2867,  2862,
+     2856,  2850,  2845,  2839,  2833,  2827,  2822,  2816,  2811,  2806,  2801,  2796,
+     2791,  2786,  2781,  2776,  2771,  2766,  2761,  2756,  2751,  2746,  2742,  2737,
+     2732,  2727,  2722,  2717,  2712,  2707,  2702,  2697,  2692,  2687,  2682,  2677,
+     2672,  2668,  2664,  2660,  2656,  2653,  2649,  2645,  2641,  2637,  2633,  2629,
+     2625,  2621,  2618,  2614,  2610,  2606,  2602,  2598,  2594,  2590,  2586,  2582,
+     2579,  2575,  2571,  2567,  2563,  2559,  2555,  2551,  2547,  2544,  2540,  2536,
+     2532,  2528,  2525,  2521,  2518,  2514,  2511,  2507,  2504,  2500,  2497,  2493,
+     2490,  2486,  2483,  2479,  2476,  2472,  2469,  2465,  2462,  2458,  2455,  2451,
+     2448,  2445,  2441,  2438,  2434,  2431,  2427,  2424,  2420,  2417,  2413,  2410,
+     2406,  2403,  2399,  2396,  2392,  2389,  2385,  2382,  2378,  2375,  2371,  2368,
+     2365,  2361,  2358,  2354,  2351,  2347,  2344,  2340,  2337,  2333,  2330,  2327,
+     2323,  2320,  2316,  2313,  2309,  2306,  2302,  2299,  2296,  2292,  2289,  2285,
+     2282,  2278,  2275,  2271,  2268,  2264,  2261,  2258,  2254,  2251,  2247,  2244,
+     2240,  2237,  2233,  2230,  2227,  2223,  2220,  2216,  2213,  2209,  2206,  2202,
+     2199,  2195,  2192,  2189,  2186,  2184,  2181,  2178,  2175,  2173,  2170,  2167,
+     2164,  2162,  2159,  2156,  2153,  2151,  2148,  2145,  2142,  2140,  2137,  2134,
+     2131,  2129,  2126,  2123,  2120,  2118,  2115,  2112,  2109,  2106,  2104,  2101,
+     2098,  2095,  2093,  2090,  2087,  2084,  2082,  2079,  2076,  2073,  2071,  2068,
+     2065,  2062,  2060,  2057,  2054,  2051,  2049,  2046,  2043,  2040,  2038,  2035,
+     2032,  2030,  2027,  2025,  2022,  2020,  2018,  2015,  2013,  2011,  2008,  2006,
+     2003,  2001,  1999,  1996,  1994,  1991,  1989,  1987,  1984,  1982,  1979,  1977,
+     1975,  1972,  1970,  1968,  1965,  1963,  1960,  1958,  1956,  1953,  1951,  1948,
+     1946,  1944,  1941,  1939,  1936,  1934,  1932,  1929,  1927,  1925,  1922,  1920,
+     1917,  1915,  1913,  1910,  1908,  1905,  1903,  1901,  1898,  1896,  1893,  1891,
+     1889,  1886,  1884,  1882,  1879,  1877,  1874,  1872,  1870,  1867,  1865,  1862,
+     1860,  1857,  1855,  1852,  1850,  1848,  1845,  1843,  1840,  1838,  1835,  1833,
+     1830,  1828,  1826,  1823,  1821,  1818,  1816,  1813,  1811,  1808,  1806,  1804,
+     1801,  1799,  1796,  1794,  1791,  1789,  1786,  1784,  1782,  1779,  1777,  1774,
+     1772,  1769,  1767,  1764,  1762,  1760,  1757,  1755,  1752,  1750,  1747,  1745,
+     1742,  1740,  1738,  1735,  1733,  1730,  1728,  1725,  1723,  1720,  1718,  1716,
+     1713,  1711,  1708,  1706,  1703,  1701,  1698,  1696,  1694,  1692,  1690,  1687,
+     1685,  1683,  1681,  1679,  1677,  1675,  1673,  1670,  1668,  1666,  1664,  1662,
+     1660,  1658,  1655,  1653,  1651,  1649,  1647,  1645,  1643,  1641,  1638,  1636,
+     1634,  1632,  1630,  1628,  1626,  1623,  1621,  1619,  1617,  1615,  1613,  1611,
+     1609,  1606,  1604,  1602,  1600,  1598,  1596,  1594,  1591,  1589,  1587,  1585,
+     1583,  1581,  1579,  1577,  1574,  1572,  1570,  1568,  1566,  1564,  1562,  1559,
+     1557,  1555,  1553,  1551,  1549,  1547,  1545,  1542,  1540,  1538,  1536,  1534,
+     1532,  1530,  1527,  1525,  1523,  1521,  1519,  1517,  1515,  1513,  1510,  1508,
+     1506,  1504,  1502,  1500,  1498,  1495,  1493,  1491,  1489,  1487,  1485,  1483,
+     1481,  1478,  1476,  1474,  1472,  1470,  1468,  1466,  1463,  1461,  1459,  1457,
+     1455,  1453,  1451,  1449,  1446,  1444,  1442,  1440,  1438,  1436,  1434,  1431,
+     1429,  1427,  1425,  1423,  1421,  1419,  1417,  1414,  1412,  1410,  1408,  1406,
+     1404,  1402,  1399,  1397,  1395,  1393,  1391,  1389,  1387,  1385,  1382,  1380,
+     1378,  1376,  1374,  1371,  1369,  1367,  1365,  1362,  1360,  1358,  1356,  1353,
+     1351,  1349,  1347,  1344,  1342,  1340,  1338,  1335,  1333,  1331,  1329,  1326,
+     1324,  1322,  1320,  1317,  1315,  1313,  1311,  1308,  1306,  1304,  1302,  1299,
+     1297,  1295,  1293,  1290,  1288,  1286,  1284,  1281,  1279,  1277,  1275,  1272,
+     1270,  1268,  1266,  1263,  1261,  1259,  1257,  1254,  1252,  1250,  1248,  1245,
+     1243,  1241,  1239,  1236,  1234,  1232,  1230,  1227,  1225,  1223,  1221,  1218,
+     1216,  1214,  1211,  1209,  1207,  1205,  1202,  1200,  1198,  1195,  1193,  1191,
+     1189,  1186,  1184,  1182,  1179,  1177,  1175,  1173,  1170,  1168,  1166,  1163,
+     1161,  1159,  1157,  1154,  1152,  1149,  1147,  1144,  1142,  1139,  1137,  1134,
+     1132,  1129,  1127,  1124,  1122,  1119,  1116,  1114,  1111,  1109,  1106,  1104,
+     1101,  1099,  1096,  1094,  1091,  1089,  1086,  1083,  1081,  1078,  1076,  1073,
+     1071,  1068,  1066,  1063,  1061,  1058,  1055,  1053,  1050,  1048,  1045,  1043,
+     1040,  1038,  1035,  1033,  1030,  1028,  1025,  1022,  1020,  1017,  1015,  1012,
+     1010,  1007,  1005,  1002,  1000,   997,   995,   992,   989,   986,   983,   980,
+      976,   973,   970,   967,   964,   961,   958,   955,   952,   948,   945,   942,
+      939,   936,   933,   930,   927,   924,   920,   917,   914,   911,   908,   905,
+      902,   899,   896,   892,   889,   886,   883,   880,   877,   874,   871,   868,
+      864,   861,   858,   855,   852,   849,   846,   843,   840,   836,   833,   830,
+      827,   824,   821,   818,   815,   812,   808,   805,   802,   799,   796,   793,
+      790,   787,   784,   780,   777,   774,   771,   768,   766,   764,   762,   760,
+      758,   756,   754,   752,   750,   748,   746,   744,   742,   740,   738,   736,
+      734,   732,   730,   728,   726,   724,   722,   720,   714,   709,   703,   698,
+      692,   687,   681,   676,   670,   665,   659,   654,   648,   643,   637,   632,
+      626,   621,   615,   610,   604,   599,   593,   588,   582,   577,   571,   566,
+      560,   553,   545,   538,   531,   524,   516,   509,   502,   495,   487,   480,
+      473,   465,   458,   451,   444,   436,   429,   422,   415,   407,   400,   390,
+      380,   370,   360,   350,   340,   330,   320,   310,   300,   290,   280,   270,
+      260,   250,   240,   227,   213,   200,   187,   173,   160,   144,   128,   112,
+       96,    80,    60,    40,    20,     0,   -20,   -40,   -60,   -80,  -100,  -120,
+     -140,  -160,  -180,  -200,  -220,  -240,  -240
+  };
+#endif
+
+#if ANY_THERMISTOR_IS(18)
+  #define HAS_UNIFORM_TEMPTABLE_18 1
+  #define UNIFORM_TEMPTABLE_18_SHIFT 0 // max error 0.06 degC
+  const int16_t uniform_temptable_18[] PROGMEM = {
+    11408, 10979, 10550, 10121,  9692,  9263,  8834,  8405,  7976,  7547,  7118,  6689,
+     6260,  5831,  5402,  4973,  4544,  4496,  4448,  4400,  4357,  4315,  4272,  4232,
+     4192,  4152,  4112,  4084,  4056,  4028,  4000,  3973,  3947,  3920,  3893,  3867,
+     3840,  3819,  3797,  3776,  3755,  3733,  3712,  3692,  3672,  3652,  3632,  3612,
+     3592,  3572,  3552,  3538,  3523,  3509,  3494,  3480,  3466,  3451,  3437,  3422,
+     3408,  3396,  3384,  3372,  3360,  3348,  3336,  3324,  3312,  3300,  3288,  3276,
+     3264,  3254,  3243,  3233,  3223,  3213,  3202,  3192,  3182,  3171,  3161,  3151,
+     3141,  3130,  3120,  3112,  3103,  3095,  3086,  3078,  3069,  3061,  3053,  3044,
+     3036,  3027,  3019,  3011,  3002,  2994,  2985,  2977,  2968,  2960,  2953,  2945,
+     2938,  2931,  2924,  2916,  2909,  2902,  2895,  2887,  2880,  2873,  2865,  2858,
+     2851,  2844,  2836,  2829,  2822,  2815,  2807,  2800,  2795,  2789,  2784,  2779,
+     2773,  2768,  2763,  2757,  2752,  2747,  2741,  2736,  2731,  2725,  2720,  2715,
+     2709,  2704,  2699,  2693,  2688,  2683,  2677,  2672,  2667,  2661,  2656,  2651,
+     2647,  2642,  2637,  2632,  2628,  2623,  2618,  2614,  2609,  2604,  2600,  2595,
+     2590,  2585,  2581,  2576,  2571,  2567,  2562,  2557,  2552,  2548,  2543,  2538,
+     2534,  2529,  2524,  2520,  2515,  2510,  2505,  2501,  2496,  2492,  2488,  2484,
+     2480,  2476,  2473,  2469,  2465,  2461,  2457,  2453,  2449,  2445,  2441,  2437,
+     2434,  2430,  2426,  2422,  2418,  2414,  2410,  2406,  2402,  2398,  2395,  2391,
+     2387,  2383,  2379,  2375,  2371,  2367,  2363,  2359,  2356,  2352,  2348,  2344,
+     2340,  2336,  2333,  2330,  2327,  2324,  2321,  2318,  2315,  2312,  2309,  2306,
+     2303,  2300,  2297,  2294,  2291,  2288,  2285,  2282,  2279,  2276,  2273,  2270,
+     2267,  2264,  2261,  2258,  2255,  2252,  2249,  2246,  2243,  2240,  2237,  2234,
+     2231,  2228,  2225,  2222,  2219,  2216,  2213,  2210,  2207,  2204,  2201,  2198,
+     2195,  2192,  2189,  2186,  2184,  2181,  2178,  2175,  2173,  2170,  2167,  2164,
+     2162,  2159,  2156,  2153,  2151,  2148,  2145,  2142,  2140,  2137,  2134,  2131,
+     2129,  2126,  2123,  2120,  2118,  2115,  2112,  2109,  2106,  2104,  2101,  2098,
+     2095,  2093,  2090,  2087,  2084,  2082,  2079,  2076,  2073,  2071,  2068,  2065,
+     2062,  2060,  2057,  2054,  2051,  2049,  2046,  2043,  2040,  2038,  2035,  2032,
+     2030,  2027,  2025,  2022,  2020,  2017,  2015,  2013,  2010,  2008,  2005,  2003,
+     2000,  1998,  1996,  1993,  1991,  1988,  1986,  1984,  1981,  1979,  1976,  1974,
+     1971,  1969,  1967,  1964,  1962,  1959,  1957,  1954,  1952,  1950,  1947,  1945,
+     1942,  1940,  1937,  1935,  1933,  1930,  1928,  1925,  1923,  1920,  1918,  1916,
+     1913,  1911,  1908,  1906,  1904,  1901,  1899,  1896,  1894,  1891,  1889,  1887,
+     1884,  1882,  1879,  1877,  1874,  1872,  1870,  1868,  1866,  1863,  1861,  1859,
+     1857,  1855,  1853,  1850,  1848,  1846,  1844,  1842,  1840,  1837,  1835,  1833,
+     1831,  1829,  1827,  1824,  1822,  1820,  1818,  1816,  1814,  1811,  1809,  1807,
+     1805,  1803,  1801,  1798,  1796,  1794,  1792,  1790,  1788,  1786,  1783,  1781,
+     1779,  1777,  1775,  1773,  1770,  1768,  1766,  1764,  1762,  1760,  1757,  1755,
+     1753,  1751,  1749,  1747,  1744,  1742,  1740,  1738,  1736,  1734,  1731,  1729,
+     1727,  1725,  1723,  1721,  1718,  1716,  1714,  1712,  1710,  1708,  1706,  1704,
+     1702,  1700,  1698,  1696,  1694,  1691,  1689,  1687,  1685,  1683,  1681,  1679,
+     1677,  1675,  1673,  1671,  1669,  1667,  1665,  1663,  1661,  1659,  1657,  1655,
+     1653,  1650,  1648,  1646,  1644,  1642,  1640,  1638,  1636,  1634,  1632,  1630,
+     1628,  1626,  1624,  1622,  1620,  1618,  1616,  1614,  1611,  1609,  1607,  1605,
+     1603,  1601,  1599,  1597,  1595,  1593,  1591,  1589,  1587,  1585,  1583,  1581,
+     1579,  1577,  1575,  1573,  1570,  1568,  1566,  1564,  1562,  1560,  1558,  1556,
+     1554,  1552,  1550,  1548,  1546,  1544,  1542,  1540,  1538,  1536,  1534,  1532,
+     1530,  1528,  1526,  1524,  1522,  1520,  1518,  1516,  1514,  1512,  1511,  1509,
+     1507,  1505,  1503,  1501,  1499,  1497,  1495,  1493,  1491,  1489,  1487,  1485,
+     1483,  1481,  1479,  1477,  1475,  1473,  1471,  1469,  1467,  1465,  1463,  1461,
+     1459,  1457,  1455,  1453,  1451,  1449,  1447,  1445,  1443,  1441,  1439,  1437,
+     1435,  1433,  1432,  1430,  1428,  1426,  1424,  1422,  1420,  1418,  1416,  1414,
+     1412,  1410,  1408,  1406,  1404,  1402,  1400,  1398,  1396,  1394,  1392,  1390,
+     1388,  1386,  1385,  1383,  1381,  1379,  1377,  1375,  1374,  1372,  1370,  1368,
+     1366,  1364,  1362,  1361,  1359,  1357,  1355,  1353,  1351,  1350,  1348,  1346,
+     1344,  1342,  1340,  1338,  1337,  1335,  1333,  1331,  1329,  1327,  1326,  1324,
+     1322,  1320,  1318,  1316,  1314,  1313,  1311,  1309,  1307,  1305,  1303,  1302,
+     1300,  1298,  1296,  1294,  1292,  1290,  1289,  1287,  1285,  1283,  1281,  1279,
+     1278,  1276,  1274,  1272,  1270,  1268,  1266,  1265,  1263,  1261,  1259,  1257,
+     1255,  1254,  1252,  1250,  1248,  1246,  1243,  1241,  1239,  1237,  1234,  1232,
+     1230,  1228,  1225,  1223,  1221,  1219,  1216,  1214,  1212,  1210,  1207,  1205,
+     1203,  1201,  1198,  1196,  1194,  1192,  1189,  1187,  1185,  1183,  1180,  1178,
+     1176,  1174,  1171,  1169,  1167,  1165,  1162,  1160,  1158,  1156,  1153,  1151,
+     1149,  1147,  1144,  1142,  1140,  1138,  1135,  1133,  1131,  1129,  1126,  1124,
+     1122,  1120,  1117,  1115,  1113,  1111,  1108,  1106,  1104,  1102,  1099,  1097,
+     1095,  1093,  1090,  1088,  1085,  1083,  1080,  1078,  1075,  1073,  1070,  1067,
+     1065,  1062,  1060,  1057,  1054,  1052,  1049,  1047,  1044,  1042,  1039,  1036,
+     1034,  1031,  1029,  1026,  1023,  1021,  1018,  1016,  1013,  1011,  1008,  1005,
+     1003,  1000,   998,   995,   993,   990,   987,   985,   982,   980,   977,   974,
+      972,   969,   967,   964,   962,   959,   956,   954,   951,   949,   946,   943,
+      941,   938,   936,   933,   931,   928,   925,   922,   920,   917,   914,   911,
+      908,   905,   903,   900,   897,   894,   891,   888,   886,   883,   880,   877,
+      874,   872,   869,   866,   863,   860,   857,   855,   852,   849,   846,   843,
+      840,   838,   835,   832,   829,   826,   824,   821,   818,   815,   812,   809,
+      807,   804,   801,   798,   795,   792,   790,   787,   784,   780,   776,   772,
+      768,   764,   760,   756,   752,   748,   744,   740,   736,   732,   728,   724,
+      720,   716,   712,   708,   704,   700,   696,   692,   688,   684,   680,   676,
+      672,   668,   664,   660,   656,   652,   648,   644,   640,   636,   632,   628,
+      624,   619,   614,   609,   604,   599,   594,   589,   584,   579,   574,   569,
+      564,   559,   554,   550,   545,   540,   535,   530,   525,   520,   515,   510,
+      505,   500,   495,   490,   485,   480,   472,   464,   456,   448,   440,   432,
+      424,   416,   408,   400,   392,   384,   376,   368,   360,   352,   344,   336,
+      328,   320,   309,   297,   286,   274,   263,   251,   240,   229,   217,   206,
+      194,   183,   171,   160,   144,   128,   112,    96,    80,    64,    48,    32,
+       16,     0,  -312,  -624,  -936, -1248, -1560, -1872, -2184, -2496, -2808, -3120,
+    -3432, -3744, -4056, -4368, -4368
+  };
+#endif
+
+#if ANY_THERMISTOR_IS(20)
+  #define HAS_UNIFORM_TEMPTABLE_20 1
+  #define UNIFORM_TEMPTABLE_20_SHIFT 0 // max error 0.06 degC
+  const int16_t uniform_temptable_20[] PROGMEM = {
+        0,     0,     0,     0,     0,     0,     0,     0,     1,     1,     1,     1,
+        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,     2,     2,
+        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+        3,     3,     3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+        3,     3,     4,     4,     4,     4,     4,     4,     4,     4,     4,     4,
+        4,     4,     4,     4,     5,     5,     5,     5,     5,     5,     5,     5,
+        5,     5,     5,     5,     5,     5,     5,     6,     6,     6,     6,     6,
+        6,     6,     6,     6,     6,     6,     6,     6,     6,     7,     7,     7,
+        7,     7,     7,     7,     7,     7,     7,     7,     7,     7,     7,     8,
+        8,     8,     8,     8,     8,     8,     8,     8,     8,     8,     8,     8,
+        8,     9,     9,     9,     9,     9,     9,     9,     9,     9,     9,     9,
+        9,     9,     9,    10,    10,    10,    10,    10,    10,    10,    10,    10,
+       10,    10,    10,    10,    10,    11,    11,    11,    11,    11,    11,    11,
+       11,    11,    11,    11,    11,    11,    11,    11,    12,    12,    12,    12,
+       12,    12,    12,    12,    12,    12,    12,    12,    12,    12,    13,    13,
+       13,    13,    13,    13,    13,    13,    13,    13,    13,    13,    13,    13,
+       14,    14,    14,    14,    14,    14,    14,    14,    14,    14,    14,    14,
+       14,    14,    15,    15,    15,    15,    15,    15,    15,    15,    15,    15,
+       15,    15,    15,    15,    16,    16,    16,    16,    16,    16,    16,    16,
+       32,    48,    64,    80,    96,   112,   128,   144,   160,   178,   196,   213,
+      231,   249,   267,   284,   302,   320,   340,   360,   380,   400,   420,   440,
+      460,   480,   498,   516,   533,   551,   569,   587,   604,   622,   640,   660,
+      680,   700,   720,   740,   760,   780,   800,   818,   836,   853,   871,   889,
+      907,   924,   942,   960,   980,  1000,  1020,  1040,  1060,  1080,  1100,  1120,
+     1140,  1160,  1180,  1200,  1220,  1240,  1260,  1280,  1298,  1316,  1333,  1351,
+     1369,  1387,  1404,  1422,  1440,  1460,  1480,  1500,  1520,  1540,  1560,  1580,
+     1600,  1620,  1640,  1660,  1680,  1700,  1720,  1740,  1760,  1778,  1796,  1813,
+     1831,  1849,  1867,  1884,  1902,  1920,  1940,  1960,  1980,  2000,  2020,  2040,
+     2060,  2080,  2100,  2120,  2140,  2160,  2180,  2200,  2220,  2240,  2260,  2280,
+     2300,  2320,  2340,  2360,  2380,  2400,  2420,  2440,  2460,  2480,  2500,  2520,
+     2540,  2560,  2580,  2600,  2620,  2640,  2660,  2680,  2700,  2720,  2740,  2760,
+     2780,  2800,  2820,  2840,  2860,  2880,  2900,  2920,  2940,  2960,  2980,  3000,
+     3020,  3040,  3060,  3080,  3100,  3120,  3140,  3160,  3180,  3200,  3220,  3240,
+     3260,  3280,  3300,  3320,  3340,  3360,  3380,  3400,  3420,  3440,  3460,  3480,
+     3500,  3520,  3540,  3560,  3580,  3600,  3620,  3640,  3660,  3680,  3703,  3726,
+     3749,  3771,  3794,  3817,  3840,  3860,  3880,  3900,  3920,  3940,  3960,  3980,
+     4000,  4020,  4040,  4060,  4080,  4100,  4120,  4140,  4160,  4183,  4206,  4229,
+     4251,  4274,  4297,  4320,  4340,  4360,  4380,  4400,  4420,  4440,  4460,  4480,
+     4500,  4520,  4540,  4560,  4580,  4600,  4620,  4640,  4663,  4686,  4709,  4731,
+     4754,  4777,  4800,  4820,  4840,  4860,  4880,  4900,  4920,  4940,  4960,  4983,
+     5006,  5029,  5051,  5074,  5097,  5120,  5140,  5160,  5180,  5200,  5220,  5240,
+     5260,  5280,  5303,  5326,  5349,  5371,  5394,  5417,  5440,  5463,  5486,  5509,
+     5531,  5554,  5577,  5600,  5620,  5640,  5660,  5680,  5700,  5720,  5740,  5760,
+     5783,  5806,  5829,  5851,  5874,  5897,  5920,  5943,  5966,  5989,  6011,  6034,
+     6057,  6080,  6100,  6120,  6140,  6160,  6180,  6200,  6220,  6240,  6263,  6286,
+     6309,  6331,  6354,  6377,  6400,  6423,  6446,  6469,  6491,  6514,  6537,  6560,
+     6583,  6606,  6629,  6651,  6674,  6697,  6720,  6743,  6766,  6789,  6811,  6834,
+     6857,  6880,  6903,  6926,  6949,  6971,  6994,  7017,  7040,  7063,  7086,  7109,
+     7131,  7154,  7177,  7200,  7223,  7246,  7269,  7291,  7314,  7337,  7360,  7383,
+     7406,  7429,  7451,  7474,  7497,  7520,  7543,  7566,  7589,  7611,  7634,  7657,
+     7680,  7703,  7726,  7749,  7771,  7794,  7817,  7840,  7863,  7886,  7909,  7931,
+     7954,  7977,  8000,  8024,  8048,  8072,  8096,  8119,  8143,  8167,  8191,  8215,
+     8239,  8263,  8287,  8310,  8334,  8358,  8382,  8406,  8430,  8454,  8478,  8501,
+     8525,  8549,  8573,  8597,  8621,  8645,  8669,  8693,  8716,  8740,  8764,  8788,
+     8812,  8836,  8860,  8884,  8907,  8931,  8955,  8979,  9003,  9027,  9051,  9075,
+     9099,  9122,  9146,  9170,  9194,  9218,  9242,  9266,  9290,  9313,  9337,  9361,
+     9385,  9409,  9433,  9457,  9481,  9504,  9528,  9552,  9576,  9600,  9625,  9651,
+     9676,  9702,  9727,  9752,  9778,  9803,  9829,  9854,  9879,  9905,  9930,  9956,
+     9981, 10006, 10032, 10057, 10083, 10108, 10133, 10159, 10184, 10210, 10235, 10260,
+    10286, 10311, 10337, 10362, 10387, 10413, 10438, 10463, 10489, 10514, 10540, 10565,
+    10590, 10616, 10641, 10667, 10692, 10717, 10743, 10768, 10794, 10819, 10844, 10870,
+    10895, 10921, 10946, 10971, 10997, 11022, 11048, 11073, 11098, 11124, 11149, 11175,
+    11200, 11226, 11252, 11279, 11305, 11331, 11357, 11384, 11410, 11436, 11462, 11489,
+    11515, 11541, 11567, 11593, 11620, 11646, 11672, 11698, 11725, 11751, 11777, 11803,
+    11830, 11856, 11882, 11908, 11934, 11961, 11987, 12013, 12039, 12066, 12092, 12118,
+    12144, 12170, 12197, 12223, 12249, 12275, 12302, 12328, 12354, 12380, 12407, 12433,
+    12459, 12485, 12511, 12538, 12564, 12590, 12616, 12643, 12669, 12695, 12721, 12748,
+    12774, 12800, 12828, 12856, 12884, 12912, 12940, 12968, 12996, 13025, 13053, 13081,
+    13109, 13137, 13165, 13193, 13221, 13249, 13277, 13305, 13333, 13361, 13389, 13418,
+    13446, 13474, 13502, 13530, 13558, 13586, 13614, 13642, 13670, 13698, 13726, 13754,
+    13782, 13811, 13839, 13867, 13895, 13923, 13951, 13979, 14007, 14035, 14063, 14091,
+    14119, 14147, 14175, 14204, 14232, 14260, 14288, 14316, 14344, 14372, 14400, 14429,
+    14458, 14487, 14516, 14545, 14575, 14604, 14633, 14662, 14691, 14720, 14749, 14778,
+    14807, 14836, 14865, 14895, 14924, 14953, 14982, 15011, 15040, 15069, 15098, 15127,
+    15156, 15185, 15215, 15244, 15273, 15302, 15331, 15360, 15389, 15418, 15447, 15476,
+    15505, 15535, 15564, 15593, 15622, 15651, 15680, 15709, 15738, 15767, 15796, 15825,
+    15855, 15884, 15913, 15942, 15971, 16000, 16031, 16063, 16094, 16125, 16157, 16188,
+    16220, 16251, 16282, 16314, 16345, 16376, 16408, 16439, 16471, 16502, 16533, 16565,
+    16596, 16627, 16659, 16690, 16722, 16753, 16784, 16816, 16847, 16878, 16910, 16941,
+    16973, 17004, 17035, 17067, 17098, 17129, 17161, 17192, 17224, 17255, 17286, 17318,
+    17349, 17380, 17412, 17443, 17475, 17506, 17537, 17569, 17600, 17600
+  };
+#endif
+
+#if ANY_THERMISTOR_IS(21)
+  #define HAS_UNIFORM_TEMPTABLE_21 1
+  #define UNIFORM_TEMPTABLE_21_SHIFT 0 // max error 0.25 degC
+  const int16_t uniform_temptable_21[] PROGMEM = {
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     1,
+        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+        1,     1,     1,     1,     1,     1,     1,     1,     1,     2,     2,     2,
+        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+        2,     2,     2,     2,     2,     2,     3,     3,     3,     3,     3,     3,
+        3,     3,     3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+        3,     3,     3,     3,     4,     4,     4,     4,     4,     4,     4,     4,
+        4,     4,     4,     4,     4,     4,     4,     4,     4,     4,     4,     4,
+        4,     5,     5,     5,     5,     5,     5,     5,     5,     5,     5,     5,
+        5,     5,     5,     5,     5,     5,     5,     5,     5,     5,     5,     6,
+        6,     6,     6,     6,     6,     6,     6,     6,     6,     6,     6,     6,
+        6,     6,     6,     6,     6,     6,     6,     6,     7,     7,     7,     7,
+        7,     7,     7,     7,     7,     7,     7,     7,     7,     7,     7,     7,
+        7,     7,     7,     7,     7,     7,     8,     8,     8,     8,     8,     8,
+        8,     8,     8,     8,     8,     8,     8,     8,     8,     8,     8,     8,
+        8,     8,     8,     9,     9,     9,     9,     9,     9,     9,     9,     9,
+        9,     9,     9,     9,     9,     9,     9,     9,     9,     9,     9,     9,
+        9,    10,    10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
+       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,    11,    11,
+       11,    11,    11,    11,    11,    11,    11,    11,    11,    11,    11,    11,
+       11,    11,    11,    11,    11,    11,    11,    11,    12,    12,    12,    12,
+       12,    12,    12,    12,    12,    12,    12,    12,    12,    12,    12,    12,
+       12,    12,    12,    12,    12,    13,    13,    13,    13,    13,    13,    13,
+       13,    13,    13,    13,    13,    13,    13,    13,    13,    13,    13,    13,
+       13,    13,    13,    14,    14,    14,    14,    14,    14,    14,    14,    14,
+       14,    14,    14,    14,    14,    14,    14,    14,    14,    14,    14,    14,
+       15,    15,    15,    15,    15,    15,    15,    15,    15,    15,    15,    15,
+       15,    15,    15,    15,    15,    15,    15,    15,    15,    15,    16,    16,
+       16,    16,    16,    16,    16,    16,    16,    16,    17,    27,    38,    48,
+       59,    69,    80,    91,   101,   112,   122,   133,   143,   154,   165,   177,
+      188,   200,   212,   224,   235,   247,   259,   271,   282,   294,   306,   318,
+      330,   344,   357,   370,   383,   396,   410,   423,   436,   449,   462,   476,
+      488,   500,   511,   523,   535,   546,   558,   570,   582,   593,   605,   617,
+      629,   640,   654,   667,   680,   693,   706,   720,   733,   746,   759,   772,
+      786,   799,   811,   822,   834,   846,   858,   869,   881,   893,   905,   916,
+      928,   940,   951,   964,   977,   990,  1003,  1016,  1030,  1043,  1056,  1069,
+     1082,  1096,  1109,  1122,  1135,  1148,  1162,  1175,  1188,  1201,  1214,  1228,
+     1241,  1254,  1267,  1280,  1292,  1304,  1316,  1327,  1339,  1351,  1362,  1374,
+     1386,  1398,  1409,  1421,  1433,  1445,  1458,  1472,  1485,  1498,  1511,  1524,
+     1538,  1551,  1564,  1577,  1590,  1604,  1617,  1630,  1643,  1656,  1670,  1683,
+     1696,  1709,  1722,  1736,  1749,  1762,  1774,  1785,  1797,  1809,  1820,  1832,
+     1844,  1856,  1867,  1879,  1891,  1903,  1914,  1927,  1940,  1953,  1966,  1980,
+     1993,  2006,  2019,  2032,  2046,  2059,  2072,  2085,  2098,  2112,  2125,  2138,
+     2151,  2164,  2178,  2191,  2204,  2217,  2230,  2244,  2257,  2270,  2283,  2296,
+     2310,  2323,  2336,  2349,  2362,  2376,  2389,  2402,  2415,  2428,  2442,  2455,
+     2468,  2481,  2494,  2508,  2521,  2534,  2547,  2560,  2574,  2587,  2600,  2613,
+     2626,  2640,  2653,  2666,  2679,  2692,  2706,  2719,  2732,  2745,  2758,  2772,
+     2785,  2798,  2811,  2824,  2838,  2851,  2864,  2877,  2890,  2904,  2917,  2930,
+     2943,  2956,  2970,  2983,  2996,  3009,  3022,  3036,  3049,  3062,  3075,  3088,
+     3102,  3115,  3128,  3141,  3154,  3168,  3181,  3194,  3207,  3220,  3234,  3247,
+     3260,  3273,  3286,  3300,  3313,  3326,  3339,  3352,  3366,  3379,  3392,  3405,
+     3418,  3432,  3445,  3458,  3471,  3484,  3498,  3511,  3524,  3537,  3550,  3564,
+     3577,  3590,  3603,  3616,  3630,  3643,  3656,  3669,  3683,  3698,  3713,  3728,
+     3743,  3758,  3773,  3788,  3803,  3819,  3834,  3848,  3861,  3874,  3887,  3900,
+     3914,  3927,  3940,  3953,  3966,  3980,  3993,  4006,  4019,  4032,  4046,  4059,
+     4072,  4085,  4098,  4112,  4125,  4138,  4151,  4165,  4180,  4195,  4210,  4225,
+     4240,  4256,  4271,  4286,  4301,  4316,  4330,  4343,  4356,  4369,  4382,  4396,
+     4409,  4422,  4435,  4448,  4462,  4475,  4488,  4501,  4514,  4528,  4541,  4554,
+     4567,  4580,  4594,  4607,  4620,  4633,  4647,  4662,  4677,  4693,  4708,  4723,
+     4738,  4753,  4768,  4783,  4798,  4812,  4825,  4838,  4851,  4864,  4878,  4891,
+     4904,  4917,  4930,  4944,  4957,  4971,  4987,  5002,  5017,  5032,  5047,  5062,
+     5077,  5092,  5107,  5122,  5135,  5148,  5162,  5175,  5188,  5201,  5214,  5228,
+     5241,  5254,  5267,  5280,  5296,  5311,  5326,  5341,  5356,  5371,  5386,  5401,
+     5416,  5431,  5446,  5461,  5477,  5492,  5507,  5522,  5537,  5552,  5567,  5582,
+     5597,  5611,  5624,  5637,  5650,  5664,  5677,  5690,  5703,  5716,  5730,  5743,
+     5756,  5771,  5786,  5801,  5816,  5831,  5846,  5861,  5876,  5891,  5906,  5921,
+     5936,  5952,  5967,  5982,  5997,  6012,  6027,  6042,  6057,  6072,  6086,  6100,
+     6113,  6126,  6139,  6152,  6166,  6179,  6192,  6205,  6218,  6232,  6245,  6261,
+     6276,  6291,  6306,  6321,  6336,  6351,  6366,  6381,  6396,  6411,  6427,  6442,
+     6457,  6472,  6487,  6502,  6517,  6532,  6547,  6562,  6577,  6592,  6608,  6623,
+     6638,  6653,  6668,  6683,  6698,  6713,  6728,  6743,  6758,  6773,  6789,  6804,
+     6819,  6834,  6849,  6864,  6879,  6894,  6909,  6924,  6939,  6955,  6970,  6985,
+     7000,  7015,  7030,  7045,  7060,  7075,  7090,  7105,  7120,  7136,  7151,  7166,
+     7181,  7196,  7211,  7226,  7241,  7256,  7271,  7286,  7301,  7317,  7332,  7347,
+     7362,  7377,  7392,  7407,  7422,  7437,  7452,  7467,  7483,  7498,  7513,  7528,
+     7543,  7558,  7573,  7588,  7603,  7618,  7633,  7648,  7664,  7679,  7694,  7709,
+     7724,  7739,  7754,  7769,  7784,  7799,  7814,  7829,  7845,  7860,  7875,  7890,
+     7905,  7920,  7935,  7950,  7965,  7980,  7995,  8000
+  };
+#endif
+
+#if ANY_THERMISTOR_IS(22)
+  #define HAS_UNIFORM_TEMPTABLE_22 1
+  #define UNIFORM_TEMPTABLE_22_SHIFT 0 // max error 0.06 degC
+  const int16_t uniform_temptable_22[] PROGMEM = {
+     5632,  5597,  5562,  5526,  5491,  5456,  5421,  5386,  5350,  5315,  5280,  5245,
+     5210,  5174,  5139,  5104,  5056,  5008,  4960,  4912,  4883,  4853,  4824,  4795,
+     4765,  4736,  4701,  4666,  4630,  4595,  4560,  4540,  4521,  4501,  4482,  4462,
+     4443,  4423,  4404,  4384,  4368,  4352,  4336,  4320,  4304,  4288,  4272,  4256,
+     4240,  4224,  4208,  4189,  4170,  4150,  4131,  4112,  4093,  4074,  4054,  4035,
+     4016,  4007,  3999,  3990,  3981,  3972,  3964,  3955,  3946,  3937,  3929,  3920,
+     3904,  3888,  3872,  3856,  3840,  3830,  3821,  3811,  3802,  3792,  3776,  3760,
+     3744,  3728,  3712,  3700,  3688,  3676,  3664,  3653,  3643,  3632,  3621,  3611,
+     3600,  3589,  3579,  3568,  3560,  3552,  3544,  3536,  3528,  3520,  3512,  3504,
+     3493,  3481,  3470,  3458,  3447,  3435,  3424,  3417,  3409,  3402,  3395,  3388,
+     3380,  3373,  3366,  3359,  3351,  3344,  3337,  3329,  3322,  3315,  3308,  3300,
+     3293,  3286,  3279,  3271,  3264,  3258,  3251,  3245,  3238,  3232,  3226,  3219,
+     3213,  3206,  3200,  3190,  3180,  3169,  3159,  3149,  3139,  3129,  3119,  3108,
+     3098,  3088,  3086,  3084,  3083,  3081,  3079,  3077,  3076,  3074,  3072,  3067,
+     3062,  3058,  3053,  3048,  3043,  3038,  3034,  3029,  3024,  3003,  2982,  2962,
+     2941,  2920,  2899,  2878,  2858,  2837,  2816,  2795,  2774,  2754,  2733,  2712,
+     2691,  2670,  2650,  2629,  2608,  2613,  2619,  2624,  2629,  2635,  2640,  2645,
+     2651,  2656,  2661,  2667,  2672,  2677,  2683,  2688,  2693,  2699,  2704,  2709,
+     2715,  2720,  2725,  2731,  2736,  2741,  2747,  2752,  2757,  2763,  2768,  2773,
+     2779,  2784,  2780,  2776,  2772,  2768,  2765,  2761,  2757,  2753,  2749,  2745,
+     2741,  2737,  2733,  2730,  2726,  2722,  2718,  2714,  2710,  2706,  2702,  2698,
+     2694,  2691,  2687,  2683,  2679,  2675,  2671,  2667,  2663,  2659,  2656,  2652,
+     2648,  2644,  2640,  2637,  2635,  2632,  2630,  2627,  2624,  2622,  2619,  2617,
+     2614,  2611,  2609,  2606,  2604,  2601,  2598,  2596,  2593,  2591,  2588,  2585,
+     2583,  2580,  2577,  2575,  2572,  2570,  2567,  2564,  2562,  2559,  2557,  2554,
+     2551,  2549,  2546,  2544,  2541,  2538,  2536,  2533,  2531,  2528,  2524,  2519,
+     2515,  2511,  2506,  2502,  2498,  2494,  2489,  2485,  2481,  2476,  2472,  2468,
+     2463,  2459,  2455,  2450,  2446,  2442,  2438,  2433,  2429,  2425,  2420,  2416,
+     2413,  2410,  2407,  2404,  2401,  2398,  2395,  2392,  2389,  2386,  2383,  2380,
+     2377,  2374,  2371,  2368,  2365,  2362,  2359,  2356,  2353,  2351,  2348,  2345,
+     2342,  2339,  2336,  2333,  2330,  2327,  2324,  2321,  2318,  2315,  2312,  2309,
+     2306,  2303,  2300,  2297,  2294,  2291,  2288,  2286,  2283,  2281,  2279,  2276,
+     2274,  2272,  2269,  2267,  2264,  2262,  2260,  2257,  2255,  2253,  2250,  2248,
+     2246,  2243,  2241,  2239,  2236,  2234,  2232,  2229,  2227,  2224,  2222,  2220,
+     2217,  2215,  2213,  2210,  2208,  2205,  2203,  2200,  2197,  2195,  2192,  2190,
+     2187,  2184,  2182,  2179,  2176,  2174,  2171,  2169,  2166,  2163,  2161,  2158,
+     2155,  2153,  2150,  2148,  2145,  2142,  2140,  2137,  2134,  2132,  2129,  2127,
+     2124,  2121,  2119,  2116,  2113,  2111,  2108,  2106,  2103,  2100,  2098,  2095,
+     2092,  2090,  2087,  2085,  2082,  2079,  2077,  2074,  2071,  2069,  2066,  2064,
+     2061,  2058,  2056,  2053,  2050,  2048,  2045,  2043,  2040,  2037,  2035,  2032,
+     2029,  2027,  2024,  2021,  2018,  2016,  2013,  2010,  2008,  2005,  2002,  1999,
+     1997,  1994,  1991,  1988,  1986,  1983,  1980,  1978,  1975,  1972,  1969,  1967,
+     1964,  1961,  1959,  1956,  1953,  1950,  1948,  1945,  1942,  1940,  1937,  1934,
+     1931,  1929,  1926,  1923,  1920,  1918,  1915,  1912,  1910,  1907,  1904,  1901,
+     1899,  1896,  1893,  1891,  1888,  1885,  1882,  1880,  1877,  1874,  1872,  1869,
+     1866,  1863,  1861,  1858,  1855,  1852,  1850,  1847,  1844,  1842,  1839,  1836,
+     1833,  1831,  1828,  1825,  1823,  1820,  1817,  1814,  1812,  1809,  1806,  1804,
+     1801,  1798,  1795,  1793,  1790,  1787,  1784,  1782,  1779,  1776,  1774,  1771,
+     1768,  1765,  1763,  1760,  1758,  1755,  1753,  1750,  1748,  1745,  1743,  1741,
+     1738,  1736,  1733,  1731,  1728,  1726,  1724,  1721,  1719,  1716,  1714,  1712,
+     1709,  1707,  1704,  1702,  1699,  1697,  1695,  1692,  1690,  1687,  1685,  1682,
+     1680,  1678,  1675,  1673,  1670,  1668,  1665,  1663,  1661,  1658,  1656,  1653,
+     1651,  1648,  1646,  1644,  1641,  1639,  1636,  1634,  1632,  1629,  1627,  1624,
+     1622,  1619,  1617,  1615,  1612,  1610,  1607,  1605,  1602,  1600,  1598,  1595,
+     1593,  1591,  1589,  1586,  1584,  1582,  1580,  1577,  1575,  1573,  1571,  1568,
+     1566,  1564,  1562,  1559,  1557,  1555,  1553,  1550,  1548,  1546,  1544,  1541,
+     1539,  1537,  1534,  1532,  1530,  1528,  1525,  1523,  1521,  1519,  1516,  1514,
+     1512,  1510,  1507,  1505,  1503,  1501,  1498,  1496,  1494,  1492,  1489,  1487,
+     1485,  1483,  1480,  1478,  1476,  1474,  1471,  1469,  1467,  1464,  1462,  1460,
+     1458,  1455,  1453,  1451,  1449,  1446,  1444,  1442,  1440,  1437,  1435,  1433,
+     1431,  1428,  1426,  1424,  1422,  1419,  1417,  1415,  1413,  1410,  1408,  1406,
+     1405,  1403,  1401,  1399,  1398,  1396,  1394,  1392,  1391,  1389,  1387,  1386,
+     1384,  1382,  1380,  1379,  1377,  1375,  1373,  1372,  1370,  1368,  1366,  1365,
+     1363,  1361,  1360,  1358,  1356,  1354,  1353,  1351,  1349,  1347,  1346,  1344,
+     1341,  1339,  1336,  1334,  1331,  1329,  1326,  1323,  1321,  1318,  1316,  1313,
+     1310,  1308,  1305,  1303,  1300,  1298,  1295,  1292,  1290,  1287,  1285,  1282,
+     1279,  1277,  1274,  1272,  1269,  1267,  1264,  1261,  1259,  1256,  1254,  1251,
+     1249,  1246,  1243,  1241,  1238,  1236,  1233,  1230,  1228,  1225,  1223,  1220,
+     1218,  1215,  1212,  1210,  1207,  1205,  1202,  1199,  1197,  1194,  1192,  1189,
+     1187,  1184,  1181,  1179,  1176,  1174,  1171,  1169,  1166,  1163,  1161,  1158,
+     1156,  1153,  1150,  1148,  1145,  1143,  1140,  1138,  1135,  1132,  1130,  1127,
+     1125,  1122,  1119,  1117,  1114,  1112,  1109,  1107,  1104,  1100,  1096,  1092,
+     1088,  1083,  1079,  1075,  1071,  1067,  1063,  1059,  1055,  1051,  1046,  1042,
+     1038,  1034,  1030,  1026,  1022,  1018,  1014,  1010,  1005,  1001,   997,   993,
+      989,   985,   981,   977,   973,   968,   964,   960,   956,   952,   948,   944,
+      940,   936,   931,   927,   923,   919,   915,   911,   907,   903,   899,   894,
+      890,   886,   882,   878,   874,   870,   866,   862,   858,   853,   849,   845,
+      841,   837,   833,   829,   825,   821,   816,   812,   808,   804,   800,   795,
+      790,   786,   781,   776,   771,   766,   762,   757,   752,   747,   742,   738,
+      733,   728,   723,   718,   714,   709,   704,   699,   694,   690,   685,   680,
+      675,   670,   666,   661,   656,   651,   646,   642,   637,   632,   627,   622,
+      618,   613,   608,   601,   594,   588,   581,   574,   567,   561,   554,   547,
+      540,   534,   527,   520,   513,   506,   500,   493,   486,   479,   473,   466,
+      459,   452,   446,   439,   432,   424,   416,   408,   400,   392,   384,   376,
+      368,   360,   352,   316,   280,   244,   208,   186,   163,   141,   118,    96,
+       64,    32,     0,     0
+  };
+#endif
+
+#if ANY_THERMISTOR_IS(23)
+  #define HAS_UNIFORM_TEMPTABLE_23 1
+  #define UNIFORM_TEMPTABLE_23_SHIFT 1 // max error 0.05 degC
+  const int16_t uniform_temptable_23[] PROGMEM = {
+    15008, 13360, 11712, 10064,  8416,  6768,  6538,  6307,  6077,  5846,  5616,  5498,
+     5379,  5261,  5142,  5024,  4947,  4870,  4794,  4717,  4640,  4582,  4525,  4467,
+     4410,  4352,  4307,  4262,  4218,  4173,  4128,  4093,  4058,  4022,  3987,  3952,
+     3920,  3888,  3856,  3824,  3792,  3766,  3741,  3715,  3690,  3664,  3638,  3613,
+     3587,  3562,  3536,  3517,  3498,  3478,  3459,  3440,  3421,  3402,  3382,  3363,
+     3344,  3328,  3312,  3296,  3280,  3264,  3248,  3232,  3216,  3200,  3184,  3171,
+     3158,  3146,  3133,  3120,  3104,  3088,  3072,  3056,  3040,  3030,  3021,  3011,
+     3002,  2992,  2979,  2966,  2954,  2941,  2928,  2915,  2902,  2890,  2877,  2864,
+     2854,  2845,  2835,  2826,  2816,  2806,  2797,  2787,  2778,  2768,  2758,  2749,
+     2739,  2730,  2720,  2710,  2701,  2691,  2682,  2672,  2666,  2659,  2653,  2646,
+     2640,  2630,  2621,  2611,  2602,  2592,  2586,  2579,  2573,  2566,  2560,  2550,
+     2541,  2531,  2522,  2512,  2506,  2499,  2493,  2486,  2480,  2474,  2467,  2461,
+     2454,  2448,  2438,  2429,  2419,  2410,  2400,  2394,  2387,  2381,  2374,  2368,
+     2362,  2355,  2349,  2342,  2336,  2330,  2323,  2317,  2310,  2304,  2298,  2291,
+     2285,  2278,  2272,  2266,  2259,  2253,  2246,  2240,  2237,  2234,  2230,  2227,
+     2224,  2218,  2211,  2205,  2198,  2192,  2186,  2179,  2173,  2166,  2160,  2154,
+     2147,  2141,  2134,  2128,  2122,  2115,  2109,  2102,  2096,  2093,  2090,  2086,
+     2083,  2080,  2074,  2067,  2061,  2054,  2048,  2042,  2035,  2029,  2022,  2016,
+     2013,  2010,  2006,  2003,  2000,  1994,  1987,  1981,  1974,  1968,  1965,  1962,
+     1958,  1955,  1952,  1946,  1939,  1933,  1926,  1920,  1917,  1914,  1910,  1907,
+     1904,  1898,  1891,  1885,  1878,  1872,  1869,  1866,  1862,  1859,  1856,  1850,
+     1843,  1837,  1830,  1824,  1821,  1818,  1814,  1811,  1808,  1802,  1795,  1789,
+     1782,  1776,  1773,  1770,  1766,  1763,  1760,  1754,  1747,  1741,  1734,  1728,
+     1725,  1722,  1718,  1715,  1712,  1706,  1699,  1693,  1686,  1680,  1677,  1674,
+     1670,  1667,  1664,  1658,  1651,  1645,  1638,  1632,  1629,  1626,  1622,  1619,
+     1616,  1613,  1610,  1606,  1603,  1600,  1594,  1587,  1581,  1574,  1568,  1565,
+     1562,  1558,  1555,  1552,  1546,  1539,  1533,  1526,  1520,  1517,  1514,  1510,
+     1507,  1504,  1498,  1491,  1485,  1478,  1472,  1469,  1466,  1462,  1459,  1456,
+     1453,  1450,  1446,  1443,  1440,  1434,  1427,  1421,  1414,  1408,  1405,  1402,
+     1398,  1395,  1392,  1386,  1379,  1373,  1366,  1360,  1357,  1354,  1350,  1347,
+     1344,  1338,  1331,  1325,  1318,  1312,  1309,  1306,  1302,  1299,  1296,  1290,
+     1283,  1277,  1270,  1264,  1258,  1251,  1245,  1238,  1232,  1229,  1226,  1222,
+     1219,  1216,  1210,  1203,  1197,  1190,  1184,  1178,  1171,  1165,  1158,  1152,
+     1149,  1146,  1142,  1139,  1136,  1130,  1123,  1117,  1110,  1104,  1098,  1091,
+     1085,  1078,  1072,  1066,  1059,  1053,  1046,  1040,  1034,  1027,  1021,  1014,
+     1008,  1005,  1002,   998,   995,   992,   986,   979,   973,   966,   960,   950,
+      941,   931,   922,   912,   906,   899,   893,   886,   880,   874,   867,   861,
+      854,   848,   842,   835,   829,   822,   816,   806,   797,   787,   778,   768,
+      758,   749,   739,   730,   720,   710,   701,   691,   682,   672,   662,   653,
+      643,   634,   624,   614,   605,   595,   586,   576,   563,   550,   538,   525,
+      512,   499,   486,   474,   461,   448,   438,   429,   419,   410,   400,   394,
+      387,   381,   374,   368,   362,   355,   349,   342,   336,   330,   323,   317,
+      310,   304,   259,   214,   170,   125,    80,    80
+  };
+#endif
+
+#if ANY_THERMISTOR_IS(30)
+  #define HAS_UNIFORM_TEMPTABLE_30 1
+  #define UNIFORM_TEMPTABLE_30_SHIFT 0 // max error 0.06 degC
+  const int16_t uniform_temptable_30[] PROGMEM = {
+    15008, 14964, 14920, 14877, 14833, 14789, 14745, 14701, 14658, 14614, 14570, 14526,
+    14482, 14439, 14395, 14351, 14307, 14263, 14220, 14176, 14132, 14088, 14044, 14001,
+    13957, 13913, 13869, 13825, 13782, 13738, 13694, 13650, 13606, 13563, 13519, 13475,
+    13431, 13387, 13344, 13300, 13256, 13212, 13168, 13125, 13081, 13037, 12993, 12949,
+    12906, 12862, 12818, 12774, 12731, 12687, 12643, 12599, 12555, 12512, 12468, 12424,
+    12380, 12336, 12293, 12249, 12205, 12161, 12117, 12074, 12030, 11986, 11942, 11898,
+    11855, 11811, 11767, 11723, 11679, 11636, 11592, 11548, 11504, 11460, 11417, 11373,
+    11329, 11285, 11241, 11198, 11154, 11110, 11066, 11022, 10979, 10935, 10891, 10847,
+    10803, 10760, 10716, 10672, 10628, 10584, 10541, 10497, 10453, 10409, 10365, 10322,
+    10278, 10234, 10190, 10146, 10103, 10059, 10015,  9971,  9927,  9884,  9840,  9796,
+     9752,  9708,  9665,  9621,  9577,  9533,  9489,  9446,  9402,  9358,  9314,  9270,
+     9227,  9183,  9139,  9095,  9051,  9008,  8964,  8920,  8876,  8832,  8789,  8745,
+     8701,  8657,  8613,  8570,  8526,  8482,  8438,  8395,  8351,  8307,  8263,  8219,
+     8176,  8132,  8088,  8044,  8000,  7957,  7913,  7869,  7825,  7781,  7738,  7694,
+     7650,  7606,  7562,  7519,  7475,  7431,  7387,  7343,  7300,  7256,  7212,  7168,
+     7124,  7081,  7037,  6993,  6949,  6905,  6862,  6818,  6774,  6730,  6686,  6643,
+     6599,  6555,  6511,  6467,  6424,  6380,  6336,  6292,  6248,  6205,  6161,  6117,
+     6073,  6029,  5986,  5942,  5898,  5854,  5810,  5767,  5723,  5679,  5635,  5591,
+     5548,  5504,  5460,  5416,  5372,  5329,  5285,  5241,  5197,  5153,  5110,  5066,
+     5022,  4978,  4934,  4891,  4847,  4803,  4759,  4715,  4672,  4628,  4584,  4540,
+     4496,  4453,  4409,  4365,  4321,  4277,  4234,  4190,  4146,  4102,  4059,  4015,
+     3971,  3927,  3883,  3840,  3796,  3752,  3708,  3664,  3621,  3577,  3533,  3489,
+     3445,  3402,  3358,  3314,  3270,  3226,  3183,  3139,  3095,  3051,  3007,  2964,
+     2920,  2876,  2832,  2788,  2745,  2701,  2657,  2613,  2569,  2526,  2482,  2438,
+     2394,  2350,  2307,  2263,  2219,  2175,  2131,  2088,  2044,  2000,  1997,  1994,
+     1992,  1989,  1986,  1983,  1981,  1978,  1975,  1972,  1969,  1967,  1964,  1961,
+     1958,  1955,  1953,  1950,  1947,  1944,  1942,  1939,  1936,  1934,  1931,  1929,
+     1927,  1924,  1922,  1919,  1917,  1915,  1912,  1910,  1908,  1905,  1903,  1900,
+     1898,  1896,  1893,  1891,  1889,  1886,  1884,  1881,  1879,  1877,  1874,  1872,
+     1870,  1869,  1867,  1865,  1864,  1862,  1861,  1859,  1857,  1856,  1854,  1852,
+     1851,  1849,  1847,  1846,  1844,  1842,  1841,  1839,  1838,  1836,  1834,  1833,
+     1831,  1829,  1828,  1826,  1824,  1823,  1821,  1819,  1818,  1816,  1815,  1813,
+     1811,  1810,  1808,  1806,  1804,  1802,  1800,  1798,  1796,  1794,  1792,  1790,
+     1788,  1786,  1784,  1782,  1780,  1778,  1776,  1774,  1772,  1770,  1768,  1766,
+     1764,  1762,  1760,  1758,  1756,  1754,  1752,  1751,  1749,  1747,  1745,  1743,
+     1741,  1739,  1737,  1736,  1734,  1732,  1730,  1728,  1726,  1724,  1722,  1720,
+     1719,  1717,  1715,  1713,  1711,  1709,  1707,  1705,  1704,  1702,  1700,  1698,
+     1696,  1694,  1691,  1689,  1687,  1685,  1682,  1680,  1678,  1675,  1673,  1671,
+     1669,  1666,  1664,  1662,  1659,  1657,  1655,  1653,  1650,  1648,  1646,  1643,
+     1641,  1639,  1637,  1634,  1632,  1630,  1627,  1625,  1623,  1621,  1618,  1616,
+     1614,  1612,  1611,  1609,  1607,  1605,  1604,  1602,  1600,  1598,  1596,  1595,
+     1593,  1591,  1589,  1588,  1586,  1584,  1582,  1580,  1579,  1577,  1575,  1573,
+     1572,  1570,  1568,  1566,  1564,  1563,  1561,  1559,  1557,  1556,  1554,  1552,
+     1550,  1548,  1546,  1543,  1541,  1539,  1537,  1535,  1533,  1530,  1528,  1526,
+     1524,  1522,  1520,  1517,  1515,  1513,  1511,  1509,  1507,  1504,  1502,  1500,
+     1498,  1496,  1494,  1491,  1489,  1487,  1485,  1483,  1481,  1478,  1476,  1474,
+     1472,  1470,  1469,  1467,  1465,  1464,  1462,  1460,  1459,  1457,  1455,  1453,
+     1452,  1450,  1448,  1447,  1445,  1443,  1442,  1440,  1438,  1437,  1435,  1433,
+     1432,  1430,  1428,  1427,  1425,  1423,  1421,  1420,  1418,  1416,  1415,  1413,
+     1411,  1410,  1408,  1406,  1405,  1403,  1401,  1399,  1398,  1396,  1394,  1392,
+     1391,  1389,  1387,  1386,  1384,  1382,  1380,  1379,  1377,  1375,  1373,  1372,
+     1370,  1368,  1366,  1365,  1363,  1361,  1360,  1358,  1356,  1354,  1353,  1351,
+     1349,  1347,  1346,  1344,  1342,  1340,  1338,  1335,  1333,  1331,  1329,  1327,
+     1325,  1322,  1320,  1318,  1316,  1314,  1312,  1309,  1307,  1305,  1303,  1301,
+     1299,  1296,  1294,  1292,  1290,  1288,  1286,  1283,  1281,  1279,  1277,  1275,
+     1273,  1270,  1268,  1266,  1264,  1262,  1261,  1259,  1257,  1255,  1254,  1252,
+     1250,  1248,  1247,  1245,  1243,  1242,  1240,  1238,  1236,  1235,  1233,  1231,
+     1229,  1228,  1226,  1224,  1222,  1221,  1219,  1217,  1216,  1214,  1212,  1210,
+     1209,  1207,  1205,  1203,  1202,  1200,  1198,  1196,  1194,  1192,  1191,  1189,
+     1187,  1185,  1183,  1181,  1179,  1177,  1176,  1174,  1172,  1170,  1168,  1166,
+     1164,  1162,  1160,  1159,  1157,  1155,  1153,  1151,  1149,  1147,  1145,  1144,
+     1142,  1140,  1138,  1136,  1134,  1132,  1130,  1128,  1127,  1125,  1123,  1121,
+     1119,  1117,  1115,  1113,  1112,  1110,  1108,  1106,  1104,  1102,  1100,  1098,
+     1096,  1095,  1093,  1091,  1089,  1087,  1085,  1083,  1081,  1080,  1078,  1076,
+     1074,  1072,  1070,  1068,  1066,  1064,  1062,  1060,  1058,  1055,  1053,  1051,
+     1049,  1047,  1045,  1043,  1041,  1039,  1037,  1035,  1033,  1031,  1029,  1027,
+     1025,  1022,  1020,  1018,  1016,  1014,  1012,  1010,  1008,  1006,  1004,  1001,
+      999,   997,   995,   993,   990,   988,   986,   984,   982,   979,   977,   975,
+      973,   970,   968,   966,   964,   962,   959,   957,   955,   953,   951,   948,
+      946,   944,   942,   939,   937,   935,   932,   930,   927,   925,   923,   920,
+      918,   916,   913,   911,   908,   906,   904,   901,   899,   897,   894,   892,
+      889,   887,   885,   882,   880,   877,   875,   872,   869,   867,   864,   861,
+      859,   856,   853,   851,   848,   845,   843,   840,   837,   835,   832,   829,
+      827,   824,   821,   819,   816,   813,   810,   807,   804,   801,   798,   795,
+      792,   789,   786,   782,   779,   776,   773,   770,   767,   764,   761,   758,
+      755,   752,   748,   744,   740,   736,   732,   728,   724,   720,   716,   712,
+      708,   704,   700,   696,   692,   688,   684,   680,   676,   672,   668,   664,
+      660,   656,   652,   648,   644,   640,   636,   632,   628,   624,   620,   616,
+      612,   608,   603,   599,   594,   590,   585,   581,   576,   571,   567,   562,
+      558,   553,   549,   544,   537,   531,   524,   517,   511,   504,   497,   491,
+      484,   477,   471,   464,   458,   452,   447,   441,   435,   429,   423,   417,
+      412,   406,   400,   394,   387,   381,   374,   368,   359,   351,   342,   333,
+      324,   316,   307,   298,   289,   281,   272,   259,   246,   234,   221,   208,
+      195,   182,   170,   157,   144,   123,   101,    80,    60,    40,    20,     0,
+      -20,   -40,   -60,   -80,  -100,  -120,  -140,  -160,  -180,  -200,  -220,  -240,
+     -240
+  };
+#endif
+
+#if ANY_THERMISTOR_IS(51)
+  #define HAS_UNIFORM_TEMPTABLE_51 1
+  #define UNIFORM_TEMPTABLE_51_SHIFT 1 // max error 0.22 degC
+  const int16_t uniform_temptable_51[] PROGMEM = {
+     5600,  5583,  5566,  5549,  5532,  5515,  5498,  5481,  5465,  5448,  5431,  5414,
+     5397,  5380,  5363,  5346,  5329,  5312,  5295,  5278,  5261,  5244,  5228,  5211,
+     5194,  5177,  5160,  5143,  5126,  5109,  5092,  5075,  5058,  5041,  5024,  5007,
+     4990,  4974,  4957,  4940,  4923,  4906,  4889,  4872,  4855,  4838,  4821,  4804,
+     4787,  4770,  4753,  4737,  4720,  4703,  4686,  4669,  4652,  4635,  4618,  4601,
+     4584,  4567,  4550,  4533,  4516,  4499,  4483,  4466,  4449,  4432,  4415,  4398,
+     4381,  4364,  4347,  4330,  4313,  4296,  4279,  4262,  4246,  4229,  4212,  4195,
+     4178,  4161,  4144,  4127,  4110,  4093,  4076,  4059,  4042,  4025,  4008,  3994,
+     3982,  3969,  3957,  3945,  3932,  3920,  3909,  3897,  3886,  3874,  3863,  3851,
+     3840,  3829,  3819,  3808,  3797,  3787,  3776,  3765,  3755,  3745,  3735,  3725,
+     3715,  3705,  3695,  3685,  3675,  3666,  3656,  3647,  3638,  3628,  3619,  3609,
+     3600,  3591,  3582,  3573,  3564,  3556,  3547,  3538,  3529,  3520,  3512,  3503,
+     3495,  3486,  3478,  3469,  3461,  3453,  3444,  3436,  3428,  3420,  3412,  3404,
+     3396,  3388,  3380,  3372,  3364,  3356,  3349,  3342,  3335,  3327,  3320,  3313,
+     3305,  3298,  3291,  3284,  3276,  3269,  3262,  3255,  3247,  3240,  3233,  3225,
+     3218,  3211,  3204,  3197,  3190,  3183,  3177,  3170,  3163,  3157,  3150,  3143,
+     3137,  3130,  3123,  3117,  3110,  3104,  3098,  3091,  3085,  3078,  3072,  3066,
+     3059,  3053,  3046,  3040,  3034,  3027,  3021,  3014,  3008,  3002,  2995,  2989,
+     2982,  2976,  2970,  2963,  2957,  2951,  2945,  2939,  2933,  2927,  2921,  2916,
+     2910,  2904,  2898,  2892,  2886,  2880,  2874,  2868,  2862,  2856,  2850,  2844,
+     2839,  2833,  2827,  2821,  2815,  2809,  2803,  2797,  2791,  2786,  2780,  2774,
+     2769,  2763,  2757,  2751,  2746,  2740,  2734,  2729,  2723,  2717,  2712,  2706,
+     2701,  2695,  2690,  2684,  2679,  2673,  2668,  2662,  2657,  2651,  2646,  2640,
+     2634,  2629,  2623,  2618,  2612,  2607,  2601,  2596,  2590,  2585,  2579,  2574,
+     2568,  2563,  2557,  2552,  2546,  2541,  2535,  2530,  2524,  2519,  2513,  2508,
+     2502,  2497,  2491,  2486,  2480,  2474,  2469,  2463,  2458,  2452,  2447,  2441,
+     2436,  2430,  2425,  2419,  2414,  2408,  2403,  2397,  2391,  2386,  2380,  2374,
+     2369,  2363,  2357,  2351,  2346,  2340,  2334,  2329,  2323,  2317,  2312,  2306,
+     2301,  2295,  2290,  2284,  2279,  2273,  2268,  2262,  2257,  2251,  2246,  2240,
+     2234,  2228,  2222,  2216,  2210,  2204,  2199,  2193,  2187,  2181,  2175,  2169,
+     2163,  2157,  2151,  2145,  2139,  2133,  2127,  2121,  2116,  2110,  2104,  2098,
+     2092,  2086,  2080,  2074,  2068,  2062,  2055,  2049,  2043,  2037,  2031,  2025,
+     2018,  2012,  2006,  2000,  1994,  1987,  1981,  1974,  1968,  1962,  1955,  1949,
+     1942,  1936,  1930,  1923,  1917,  1910,  1903,  1896,  1889,  1882,  1875,  1868,
+     1861,  1854,  1847,  1840,  1833,  1825,  1818,  1811,  1804,  1796,  1789,  1782,
+     1775,  1767,  1760,  1752,  1744,  1736,  1728,  1720,  1712,  1704,  1696,  1688,
+     1680,  1672,  1663,  1655,  1646,  1638,  1629,  1621,  1613,  1604,  1595,  1586,
+     1576,  1567,  1558,  1548,  1539,  1529,  1520,  1510,  1500,  1490,  1480,  1470,
+     1460,  1450,  1440,  1429,  1419,  1408,  1397,  1387,  1376,  1365,  1353,  1340,
+     1327,  1313,  1300,  1287,  1273,  1260,  1247,  1233,  1220,  1207,  1192,  1176,
+     1160,  1144,  1128,  1111,  1093,  1076,  1058,  1040,  1017,   994,   971,   949,
+      926,   903,   880,   853,   827,   800,   768,   736,   700,   660,   613,   560,
+      507,   453,   400,   320,   240,    80,   -80,   -80
+  };
+#endif
+
+#if ANY_THERMISTOR_IS(52)
+  #define HAS_UNIFORM_TEMPTABLE_52 1
+  #define UNIFORM_TEMPTABLE_52_SHIFT 0 // max error 0.06 degC
+  const int16_t uniform_temptable_52[] PROGMEM = {
+     8000,  7974,  7948,  7923,  7897,  7871,  7845,  7819,  7794,  7768,  7742,  7716,
+     7690,  7665,  7639,  7613,  7587,  7561,  7535,  7510,  7484,  7458,  7432,  7406,
+     7381,  7355,  7329,  7303,  7277,  7252,  7226,  7200,  7174,  7148,  7123,  7097,
+     7071,  7045,  7019,  6994,  6968,  6942,  6916,  6890,  6865,  6839,  6813,  6787,
+     6761,  6735,  6710,  6684,  6658,  6632,  6606,  6581,  6555,  6529,  6503,  6477,
+     6452,  6426,  6400,  6374,  6348,  6323,  6297,  6271,  6245,  6219,  6194,  6168,
+     6142,  6116,  6090,  6065,  6039,  6013,  5987,  5961,  5935,  5910,  5884,  5858,
+     5832,  5806,  5781,  5755,  5729,  5703,  5677,  5652,  5626,  5600,  5574,  5548,
+     5523,  5497,  5471,  5445,  5419,  5394,  5368,  5342,  5316,  5290,  5265,  5239,
+     5213,  5187,  5161,  5135,  5110,  5084,  5058,  5032,  5006,  4981,  4955,  4929,
+     4903,  4877,  4852,  4826,  4800,  4791,  4781,  4772,  4762,  4753,  4744,  4734,
+     4725,  4715,  4706,  4696,  4687,  4678,  4668,  4659,  4649,  4640,  4632,  4624,
+     4616,  4608,  4600,  4592,  4584,  4576,  4568,  4560,  4552,  4544,  4536,  4528,
+     4520,  4512,  4504,  4496,  4488,  4480,  4473,  4466,  4459,  4452,  4445,  4438,
+     4431,  4424,  4417,  4410,  4403,  4397,  4390,  4383,  4376,  4369,  4362,  4355,
+     4348,  4341,  4334,  4327,  4320,  4314,  4308,  4302,  4295,  4289,  4283,  4277,
+     4271,  4265,  4258,  4252,  4246,  4240,  4234,  4228,  4222,  4215,  4209,  4203,
+     4197,  4191,  4185,  4178,  4172,  4166,  4160,  4154,  4149,  4143,  4138,  4132,
+     4127,  4121,  4116,  4110,  4105,  4099,  4094,  4088,  4083,  4077,  4072,  4066,
+     4061,  4055,  4050,  4044,  4039,  4033,  4028,  4022,  4017,  4011,  4006,  4000,
+     3995,  3991,  3986,  3981,  3976,  3972,  3967,  3962,  3958,  3953,  3948,  3944,
+     3939,  3934,  3929,  3925,  3920,  3915,  3911,  3906,  3901,  3896,  3892,  3887,
+     3882,  3878,  3873,  3868,  3864,  3859,  3854,  3849,  3845,  3840,  3836,  3832,
+     3827,  3823,  3819,  3815,  3811,  3806,  3802,  3798,  3794,  3789,  3785,  3781,
+     3777,  3773,  3768,  3764,  3760,  3756,  3752,  3747,  3743,  3739,  3735,  3731,
+     3726,  3722,  3718,  3714,  3709,  3705,  3701,  3697,  3693,  3688,  3684,  3680,
+     3676,  3673,  3669,  3665,  3661,  3658,  3654,  3650,  3647,  3643,  3639,  3635,
+     3632,  3628,  3624,  3620,  3617,  3613,  3609,  3606,  3602,  3598,  3594,  3591,
+     3587,  3583,  3580,  3576,  3572,  3568,  3565,  3561,  3557,  3553,  3550,  3546,
+     3542,  3539,  3535,  3531,  3527,  3524,  3520,  3517,  3513,  3510,  3506,  3503,
+     3499,  3496,  3492,  3489,  3485,  3482,  3478,  3475,  3471,  3468,  3464,  3461,
+     3457,  3454,  3450,  3447,  3443,  3440,  3437,  3433,  3430,  3426,  3423,  3419,
+     3416,  3412,  3409,  3405,  3402,  3398,  3395,  3391,  3388,  3384,  3381,  3377,
+     3374,  3370,  3367,  3363,  3360,  3357,  3354,  3351,  3347,  3344,  3341,  3338,
+     3335,  3332,  3329,  3325,  3322,  3319,  3316,  3313,  3310,  3307,  3304,  3300,
+     3297,  3294,  3291,  3288,  3285,  3282,  3278,  3275,  3272,  3269,  3266,  3263,
+     3260,  3256,  3253,  3250,  3247,  3244,  3241,  3238,  3235,  3231,  3228,  3225,
+     3222,  3219,  3216,  3213,  3209,  3206,  3203,  3200,  3197,  3194,  3191,  3188,
+     3185,  3182,  3179,  3176,  3173,  3170,  3167,  3164,  3161,  3159,  3156,  3153,
+     3150,  3147,  3144,  3141,  3138,  3135,  3132,  3129,  3126,  3123,  3120,  3117,
+     3114,  3111,  3108,  3105,  3102,  3099,  3096,  3093,  3090,  3087,  3084,  3081,
+     3079,  3076,  3073,  3070,  3067,  3064,  3061,  3058,  3055,  3052,  3049,  3046,
+     3043,  3040,  3037,  3034,  3032,  3029,  3026,  3023,  3020,  3018,  3015,  3012,
+     3009,  3006,  3004,  3001,  2998,  2995,  2992,  2989,  2987,  2984,  2981,  2978,
+     2975,  2973,  2970,  2967,  2964,  2961,  2959,  2956,  2953,  2950,  2947,  2945,
+     2942,  2939,  2936,  2933,  2931,  2928,  2925,  2922,  2919,  2916,  2914,  2911,
+     2908,  2905,  2902,  2900,  2897,  2894,  2891,  2888,  2886,  2883,  2880,  2877,
+     2874,  2872,  2869,  2866,  2863,  2860,  2858,  2855,  2852,  2849,  2846,  2844,
+     2841,  2838,  2835,  2832,  2829,  2827,  2824,  2821,  2818,  2815,  2813,  2810,
+     2807,  2804,  2801,  2799,  2796,  2793,  2790,  2787,  2785,  2782,  2779,  2776,
+     2773,  2771,  2768,  2765,  2762,  2759,  2756,  2754,  2751,  2748,  2745,  2742,
+     2740,  2737,  2734,  2731,  2728,  2726,  2723,  2720,  2717,  2714,  2712,  2709,
+     2706,  2703,  2700,  2698,  2695,  2692,  2689,  2686,  2684,  2681,  2678,  2675,
+     2672,  2669,  2667,  2664,  2661,  2658,  2655,  2653,  2650,  2647,  2644,  2641,
+     2639,  2636,  2633,  2630,  2627,  2625,  2622,  2619,  2616,  2613,  2611,  2608,
+     2605,  2602,  2599,  2596,  2594,  2591,  2588,  2585,  2582,  2580,  2577,  2574,
+     2571,  2568,  2566,  2563,  2560,  2557,  2554,  2551,  2548,  2545,  2543,  2540,
+     2537,  2534,  2531,  2528,  2525,  2522,  2519,  2516,  2513,  2511,  2508,  2505,
+     2502,  2499,  2496,  2493,  2490,  2487,  2484,  2481,  2479,  2476,  2473,  2470,
+     2467,  2464,  2461,  2458,  2455,  2452,  2449,  2447,  2444,  2441,  2438,  2435,
+     2432,  2429,  2426,  2423,  2420,  2417,  2415,  2412,  2409,  2406,  2403,  2400,
+     2397,  2394,  2391,  2387,  2384,  2381,  2378,  2375,  2372,  2369,  2365,  2362,
+     2359,  2356,  2353,  2350,  2347,  2344,  2340,  2337,  2334,  2331,  2328,  2325,
+     2322,  2318,  2315,  2312,  2309,  2306,  2303,  2300,  2296,  2293,  2290,  2287,
+     2284,  2281,  2278,  2275,  2271,  2268,  2265,  2262,  2259,  2256,  2253,  2249,
+     2246,  2243,  2240,  2237,  2233,  2230,  2226,  2223,  2220,  2216,  2213,  2209,
+     2206,  2203,  2199,  2196,  2192,  2189,  2186,  2182,  2179,  2175,  2172,  2169,
+     2165,  2162,  2158,  2155,  2151,  2148,  2145,  2141,  2138,  2134,  2131,  2128,
+     2124,  2121,  2117,  2114,  2111,  2107,  2104,  2100,  2097,  2094,  2090,  2087,
+     2083,  2080,  2076,  2072,  2068,  2064,  2060,  2057,  2053,  2049,  2045,  2041,
+     2037,  2033,  2029,  2025,  2021,  2018,  2014,  2010,  2006,  2002,  1998,  1994,
+     1990,  1986,  1982,  1979,  1975,  1971,  1967,  1963,  1959,  1955,  1951,  1947,
+     1943,  1940,  1936,  1932,  1928,  1924,  1920,  1915,  1911,  1906,  1902,  1897,
+     1893,  1888,  1883,  1879,  1874,  1870,  1865,  1861,  1856,  1851,  1847,  1842,
+     1838,  1833,  1829,  1824,  1819,  1815,  1810,  1806,  1801,  1797,  1792,  1787,
+     1783,  1778,  1774,  1769,  1765,  1760,  1754,  1749,  1743,  1738,  1732,  1727,
+     1721,  1716,  1710,  1705,  1699,  1694,  1688,  1683,  1677,  1672,  1666,  1661,
+     1655,  1650,  1644,  1639,  1633,  1628,  1622,  1617,  1611,  1606,  1600,  1593,
+     1586,  1579,  1572,  1565,  1558,  1551,  1544,  1537,  1530,  1523,  1517,  1510,
+     1503,  1496,  1489,  1482,  1475,  1468,  1461,  1454,  1447,  1440,  1431,  1422,
+     1413,  1404,  1396,  1387,  1378,  1369,  1360,  1351,  1342,  1333,  1324,  1316,
+     1307,  1298,  1289,  1280,  1269,  1257,  1246,  1234,  1223,  1211,  1200,  1189,
+     1177,  1166,  1154,  1143,  1131,  1120,  1104,  1088,  1072,  1056,  1040,  1024,
+     1008,   992,   976,   960,   940,   920,   900,   880,   860,   840,   820,   800,
+      768,   736,   704,   672,   640,   600,   560,   520,   480,   400,   320,   240,
+      160,     0,     0
+  };
+#endif
+
+#if ANY_THERMISTOR_IS(55)
+  #define HAS_UNIFORM_TEMPTABLE_55 1
+  #define UNIFORM_TEMPTABLE_55_SHIFT 0 // max error 0.06 degC
+  const int16_t uniform_temptable_55[] PROGMEM = {
+     8000,  7957,  7915,  7872,  7829,  7787,  7744,  7701,  7659,  7616,  7573,  7531,
+     7488,  7445,  7403,  7360,  7317,  7275,  7232,  7189,  7147,  7104,  7061,  7019,
+     6976,  6933,  6891,  6848,  6805,  6763,  6720,  6677,  6635,  6592,  6549,  6507,
+     6464,  6421,  6379,  6336,  6293,  6251,  6208,  6165,  6123,  6080,  6037,  5995,
+     5952,  5909,  5867,  5824,  5781,  5739,  5696,  5653,  5611,  5568,  5525,  5483,
+     5440,  5397,  5355,  5312,  5269,  5227,  5184,  5141,  5099,  5056,  5013,  4971,
+     4928,  4885,  4843,  4800,  4785,  4771,  4756,  4742,  4727,  4713,  4698,  4684,
+     4669,  4655,  4640,  4628,  4615,  4603,  4591,  4578,  4566,  4554,  4542,  4529,
+     4517,  4505,  4492,  4480,  4469,  4457,  4446,  4434,  4423,  4411,  4400,  4389,
+     4377,  4366,  4354,  4343,  4331,  4320,  4311,  4301,  4292,  4282,  4273,  4264,
+     4254,  4245,  4235,  4226,  4216,  4207,  4198,  4188,  4179,  4169,  4160,  4152,
+     4145,  4137,  4130,  4122,  4114,  4107,  4099,  4091,  4084,  4076,  4069,  4061,
+     4053,  4046,  4038,  4030,  4023,  4015,  4008,  4000,  3993,  3986,  3979,  3972,
+     3965,  3958,  3951,  3944,  3937,  3930,  3923,  3917,  3910,  3903,  3896,  3889,
+     3882,  3875,  3868,  3861,  3854,  3847,  3840,  3834,  3828,  3822,  3816,  3810,
+     3804,  3799,  3793,  3787,  3781,  3775,  3769,  3763,  3757,  3751,  3745,  3739,
+     3733,  3727,  3721,  3716,  3710,  3704,  3698,  3692,  3686,  3680,  3675,  3670,
+     3665,  3660,  3655,  3650,  3645,  3640,  3635,  3630,  3625,  3620,  3615,  3610,
+     3605,  3600,  3595,  3590,  3585,  3580,  3575,  3570,  3565,  3560,  3555,  3550,
+     3545,  3540,  3535,  3530,  3525,  3520,  3516,  3511,  3507,  3503,  3498,  3494,
+     3490,  3485,  3481,  3477,  3472,  3468,  3464,  3459,  3455,  3451,  3446,  3442,
+     3438,  3434,  3429,  3425,  3421,  3416,  3412,  3408,  3403,  3399,  3395,  3390,
+     3386,  3382,  3377,  3373,  3369,  3364,  3360,  3356,  3352,  3348,  3344,  3340,
+     3337,  3333,  3329,  3325,  3321,  3317,  3313,  3309,  3305,  3301,  3298,  3294,
+     3290,  3286,  3282,  3278,  3274,  3270,  3266,  3262,  3259,  3255,  3251,  3247,
+     3243,  3239,  3235,  3231,  3227,  3223,  3220,  3216,  3212,  3208,  3204,  3200,
+     3197,  3193,  3190,  3186,  3183,  3180,  3176,  3173,  3169,  3166,  3163,  3159,
+     3156,  3152,  3149,  3146,  3142,  3139,  3135,  3132,  3129,  3125,  3122,  3118,
+     3115,  3111,  3108,  3105,  3101,  3098,  3094,  3091,  3088,  3084,  3081,  3077,
+     3074,  3071,  3067,  3064,  3060,  3057,  3054,  3050,  3047,  3043,  3040,  3037,
+     3034,  3031,  3028,  3025,  3022,  3018,  3015,  3012,  3009,  3006,  3003,  3000,
+     2997,  2994,  2991,  2988,  2985,  2982,  2978,  2975,  2972,  2969,  2966,  2963,
+     2960,  2957,  2954,  2951,  2948,  2945,  2942,  2938,  2935,  2932,  2929,  2926,
+     2923,  2920,  2917,  2914,  2911,  2908,  2905,  2902,  2898,  2895,  2892,  2889,
+     2886,  2883,  2880,  2877,  2874,  2871,  2869,  2866,  2863,  2860,  2857,  2854,
+     2851,  2849,  2846,  2843,  2840,  2837,  2834,  2831,  2829,  2826,  2823,  2820,
+     2817,  2814,  2811,  2809,  2806,  2803,  2800,  2797,  2794,  2791,  2789,  2786,
+     2783,  2780,  2777,  2774,  2771,  2769,  2766,  2763,  2760,  2757,  2754,  2751,
+     2749,  2746,  2743,  2740,  2737,  2734,  2731,  2729,  2726,  2723,  2720,  2717,
+     2715,  2712,  2709,  2707,  2704,  2701,  2699,  2696,  2693,  2691,  2688,  2685,
+     2683,  2680,  2677,  2675,  2672,  2669,  2667,  2664,  2661,  2659,  2656,  2653,
+     2651,  2648,  2645,  2643,  2640,  2637,  2635,  2632,  2629,  2627,  2624,  2621,
+     2619,  2616,  2613,  2611,  2608,  2605,  2603,  2600,  2597,  2595,  2592,  2589,
+     2587,  2584,  2581,  2579,  2576,  2573,  2571,  2568,  2565,  2563,  2560,  2557,
+     2555,  2552,  2550,  2547,  2545,  2542,  2540,  2537,  2535,  2532,  2530,  2527,
+     2524,  2522,  2519,  2517,  2514,  2512,  2509,  2507,  2504,  2502,  2499,  2497,
+     2494,  2491,  2489,  2486,  2484,  2481,  2479,  2476,  2474,  2471,  2469,  2466,
+     2463,  2461,  2458,  2456,  2453,  2451,  2448,  2446,  2443,  2441,  2438,  2436,
+     2433,  2430,  2428,  2425,  2423,  2420,  2418,  2415,  2413,  2410,  2408,  2405,
+     2403,  2400,  2397,  2395,  2392,  2390,  2387,  2385,  2382,  2379,  2377,  2374,
+     2372,  2369,  2366,  2364,  2361,  2359,  2356,  2354,  2351,  2348,  2346,  2343,
+     2341,  2338,  2335,  2333,  2330,  2328,  2325,  2323,  2320,  2317,  2315,  2312,
+     2310,  2307,  2305,  2302,  2299,  2297,  2294,  2292,  2289,  2286,  2284,  2281,
+     2279,  2276,  2274,  2271,  2268,  2266,  2263,  2261,  2258,  2255,  2253,  2250,
+     2248,  2245,  2243,  2240,  2237,  2235,  2232,  2230,  2227,  2224,  2222,  2219,
+     2216,  2214,  2211,  2209,  2206,  2203,  2201,  2198,  2195,  2193,  2190,  2188,
+     2185,  2182,  2180,  2177,  2174,  2172,  2169,  2167,  2164,  2161,  2159,  2156,
+     2153,  2151,  2148,  2146,  2143,  2140,  2138,  2135,  2132,  2130,  2127,  2125,
+     2122,  2119,  2117,  2114,  2111,  2109,  2106,  2104,  2101,  2098,  2096,  2093,
+     2090,  2088,  2085,  2083,  2080,  2077,  2074,  2072,  2069,  2066,  2063,  2060,
+     2058,  2055,  2052,  2049,  2046,  2044,  2041,  2038,  2035,  2032,  2029,  2027,
+     2024,  2021,  2018,  2015,  2013,  2010,  2007,  2004,  2001,  1999,  1996,  1993,
+     1990,  1987,  1985,  1982,  1979,  1976,  1973,  1971,  1968,  1965,  1962,  1959,
+     1956,  1954,  1951,  1948,  1945,  1942,  1940,  1937,  1934,  1931,  1928,  1926,
+     1923,  1920,  1917,  1914,  1911,  1908,  1905,  1902,  1898,  1895,  1892,  1889,
+     1886,  1883,  1880,  1877,  1874,  1871,  1868,  1865,  1862,  1858,  1855,  1852,
+     1849,  1846,  1843,  1840,  1837,  1834,  1831,  1828,  1825,  1822,  1818,  1815,
+     1812,  1809,  1806,  1803,  1800,  1797,  1794,  1791,  1788,  1785,  1782,  1778,
+     1775,  1772,  1769,  1766,  1763,  1760,  1756,  1753,  1749,  1746,  1742,  1739,
+     1735,  1732,  1728,  1724,  1721,  1717,  1714,  1710,  1707,  1703,  1700,  1696,
+     1692,  1689,  1685,  1682,  1678,  1675,  1671,  1668,  1664,  1660,  1657,  1653,
+     1650,  1646,  1643,  1639,  1636,  1632,  1628,  1625,  1621,  1618,  1614,  1611,
+     1607,  1604,  1600,  1596,  1592,  1587,  1583,  1579,  1575,  1571,  1566,  1562,
+     1558,  1554,  1549,  1545,  1541,  1537,  1533,  1528,  1524,  1520,  1516,  1512,
+     1507,  1503,  1499,  1495,  1491,  1486,  1482,  1478,  1474,  1469,  1465,  1461,
+     1457,  1453,  1448,  1444,  1440,  1435,  1430,  1425,  1419,  1414,  1409,  1404,
+     1399,  1394,  1388,  1383,  1378,  1373,  1368,  1363,  1357,  1352,  1347,  1342,
+     1337,  1332,  1326,  1321,  1316,  1311,  1306,  1301,  1295,  1290,  1285,  1280,
+     1274,  1267,  1261,  1254,  1248,  1242,  1235,  1229,  1222,  1216,  1210,  1203,
+     1197,  1190,  1184,  1178,  1171,  1165,  1158,  1152,  1146,  1139,  1133,  1126,
+     1120,  1111,  1102,  1093,  1084,  1076,  1067,  1058,  1049,  1040,  1031,  1022,
+     1013,  1004,   996,   987,   978,   969,   960,   949,   937,   926,   914,   903,
+      891,   880,   869,   857,   846,   834,   823,   811,   800,   784,   768,   752,
+      736,   720,   704,   688,   672,   656,   640,   617,   594,   571,   549,   526,
+      503,   480,   448,   416,   384,   352,   320,   267,   213,   160,    80,     0,
+        0
+  };
+#endif
+
+#if ANY_THERMISTOR_IS(56)
+  #define HAS_UNIFORM_TEMPTABLE_56 1
+  #define UNIFORM_TEMPTABLE_56_SHIFT 0 // max error 0.06 degC
+  const int16_t uniform_temptable_56[] PROGMEM = {
+     5280,  5160,  5040,  4960,  4800,  4760,  4720,  4680,  4640,  4600,  4560,  4480,
+     4453,  4427,  4400,  4360,  4320,  4280,  4240,  4213,  4187,  4160,  4133,  4107,
+     4080,  4053,  4027,  4000,  3980,  3960,  3940,  3920,  3880,  3840,  3800,  3760,
+     3720,  3680,  3640,  3600,  3573,  3547,  3520,  3500,  3480,  3460,  3440,  3424,
+     3408,  3392,  3376,  3360,  3352,  3344,  3336,  3328,  3320,  3312,  3304,  3296,
+     3288,  3280,  3274,  3269,  3263,  3257,  3251,  3246,  3240,  3234,  3229,  3223,
+     3217,  3211,  3206,  3200,  3190,  3180,  3170,  3160,  3150,  3140,  3130,  3120,
+     3112,  3104,  3096,  3088,  3080,  3072,  3064,  3056,  3048,  3040,  3032,  3024,
+     3016,  3008,  3000,  2992,  2984,  2976,  2968,  2960,  2956,  2952,  2948,  2944,
+     2940,  2936,  2932,  2928,  2924,  2920,  2916,  2912,  2908,  2904,  2900,  2896,
+     2892,  2888,  2884,  2880,  2870,  2860,  2850,  2840,  2830,  2820,  2810,  2800,
+     2790,  2780,  2770,  2760,  2750,  2740,  2730,  2720,  2715,  2709,  2704,  2699,
+     2693,  2688,  2683,  2677,  2672,  2667,  2661,  2656,  2651,  2645,  2640,  2635,
+     2630,  2625,  2620,  2615,  2610,  2605,  2600,  2595,  2590,  2585,  2580,  2575,
+     2570,  2565,  2560,  2556,  2551,  2547,  2542,  2538,  2533,  2529,  2524,  2520,
+     2516,  2511,  2507,  2502,  2498,  2493,  2489,  2484,  2480,  2476,  2472,  2467,
+     2463,  2459,  2455,  2451,  2446,  2442,  2438,  2434,  2429,  2425,  2421,  2417,
+     2413,  2408,  2404,  2400,  2398,  2396,  2395,  2393,  2391,  2389,  2387,  2385,
+     2384,  2382,  2380,  2378,  2376,  2375,  2373,  2371,  2369,  2367,  2365,  2364,
+     2362,  2360,  2358,  2356,  2355,  2353,  2351,  2349,  2347,  2345,  2344,  2342,
+     2340,  2338,  2336,  2335,  2333,  2331,  2329,  2327,  2325,  2324,  2322,  2320,
+     2317,  2314,  2310,  2307,  2304,  2301,  2298,  2294,  2291,  2288,  2285,  2282,
+     2278,  2275,  2272,  2269,  2266,  2262,  2259,  2256,  2253,  2250,  2246,  2243,
+     2240,  2237,  2234,  2231,  2228,  2225,  2222,  2219,  2216,  2213,  2210,  2207,
+     2204,  2201,  2199,  2196,  2193,  2190,  2187,  2184,  2181,  2178,  2175,  2172,
+     2169,  2166,  2163,  2160,  2157,  2154,  2151,  2149,  2146,  2143,  2140,  2137,
+     2134,  2131,  2129,  2126,  2123,  2120,  2117,  2114,  2111,  2109,  2106,  2103,
+     2100,  2097,  2094,  2091,  2089,  2086,  2083,  2080,  2077,  2075,  2072,  2070,
+     2067,  2065,  2062,  2059,  2057,  2054,  2052,  2049,  2046,  2044,  2041,  2039,
+     2036,  2034,  2031,  2028,  2026,  2023,  2021,  2018,  2015,  2013,  2010,  2008,
+     2005,  2003,  2000,  1998,  1997,  1995,  1993,  1992,  1990,  1989,  1987,  1985,
+     1984,  1982,  1980,  1979,  1977,  1976,  1974,  1972,  1971,  1969,  1967,  1966,
+     1964,  1962,  1961,  1959,  1958,  1956,  1954,  1953,  1951,  1949,  1948,  1946,
+     1944,  1943,  1941,  1940,  1938,  1936,  1935,  1933,  1931,  1930,  1928,  1927,
+     1925,  1923,  1922,  1920,  1918,  1917,  1915,  1913,  1912,  1910,  1908,  1907,
+     1905,  1903,  1902,  1900,  1898,  1897,  1895,  1893,  1892,  1890,  1888,  1887,
+     1885,  1883,  1882,  1880,  1878,  1877,  1875,  1873,  1872,  1870,  1868,  1867,
+     1865,  1863,  1862,  1860,  1858,  1857,  1855,  1853,  1852,  1850,  1848,  1847,
+     1845,  1843,  1842,  1840,  1838,  1836,  1834,  1832,  1830,  1828,  1826,  1824,
+     1822,  1820,  1818,  1816,  1814,  1812,  1810,  1808,  1806,  1804,  1802,  1800,
+     1798,  1796,  1794,  1792,  1790,  1788,  1786,  1784,  1782,  1780,  1778,  1776,
+     1774,  1772,  1770,  1768,  1766,  1764,  1762,  1760,  1758,  1756,  1754,  1751,
+     1749,  1747,  1745,  1743,  1741,  1738,  1736,  1734,  1732,  1730,  1728,  1725,
+     1723,  1721,  1719,  1717,  1715,  1712,  1710,  1708,  1706,  1704,  1702,  1699,
+     1697,  1695,  1693,  1691,  1689,  1686,  1684,  1682,  1680,  1678,  1676,  1674,
+     1672,  1669,  1667,  1665,  1663,  1661,  1659,  1657,  1655,  1653,  1651,  1648,
+     1646,  1644,  1642,  1640,  1638,  1636,  1634,  1632,  1629,  1627,  1625,  1623,
+     1621,  1619,  1617,  1615,  1613,  1611,  1608,  1606,  1604,  1602,  1600,  1598,
+     1596,  1594,  1591,  1589,  1587,  1585,  1583,  1581,  1578,  1576,  1574,  1572,
+     1570,  1568,  1565,  1563,  1561,  1559,  1557,  1555,  1552,  1550,  1548,  1546,
+     1544,  1542,  1539,  1537,  1535,  1533,  1531,  1529,  1526,  1524,  1522,  1520,
+     1518,  1516,  1514,  1511,  1509,  1507,  1505,  1503,  1501,  1498,  1496,  1494,
+     1492,  1490,  1488,  1485,  1483,  1481,  1479,  1477,  1475,  1472,  1470,  1468,
+     1466,  1464,  1462,  1459,  1457,  1455,  1453,  1451,  1449,  1446,  1444,  1442,
+     1440,  1438,  1436,  1434,  1431,  1429,  1427,  1425,  1423,  1421,  1418,  1416,
+     1414,  1412,  1410,  1408,  1405,  1403,  1401,  1399,  1397,  1395,  1392,  1390,
+     1388,  1386,  1384,  1382,  1379,  1377,  1375,  1373,  1371,  1369,  1366,  1364,
+     1362,  1360,  1358,  1355,  1353,  1351,  1349,  1346,  1344,  1342,  1339,  1337,
+     1335,  1333,  1330,  1328,  1326,  1323,  1321,  1319,  1317,  1314,  1312,  1310,
+     1307,  1305,  1303,  1301,  1298,  1296,  1294,  1291,  1289,  1287,  1285,  1282,
+     1280,  1278,  1275,  1273,  1270,  1268,  1265,  1263,  1261,  1258,  1256,  1253,
+     1251,  1248,  1246,  1244,  1241,  1239,  1236,  1234,  1232,  1229,  1227,  1224,
+     1222,  1219,  1217,  1215,  1212,  1210,  1207,  1205,  1202,  1200,  1197,  1195,
+     1192,  1190,  1187,  1185,  1182,  1179,  1177,  1174,  1172,  1169,  1166,  1164,
+     1161,  1159,  1156,  1154,  1151,  1148,  1146,  1143,  1141,  1138,  1135,  1133,
+     1130,  1128,  1125,  1123,  1120,  1117,  1114,  1112,  1109,  1106,  1103,  1101,
+     1098,  1095,  1092,  1090,  1087,  1084,  1081,  1079,  1076,  1073,  1070,  1068,
+     1065,  1062,  1059,  1057,  1054,  1051,  1048,  1046,  1043,  1040,  1037,  1034,
+     1031,  1028,  1025,  1022,  1019,  1016,  1013,  1010,  1007,  1004,  1001,   999,
+      996,   993,   990,   987,   984,   981,   978,   975,   972,   969,   966,   963,
+      960,   957,   953,   950,   947,   943,   940,   937,   933,   930,   927,   923,
+      920,   917,   913,   910,   907,   903,   900,   897,   893,   890,   887,   883,
+      880,   876,   873,   869,   865,   862,   858,   855,   851,   847,   844,   840,
+      836,   833,   829,   825,   822,   818,   815,   811,   807,   804,   800,   796,
+      792,   787,   783,   779,   775,   771,   766,   762,   758,   754,   749,   745,
+      741,   737,   733,   728,   724,   720,   715,   711,   706,   701,   696,   692,
+      687,   682,   678,   673,   668,   664,   659,   654,   649,   645,   640,   635,
+      629,   624,   619,   613,   608,   603,   597,   592,   587,   581,   576,   571,
+      565,   560,   553,   547,   540,   533,   527,   520,   513,   507,   500,   493,
+      487,   480,   473,   465,   458,   451,   444,   436,   429,   422,   415,   407,
+      400,   396,   392,   388,   384,   380,   376,   372,   368,   362,   356,   350,
+      344,   338,   332,   326,   320,   315,   311,   306,   302,   297,   293,   288,
+      283,   278,   274,   269,   264,   259,   254,   250,   245,   240,   228,   216,
+      204,   192,   171,   149,   128,   104,    80,    40,     0,   -40,   -80,   -80
+  };
+#endif
+
+#if ANY_THERMISTOR_IS(57)
+  #define HAS_UNIFORM_TEMPTABLE_57 1
+  #define UNIFORM_TEMPTABLE_57_SHIFT 0 // max error 0.06 degC
+  const int16_t uniform_temptable_57[] PROGMEM = {
+    15008, 13595, 12183, 10770,  9358,  7945,  6533,  5120,  5080,  5040,  5000,  4960,
+     4920,  4880,  4840,  4800,  4785,  4771,  4756,  4742,  4727,  4713,  4698,  4684,
+     4669,  4655,  4640,  4608,  4576,  4544,  4512,  4480,  4448,  4416,  4384,  4352,
+     4332,  4311,  4291,  4271,  4250,  4230,  4209,  4189,  4169,  4148,  4128,  4110,
+     4092,  4075,  4057,  4039,  4021,  4004,  3986,  3968,  3964,  3960,  3956,  3952,
+     3948,  3944,  3940,  3936,  3932,  3928,  3924,  3920,  3907,  3894,  3882,  3869,
+     3856,  3843,  3830,  3818,  3805,  3792,  3779,  3766,  3753,  3740,  3727,  3713,
+     3700,  3687,  3674,  3661,  3648,  3637,  3626,  3614,  3603,  3592,  3581,  3570,
+     3558,  3547,  3536,  3527,  3519,  3510,  3501,  3492,  3484,  3475,  3466,  3457,
+     3449,  3440,  3430,  3421,  3411,  3402,  3392,  3382,  3373,  3363,  3354,  3344,
+     3337,  3329,  3322,  3315,  3308,  3300,  3293,  3286,  3279,  3271,  3264,  3256,
+     3248,  3240,  3232,  3224,  3216,  3208,  3200,  3192,  3184,  3178,  3171,  3165,
+     3158,  3152,  3146,  3139,  3133,  3126,  3120,  3112,  3104,  3096,  3088,  3080,
+     3072,  3064,  3056,  3048,  3040,  3035,  3030,  3026,  3021,  3016,  3011,  3006,
+     3002,  2997,  2992,  2986,  2979,  2973,  2966,  2960,  2954,  2947,  2941,  2934,
+     2928,  2925,  2922,  2918,  2915,  2912,  2909,  2906,  2902,  2899,  2896,  2893,
+     2890,  2886,  2883,  2880,  2877,  2874,  2870,  2867,  2864,  2857,  2850,  2842,
+     2835,  2828,  2821,  2814,  2806,  2799,  2792,  2785,  2778,  2770,  2763,  2756,
+     2749,  2742,  2734,  2727,  2720,  2717,  2715,  2712,  2709,  2707,  2704,  2701,
+     2699,  2696,  2693,  2691,  2688,  2685,  2683,  2680,  2677,  2675,  2672,  2669,
+     2667,  2664,  2661,  2659,  2656,  2653,  2651,  2648,  2645,  2643,  2640,  2632,
+     2624,  2616,  2608,  2600,  2592,  2584,  2576,  2568,  2560,  2557,  2555,  2552,
+     2549,  2547,  2544,  2541,  2539,  2536,  2533,  2531,  2528,  2525,  2523,  2520,
+     2517,  2515,  2512,  2509,  2507,  2504,  2501,  2499,  2496,  2493,  2491,  2488,
+     2485,  2483,  2480,  2477,  2475,  2472,  2469,  2467,  2464,  2461,  2459,  2456,
+     2453,  2451,  2448,  2445,  2443,  2440,  2437,  2435,  2432,  2429,  2427,  2424,
+     2421,  2419,  2416,  2413,  2411,  2408,  2405,  2403,  2400,  2398,  2395,  2393,
+     2390,  2388,  2386,  2383,  2381,  2378,  2376,  2374,  2371,  2369,  2366,  2364,
+     2362,  2359,  2357,  2354,  2352,  2350,  2347,  2345,  2342,  2340,  2338,  2335,
+     2333,  2330,  2328,  2326,  2323,  2321,  2318,  2316,  2314,  2311,  2309,  2306,
+     2304,  2302,  2301,  2299,  2298,  2296,  2294,  2293,  2291,  2290,  2288,  2286,
+     2285,  2283,  2282,  2280,  2278,  2277,  2275,  2274,  2272,  2270,  2269,  2267,
+     2266,  2264,  2262,  2261,  2259,  2258,  2256,  2254,  2253,  2251,  2250,  2248,
+     2246,  2245,  2243,  2242,  2240,  2234,  2229,  2223,  2218,  2212,  2206,  2201,
+     2195,  2190,  2184,  2178,  2173,  2167,  2162,  2156,  2150,  2145,  2139,  2134,
+     2128,  2126,  2125,  2123,  2122,  2120,  2118,  2117,  2115,  2114,  2112,  2110,
+     2109,  2107,  2106,  2104,  2102,  2101,  2099,  2098,  2096,  2094,  2093,  2091,
+     2090,  2088,  2086,  2085,  2083,  2082,  2080,  2078,  2077,  2075,  2074,  2072,
+     2070,  2069,  2067,  2066,  2064,  2062,  2061,  2059,  2058,  2056,  2054,  2053,
+     2051,  2050,  2048,  2046,  2045,  2043,  2042,  2040,  2038,  2037,  2035,  2034,
+     2032,  2030,  2029,  2027,  2026,  2024,  2022,  2021,  2019,  2018,  2016,  2014,
+     2013,  2011,  2010,  2008,  2006,  2005,  2003,  2002,  2000,  1998,  1997,  1995,
+     1994,  1992,  1990,  1989,  1987,  1986,  1984,  1982,  1981,  1979,  1978,  1976,
+     1974,  1973,  1971,  1970,  1968,  1966,  1965,  1963,  1962,  1960,  1958,  1957,
+     1955,  1954,  1952,  1950,  1949,  1947,  1946,  1944,  1942,  1941,  1939,  1938,
+     1936,  1934,  1933,  1931,  1930,  1928,  1926,  1925,  1923,  1922,  1920,  1918,
+     1915,  1913,  1910,  1908,  1906,  1903,  1901,  1898,  1896,  1894,  1891,  1889,
+     1886,  1884,  1882,  1879,  1877,  1874,  1872,  1868,  1863,  1859,  1854,  1850,
+     1845,  1841,  1836,  1832,  1827,  1823,  1818,  1814,  1809,  1805,  1800,  1796,
+     1791,  1787,  1782,  1778,  1773,  1769,  1764,  1760,  1757,  1755,  1752,  1749,
+     1747,  1744,  1741,  1739,  1736,  1733,  1731,  1728,  1725,  1723,  1720,  1717,
+     1715,  1712,  1709,  1707,  1704,  1701,  1699,  1696,  1693,  1691,  1688,  1685,
+     1683,  1680,  1678,  1676,  1674,  1672,  1670,  1668,  1666,  1664,  1662,  1660,
+     1658,  1656,  1654,  1652,  1650,  1648,  1646,  1644,  1642,  1640,  1638,  1636,
+     1634,  1632,  1630,  1628,  1626,  1624,  1622,  1620,  1618,  1616,  1614,  1612,
+     1610,  1608,  1606,  1604,  1602,  1600,  1593,  1585,  1578,  1571,  1564,  1556,
+     1549,  1542,  1535,  1527,  1520,  1516,  1512,  1508,  1504,  1500,  1496,  1492,
+     1488,  1484,  1480,  1476,  1472,  1468,  1464,  1460,  1456,  1452,  1448,  1444,
+     1440,  1436,  1432,  1428,  1424,  1420,  1416,  1412,  1408,  1404,  1400,  1396,
+     1392,  1388,  1384,  1380,  1376,  1372,  1368,  1364,  1360,  1350,  1341,  1331,
+     1322,  1312,  1302,  1293,  1283,  1274,  1264,  1259,  1254,  1249,  1245,  1240,
+     1235,  1230,  1225,  1220,  1215,  1210,  1206,  1201,  1196,  1191,  1186,  1181,
+     1176,  1171,  1167,  1162,  1157,  1152,  1151,  1150,  1148,  1147,  1146,  1145,
+     1143,  1142,  1141,  1140,  1138,  1137,  1136,  1135,  1134,  1132,  1131,  1130,
+     1129,  1127,  1126,  1125,  1124,  1122,  1121,  1120,  1119,  1118,  1116,  1115,
+     1114,  1113,  1111,  1110,  1109,  1108,  1106,  1105,  1104,  1102,  1100,  1098,
+     1095,  1093,  1091,  1089,  1087,  1085,  1083,  1081,  1078,  1076,  1074,  1072,
+     1070,  1068,  1066,  1063,  1061,  1059,  1057,  1055,  1053,  1051,  1049,  1046,
+     1044,  1042,  1040,  1037,  1034,  1031,  1028,  1025,  1022,  1019,  1016,  1013,
+     1010,  1006,  1003,  1000,   997,   994,   991,   988,   985,   982,   979,   976,
+      973,   970,   967,   964,   961,   958,   955,   952,   949,   946,   942,   939,
+      936,   933,   930,   927,   924,   921,   918,   915,   912,   908,   905,   901,
+      898,   894,   891,   887,   884,   880,   874,   868,   863,   857,   851,   845,
+      839,   833,   828,   822,   816,   813,   810,   806,   803,   800,   797,   794,
+      790,   787,   784,   781,   778,   774,   771,   768,   765,   762,   758,   755,
+      752,   749,   746,   742,   739,   736,   733,   730,   726,   723,   720,   711,
+      703,   694,   685,   676,   668,   659,   650,   641,   633,   624,   620,   616,
+      613,   609,   605,   601,   597,   593,   590,   586,   582,   578,   574,   570,
+      567,   563,   559,   555,   551,   547,   544,   540,   536,   532,   528,   525,
+      521,   517,   513,   509,   505,   502,   498,   494,   490,   486,   482,   479,
+      475,   471,   467,   463,   459,   456,   452,   448,   443,   437,   432,   427,
+      421,   416,   411,   405,   400,   396,   392,   388,   384,   380,   376,   372,
+      368,   362,   356,   350,   344,   338,   332,   326,   320,   315,   309,   304,
+      299,   293,   288,   278,   269,   259,   250,   240,   228,   216,   204,   192,
+      176,   160,   144,   128,   116,   104,    92,    80,    60,    40,    20,     0,
+      -27,   -53,   -80,   -80
+  };
+#endif
+
+#if ANY_THERMISTOR_IS(60)
+  #define HAS_UNIFORM_TEMPTABLE_60 1
+  #define UNIFORM_TEMPTABLE_60_SHIFT 0 // max error 0.06 degC
+  const int16_t uniform_temptable_60[] PROGMEM = {
+     4352,  4330,  4307,  4285,  4262,  4240,  4218,  4195,  4173,  4150,  4128,  4110,
+     4093,  4075,  4058,  4040,  4022,  4005,  3987,  3970,  3952,  3936,  3920,  3904,
+     3888,  3872,  3856,  3840,  3824,  3808,  3792,  3779,  3766,  3754,  3741,  3728,
+     3715,  3702,  3690,  3677,  3664,  3651,  3638,  3626,  3613,  3600,  3587,  3574,
+     3562,  3549,  3536,  3527,  3518,  3509,  3500,  3491,  3482,  3473,  3463,  3454,
+     3445,  3436,  3427,  3418,  3409,  3400,  3391,  3382,  3373,  3364,  3355,  3346,
+     3337,  3327,  3318,  3309,  3300,  3291,  3282,  3273,  3264,  3257,  3249,  3242,
+     3234,  3227,  3219,  3212,  3204,  3197,  3189,  3182,  3174,  3167,  3159,  3152,
+     3145,  3137,  3130,  3122,  3115,  3107,  3100,  3092,  3085,  3077,  3070,  3062,
+     3055,  3047,  3040,  3034,  3028,  3022,  3017,  3011,  3005,  2999,  2993,  2987,
+     2981,  2975,  2970,  2964,  2958,  2952,  2946,  2940,  2934,  2929,  2923,  2917,
+     2911,  2905,  2899,  2893,  2887,  2882,  2876,  2870,  2864,  2859,  2854,  2850,
+     2845,  2840,  2835,  2830,  2826,  2821,  2816,  2811,  2806,  2802,  2797,  2792,
+     2787,  2782,  2778,  2773,  2768,  2763,  2758,  2754,  2749,  2744,  2739,  2734,
+     2730,  2725,  2720,  2715,  2710,  2706,  2701,  2696,  2691,  2686,  2682,  2677,
+     2672,  2668,  2664,  2660,  2656,  2652,  2648,  2644,  2640,  2636,  2632,  2628,
+     2624,  2620,  2616,  2612,  2608,  2604,  2600,  2596,  2592,  2588,  2584,  2580,
+     2576,  2572,  2568,  2564,  2560,  2556,  2552,  2548,  2544,  2540,  2536,  2532,
+     2528,  2524,  2520,  2516,  2512,  2508,  2505,  2501,  2498,  2494,  2490,  2487,
+     2483,  2480,  2476,  2472,  2469,  2465,  2462,  2458,  2454,  2451,  2447,  2444,
+     2440,  2436,  2433,  2429,  2426,  2422,  2418,  2415,  2411,  2408,  2404,  2400,
+     2397,  2393,  2390,  2386,  2382,  2379,  2375,  2372,  2368,  2365,  2362,  2358,
+     2355,  2352,  2349,  2346,  2342,  2339,  2336,  2333,  2330,  2326,  2323,  2320,
+     2317,  2314,  2310,  2307,  2304,  2301,  2298,  2294,  2291,  2288,  2285,  2282,
+     2278,  2275,  2272,  2269,  2266,  2262,  2259,  2256,  2253,  2250,  2246,  2243,
+     2240,  2237,  2235,  2232,  2229,  2227,  2224,  2221,  2219,  2216,  2213,  2211,
+     2208,  2205,  2203,  2200,  2197,  2195,  2192,  2189,  2187,  2184,  2181,  2179,
+     2176,  2173,  2171,  2168,  2165,  2163,  2160,  2157,  2155,  2152,  2149,  2147,
+     2144,  2141,  2139,  2136,  2133,  2131,  2128,  2125,  2123,  2120,  2117,  2115,
+     2112,  2109,  2107,  2104,  2101,  2099,  2096,  2093,  2091,  2088,  2085,  2083,
+     2080,  2077,  2075,  2072,  2069,  2067,  2064,  2061,  2059,  2056,  2053,  2051,
+     2048,  2045,  2043,  2040,  2037,  2035,  2032,  2029,  2027,  2024,  2021,  2019,
+     2016,  2013,  2011,  2008,  2005,  2003,  2000,  1997,  1994,  1990,  1987,  1984,
+     1981,  1978,  1974,  1971,  1968,  1966,  1965,  1963,  1962,  1960,  1958,  1957,
+     1955,  1954,  1952,  1949,  1946,  1942,  1939,  1936,  1933,  1930,  1926,  1923,
+     1920,  1918,  1917,  1915,  1914,  1912,  1910,  1909,  1907,  1906,  1904,  1901,
+     1898,  1894,  1891,  1888,  1885,  1882,  1878,  1875,  1872,  1870,  1869,  1867,
+     1866,  1864,  1862,  1861,  1859,  1858,  1856,  1853,  1850,  1846,  1843,  1840,
+     1837,  1834,  1830,  1827,  1824,  1822,  1821,  1819,  1818,  1816,  1814,  1813,
+     1811,  1810,  1808,  1805,  1802,  1798,  1795,  1792,  1789,  1786,  1782,  1779,
+     1776,  1774,  1773,  1771,  1770,  1768,  1766,  1765,  1763,  1762,  1760,  1757,
+     1754,  1750,  1747,  1744,  1741,  1738,  1734,  1731,  1728,  1726,  1725,  1723,
+     1722,  1720,  1718,  1717,  1715,  1714,  1712,  1709,  1706,  1702,  1699,  1696,
+     1693,  1690,  1686,  1683,  1680,  1678,  1677,  1675,  1674,  1672,  1670,  1669,
+     1667,  1666,  1664,  1661,  1658,  1654,  1651,  1648,  1645,  1642,  1638,  1635,
+     1632,  1630,  1629,  1627,  1626,  1624,  1622,  1621,  1619,  1618,  1616,  1614,
+     1613,  1611,  1610,  1608,  1606,  1605,  1603,  1602,  1600,  1597,  1594,  1590,
+     1587,  1584,  1581,  1578,  1574,  1571,  1568,  1566,  1565,  1563,  1562,  1560,
+     1558,  1557,  1555,  1554,  1552,  1549,  1546,  1542,  1539,  1536,  1533,  1530,
+     1526,  1523,  1520,  1518,  1517,  1515,  1514,  1512,  1510,  1509,  1507,  1506,
+     1504,  1501,  1498,  1494,  1491,  1488,  1485,  1482,  1478,  1475,  1472,  1470,
+     1469,  1467,  1466,  1464,  1462,  1461,  1459,  1458,  1456,  1454,  1453,  1451,
+     1450,  1448,  1446,  1445,  1443,  1442,  1440,  1437,  1434,  1430,  1427,  1424,
+     1421,  1418,  1414,  1411,  1408,  1406,  1405,  1403,  1402,  1400,  1398,  1397,
+     1395,  1394,  1392,  1389,  1386,  1382,  1379,  1376,  1373,  1370,  1366,  1363,
+     1360,  1358,  1357,  1355,  1354,  1352,  1350,  1349,  1347,  1346,  1344,  1341,
+     1338,  1334,  1331,  1328,  1325,  1322,  1318,  1315,  1312,  1310,  1309,  1307,
+     1306,  1304,  1302,  1301,  1299,  1298,  1296,  1293,  1290,  1286,  1283,  1280,
+     1277,  1274,  1270,  1267,  1264,  1261,  1258,  1254,  1251,  1248,  1245,  1242,
+     1238,  1235,  1232,  1230,  1229,  1227,  1226,  1224,  1222,  1221,  1219,  1218,
+     1216,  1213,  1210,  1206,  1203,  1200,  1197,  1194,  1190,  1187,  1184,  1181,
+     1178,  1174,  1171,  1168,  1165,  1162,  1158,  1155,  1152,  1150,  1149,  1147,
+     1146,  1144,  1142,  1141,  1139,  1138,  1136,  1133,  1130,  1126,  1123,  1120,
+     1117,  1114,  1110,  1107,  1104,  1101,  1098,  1094,  1091,  1088,  1085,  1082,
+     1078,  1075,  1072,  1069,  1066,  1062,  1059,  1056,  1053,  1050,  1046,  1043,
+     1040,  1037,  1034,  1030,  1027,  1024,  1021,  1018,  1014,  1011,  1008,  1006,
+     1005,  1003,  1002,  1000,   998,   997,   995,   994,   992,   989,   986,   982,
+      979,   976,   973,   970,   966,   963,   960,   955,   950,   946,   941,   936,
+      931,   926,   922,   917,   912,   909,   906,   902,   899,   896,   893,   890,
+      886,   883,   880,   877,   874,   870,   867,   864,   861,   858,   854,   851,
+      848,   845,   842,   838,   835,   832,   829,   826,   822,   819,   816,   811,
+      806,   802,   797,   792,   787,   782,   778,   773,   768,   763,   758,   754,
+      749,   744,   739,   734,   730,   725,   720,   715,   710,   706,   701,   696,
+      691,   686,   682,   677,   672,   667,   662,   658,   653,   648,   643,   638,
+      634,   629,   624,   619,   614,   610,   605,   600,   595,   590,   586,   581,
+      576,   570,   563,   557,   550,   544,   538,   531,   525,   518,   512,   505,
+      498,   490,   483,   476,   469,   462,   454,   447,   440,   433,   426,   418,
+      411,   404,   397,   390,   382,   375,   368,   358,   349,   339,   330,   320,
+      310,   301,   291,   282,   272,   259,   246,   234,   221,   208,   195,   182,
+      170,   157,   144,   123,   103,    82,    62,    41,    21,     0,     0
+  };
+#endif
+
+// temptable_61 is off by 3.88 degC with an entry every ADC count, so it has no uniform table
+
+// temptable_66 is off by 217.56 degC with an entry every ADC count, so it has no uniform table
+
+#if ANY_THERMISTOR_IS(67)
+  #define HAS_UNIFORM_TEMPTABLE_67 1
+  #define UNIFORM_TEMPTABLE_67_SHIFT 0 // max error 0.06 degC
+  const int16_t uniform_temptable_67[] PROGMEM = {
+     8000,  7840,  7760,  7680,  7600,  7520,  7440,  7360,  7307,  7253,  7200,  7147,
+     7093,  7040,  6987,  6933,  6880,  6827,  6773,  6720,  6680,  6640,  6600,  6560,
+     6528,  6496,  6464,  6432,  6400,  6368,  6336,  6304,  6272,  6240,  6208,  6176,
+     6144,  6112,  6080,  6057,  6034,  6011,  5989,  5966,  5943,  5920,  5897,  5874,
+     5851,  5829,  5806,  5783,  5760,  5740,  5720,  5700,  5680,  5660,  5640,  5620,
+     5600,  5582,  5564,  5547,  5529,  5511,  5493,  5476,  5458,  5440,  5425,  5411,
+     5396,  5382,  5367,  5353,  5338,  5324,  5309,  5295,  5280,  5267,  5253,  5240,
+     5227,  5213,  5200,  5187,  5173,  5160,  5147,  5133,  5120,  5108,  5095,  5083,
+     5071,  5058,  5046,  5034,  5022,  5009,  4997,  4985,  4972,  4960,  4950,  4940,
+     4930,  4920,  4910,  4900,  4890,  4880,  4870,  4860,  4850,  4840,  4830,  4820,
+     4810,  4800,  4791,  4782,  4773,  4764,  4756,  4747,  4738,  4729,  4720,  4711,
+     4702,  4693,  4684,  4676,  4667,  4658,  4649,  4640,  4632,  4624,  4616,  4608,
+     4600,  4592,  4584,  4576,  4568,  4560,  4552,  4544,  4536,  4528,  4520,  4512,
+     4504,  4496,  4488,  4480,  4473,  4466,  4459,  4452,  4445,  4438,  4431,  4424,
+     4417,  4410,  4403,  4397,  4390,  4383,  4376,  4369,  4362,  4355,  4348,  4341,
+     4334,  4327,  4320,  4314,  4307,  4301,  4294,  4288,  4282,  4275,  4269,  4262,
+     4256,  4250,  4243,  4237,  4230,  4224,  4218,  4211,  4205,  4198,  4192,  4186,
+     4179,  4173,  4166,  4160,  4155,  4149,  4144,  4139,  4133,  4128,  4123,  4117,
+     4112,  4107,  4101,  4096,  4091,  4085,  4080,  4075,  4069,  4064,  4059,  4053,
+     4048,  4043,  4037,  4032,  4027,  4021,  4016,  4011,  4005,  4000,  3995,  3990,
+     3985,  3979,  3974,  3969,  3964,  3959,  3954,  3948,  3943,  3938,  3933,  3928,
+     3923,  3917,  3912,  3907,  3902,  3897,  3892,  3886,  3881,  3876,  3871,  3866,
+     3861,  3855,  3850,  3845,  3840,  3835,  3831,  3826,  3822,  3817,  3813,  3808,
+     3803,  3799,  3794,  3790,  3785,  3781,  3776,  3771,  3767,  3762,  3758,  3753,
+     3749,  3744,  3739,  3735,  3730,  3726,  3721,  3717,  3712,  3707,  3703,  3698,
+     3694,  3689,  3685,  3680,  3676,  3672,  3668,  3664,  3659,  3655,  3651,  3647,
+     3643,  3639,  3635,  3631,  3627,  3623,  3618,  3614,  3610,  3606,  3602,  3598,
+     3594,  3590,  3586,  3582,  3577,  3573,  3569,  3565,  3561,  3557,  3553,  3549,
+     3545,  3541,  3536,  3532,  3528,  3524,  3520,  3516,  3513,  3509,  3505,  3501,
+     3498,  3494,  3490,  3487,  3483,  3479,  3475,  3472,  3468,  3464,  3460,  3457,
+     3453,  3449,  3446,  3442,  3438,  3434,  3431,  3427,  3423,  3420,  3416,  3412,
+     3408,  3405,  3401,  3397,  3393,  3390,  3386,  3382,  3379,  3375,  3371,  3367,
+     3364,  3360,  3357,  3353,  3350,  3346,  3343,  3339,  3336,  3332,  3329,  3325,
+     3322,  3318,  3315,  3311,  3308,  3304,  3301,  3297,  3294,  3290,  3287,  3283,
+     3280,  3277,  3273,  3270,  3266,  3263,  3259,  3256,  3252,  3249,  3245,  3242,
+     3238,  3235,  3231,  3228,  3224,  3221,  3217,  3214,  3210,  3207,  3203,  3200,
+     3197,  3193,  3190,  3187,  3183,  3180,  3177,  3173,  3170,  3167,  3163,  3160,
+     3157,  3153,  3150,  3147,  3143,  3140,  3137,  3133,  3130,  3127,  3123,  3120,
+     3117,  3113,  3110,  3107,  3103,  3100,  3097,  3093,  3090,  3087,  3083,  3080,
+     3077,  3073,  3070,  3067,  3063,  3060,  3057,  3053,  3050,  3047,  3043,  3040,
+     3037,  3034,  3030,  3027,  3024,  3021,  3018,  3014,  3011,  3008,  3005,  3002,
+     2998,  2995,  2992,  2989,  2986,  2982,  2979,  2976,  2973,  2970,  2966,  2963,
+     2960,  2957,  2954,  2950,  2947,  2944,  2941,  2938,  2934,  2931,  2928,  2925,
+     2922,  2918,  2915,  2912,  2909,  2906,  2902,  2899,  2896,  2893,  2890,  2886,
+     2883,  2880,  2877,  2874,  2871,  2868,  2865,  2862,  2858,  2855,  2852,  2849,
+     2846,  2843,  2840,  2837,  2834,  2831,  2828,  2825,  2822,  2818,  2815,  2812,
+     2809,  2806,  2803,  2800,  2797,  2794,  2791,  2788,  2785,  2782,  2778,  2775,
+     2772,  2769,  2766,  2763,  2760,  2757,  2754,  2751,  2748,  2745,  2742,  2738,
+     2735,  2732,  2729,  2726,  2723,  2720,  2717,  2714,  2711,  2708,  2705,  2702,
+     2698,  2695,  2692,  2689,  2686,  2683,  2680,  2677,  2674,  2671,  2668,  2665,
+     2662,  2658,  2655,  2652,  2649,  2646,  2643,  2640,  2637,  2634,  2631,  2628,
+     2625,  2622,  2618,  2615,  2612,  2609,  2606,  2603,  2600,  2597,  2594,  2591,
+     2588,  2585,  2582,  2578,  2575,  2572,  2569,  2566,  2563,  2560,  2557,  2554,
+     2551,  2547,  2544,  2541,  2538,  2535,  2532,  2529,  2525,  2522,  2519,  2516,
+     2513,  2510,  2507,  2504,  2500,  2497,  2494,  2491,  2488,  2485,  2482,  2478,
+     2475,  2472,  2469,  2466,  2463,  2460,  2456,  2453,  2450,  2447,  2444,  2441,
+     2438,  2435,  2431,  2428,  2425,  2422,  2419,  2416,  2413,  2409,  2406,  2403,
+     2400,  2397,  2393,  2390,  2387,  2384,  2380,  2377,  2374,  2371,  2367,  2364,
+     2361,  2358,  2354,  2351,  2348,  2344,  2341,  2338,  2335,  2331,  2328,  2325,
+     2322,  2318,  2315,  2312,  2309,  2305,  2302,  2299,  2296,  2292,  2289,  2286,
+     2282,  2279,  2276,  2273,  2269,  2266,  2263,  2260,  2256,  2253,  2250,  2247,
+     2243,  2240,  2237,  2233,  2230,  2226,  2223,  2219,  2216,  2212,  2209,  2205,
+     2202,  2198,  2195,  2191,  2188,  2184,  2181,  2177,  2174,  2170,  2167,  2163,
+     2160,  2157,  2153,  2150,  2146,  2143,  2139,  2136,  2132,  2129,  2125,  2122,
+     2118,  2115,  2111,  2108,  2104,  2101,  2097,  2094,  2090,  2087,  2083,  2080,
+     2076,  2072,  2068,  2064,  2060,  2057,  2053,  2049,  2045,  2041,  2037,  2033,
+     2029,  2025,  2021,  2018,  2014,  2010,  2006,  2002,  1998,  1994,  1990,  1986,
+     1982,  1979,  1975,  1971,  1967,  1963,  1959,  1955,  1951,  1947,  1943,  1940,
+     1936,  1932,  1928,  1924,  1920,  1916,  1911,  1907,  1903,  1898,  1894,  1890,
+     1885,  1881,  1877,  1872,  1868,  1864,  1859,  1855,  1851,  1846,  1842,  1838,
+     1834,  1829,  1825,  1821,  1816,  1812,  1808,  1803,  1799,  1795,  1790,  1786,
+     1782,  1777,  1773,  1769,  1764,  1760,  1755,  1750,  1745,  1739,  1734,  1729,
+     1724,  1719,  1714,  1708,  1703,  1698,  1693,  1688,  1683,  1677,  1672,  1667,
+     1662,  1657,  1652,  1646,  1641,  1636,  1631,  1626,  1621,  1615,  1610,  1605,
+     1600,  1594,  1588,  1582,  1575,  1569,  1563,  1557,  1551,  1545,  1538,  1532,
+     1526,  1520,  1514,  1508,  1502,  1495,  1489,  1483,  1477,  1471,  1465,  1458,
+     1452,  1446,  1440,  1433,  1427,  1420,  1413,  1407,  1400,  1393,  1387,  1380,
+     1373,  1367,  1360,  1352,  1344,  1336,  1328,  1320,  1312,  1304,  1296,  1288,
+     1280,  1271,  1261,  1252,  1242,  1233,  1224,  1214,  1205,  1195,  1186,  1176,
+     1167,  1158,  1148,  1139,  1129,  1120,  1108,  1095,  1083,  1071,  1058,  1046,
+     1034,  1022,  1009,   997,   985,   972,   960,   944,   928,   912,   896,   880,
+      864,   848,   832,   816,   800,   780,   760,   740,   720,   700,   680,   660,
+      640,   608,   576,   544,   512,   480,   440,   400,   360,   320,   267,   213,
+      160,    80,     0,  -160,  -320,  -320
+  };
+#endif
+
+#if ANY_THERMISTOR_IS(70)
+  #define HAS_UNIFORM_TEMPTABLE_70 1
+  #define UNIFORM_TEMPTABLE_70_SHIFT 0 // max error 0.06 degC
+  const int16_t uniform_temptable_70[] PROGMEM = {
+     4320,  4281,  4242,  4203,  4164,  4124,  4085,  4046,  4007,  3968,  3936,  3904,
+     3872,  3840,  3808,  3776,  3744,  3724,  3703,  3683,  3663,  3642,  3622,  3601,
+     3581,  3561,  3540,  3520,  3505,  3490,  3475,  3460,  3445,  3430,  3415,  3400,
+     3385,  3370,  3355,  3340,  3325,  3310,  3295,  3280,  3269,  3258,  3247,  3236,
+     3226,  3215,  3204,  3193,  3182,  3171,  3160,  3149,  3139,  3128,  3117,  3106,
+     3095,  3084,  3073,  3062,  3052,  3041,  3030,  3019,  3008,  3001,  2994,  2987,
+     2980,  2973,  2966,  2960,  2953,  2946,  2939,  2932,  2925,  2918,  2911,  2904,
+     2897,  2890,  2883,  2877,  2870,  2863,  2856,  2849,  2842,  2835,  2828,  2821,
+     2814,  2807,  2800,  2794,  2787,  2780,  2773,  2766,  2759,  2752,  2749,  2745,
+     2742,  2739,  2735,  2732,  2729,  2725,  2722,  2719,  2715,  2712,  2709,  2705,
+     2702,  2699,  2695,  2692,  2689,  2685,  2682,  2679,  2675,  2672,  2668,  2665,
+     2662,  2658,  2655,  2652,  2648,  2645,  2642,  2638,  2635,  2632,  2628,  2625,
+     2622,  2618,  2615,  2612,  2608,  2605,  2602,  2598,  2595,  2592,  2588,  2585,
+     2582,  2578,  2575,  2572,  2568,  2565,  2562,  2558,  2555,  2552,  2548,  2545,
+     2542,  2538,  2535,  2532,  2528,  2525,  2522,  2518,  2515,  2512,  2508,  2505,
+     2501,  2498,  2495,  2491,  2488,  2485,  2481,  2478,  2475,  2471,  2468,  2465,
+     2461,  2458,  2455,  2451,  2448,  2445,  2441,  2438,  2435,  2431,  2428,  2425,
+     2421,  2418,  2415,  2411,  2408,  2405,  2401,  2398,  2395,  2391,  2388,  2385,
+     2381,  2378,  2375,  2371,  2368,  2365,  2361,  2358,  2355,  2351,  2348,  2345,
+     2341,  2338,  2334,  2331,  2328,  2324,  2321,  2318,  2314,  2311,  2308,  2304,
+     2301,  2298,  2294,  2291,  2288,  2284,  2281,  2278,  2274,  2271,  2268,  2264,
+     2261,  2258,  2254,  2251,  2248,  2244,  2241,  2238,  2234,  2231,  2228,  2224,
+     2221,  2218,  2214,  2211,  2208,  2204,  2201,  2198,  2194,  2191,  2188,  2184,
+     2181,  2178,  2174,  2171,  2167,  2164,  2161,  2157,  2154,  2151,  2147,  2144,
+     2141,  2137,  2134,  2131,  2127,  2124,  2121,  2117,  2114,  2111,  2107,  2104,
+     2101,  2097,  2094,  2091,  2087,  2084,  2081,  2077,  2074,  2071,  2067,  2064,
+     2061,  2057,  2054,  2051,  2047,  2044,  2041,  2037,  2034,  2031,  2027,  2024,
+     2021,  2017,  2014,  2011,  2007,  2004,  2000,  1997,  1994,  1990,  1987,  1984,
+     1980,  1977,  1974,  1970,  1967,  1964,  1960,  1957,  1954,  1950,  1947,  1944,
+     1940,  1937,  1934,  1930,  1927,  1924,  1920,  1917,  1914,  1910,  1907,  1904,
+     1900,  1897,  1894,  1890,  1887,  1884,  1880,  1877,  1874,  1870,  1867,  1864,
+     1860,  1857,  1854,  1850,  1847,  1844,  1840,  1837,  1833,  1830,  1827,  1823,
+     1820,  1817,  1813,  1810,  1807,  1803,  1800,  1797,  1793,  1790,  1787,  1783,
+     1780,  1777,  1773,  1770,  1767,  1763,  1760,  1758,  1756,  1754,  1752,  1751,
+     1749,  1747,  1745,  1743,  1741,  1739,  1737,  1736,  1734,  1732,  1730,  1728,
+     1726,  1724,  1722,  1720,  1719,  1717,  1715,  1713,  1711,  1709,  1707,  1705,
+     1704,  1702,  1700,  1698,  1696,  1694,  1692,  1690,  1688,  1687,  1685,  1683,
+     1681,  1679,  1677,  1675,  1673,  1672,  1670,  1668,  1666,  1664,  1662,  1660,
+     1658,  1656,  1655,  1653,  1651,  1649,  1647,  1645,  1643,  1641,  1640,  1638,
+     1636,  1634,  1632,  1630,  1628,  1626,  1624,  1623,  1621,  1619,  1617,  1615,
+     1613,  1611,  1609,  1608,  1606,  1604,  1602,  1600,  1598,  1596,  1594,  1592,
+     1591,  1589,  1587,  1585,  1583,  1581,  1579,  1577,  1576,  1574,  1572,  1570,
+     1568,  1566,  1564,  1562,  1560,  1559,  1557,  1555,  1553,  1551,  1549,  1547,
+     1545,  1544,  1542,  1540,  1538,  1536,  1534,  1532,  1530,  1528,  1527,  1525,
+     1523,  1521,  1519,  1517,  1515,  1513,  1512,  1510,  1508,  1506,  1504,  1502,
+     1500,  1498,  1496,  1495,  1493,  1491,  1489,  1487,  1485,  1483,  1481,  1480,
+     1478,  1476,  1474,  1472,  1470,  1468,  1466,  1464,  1463,  1461,  1459,  1457,
+     1455,  1453,  1451,  1449,  1448,  1446,  1444,  1442,  1440,  1438,  1436,  1434,
+     1431,  1429,  1427,  1425,  1423,  1421,  1419,  1417,  1414,  1412,  1410,  1408,
+     1406,  1404,  1402,  1399,  1397,  1395,  1393,  1391,  1389,  1387,  1385,  1382,
+     1380,  1378,  1376,  1374,  1372,  1370,  1367,  1365,  1363,  1361,  1359,  1357,
+     1355,  1353,  1350,  1348,  1346,  1344,  1342,  1340,  1338,  1335,  1333,  1331,
+     1329,  1327,  1325,  1323,  1321,  1318,  1316,  1314,  1312,  1310,  1308,  1306,
+     1303,  1301,  1299,  1297,  1295,  1293,  1291,  1289,  1286,  1284,  1282,  1280,
+     1278,  1276,  1274,  1271,  1269,  1267,  1265,  1263,  1261,  1259,  1257,  1254,
+     1252,  1250,  1248,  1246,  1244,  1242,  1239,  1237,  1235,  1233,  1231,  1229,
+     1227,  1225,  1222,  1220,  1218,  1216,  1214,  1212,  1210,  1207,  1205,  1203,
+     1201,  1199,  1197,  1195,  1193,  1190,  1188,  1186,  1184,  1182,  1180,  1178,
+     1175,  1173,  1171,  1169,  1167,  1165,  1163,  1161,  1158,  1156,  1154,  1152,
+     1150,  1148,  1146,  1143,  1141,  1139,  1137,  1135,  1133,  1131,  1129,  1126,
+     1124,  1122,  1120,  1118,  1116,  1114,  1111,  1109,  1107,  1105,  1103,  1101,
+     1099,  1097,  1094,  1092,  1090,  1088,  1086,  1084,  1082,  1079,  1077,  1075,
+     1073,  1071,  1069,  1067,  1065,  1062,  1060,  1058,  1056,  1054,  1052,  1050,
+     1047,  1045,  1043,  1041,  1039,  1037,  1035,  1033,  1030,  1028,  1026,  1024,
+     1022,  1020,  1018,  1015,  1013,  1011,  1009,  1007,  1005,  1003,  1001,   998,
+      996,   994,   992,   990,   988,   986,   983,   981,   979,   977,   975,   973,
+      971,   969,   966,   964,   962,   960,   958,   956,   954,   951,   949,   947,
+      945,   943,   941,   939,   937,   934,   932,   930,   928,   926,   924,   922,
+      919,   917,   915,   913,   911,   909,   907,   905,   902,   900,   898,   896,
+      892,   888,   884,   880,   876,   872,   868,   864,   860,   856,   852,   848,
+      844,   840,   836,   833,   829,   825,   821,   817,   813,   809,   805,   801,
+      797,   793,   789,   785,   781,   777,   773,   769,   765,   761,   757,   753,
+      749,   745,   741,   737,   733,   729,   725,   721,   717,   713,   710,   706,
+      702,   698,   694,   690,   686,   682,   678,   674,   670,   666,   662,   658,
+      654,   650,   646,   642,   638,   634,   630,   626,   622,   618,   614,   610,
+      606,   602,   598,   594,   590,   586,   583,   579,   575,   571,   567,   563,
+      559,   555,   551,   547,   543,   539,   535,   531,   527,   523,   519,   515,
+      511,   507,   503,   499,   495,   491,   487,   483,   479,   475,   471,   467,
+      463,   460,   456,   452,   448,   444,   440,   436,   432,   428,   424,   420,
+      416,   412,   408,   404,   400,   395,   390,   385,   380,   375,   370,   365,
+      360,   355,   350,   345,   340,   335,   330,   325,   320,   310,   300,   290,
+      280,   270,   260,   250,   240,   227,   213,   200,   187,   173,   160,   144,
+      128,   112,    96,    80,    60,    40,    20,     0,     0
+  };
+#endif
+
+#if ANY_THERMISTOR_IS(71)
+  #define HAS_UNIFORM_TEMPTABLE_71 1
+  #define UNIFORM_TEMPTABLE_71_SHIFT 0 // max error 0.06 degC
+  const int16_t uniform_temptable_71[] PROGMEM = {
+     4800,  4769,  4738,  4707,  4676,  4645,  4614,  4583,  4552,  4521,  4490,  4459,
+     4428,  4397,  4366,  4335,  4304,  4282,  4260,  4238,  4216,  4194,  4172,  4150,
+     4128,  4109,  4090,  4070,  4051,  4032,  4014,  3995,  3977,  3959,  3941,  3922,
+     3904,  3890,  3875,  3861,  3846,  3832,  3818,  3803,  3789,  3774,  3760,  3747,
+     3733,  3720,  3707,  3693,  3680,  3667,  3654,  3642,  3629,  3616,  3605,  3594,
+     3582,  3571,  3560,  3549,  3538,  3526,  3515,  3504,  3494,  3484,  3474,  3464,
+     3454,  3444,  3434,  3424,  3414,  3405,  3395,  3386,  3376,  3367,  3359,  3350,
+     3341,  3332,  3324,  3315,  3306,  3297,  3289,  3280,  3272,  3264,  3256,  3248,
+     3240,  3232,  3224,  3216,  3208,  3200,  3193,  3185,  3178,  3171,  3164,  3156,
+     3149,  3142,  3135,  3127,  3120,  3113,  3106,  3099,  3093,  3086,  3079,  3072,
+     3066,  3059,  3053,  3046,  3040,  3034,  3027,  3021,  3014,  3008,  3002,  2996,
+     2990,  2984,  2978,  2972,  2966,  2960,  2955,  2949,  2944,  2939,  2933,  2928,
+     2923,  2917,  2912,  2907,  2901,  2896,  2891,  2885,  2880,  2875,  2869,  2864,
+     2859,  2853,  2848,  2843,  2837,  2832,  2827,  2821,  2816,  2811,  2805,  2800,
+     2795,  2789,  2784,  2779,  2773,  2768,  2763,  2759,  2754,  2750,  2745,  2741,
+     2736,  2732,  2727,  2723,  2719,  2714,  2710,  2705,  2701,  2697,  2692,  2688,
+     2684,  2679,  2675,  2671,  2666,  2662,  2657,  2653,  2649,  2644,  2640,  2636,
+     2632,  2627,  2623,  2619,  2615,  2611,  2606,  2602,  2598,  2594,  2589,  2585,
+     2581,  2577,  2573,  2568,  2564,  2560,  2556,  2553,  2549,  2545,  2542,  2538,
+     2535,  2531,  2527,  2524,  2520,  2516,  2513,  2509,  2505,  2502,  2498,  2495,
+     2491,  2487,  2484,  2480,  2476,  2473,  2469,  2465,  2462,  2458,  2455,  2451,
+     2447,  2444,  2440,  2436,  2433,  2429,  2425,  2422,  2418,  2415,  2411,  2407,
+     2404,  2400,  2397,  2394,  2391,  2387,  2384,  2381,  2378,  2375,  2372,  2369,
+     2365,  2362,  2359,  2356,  2353,  2350,  2347,  2344,  2340,  2337,  2334,  2331,
+     2328,  2325,  2322,  2318,  2315,  2312,  2309,  2306,  2303,  2300,  2296,  2293,
+     2290,  2287,  2284,  2281,  2278,  2275,  2271,  2268,  2265,  2262,  2259,  2256,
+     2253,  2249,  2246,  2243,  2240,  2237,  2235,  2232,  2229,  2227,  2224,  2221,
+     2218,  2216,  2213,  2210,  2208,  2205,  2202,  2200,  2197,  2194,  2192,  2189,
+     2186,  2184,  2181,  2178,  2175,  2173,  2170,  2167,  2165,  2162,  2159,  2157,
+     2154,  2151,  2149,  2146,  2143,  2141,  2138,  2135,  2132,  2130,  2127,  2124,
+     2122,  2119,  2116,  2114,  2111,  2108,  2106,  2103,  2100,  2097,  2095,  2092,
+     2089,  2087,  2084,  2081,  2079,  2076,  2073,  2071,  2068,  2065,  2063,  2060,
+     2057,  2054,  2052,  2049,  2046,  2044,  2041,  2038,  2036,  2033,  2030,  2028,
+     2025,  2022,  2019,  2017,  2014,  2011,  2009,  2006,  2003,  2001,  1998,  1995,
+     1993,  1990,  1987,  1985,  1982,  1979,  1976,  1974,  1971,  1968,  1966,  1963,
+     1960,  1958,  1955,  1952,  1950,  1947,  1944,  1942,  1939,  1936,  1933,  1931,
+     1928,  1925,  1923,  1920,  1918,  1915,  1913,  1911,  1908,  1906,  1904,  1901,
+     1899,  1896,  1894,  1892,  1889,  1887,  1885,  1882,  1880,  1878,  1875,  1873,
+     1871,  1868,  1866,  1864,  1861,  1859,  1856,  1854,  1852,  1849,  1847,  1845,
+     1842,  1840,  1838,  1835,  1833,  1831,  1828,  1826,  1824,  1821,  1819,  1816,
+     1814,  1812,  1809,  1807,  1805,  1802,  1800,  1798,  1795,  1793,  1791,  1788,
+     1786,  1784,  1781,  1779,  1776,  1774,  1772,  1769,  1767,  1765,  1762,  1760,
+     1758,  1755,  1753,  1751,  1748,  1746,  1744,  1741,  1739,  1737,  1734,  1732,
+     1730,  1728,  1725,  1723,  1721,  1718,  1716,  1714,  1711,  1709,  1707,  1704,
+     1702,  1700,  1697,  1695,  1693,  1690,  1688,  1686,  1683,  1681,  1679,  1677,
+     1674,  1672,  1670,  1667,  1665,  1663,  1660,  1658,  1656,  1653,  1651,  1649,
+     1646,  1644,  1642,  1639,  1637,  1635,  1632,  1630,  1628,  1626,  1623,  1621,
+     1619,  1616,  1614,  1612,  1609,  1607,  1605,  1602,  1600,  1598,  1595,  1593,
+     1591,  1588,  1586,  1584,  1581,  1579,  1577,  1574,  1572,  1570,  1568,  1565,
+     1563,  1561,  1558,  1556,  1554,  1551,  1549,  1547,  1544,  1542,  1540,  1537,
+     1535,  1533,  1530,  1528,  1526,  1523,  1521,  1519,  1517,  1514,  1512,  1510,
+     1507,  1505,  1503,  1500,  1498,  1496,  1493,  1491,  1489,  1486,  1484,  1482,
+     1479,  1477,  1475,  1472,  1470,  1468,  1466,  1463,  1461,  1459,  1456,  1454,
+     1452,  1449,  1447,  1445,  1442,  1440,  1438,  1435,  1433,  1431,  1428,  1426,
+     1424,  1421,  1419,  1417,  1414,  1412,  1410,  1408,  1405,  1403,  1401,  1398,
+     1396,  1394,  1391,  1389,  1387,  1384,  1382,  1380,  1377,  1375,  1373,  1370,
+     1368,  1366,  1363,  1361,  1359,  1357,  1354,  1352,  1350,  1347,  1345,  1343,
+     1340,  1338,  1336,  1333,  1331,  1329,  1326,  1324,  1322,  1319,  1317,  1315,
+     1312,  1310,  1308,  1306,  1303,  1301,  1299,  1296,  1294,  1292,  1289,  1287,
+     1285,  1282,  1280,  1277,  1275,  1272,  1270,  1267,  1265,  1262,  1260,  1257,
+     1254,  1252,  1249,  1247,  1244,  1242,  1239,  1236,  1234,  1231,  1229,  1226,
+     1224,  1221,  1219,  1216,  1213,  1211,  1208,  1205,  1203,  1200,  1197,  1195,
+     1192,  1189,  1187,  1184,  1181,  1179,  1176,  1173,  1171,  1168,  1165,  1163,
+     1160,  1157,  1155,  1152,  1149,  1147,  1144,  1141,  1139,  1136,  1133,  1131,
+     1128,  1125,  1123,  1120,  1117,  1114,  1112,  1109,  1106,  1103,  1101,  1098,
+     1095,  1092,  1089,  1087,  1084,  1081,  1078,  1075,  1073,  1070,  1067,  1064,
+     1062,  1059,  1056,  1053,  1050,  1047,  1044,  1041,  1037,  1034,  1031,  1028,
+     1025,  1022,  1019,  1016,  1013,  1010,  1006,  1003,  1000,   997,   994,   991,
+      988,   985,   982,   979,   975,   972,   969,   966,   963,   960,   957,   953,
+      950,   947,   943,   940,   936,   933,   930,   926,   923,   920,   916,   913,
+      909,   906,   903,   899,   896,   892,   889,   885,   882,   878,   875,   871,
+      868,   864,   860,   856,   853,   849,   845,   841,   838,   834,   830,   826,
+      823,   819,   815,   811,   808,   804,   800,   796,   792,   787,   783,   779,
+      775,   771,   766,   762,   758,   754,   749,   745,   741,   737,   733,   728,
+      724,   720,   715,   710,   705,   700,   695,   690,   685,   680,   675,   670,
+      665,   660,   655,   650,   645,   640,   635,   629,   624,   619,   613,   608,
+      603,   597,   592,   587,   581,   576,   571,   565,   560,   553,   547,   540,
+      534,   527,   520,   514,   507,   501,   494,   488,   481,   474,   468,   461,
+      455,   448,   440,   432,   424,   416,   408,   400,   392,   384,   375,   366,
+      357,   347,   338,   329,   320,   310,   300,   290,   280,   270,   260,   250,
+      240,   227,   213,   200,   187,   173,   160,   144,   128,   112,    96,    80,
+       60,    40,    20,     0,     0
+  };
+#endif
+
+// temptable_75 depends on HIGH_TEMP_RANGE_75, so it has no uniform table
+
+// temptable_99 is off by 0.38 degC with an entry every ADC count, so it has no uniform table
+
+#if ANY_THERMISTOR_IS(110)
+  #define HAS_UNIFORM_TEMPTABLE_110 1
+  #define UNIFORM_TEMPTABLE_110_SHIFT 1 // max error 0.06 degC
+  const int16_t uniform_temptable_110[] PROGMEM = {
+        0,   100,   200,   300,   400,   500,   600,   700,   800,   907,  1013,  1120,
+     1227,  1333,  1440,  1547,  1653,  1760,  1867,  1973,  2080,  2187,  2293,  2400,
+     2514,  2629,  2743,  2857,  2971,  3086,  3200,  3323,  3446,  3569,  3692,  3815,
+     3938,  4062,  4185,  4308,  4431,  4554,  4677,  4800,  4800
+  };
+#endif
+
+#if ANY_THERMISTOR_IS(147)
+  #define HAS_UNIFORM_TEMPTABLE_147 1
+  #define UNIFORM_TEMPTABLE_147_SHIFT 0 // max error 0.04 degC
+  const int16_t uniform_temptable_147[] PROGMEM = {
+        0,   200,   400,   600,   800,  1000,  1200,  1400,  1600,  1800,  2000,  2200,
+     2400,  2667,  2933,  3200,  3400,  3600,  3800,  4000,  4200,  4400,  4600,  4800,
+     4800
+  };
+#endif
+
+#if ANY_THERMISTOR_IS(201)
+  #define HAS_UNIFORM_TEMPTABLE_201 1
+  #define UNIFORM_TEMPTABLE_201_SHIFT 2 // max error 0.15 degC
+  const int16_t uniform_temptable_201[] PROGMEM = {
+        0,     8,    16,    37,    59,    80,   104,   136,   168,   200,   232,   264,
+      296,   328,   358,   388,   418,   448,   469,   491,   514,   537,   560,   589,
+      618,   647,   673,   700,   727,   753,   780,   806,   832,   858,   883,   909,
+      934,   960,   986,  1011,  1037,  1062,  1088,  1114,  1139,  1165,  1190,  1216,
+     1242,  1267,  1294,  1322,  1350,  1377,  1405,  1433,  1460,  1487,  1513,  1540,
+     1567,  1593,  1620,  1647,  1673,  1700,  1727,  1753,  1779,  1805,  1830,  1856,
+     1882,  1907,  1935,  1964,  1993,  2022,  2051,  2080,  2105,  2129,  2154,  2178,
+     2203,  2228,  2255,  2284,  2313,  2342,  2371,  2400,  2428,  2456,  2483,  2511,
+     2539,  2566,  2592,  2618,  2643,  2669,  2694,  2720,  2750,  2781,  2811,  2842,
+     2872,  2901,  2929,  2957,  2984,  3012,  3040,  3067,  3093,  3120,  3147,  3173,
+     3200,  3232,  3264,  3296,  3328,  3360,  3379,  3397,  3416,  3435,  3453,  3472,
+     3491,  3509,  3528,  3547,  3565,  3584,  3608,  3632,  3656,  3680,  3704,  3728,
+     3756,  3784,  3813,  3841,  3869,  3897,  3925,  3954,  3982,  4010,  4038,  4067,
+     4095,  4123,  4151,  4179,  4208,  4236,  4264,  4292,  4320,  4349,  4377,  4405,
+     4433,  4462,  4490,  4518,  4546,  4574,  4603,  4631,  4659,  4687,  4715,  4744,
+     4772,  4800,  4828,  4857,  4885,  4913,  4941,  4969,  4998,  5026,  5054,  5082,
+     5110,  5139,  5167,  5195,  5223,  5251,  5280,  5308,  5336,  5364,  5393,  5421,
+     5449,  5477,  5505,  5534,  5562,  5590,  5618,  5646,  5675,  5703,  5731,  5759,
+     5788,  5816,  5844,  5872,  5900,  5929,  5957,  5985,  6013,  6041,  6070,  6098,
+     6126,  6154,  6183,  6211,  6239,  6267,  6295,  6324,  6352,  6380,  6408,  6436,
+     6465,  6493,  6521,  6549,  6577,  6606,  6634,  6662,  6690,  6719,  6747,  6775,
+     6803,  6831,  6860,  6888,  6916,  6944,  6972,  7001,  7029,  7057,  7085,  7114,
+     7142,  7170,  7198,  7226,  7255,  7283,  7311,  7339,  7367,  7396,  7424,  7452,
+     7480,  7509,  7537,  7565,  7593,  7621,  7650,  7678,  7706,  7734,  7762,  7791,
+     7819,  7840
+  };
+#endif
+
+#if ANY_THERMISTOR_IS(202)
+  #define HAS_UNIFORM_TEMPTABLE_202 1
+  #define UNIFORM_TEMPTABLE_202_SHIFT 0 // max error 0.06 degC
+  const int16_t uniform_temptable_202[] PROGMEM = {
+    13824, 13559, 13293, 13028, 12762, 12497, 12232, 11966, 11701, 11435, 11170, 10904,
+    10639, 10374, 10108,  9843,  9577,  9312,  9047,  8781,  8516,  8250,  7985,  7720,
+     7454,  7189,  6923,  6658,  6392,  6127,  5862,  5596,  5331,  5065,  4800,  4773,
+     4747,  4720,  4693,  4667,  4640,  4613,  4587,  4560,  4533,  4507,  4480,  4460,
+     4440,  4420,  4400,  4380,  4360,  4340,  4320,  4304,  4288,  4272,  4256,  4240,
+     4224,  4208,  4192,  4176,  4160,  4144,  4128,  4112,  4096,  4080,  4067,  4053,
+     4040,  4027,  4013,  4000,  3989,  3977,  3966,  3954,  3943,  3931,  3920,  3909,
+     3897,  3886,  3874,  3863,  3851,  3840,  3830,  3820,  3810,  3800,  3790,  3780,
+     3770,  3760,  3751,  3742,  3733,  3724,  3716,  3707,  3698,  3689,  3680,  3671,
+     3662,  3653,  3644,  3636,  3627,  3618,  3609,  3600,  3593,  3585,  3578,  3571,
+     3564,  3556,  3549,  3542,  3535,  3527,  3520,  3513,  3505,  3498,  3491,  3484,
+     3476,  3469,  3462,  3455,  3447,  3440,  3434,  3428,  3422,  3415,  3409,  3403,
+     3397,  3391,  3385,  3378,  3372,  3366,  3360,  3354,  3348,  3342,  3335,  3329,
+     3323,  3317,  3311,  3305,  3298,  3292,  3286,  3280,  3275,  3269,  3264,  3259,
+     3253,  3248,  3243,  3237,  3232,  3227,  3221,  3216,  3211,  3205,  3200,  3195,
+     3190,  3185,  3180,  3175,  3170,  3165,  3160,  3155,  3150,  3145,  3140,  3135,
+     3130,  3125,  3120,  3116,  3111,  3107,  3102,  3098,  3093,  3089,  3084,  3080,
+     3076,  3071,  3067,  3062,  3058,  3053,  3049,  3044,  3040,  3036,  3032,  3027,
+     3023,  3019,  3015,  3011,  3006,  3002,  2998,  2994,  2989,  2985,  2981,  2977,
+     2973,  2968,  2964,  2960,  2956,  2952,  2949,  2945,  2941,  2937,  2933,  2930,
+     2926,  2922,  2918,  2914,  2910,  2907,  2903,  2899,  2895,  2891,  2888,  2884,
+     2880,  2876,  2873,  2869,  2865,  2862,  2858,  2855,  2851,  2847,  2844,  2840,
+     2836,  2833,  2829,  2825,  2822,  2818,  2815,  2811,  2807,  2804,  2800,  2797,
+     2793,  2790,  2787,  2783,  2780,  2777,  2773,  2770,  2767,  2763,  2760,  2757,
+     2753,  2750,  2747,  2743,  2740,  2737,  2733,  2730,  2727,  2723,  2720,  2717,
+     2714,  2711,  2708,  2705,  2702,  2698,  2695,  2692,  2689,  2686,  2683,  2680,
+     2677,  2674,  2671,  2668,  2665,  2662,  2658,  2655,  2652,  2649,  2646,  2643,
+     2640,  2637,  2634,  2631,  2628,  2625,  2622,  2619,  2616,  2613,  2610,  2607,
+     2604,  2601,  2599,  2596,  2593,  2590,  2587,  2584,  2581,  2578,  2575,  2572,
+     2569,  2566,  2563,  2560,  2557,  2554,  2552,  2549,  2546,  2543,  2541,  2538,
+     2535,  2532,  2530,  2527,  2524,  2521,  2519,  2516,  2513,  2510,  2508,  2505,
+     2502,  2499,  2497,  2494,  2491,  2488,  2486,  2483,  2480,  2477,  2475,  2472,
+     2469,  2467,  2464,  2461,  2459,  2456,  2453,  2451,  2448,  2445,  2443,  2440,
+     2437,  2435,  2432,  2429,  2427,  2424,  2421,  2419,  2416,  2413,  2411,  2408,
+     2405,  2403,  2400,  2398,  2395,  2392,  2390,  2388,  2385,  2382,  2380,  2378,
+     2375,  2372,  2370,  2368,  2365,  2362,  2360,  2358,  2355,  2352,  2350,  2348,
+     2345,  2342,  2340,  2338,  2335,  2332,  2330,  2328,  2325,  2322,  2320,  2318,
+     2315,  2313,  2310,  2308,  2305,  2303,  2301,  2298,  2296,  2293,  2291,  2288,
+     2286,  2284,  2281,  2279,  2276,  2274,  2272,  2269,  2267,  2264,  2262,  2259,
+     2257,  2255,  2252,  2250,  2247,  2245,  2242,  2240,  2238,  2235,  2233,  2231,
+     2229,  2226,  2224,  2222,  2219,  2217,  2215,  2213,  2210,  2208,  2206,  2203,
+     2201,  2199,  2197,  2194,  2192,  2190,  2187,  2185,  2183,  2181,  2178,  2176,
+     2174,  2171,  2169,  2167,  2165,  2162,  2160,  2158,  2155,  2153,  2151,  2149,
+     2146,  2144,  2142,  2139,  2137,  2135,  2133,  2130,  2128,  2126,  2123,  2121,
+     2119,  2117,  2114,  2112,  2110,  2107,  2105,  2103,  2101,  2098,  2096,  2094,
+     2091,  2089,  2087,  2085,  2082,  2080,  2078,  2075,  2073,  2071,  2069,  2066,
+     2064,  2062,  2059,  2057,  2055,  2053,  2050,  2048,  2046,  2043,  2041,  2039,
+     2037,  2034,  2032,  2030,  2027,  2025,  2023,  2021,  2018,  2016,  2014,  2011,
+     2009,  2007,  2005,  2002,  2000,  1998,  1996,  1993,  1991,  1989,  1987,  1984,
+     1982,  1980,  1978,  1976,  1973,  1971,  1969,  1967,  1964,  1962,  1960,  1958,
+     1956,  1953,  1951,  1949,  1947,  1944,  1942,  1940,  1938,  1936,  1933,  1931,
+     1929,  1927,  1924,  1922,  1920,  1918,  1915,  1913,  1911,  1909,  1906,  1904,
+     1902,  1899,  1897,  1895,  1893,  1890,  1888,  1886,  1883,  1881,  1879,  1877,
+     1874,  1872,  1870,  1867,  1865,  1863,  1861,  1858,  1856,  1854,  1851,  1849,
+     1847,  1845,  1842,  1840,  1838,  1835,  1833,  1831,  1829,  1826,  1824,  1822,
+     1819,  1817,  1815,  1813,  1810,  1808,  1806,  1803,  1801,  1799,  1797,  1794,
+     1792,  1790,  1787,  1785,  1783,  1781,  1778,  1776,  1774,  1771,  1769,  1767,
+     1765,  1762,  1760,  1758,  1755,  1753,  1750,  1748,  1745,  1743,  1741,  1738,
+     1736,  1733,  1731,  1728,  1726,  1724,  1721,  1719,  1716,  1714,  1712,  1709,
+     1707,  1704,  1702,  1699,  1697,  1695,  1692,  1690,  1687,  1685,  1682,  1680,
+     1678,  1675,  1673,  1670,  1668,  1665,  1663,  1661,  1658,  1656,  1653,  1651,
+     1648,  1646,  1644,  1641,  1639,  1636,  1634,  1632,  1629,  1627,  1624,  1622,
+     1619,  1617,  1615,  1612,  1610,  1607,  1605,  1602,  1600,  1597,  1595,  1592,
+     1589,  1587,  1584,  1581,  1579,  1576,  1573,  1571,  1568,  1565,  1563,  1560,
+     1557,  1555,  1552,  1549,  1547,  1544,  1541,  1539,  1536,  1533,  1531,  1528,
+     1525,  1523,  1520,  1517,  1514,  1512,  1509,  1506,  1503,  1501,  1498,  1495,
+     1492,  1490,  1487,  1484,  1481,  1479,  1476,  1473,  1470,  1468,  1465,  1462,
+     1459,  1457,  1454,  1451,  1448,  1446,  1443,  1440,  1437,  1434,  1431,  1428,
+     1425,  1422,  1419,  1416,  1413,  1410,  1407,  1404,  1401,  1399,  1396,  1393,
+     1390,  1387,  1384,  1381,  1378,  1375,  1372,  1369,  1366,  1363,  1360,  1357,
+     1354,  1350,  1347,  1344,  1341,  1338,  1334,  1331,  1328,  1325,  1322,  1318,
+     1315,  1312,  1309,  1306,  1302,  1299,  1296,  1293,  1290,  1286,  1283,  1280,
+     1276,  1273,  1269,  1265,  1262,  1258,  1255,  1251,  1247,  1244,  1240,  1236,
+     1233,  1229,  1225,  1222,  1218,  1215,  1211,  1207,  1204,  1200,  1196,  1192,
+     1188,  1184,  1180,  1176,  1172,  1168,  1164,  1160,  1156,  1152,  1148,  1144,
+     1140,  1136,  1132,  1128,  1124,  1120,  1116,  1111,  1107,  1102,  1098,  1093,
+     1089,  1084,  1080,  1076,  1071,  1067,  1062,  1058,  1053,  1049,  1044,  1040,
+     1035,  1030,  1025,  1020,  1015,  1010,  1005,  1000,   995,   990,   985,   980,
+      975,   970,   965,   960,   954,   949,   943,   937,   931,   926,   920,   914,
+      909,   903,   897,   891,   886,   880,   873,   867,   860,   853,   847,   840,
+      833,   827,   820,   813,   807,   800,   792,   784,   776,   768,   760,   752,
+      744,   736,   728,   720,   711,   702,   693,   684,   676,   667,   658,   649,
+      640,   629,   617,   606,   594,   583,   571,   560,   547,   533,   520,   507,
+      493,   480,   464,   448,   432,   416,   400,   380,   360,   340,   320,   300,
+      280,   260,   240,   213,   187,   160,   120,    80,    40,     0,     0
+  };
+#endif
+
+// temptable_331 is off by 1.06 degC with an entry every ADC count, so it has no uniform table
+
+#if ANY_THERMISTOR_IS(332)
+  #define HAS_UNIFORM_TEMPTABLE_332 1
+  #define UNIFORM_TEMPTABLE_332_SHIFT 0 // max error 0.06 degC
+  const int16_t uniform_temptable_332[] PROGMEM = {
+     2400,  2397,  2394,  2390,  2387,  2384,  2381,  2378,  2374,  2371,  2368,  2365,
+     2362,  2358,  2355,  2352,  2349,  2346,  2342,  2339,  2336,  2333,  2330,  2326,
+     2323,  2320,  2318,  2315,  2313,  2311,  2308,  2306,  2303,  2301,  2299,  2296,
+     2294,  2292,  2289,  2287,  2284,  2282,  2280,  2277,  2275,  2273,  2270,  2268,
+     2265,  2263,  2261,  2258,  2256,  2254,  2252,  2249,  2247,  2245,  2243,  2241,
+     2239,  2236,  2234,  2232,  2230,  2228,  2226,  2223,  2221,  2219,  2217,  2215,
+     2213,  2210,  2208,  2206,  2204,  2202,  2200,  2197,  2195,  2193,  2191,  2189,
+     2187,  2184,  2182,  2180,  2178,  2176,  2174,  2171,  2169,  2167,  2165,  2163,
+     2161,  2158,  2156,  2154,  2152,  2150,  2148,  2145,  2143,  2141,  2139,  2137,
+     2135,  2132,  2130,  2128,  2125,  2123,  2120,  2117,  2115,  2112,  2109,  2107,
+     2104,  2101,  2099,  2096,  2093,  2091,  2088,  2085,  2083,  2080,  2077,  2075,
+     2072,  2069,  2067,  2064,  2061,  2059,  2056,  2053,  2051,  2048,  2045,  2043,
+     2040,  2037,  2035,  2032,  2029,  2027,  2024,  2021,  2019,  2016,  2013,  2011,
+     2008,  2005,  2003,  2000,  1997,  1995,  1992,  1989,  1987,  1984,  1981,  1979,
+     1976,  1973,  1971,  1968,  1965,  1963,  1960,  1957,  1955,  1952,  1949,  1946,
+     1943,  1939,  1936,  1933,  1930,  1927,  1924,  1920,  1917,  1914,  1911,  1908,
+     1905,  1902,  1898,  1895,  1892,  1889,  1886,  1883,  1879,  1876,  1873,  1870,
+     1867,  1864,  1861,  1857,  1854,  1851,  1848,  1845,  1842,  1838,  1835,  1832,
+     1829,  1826,  1823,  1819,  1816,  1813,  1810,  1807,  1804,  1801,  1797,  1794,
+     1791,  1788,  1785,  1782,  1778,  1775,  1772,  1769,  1766,  1763,  1760,  1756,
+     1753,  1750,  1747,  1744,  1741,  1737,  1734,  1731,  1728,  1726,  1724,  1722,
+     1719,  1717,  1715,  1713,  1711,  1709,  1707,  1705,  1702,  1700,  1698,  1696,
+     1694,  1692,  1690,  1687,  1685,  1683,  1681,  1679,  1677,  1675,  1673,  1670,
+     1668,  1666,  1664,  1662,  1660,  1658,  1655,  1653,  1651,  1649,  1647,  1645,
+     1643,  1641,  1638,  1636,  1634,  1632,  1630,  1628,  1626,  1623,  1621,  1619,
+     1617,  1615,  1613,  1611,  1609,  1606,  1604,  1602,  1600,  1598,  1596,  1594,
+     1591,  1589,  1587,  1585,  1583,  1581,  1579,  1577,  1574,  1572,  1570,  1568,
+     1566,  1564,  1562,  1559,  1557,  1555,  1553,  1551,  1549,  1546,  1544,  1542,
+     1540,  1538,  1536,  1533,  1531,  1529,  1527,  1525,  1523,  1520,  1518,  1516,
+     1514,  1512,  1510,  1507,  1505,  1503,  1501,  1499,  1497,  1494,  1492,  1490,
+     1488,  1486,  1484,  1482,  1479,  1477,  1475,  1473,  1471,  1469,  1466,  1464,
+     1462,  1460,  1458,  1456,  1453,  1451,  1449,  1447,  1445,  1443,  1440,  1438,
+     1436,  1434,  1432,  1430,  1427,  1425,  1423,  1421,  1419,  1417,  1414,  1412,
+     1410,  1408,  1406,  1404,  1402,  1400,  1398,  1396,  1394,  1392,  1390,  1388,
+     1386,  1384,  1382,  1380,  1378,  1376,  1374,  1372,  1370,  1368,  1366,  1364,
+     1362,  1360,  1358,  1356,  1354,  1352,  1350,  1348,  1346,  1344,  1342,  1340,
+     1338,  1336,  1334,  1332,  1330,  1328,  1326,  1324,  1322,  1320,  1318,  1316,
+     1314,  1312,  1310,  1308,  1306,  1304,  1302,  1300,  1298,  1296,  1294,  1292,
+     1290,  1288,  1286,  1284,  1282,  1280,  1278,  1276,  1274,  1272,  1270,  1268,
+     1266,  1264,  1262,  1260,  1257,  1255,  1253,  1250,  1248,  1246,  1244,  1242,
+     1239,  1237,  1235,  1232,  1230,  1228,  1226,  1224,  1221,  1219,  1217,  1214,
+     1212,  1210,  1208,  1206,  1203,  1201,  1199,  1196,  1194,  1192,  1190,  1188,
+     1185,  1183,  1181,  1178,  1176,  1174,  1172,  1170,  1167,  1165,  1163,  1160,
+     1158,  1156,  1154,  1152,  1149,  1147,  1145,  1142,  1140,  1138,  1136,  1134,
+     1131,  1129,  1127,  1124,  1122,  1120,  1116,  1111,  1107,  1103,  1099,  1094,
+     1090,  1086,  1081,  1077,  1073,  1069,  1064,  1060,  1056,  1051,  1047,  1043,
+     1039,  1034,  1030,  1026,  1021,  1017,  1013,  1009,  1004,  1000,   996,   991,
+      987,   983,   979,   974,   970,   966,   961,   957,   953,   949,   944,   940,
+      936,   931,   927,   923,   919,   914,   910,   906,   901,   897,   893,   889,
+      884,   880,   877,   874,   871,   867,   864,   861,   858,   855,   852,   849,
+      846,   842,   839,   836,   833,   830,   827,   824,   821,   817,   814,   811,
+      808,   805,   802,   799,   795,   792,   789,   786,   783,   780,   777,   774,
+      770,   767,   764,   761,   758,   755,   752,   749,   745,   742,   739,   736,
+      733,   730,   727,   724,   720,   717,   714,   711,   708,   705,   702,   699,
+      696,   692,   689,   686,   683,   680,   677,   674,   671,   668,   664,   661,
+      658,   655,   652,   649,   646,   643,   640,   636,   633,   630,   627,   624,
+      618,   611,   605,   598,   592,   586,   579,   573,   566,   560,   554,   547,
+      541,   534,   528,   520,   512,   504,   496,   488,   480,   472,   464,   456,
+      448,   440,   432,   425,   417,   410,   403,   396,   388,   381,   374,   367,
+      359,   352,   347,   342,   337,   332,   327,   321,   316,   311,   306,   301,
+      296,   291,   286,   281,   276,   271,   265,   260,   255,   250,   245,   240,
+      208,   176,   144,   112,    80,    60,    40,    20,     0,   -20,   -40,   -60,
+      -80,  -100,  -120,  -140,  -160,  -180,  -200,  -220,  -240,  -240
+  };
+#endif
+
+#if ANY_THERMISTOR_IS(501)
+  #define HAS_UNIFORM_TEMPTABLE_501 1
+  #define UNIFORM_TEMPTABLE_501_SHIFT 0 // max error 0.06 degC
+  const int16_t uniform_temptable_501[] PROGMEM = {
+    11408, 10900, 10391,  9883,  9375,  8866,  8358,  7850,  7342,  6833,  6325,  5817,
+     5308,  4800,  4720,  4640,  4587,  4533,  4480,  4440,  4400,  4360,  4320,  4280,
+     4240,  4200,  4160,  4120,  4080,  4040,  4000,  3973,  3947,  3920,  3893,  3867,
+     3840,  3824,  3808,  3792,  3776,  3760,  3744,  3728,  3712,  3696,  3680,  3664,
+     3648,  3632,  3616,  3600,  3584,  3568,  3552,  3536,  3520,  3505,  3491,  3476,
+     3462,  3447,  3433,  3418,  3404,  3389,  3375,  3360,  3350,  3340,  3330,  3320,
+     3310,  3300,  3290,  3280,  3270,  3260,  3250,  3240,  3230,  3220,  3210,  3200,
+     3190,  3180,  3170,  3160,  3150,  3140,  3130,  3120,  3110,  3100,  3090,  3080,
+     3070,  3060,  3050,  3040,  3034,  3029,  3023,  3017,  3011,  3006,  3000,  2994,
+     2989,  2983,  2977,  2971,  2966,  2960,  2954,  2949,  2943,  2937,  2931,  2926,
+     2920,  2914,  2909,  2903,  2897,  2891,  2886,  2880,  2874,  2868,  2862,  2856,
+     2850,  2844,  2839,  2833,  2827,  2821,  2815,  2809,  2803,  2797,  2791,  2785,
+     2779,  2773,  2767,  2761,  2756,  2750,  2744,  2738,  2732,  2726,  2720,  2715,
+     2711,  2706,  2701,  2696,  2692,  2687,  2682,  2678,  2673,  2668,  2664,  2659,
+     2654,  2649,  2645,  2640,  2635,  2631,  2626,  2621,  2616,  2612,  2607,  2602,
+     2598,  2593,  2588,  2584,  2579,  2574,  2569,  2565,  2560,  2556,  2552,  2548,
+     2544,  2540,  2537,  2533,  2529,  2525,  2521,  2517,  2513,  2509,  2505,  2501,
+     2498,  2494,  2490,  2486,  2482,  2478,  2474,  2470,  2466,  2462,  2459,  2455,
+     2451,  2447,  2443,  2439,  2435,  2431,  2427,  2423,  2420,  2416,  2412,  2408,
+     2404,  2400,  2397,  2393,  2390,  2387,  2383,  2380,  2377,  2373,  2370,  2367,
+     2363,  2360,  2357,  2353,  2350,  2347,  2343,  2340,  2337,  2333,  2330,  2327,
+     2323,  2320,  2317,  2313,  2310,  2307,  2303,  2300,  2297,  2293,  2290,  2287,
+     2283,  2280,  2277,  2273,  2270,  2267,  2263,  2260,  2257,  2253,  2250,  2247,
+     2243,  2240,  2237,  2234,  2232,  2229,  2226,  2223,  2221,  2218,  2215,  2212,
+     2210,  2207,  2204,  2201,  2199,  2196,  2193,  2190,  2188,  2185,  2182,  2179,
+     2177,  2174,  2171,  2168,  2166,  2163,  2160,  2157,  2154,  2152,  2149,  2146,
+     2143,  2141,  2138,  2135,  2132,  2130,  2127,  2124,  2121,  2119,  2116,  2113,
+     2110,  2108,  2105,  2102,  2099,  2097,  2094,  2091,  2088,  2086,  2083,  2080,
+     2078,  2075,  2073,  2070,  2068,  2065,  2063,  2061,  2058,  2056,  2053,  2051,
+     2048,  2046,  2044,  2041,  2039,  2036,  2034,  2032,  2029,  2027,  2024,  2022,
+     2019,  2017,  2015,  2012,  2010,  2007,  2005,  2002,  2000,  1998,  1995,  1993,
+     1990,  1988,  1985,  1983,  1981,  1978,  1976,  1973,  1971,  1968,  1966,  1964,
+     1961,  1959,  1956,  1954,  1952,  1949,  1947,  1944,  1942,  1939,  1937,  1935,
+     1932,  1930,  1927,  1925,  1922,  1920,  1918,  1916,  1914,  1911,  1909,  1907,
+     1905,  1903,  1901,  1898,  1896,  1894,  1892,  1890,  1888,  1885,  1883,  1881,
+     1879,  1877,  1875,  1872,  1870,  1868,  1866,  1864,  1862,  1859,  1857,  1855,
+     1853,  1851,  1849,  1846,  1844,  1842,  1840,  1838,  1836,  1834,  1831,  1829,
+     1827,  1825,  1823,  1821,  1818,  1816,  1814,  1812,  1810,  1808,  1805,  1803,
+     1801,  1799,  1797,  1795,  1792,  1790,  1788,  1786,  1784,  1782,  1779,  1777,
+     1775,  1773,  1771,  1769,  1766,  1764,  1762,  1760,  1758,  1756,  1754,  1752,
+     1750,  1748,  1746,  1744,  1742,  1739,  1737,  1735,  1733,  1731,  1729,  1727,
+     1725,  1723,  1721,  1719,  1717,  1715,  1713,  1711,  1709,  1707,  1705,  1703,
+     1701,  1698,  1696,  1694,  1692,  1690,  1688,  1686,  1684,  1682,  1680,  1678,
+     1676,  1674,  1672,  1670,  1668,  1666,  1664,  1662,  1659,  1657,  1655,  1653,
+     1651,  1649,  1647,  1645,  1643,  1641,  1639,  1637,  1635,  1633,  1631,  1629,
+     1627,  1625,  1623,  1621,  1618,  1616,  1614,  1612,  1610,  1608,  1606,  1604,
+     1602,  1600,  1598,  1596,  1594,  1592,  1590,  1588,  1586,  1584,  1582,  1580,
+     1578,  1576,  1574,  1572,  1570,  1568,  1566,  1564,  1562,  1560,  1559,  1557,
+     1555,  1553,  1551,  1549,  1547,  1545,  1543,  1541,  1539,  1537,  1535,  1533,
+     1531,  1529,  1527,  1525,  1523,  1521,  1519,  1517,  1515,  1513,  1511,  1509,
+     1507,  1505,  1503,  1501,  1499,  1497,  1495,  1493,  1491,  1489,  1487,  1485,
+     1483,  1481,  1480,  1478,  1476,  1474,  1472,  1470,  1468,  1466,  1464,  1462,
+     1460,  1458,  1456,  1454,  1452,  1450,  1448,  1446,  1444,  1442,  1440,  1438,
+     1436,  1434,  1432,  1430,  1428,  1426,  1424,  1422,  1419,  1417,  1415,  1413,
+     1411,  1409,  1407,  1405,  1403,  1401,  1399,  1397,  1395,  1393,  1391,  1389,
+     1387,  1385,  1383,  1381,  1378,  1376,  1374,  1372,  1370,  1368,  1366,  1364,
+     1362,  1360,  1358,  1356,  1354,  1352,  1350,  1348,  1346,  1344,  1342,  1339,
+     1337,  1335,  1333,  1331,  1329,  1327,  1325,  1323,  1321,  1319,  1317,  1315,
+     1313,  1311,  1309,  1307,  1305,  1303,  1301,  1298,  1296,  1294,  1292,  1290,
+     1288,  1286,  1284,  1282,  1280,  1278,  1275,  1273,  1271,  1269,  1266,  1264,
+     1262,  1260,  1257,  1255,  1253,  1251,  1248,  1246,  1244,  1242,  1239,  1237,
+     1235,  1233,  1230,  1228,  1226,  1224,  1221,  1219,  1217,  1215,  1212,  1210,
+     1208,  1206,  1203,  1201,  1199,  1197,  1194,  1192,  1190,  1188,  1185,  1183,
+     1181,  1179,  1176,  1174,  1172,  1170,  1167,  1165,  1163,  1161,  1158,  1156,
+     1154,  1152,  1149,  1147,  1145,  1143,  1140,  1138,  1136,  1134,  1131,  1129,
+     1127,  1125,  1122,  1120,  1117,  1115,  1112,  1110,  1107,  1105,  1102,  1099,
+     1097,  1094,  1092,  1089,  1086,  1084,  1081,  1079,  1076,  1074,  1071,  1068,
+     1066,  1063,  1061,  1058,  1055,  1053,  1050,  1048,  1045,  1043,  1040,  1037,
+     1035,  1032,  1030,  1027,  1025,  1022,  1019,  1017,  1014,  1012,  1009,  1006,
+     1004,  1001,   999,   996,   994,   991,   988,   986,   983,   981,   978,   975,
+      973,   970,   968,   965,   963,   960,   957,   954,   951,   947,   944,   941,
+      938,   935,   932,   929,   925,   922,   919,   916,   913,   910,   907,   904,
+      900,   897,   894,   891,   888,   885,   882,   878,   875,   872,   869,   866,
+      863,   860,   856,   853,   850,   847,   844,   841,   838,   835,   831,   828,
+      825,   822,   819,   816,   813,   809,   806,   803,   800,   796,   792,   788,
+      784,   780,   776,   772,   768,   764,   760,   756,   752,   748,   744,   740,
+      736,   732,   728,   724,   720,   716,   712,   708,   704,   700,   696,   692,
+      688,   684,   680,   676,   672,   668,   664,   660,   656,   652,   648,   644,
+      640,   634,   629,   623,   618,   612,   607,   601,   596,   590,   585,   579,
+      574,   568,   563,   557,   552,   546,   541,   535,   530,   524,   519,   513,
+      508,   502,   497,   491,   486,   480,   472,   464,   456,   448,   440,   432,
+      424,   416,   408,   400,   392,   384,   376,   368,   360,   352,   344,   336,
+      328,   320,   309,   297,   286,   274,   263,   251,   240,   229,   217,   206,
+      194,   183,   171,   160,   144,   128,   112,    96,    80,    64,    48,    32,
+       16,     0,     0
+  };
+#endif
+
+// temptable_502 is off by 2.06 degC with an entry every ADC count, so it has no uniform table
+
+#if ANY_THERMISTOR_IS(512)
+  #define HAS_UNIFORM_TEMPTABLE_512 1
+  #define UNIFORM_TEMPTABLE_512_SHIFT 0 // max error 0.06 degC
+  const int16_t uniform_temptable_512[] PROGMEM = {
+     4800,  4760,  4720,  4680,  4640,  4600,  4560,  4520,  4480,  4453,  4427,  4400,
+     4360,  4320,  4293,  4267,  4240,  4220,  4200,  4180,  4160,  4133,  4107,  4080,
+     4060,  4040,  4020,  4000,  3980,  3960,  3940,  3920,  3904,  3888,  3872,  3856,
+     3840,  3824,  3808,  3792,  3776,  3760,  3747,  3733,  3720,  3707,  3693,  3680,
+     3667,  3653,  3640,  3627,  3613,  3600,  3589,  3577,  3566,  3554,  3543,  3531,
+     3520,  3510,  3500,  3490,  3480,  3470,  3460,  3450,  3440,  3431,  3422,  3413,
+     3404,  3396,  3387,  3378,  3369,  3360,  3351,  3342,  3333,  3324,  3316,  3307,
+     3298,  3289,  3280,  3273,  3265,  3258,  3251,  3244,  3236,  3229,  3222,  3215,
+     3207,  3200,  3193,  3187,  3180,  3173,  3167,  3160,  3153,  3147,  3140,  3133,
+     3127,  3120,  3114,  3108,  3102,  3095,  3089,  3083,  3077,  3071,  3065,  3058,
+     3052,  3046,  3040,  3034,  3029,  3023,  3017,  3011,  3006,  3000,  2994,  2989,
+     2983,  2977,  2971,  2966,  2960,  2955,  2950,  2945,  2940,  2935,  2930,  2925,
+     2920,  2915,  2910,  2905,  2900,  2895,  2890,  2885,  2880,  2875,  2871,  2866,
+     2861,  2856,  2852,  2847,  2842,  2838,  2833,  2828,  2824,  2819,  2814,  2809,
+     2805,  2800,  2796,  2792,  2788,  2784,  2780,  2776,  2772,  2768,  2764,  2760,
+     2756,  2752,  2748,  2744,  2740,  2736,  2732,  2728,  2724,  2720,  2716,  2712,
+     2708,  2704,  2700,  2696,  2692,  2688,  2684,  2680,  2676,  2672,  2668,  2664,
+     2660,  2656,  2652,  2648,  2644,  2640,  2637,  2633,  2630,  2626,  2623,  2619,
+     2616,  2612,  2609,  2605,  2602,  2598,  2595,  2591,  2588,  2584,  2581,  2577,
+     2574,  2570,  2567,  2563,  2560,  2557,  2554,  2550,  2547,  2544,  2541,  2538,
+     2534,  2531,  2528,  2525,  2522,  2518,  2515,  2512,  2509,  2506,  2502,  2499,
+     2496,  2493,  2490,  2486,  2483,  2480,  2477,  2474,  2471,  2468,  2465,  2462,
+     2459,  2456,  2453,  2450,  2447,  2444,  2441,  2439,  2436,  2433,  2430,  2427,
+     2424,  2421,  2418,  2415,  2412,  2409,  2406,  2403,  2400,  2397,  2394,  2391,
+     2389,  2386,  2383,  2380,  2377,  2374,  2371,  2369,  2366,  2363,  2360,  2357,
+     2354,  2351,  2349,  2346,  2343,  2340,  2337,  2334,  2331,  2329,  2326,  2323,
+     2320,  2317,  2315,  2312,  2310,  2307,  2305,  2302,  2299,  2297,  2294,  2292,
+     2289,  2286,  2284,  2281,  2279,  2276,  2274,  2271,  2268,  2266,  2263,  2261,
+     2258,  2255,  2253,  2250,  2248,  2245,  2243,  2240,  2238,  2235,  2232,  2230,
+     2228,  2225,  2222,  2220,  2218,  2215,  2212,  2210,  2208,  2205,  2202,  2200,
+     2198,  2195,  2192,  2190,  2188,  2185,  2182,  2180,  2178,  2175,  2172,  2170,
+     2168,  2165,  2162,  2160,  2158,  2155,  2153,  2151,  2148,  2146,  2144,  2141,
+     2139,  2136,  2134,  2132,  2129,  2127,  2125,  2122,  2120,  2118,  2115,  2113,
+     2111,  2108,  2106,  2104,  2101,  2099,  2096,  2094,  2092,  2089,  2087,  2085,
+     2082,  2080,  2078,  2075,  2073,  2071,  2069,  2066,  2064,  2062,  2059,  2057,
+     2055,  2053,  2050,  2048,  2046,  2043,  2041,  2039,  2037,  2034,  2032,  2030,
+     2027,  2025,  2023,  2021,  2018,  2016,  2014,  2011,  2009,  2007,  2005,  2002,
+     2000,  1998,  1995,  1993,  1991,  1989,  1986,  1984,  1982,  1979,  1977,  1975,
+     1973,  1970,  1968,  1966,  1963,  1961,  1959,  1957,  1954,  1952,  1950,  1947,
+     1945,  1943,  1941,  1938,  1936,  1934,  1931,  1929,  1927,  1925,  1922,  1920,
+     1918,  1916,  1914,  1911,  1909,  1907,  1905,  1903,  1901,  1898,  1896,  1894,
+     1892,  1890,  1888,  1885,  1883,  1881,  1879,  1877,  1875,  1872,  1870,  1868,
+     1866,  1864,  1862,  1859,  1857,  1855,  1853,  1851,  1849,  1846,  1844,  1842,
+     1840,  1838,  1836,  1834,  1831,  1829,  1827,  1825,  1823,  1821,  1818,  1816,
+     1814,  1812,  1810,  1808,  1805,  1803,  1801,  1799,  1797,  1795,  1792,  1790,
+     1788,  1786,  1784,  1782,  1779,  1777,  1775,  1773,  1771,  1769,  1766,  1764,
+     1762,  1760,  1758,  1756,  1753,  1751,  1749,  1747,  1744,  1742,  1740,  1738,
+     1736,  1733,  1731,  1729,  1727,  1724,  1722,  1720,  1718,  1716,  1713,  1711,
+     1709,  1707,  1704,  1702,  1700,  1698,  1696,  1693,  1691,  1689,  1687,  1684,
+     1682,  1680,  1678,  1676,  1673,  1671,  1669,  1667,  1664,  1662,  1660,  1658,
+     1656,  1653,  1651,  1649,  1647,  1644,  1642,  1640,  1638,  1636,  1633,  1631,
+     1629,  1627,  1624,  1622,  1620,  1618,  1616,  1613,  1611,  1609,  1607,  1604,
+     1602,  1600,  1598,  1595,  1593,  1591,  1589,  1586,  1584,  1582,  1579,  1577,
+     1575,  1573,  1570,  1568,  1566,  1563,  1561,  1559,  1557,  1554,  1552,  1550,
+     1547,  1545,  1543,  1541,  1538,  1536,  1534,  1531,  1529,  1527,  1525,  1522,
+     1520,  1518,  1515,  1513,  1511,  1508,  1506,  1504,  1501,  1499,  1496,  1494,
+     1492,  1489,  1487,  1485,  1482,  1480,  1478,  1475,  1473,  1471,  1468,  1466,
+     1464,  1461,  1459,  1456,  1454,  1452,  1449,  1447,  1445,  1442,  1440,  1437,
+     1435,  1432,  1430,  1427,  1425,  1422,  1419,  1417,  1414,  1412,  1409,  1406,
+     1404,  1401,  1399,  1396,  1394,  1391,  1388,  1386,  1383,  1381,  1378,  1375,
+     1373,  1370,  1368,  1365,  1363,  1360,  1357,  1355,  1352,  1349,  1347,  1344,
+     1341,  1339,  1336,  1333,  1331,  1328,  1325,  1323,  1320,  1317,  1315,  1312,
+     1309,  1307,  1304,  1301,  1299,  1296,  1293,  1291,  1288,  1285,  1283,  1280,
+     1277,  1274,  1271,  1269,  1266,  1263,  1260,  1257,  1254,  1251,  1249,  1246,
+     1243,  1240,  1237,  1234,  1231,  1229,  1226,  1223,  1220,  1217,  1214,  1211,
+     1209,  1206,  1203,  1200,  1197,  1194,  1191,  1188,  1185,  1182,  1178,  1175,
+     1172,  1169,  1166,  1163,  1160,  1157,  1154,  1151,  1148,  1145,  1142,  1138,
+     1135,  1132,  1129,  1126,  1123,  1120,  1117,  1113,  1110,  1106,  1103,  1099,
+     1096,  1092,  1089,  1085,  1082,  1078,  1075,  1071,  1068,  1064,  1061,  1057,
+     1054,  1050,  1047,  1043,  1040,  1036,  1033,  1029,  1025,  1022,  1018,  1015,
+     1011,  1007,  1004,  1000,   996,   993,   989,   985,   982,   978,   975,   971,
+      967,   964,   960,   956,   952,   947,   943,   939,   935,   931,   926,   922,
+      918,   914,   909,   905,   901,   897,   893,   888,   884,   880,   875,   870,
+      865,   860,   855,   850,   845,   840,   835,   830,   825,   820,   815,   810,
+      805,   800,   795,   789,   784,   779,   773,   768,   763,   757,   752,   747,
+      741,   736,   731,   725,   720,   714,   709,   703,   697,   691,   686,   680,
+      674,   669,   663,   657,   651,   646,   640,   633,   625,   618,   611,   604,
+      596,   589,   582,   575,   567,   560,   552,   544,   536,   528,   520,   512,
+      504,   496,   488,   480,   471,   462,   453,   444,   436,   427,   418,   409,
+      400,   389,   377,   366,   354,   343,   331,   320,   309,   297,   286,   274,
+      263,   251,   240,   224,   208,   192,   176,   160,   144,   128,   112,    96,
+       80,    60,    40,    20,     0,     0
+  };
+#endif
+
+#if ANY_THERMISTOR_IS(666)
+  #define HAS_UNIFORM_TEMPTABLE_666 1
+  #define UNIFORM_TEMPTABLE_666_SHIFT 0 // max error 0.06 degC
+  const int16_t uniform_temptable_666[] PROGMEM = {
+    12704, 12228, 11752, 11275, 10799, 10323,  9847,  9370,  8894,  8418,  7942,  7465,
+     6989,  6513,  6037,  5560,  5084,  4608,  4557,  4506,  4456,  4405,  4354,  4303,
+     4252,  4201,  4151,  4100,  4049,  3998,  3947,  3896,  3846,  3795,  3744,  3719,
+     3693,  3668,  3642,  3617,  3592,  3566,  3541,  3515,  3490,  3464,  3439,  3414,
+     3388,  3363,  3337,  3312,  3295,  3278,  3261,  3244,  3227,  3210,  3193,  3176,
+     3160,  3143,  3126,  3109,  3092,  3075,  3058,  3041,  3024,  3012,  3000,  2987,
+     2975,  2963,  2951,  2938,  2926,  2914,  2902,  2889,  2877,  2865,  2853,  2840,
+     2828,  2816,  2807,  2797,  2788,  2778,  2769,  2760,  2750,  2741,  2731,  2722,
+     2712,  2703,  2694,  2684,  2675,  2665,  2656,  2648,  2639,  2631,  2622,  2614,
+     2605,  2597,  2588,  2580,  2571,  2563,  2554,  2546,  2537,  2529,  2520,  2512,
+     2505,  2499,  2492,  2486,  2479,  2472,  2466,  2459,  2453,  2446,  2440,  2433,
+     2426,  2420,  2413,  2407,  2400,  2394,  2389,  2383,  2377,  2372,  2366,  2360,
+     2355,  2349,  2344,  2338,  2332,  2327,  2321,  2315,  2310,  2304,  2299,  2293,
+     2288,  2283,  2277,  2272,  2267,  2261,  2256,  2251,  2245,  2240,  2235,  2229,
+     2224,  2219,  2213,  2208,  2204,  2200,  2197,  2193,  2189,  2185,  2182,  2178,
+     2174,  2170,  2167,  2163,  2159,  2155,  2152,  2148,  2144,  2139,  2135,  2130,
+     2125,  2120,  2116,  2111,  2106,  2102,  2097,  2092,  2088,  2083,  2078,  2073,
+     2069,  2064,  2060,  2056,  2053,  2049,  2045,  2041,  2038,  2034,  2030,  2026,
+     2023,  2019,  2015,  2011,  2008,  2004,  2000,  1996,  1992,  1989,  1985,  1981,
+     1977,  1974,  1970,  1966,  1962,  1959,  1955,  1951,  1947,  1944,  1940,  1936,
+     1933,  1930,  1928,  1925,  1922,  1919,  1916,  1913,  1911,  1908,  1905,  1902,
+     1899,  1896,  1894,  1891,  1888,  1885,  1882,  1880,  1877,  1874,  1871,  1868,
+     1865,  1863,  1860,  1857,  1854,  1851,  1848,  1846,  1843,  1840,  1837,  1834,
+     1832,  1829,  1826,  1823,  1820,  1817,  1815,  1812,  1809,  1806,  1803,  1800,
+     1798,  1795,  1792,  1789,  1786,  1784,  1781,  1778,  1775,  1772,  1769,  1767,
+     1764,  1761,  1758,  1755,  1752,  1750,  1747,  1744,  1741,  1738,  1736,  1733,
+     1730,  1727,  1724,  1721,  1719,  1716,  1713,  1710,  1707,  1704,  1702,  1699,
+     1696,  1693,  1690,  1688,  1685,  1682,  1679,  1676,  1673,  1671,  1668,  1665,
+     1662,  1659,  1656,  1654,  1651,  1648,  1646,  1644,  1642,  1640,  1639,  1637,
+     1635,  1633,  1631,  1629,  1627,  1625,  1624,  1622,  1620,  1618,  1616,  1614,
+     1612,  1610,  1608,  1607,  1605,  1603,  1601,  1599,  1597,  1595,  1593,  1592,
+     1590,  1588,  1586,  1584,  1581,  1578,  1576,  1573,  1570,  1567,  1564,  1561,
+     1559,  1556,  1553,  1550,  1547,  1544,  1542,  1539,  1536,  1534,  1532,  1530,
+     1528,  1527,  1525,  1523,  1521,  1519,  1517,  1515,  1513,  1512,  1510,  1508,
+     1506,  1504,  1502,  1500,  1498,  1496,  1495,  1493,  1491,  1489,  1487,  1485,
+     1483,  1481,  1480,  1478,  1476,  1474,  1472,  1470,  1468,  1466,  1464,  1463,
+     1461,  1459,  1457,  1455,  1453,  1451,  1449,  1448,  1446,  1444,  1442,  1440,
+     1438,  1436,  1434,  1432,  1431,  1429,  1427,  1425,  1423,  1421,  1419,  1417,
+     1416,  1414,  1412,  1410,  1408,  1406,  1404,  1402,  1400,  1399,  1397,  1395,
+     1393,  1391,  1389,  1387,  1385,  1384,  1382,  1380,  1378,  1376,  1374,  1372,
+     1370,  1368,  1367,  1365,  1363,  1361,  1359,  1357,  1355,  1353,  1352,  1350,
+     1348,  1346,  1344,  1342,  1340,  1338,  1336,  1335,  1333,  1331,  1329,  1327,
+     1325,  1323,  1321,  1320,  1318,  1316,  1314,  1312,  1310,  1308,  1307,  1305,
+     1303,  1301,  1300,  1298,  1296,  1294,  1292,  1291,  1289,  1287,  1285,  1284,
+     1282,  1280,  1278,  1276,  1274,  1272,  1271,  1269,  1267,  1265,  1263,  1261,
+     1259,  1257,  1256,  1254,  1252,  1250,  1248,  1246,  1244,  1242,  1240,  1239,
+     1237,  1235,  1233,  1231,  1229,  1227,  1225,  1224,  1222,  1220,  1218,  1216,
+     1214,  1212,  1210,  1208,  1207,  1205,  1203,  1201,  1199,  1197,  1195,  1193,
+     1192,  1190,  1188,  1186,  1184,  1182,  1180,  1178,  1176,  1175,  1173,  1171,
+     1169,  1167,  1165,  1163,  1161,  1160,  1158,  1156,  1154,  1152,  1150,  1148,
+     1146,  1144,  1143,  1141,  1139,  1137,  1135,  1133,  1131,  1129,  1128,  1126,
+     1124,  1122,  1120,  1118,  1116,  1114,  1112,  1111,  1109,  1107,  1105,  1103,
+     1101,  1099,  1097,  1096,  1094,  1092,  1090,  1088,  1087,  1086,  1085,  1084,
+     1083,  1082,  1081,  1080,  1080,  1079,  1078,  1077,  1076,  1075,  1074,  1073,
+     1072,  1070,  1068,  1066,  1064,  1063,  1061,  1059,  1057,  1055,  1053,  1051,
+     1049,  1048,  1046,  1044,  1042,  1040,  1038,  1036,  1034,  1032,  1031,  1029,
+     1027,  1025,  1023,  1021,  1019,  1017,  1016,  1014,  1012,  1010,  1008,  1006,
+     1004,  1002,  1000,   999,   997,   995,   993,   991,   989,   987,   985,   984,
+      982,   980,   978,   976,   974,   972,   970,   968,   967,   965,   963,   961,
+      959,   957,   955,   953,   952,   950,   948,   946,   944,   942,   940,   938,
+      936,   935,   933,   931,   929,   927,   925,   923,   921,   920,   918,   916,
+      914,   912,   910,   908,   906,   904,   903,   901,   899,   897,   895,   893,
+      891,   889,   888,   886,   884,   882,   880,   878,   876,   874,   872,   871,
+      869,   867,   865,   863,   861,   859,   857,   856,   854,   852,   850,   848,
+      846,   844,   842,   840,   839,   837,   835,   833,   831,   829,   827,   825,
+      824,   822,   820,   818,   816,   814,   812,   810,   808,   807,   805,   803,
+      801,   799,   797,   795,   793,   792,   790,   788,   786,   784,   782,   780,
+      778,   776,   775,   773,   771,   769,   767,   765,   763,   761,   760,   758,
+      756,   754,   752,   749,   746,   744,   741,   738,   735,   732,   729,   727,
+      724,   721,   718,   715,   712,   710,   707,   704,   702,   700,   698,   696,
+      695,   693,   691,   689,   687,   685,   683,   681,   680,   678,   676,   674,
+      672,   669,   667,   664,   661,   659,   656,   653,   651,   648,   645,   643,
+      640,   637,   635,   632,   629,   627,   624,   622,   620,   618,   616,   615,
+      613,   611,   609,   607,   605,   603,   601,   600,   598,   596,   594,   592,
+      589,   586,   584,   581,   578,   575,   572,   569,   567,   564,   561,   558,
+      555,   552,   550,   547,   544,   540,   536,   533,   529,   525,   521,   518,
+      514,   510,   506,   503,   499,   495,   491,   488,   484,   480,   477,   474,
+      472,   469,   466,   463,   460,   457,   455,   452,   449,   446,   443,   440,
+      438,   435,   432,   428,   424,   421,   417,   413,   409,   406,   402,   398,
+      394,   391,   387,   383,   379,   376,   372,   368,   363,   359,   354,   349,
+      344,   340,   335,   330,   326,   321,   316,   312,   307,   302,   297,   293,
+      288,   281,   275,   268,   262,   255,   248,   242,   235,   229,   222,   216,
+      209,   202,   196,   189,   183,   176,   168,   159,   151,   142,   134,   125,
+      117,   108,   100,    91,    83,    74,    66,    57,    49,    40,    32,     5,
+      -22,   -49,   -76,  -103,  -130,  -157,  -184,  -211,  -238,  -265,  -292,  -319,
+     -346,  -373,  -400,  -400
+  };
+#endif
+
+// temptable_998 depends on DUMMY_THERMISTOR_998_VALUE, so it has no uniform table
+
+// temptable_999 depends on DUMMY_THERMISTOR_999_VALUE, so it has no uniform table
+
+#if ANY_THERMISTOR_IS(1010)
+  #define HAS_UNIFORM_TEMPTABLE_1010 1
+  #define UNIFORM_TEMPTABLE_1010_SHIFT 0 // max error 0.06 degC
+  const int16_t uniform_temptable_1010[] PROGMEM = {
+        0,    17,    35,    52,    70,    87,   104,   122,   139,   157,   174,   191,
+      209,   226,   243,   261,   278,   296,   313,   330,   348,   365,   383,   400,
+      418,   436,   455,   473,   491,   509,   527,   545,   564,   582,   600,   618,
+      636,   655,   673,   691,   709,   727,   745,   764,   782,   800,   821,   842,
+      863,   884,   905,   926,   947,   968,   989,  1011,  1032,  1053,  1074,  1095,
+     1116,  1137,  1158,  1179,  1200,  1222,  1244,  1267,  1289,  1311,  1333,  1356,
+     1378,  1400,  1422,  1444,  1467,  1489,  1511,  1533,  1556,  1578,  1600,  1624,
+     1647,  1671,  1694,  1718,  1741,  1765,  1788,  1812,  1835,  1859,  1882,  1906,
+     1929,  1953,  1976,  2000,  2027,  2053,  2080,  2107,  2133,  2160,  2187,  2213,
+     2240,  2267,  2293,  2320,  2347,  2373,  2400,  2431,  2462,  2492,  2523,  2554,
+     2585,  2615,  2646,  2677,  2708,  2738,  2769,  2800,  2831,  2862,  2892,  2923,
+     2954,  2985,  3015,  3046,  3077,  3108,  3138,  3169,  3200,  3233,  3267,  3300,
+     3333,  3367,  3400,  3433,  3467,  3500,  3533,  3567,  3600,  3636,  3673,  3709,
+     3745,  3782,  3818,  3855,  3891,  3927,  3964,  4000,  4036,  4073,  4109,  4145,
+     4182,  4218,  4255,  4291,  4327,  4364,  4400,  4444,  4489,  4533,  4578,  4622,
+     4667,  4711,  4756,  4800,  4800
+  };
+#endif
+
+#if ANY_THERMISTOR_IS(1047)
+  #define HAS_UNIFORM_TEMPTABLE_1047 1
+  #define UNIFORM_TEMPTABLE_1047_SHIFT 1 // max error 0.19 degC
+  const int16_t uniform_temptable_1047[] PROGMEM = {
+        0,    57,   114,   171,   229,   286,   343,   400,   457,   514,   571,   629,
+      686,   743,   800,   862,   923,   985,  1046,  1108,  1169,  1231,  1292,  1354,
+     1415,  1477,  1538,  1600,  1670,  1739,  1809,  1878,  1948,  2017,  2087,  2157,
+     2226,  2296,  2365,  2436,  2509,  2582,  2655,  2727,  2800,  2873,  2945,  3018,
+     3091,  3164,  3238,  3314,  3390,  3467,  3543,  3619,  3695,  3771,  3848,  3924,
+     4000,  4084,  4168,  4253,  4337,  4421,  4505,  4589,  4674,  4758,  4844,  4933,
+     5022,  5111,  5200,  5289,  5378,  5467,  5556,  5650,  5750,  5850,  5950,  6050,
+     6150,  6250,  6350,  6450,  6550,  6650,  6750,  6850,  6950,  7050,  7150,  7253,
+     7360,  7467,  7573,  7680,  7787,  7893,  8000,  8000
+  };
+#endif
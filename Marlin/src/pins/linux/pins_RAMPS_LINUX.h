@@ -0,0 +1,169 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * Linux native "board", laid out like a ZONESTAR ZM3E4 V2.0 on RAMPS numbering
+ *
+ * Pins are indices into the emulated GPIO bank (HAL/LINUX/hardware/Gpio.h).
+ * Analog inputs are channel numbers, mapped to pins 240-255.
+ */
+
+#ifndef __PLAT_LINUX__
+  #error "Oops! Select 'linux_native' in 'Environments'."
+#endif
+
+#define BOARD_INFO_NAME "RAMPS 1.4 (Linux)"
+
+#define IS_RAMPS_EFB
+
+//
+// Servos
+//
+#define SERVO0_PIN                            11
+#define SERVO1_PIN                             6
+#define SERVO2_PIN                             5
+#define SERVO3_PIN                             4
+
+//
+// Limit Switches
+//
+#define X_MIN_PIN                              3
+#define X_MAX_PIN                              2
+#define Y_MIN_PIN                             14
+#define Y_MAX_PIN                             15
+#define Z_MIN_PIN                             18
+#define Z_MAX_PIN                             19
+
+//
+// Z Probe (when not Z_MIN_PIN)
+//
+#ifndef Z_MIN_PROBE_PIN
+  #define Z_MIN_PROBE_PIN                     32
+#endif
+
+//
+// Steppers
+//
+#define X_STEP_PIN                            54
+#define X_DIR_PIN                             55
+#define X_ENABLE_PIN                          38
+
+#define Y_STEP_PIN                            60
+#define Y_DIR_PIN                             61
+#define Y_ENABLE_PIN                          56
+
+#define Z_STEP_PIN                            46
+#define Z_DIR_PIN                             48
+#define Z_ENABLE_PIN                          62
+
+#ifdef OPTION_DUALZ_DRIVE
+  #define Z2_STEP_PIN                         36
+  #define Z2_DIR_PIN                          34
+  #define Z2_ENABLE_PIN                       30
+#endif
+#ifdef OPTION_Z2_ENDSTOP
+  #define Z2_MIN_PIN                          43
+#endif
+
+// Four mixing extruder drivers, as on the ZM3E4
+#define E0_STEP_PIN                           26
+#define E0_DIR_PIN                            28
+#define E0_ENABLE_PIN                         24
+
+#define E1_STEP_PIN                           65
+#define E1_DIR_PIN                            66
+#define E1_ENABLE_PIN                         64
+
+#define E2_STEP_PIN                           68
+#define E2_DIR_PIN                            69
+#define E2_ENABLE_PIN                         67
+
+#define E3_STEP_PIN                           71
+#define E3_DIR_PIN                            72
+#define E3_ENABLE_PIN                         70
+
+//
+// Temperature Sensors
+//
+#define TEMP_0_PIN                            13  // Analog Input
+#define TEMP_1_PIN                            15  // Analog Input
+#define TEMP_BED_PIN                          14  // Analog Input
+
+#if ENABLED(OPTION_CHAMBER)
+  #define TEMP_CHAMBER_PIN            TEMP_1_PIN
+#endif
+
+//
+// Heaters / Fans
+//
+#define HEATER_0_PIN                          10
+#define HEATER_1_PIN                           7
+#define HEATER_BED_PIN                         8
+#define FAN_PIN                                9
+#define FAN1_PIN                              44
+
+#if ENABLED(OPTION_CHAMBER)
+  #define HEATER_CHAMBER_PIN        HEATER_1_PIN
+#endif
+
+//
+// Misc. Functions
+//
+#define SDSS                                  53
+#define LED_PIN                               13
+#define SUICIDE_PIN                           12
+#define FIL_RUNOUT_PIN                         4
+#define SD_DETECT_PIN                         49
+
+#define WIFI_RST                              39
+#define WIFI_EN                               40
+
+//
+// LCD / Controller
+//
+#if ENABLED(ZONESTAR_DWIN_LCD)
+  #define LCDSCREEN_NAME    "ZONESTAR DWIN LCD"
+  #define BEEPER_PIN                          37
+  #define KILL_PIN                            -1
+  #define BTN_EN1                             31
+  #define BTN_EN2                             33
+  #define BTN_ENC                             35
+#endif
+
+#if ENABLED(BLTOUCH)
+  #define BLTOUCH_PROBE_PIN      Z_MIN_PROBE_PIN
+#endif
+
+//
+// Repeat printing
+//
+#if ENABLED(OPTION_REPEAT_PRINTING)
+  #undef X_MAX_PIN
+  #undef Y_MAX_PIN
+  #define RPARML_MIN_PIN                       2
+  #define RPARMR_MIN_PIN                      15
+  #define RP_ARMLP_PIN                        57
+  #define RP_ARMLN_PIN                        58
+  #define RP_ARMRP_PIN                        59
+  #define RP_ARMRN_PIN                        63
+#endif
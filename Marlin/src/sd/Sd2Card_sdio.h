@@ -28,12 +28,23 @@
 bool SDIO_Init();
 bool SDIO_ReadBlock(uint32_t block, uint8_t *dst);
 bool SDIO_WriteBlock(uint32_t block, const uint8_t *src);
+uint32_t SDIO_GetCardSize();
 
 class Sd2Card {
+  private:
+    uint32_t pos;
+
   public:
     bool init(uint8_t sckRateID = 0, uint8_t chipSelectPin = 0) { return SDIO_Init(); }
     bool readBlock(uint32_t block, uint8_t *dst) { return SDIO_ReadBlock(block, dst); }
+
+    // Sequential reads are coalesced by the SDIO driver, so a stream is just a position
+    bool readStart(const uint32_t block) { pos = block; return true; }
+    bool readData(uint8_t *dst) { return SDIO_ReadBlock(pos++, dst); }
+    bool readStop() const { return true; }
+
     bool writeBlock(uint32_t block, const uint8_t *src) { return SDIO_WriteBlock(block, src); }
+    uint32_t cardSize() { return SDIO_GetCardSize(); }
 };
 
 #endif // SDIO_SUPPORT
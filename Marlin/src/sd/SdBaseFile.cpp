@@ -1044,7 +1044,20 @@ int16_t SdBaseFile::read(void* buf, uint16_t nbyte) {
 
     // no buffering needed if n == 512
     if (n == 512 && block != vol_->cacheBlockNumber()) {
-      if (!vol_->readBlock(block, dst)) return -1;
+      // Stream whole blocks up to the end of the cluster, unless one is in the cache
+      uint16_t count = toRead >> 9;
+      if (type_ != FAT_FILE_TYPE_ROOT_FIXED) NOMORE(count, vol_->blocksPerCluster() - vol_->blockOfCluster(curPosition_));
+      if (vol_->cacheBlockNumber() - block < count) count = 1;
+
+      bool streamed = false;
+      if (count > 1) {
+        Sd2Card * const card = vol_->sdCard();
+        streamed = card->readStart(block);
+        for (uint16_t i = 0; streamed && i < count; i++) streamed = card->readData(dst + i * 512);
+        streamed = card->readStop() && streamed;
+        if (streamed) n = count * 512;
+      }
+      if (!streamed && !vol_->readBlock(block, dst)) return -1;
     }
     else {
       // read block to cache and copy data to caller
@@ -124,6 +124,12 @@ char CardReader::proc_filenames[SD_PROCEDURE_DEPTH][MAXPATHNAMELENGTH];
 
 uint32_t CardReader::filesize, CardReader::sdpos;
 
+#if ENABLED(SD_READ_AHEAD)
+  uint8_t CardReader::ahead_buffer[512] __attribute__((aligned(4))); // SDIO DMA needs whole words
+  uint32_t CardReader::ahead_base;
+  uint16_t CardReader::ahead_pos, CardReader::ahead_len;
+#endif
+
 CardReader::CardReader() {
   #if ENABLED(SDCARD_SORT_ALPHA)
     sort_count = 0;
@@ -471,6 +477,9 @@ void CardReader::openAndPrintFile(const char *name) {
 void CardReader::startFileprint() {
   if (isMounted()) {
     flag.sdprinting = true;
+    #if ENABLED(SD_GCODE_CACHE)
+      if (!sdpos && !file_subcall_ctr && isFileOpen()) gcode_cache.begin(file);
+    #endif
     TERN_(SD_RESORT, flush_presort());
   }
 }
@@ -478,6 +487,7 @@ void CardReader::startFileprint() {
 void CardReader::endFilePrint(TERN_(SD_RESORT, const bool re_sort/*=false*/)) {
   TERN_(ADVANCED_PAUSE_FEATURE, did_pause_print = 0);	
   flag.sdprinting = flag.abort_sd_printing = false;
+  TERN_(SD_GCODE_CACHE, gcode_cache.abort());
   if (isFileOpen()) file.close();
   TERN_(SD_RESORT, if (re_sort) presort());
 }
@@ -578,6 +588,8 @@ void CardReader::openFileRead(char * const path, const uint8_t subcall_type/*=0*
   if (file.open(diveDir, fname, O_READ)) {
     filesize = file.fileSize();
     sdpos = 0;
+    TERN_(SD_READ_AHEAD, resetReadAhead());
+    TERN_(SD_GCODE_CACHE, gcode_cache.select(diveDir, fname));
 
     PORT_REDIRECT(SERIAL_BOTH);
     SERIAL_ECHOLNPAIR(STR_SD_FILE_OPENED, fname, STR_SD_SIZE, filesize);
@@ -615,6 +627,7 @@ void CardReader::openFileWrite(char * const path) {
   #else
     if (file.open(diveDir, fname, O_CREAT | O_APPEND | O_WRITE | O_TRUNC)) {
       flag.saving = true;
+      TERN_(SD_READ_AHEAD, resetReadAhead());
       selectFileByName(fname);
       TERN_(EMERGENCY_PARSER, emergency_parser.disable());
       echo_write_to_file(fname);
@@ -737,6 +750,7 @@ void CardReader::closefile(const bool store_location/*=false*/) {
   file.close();
   flag.saving = flag.logging = false;
   sdpos = 0;
+  TERN_(SD_READ_AHEAD, resetReadAhead());
   TERN_(EMERGENCY_PARSER, emergency_parser.enable());
 
   if (store_location) {
@@ -819,7 +833,7 @@ const char* CardReader::diveToFile(const bool update_cwd, SdFile*& diveDir, cons
 
   while (item_name_adr) {
     // Find next subdirectory delimiter
-    char * const name_end = strchr(item_name_adr, '/');
+    const char * const name_end = strchr(item_name_adr, '/');
 
     // Last atom in the path? Item found.
     if (name_end <= item_name_adr) break;
@@ -1151,12 +1165,39 @@ uint16_t CardReader::get_num_Files() {
   );
 }
 
+#if ENABLED(SD_READ_AHEAD)
+
+  /**
+   * Refill the read-ahead buffer with the rest of the current sector.
+   * Reads stay sector-aligned, so after the first one every refill is
+   * a single whole-block transfer straight into the buffer.
+   */
+  bool CardReader::fillReadAhead() {
+    ahead_base += ahead_len;
+    ahead_pos = ahead_len = 0;
+    const int16_t n = file.read(ahead_buffer, sizeof(ahead_buffer) - (ahead_base & 0x1FF));
+    if (n <= 0) return false;
+    ahead_len = n;
+    return true;
+  }
+
+  // Put the file position back where get() left off, for direct file access
+  void CardReader::syncReadAhead() {
+    if (!ahead_len) return;
+    const uint32_t pos = ahead_base + ahead_pos;
+    file.seekSet(pos);
+    resetReadAhead(pos);
+  }
+
+#endif // SD_READ_AHEAD
+
 //
 // Return from procedure or close out the Print Job
 //
 void CardReader::fileHasFinished() {
   planner.synchronize();
   file.close();
+  TERN_(SD_READ_AHEAD, resetReadAhead());
   if (file_subcall_ctr > 0) { // Resume calling file after closing procedure
     file_subcall_ctr--;
     openFileRead(proc_filenames[file_subcall_ctr], 2); // 2 = Returning from sub-procedure
@@ -1164,6 +1205,7 @@ void CardReader::fileHasFinished() {
     startFileprint();
   }
   else {
+    TERN_(SD_GCODE_CACHE, gcode_cache.finish());
     endFilePrint(TERN_(SD_RESORT, true));
 
     marlin_state = MF_SD_COMPLETE;
@@ -1190,18 +1232,35 @@ void CardReader::fileHasFinished() {
 #if ENABLED(POWER_LOSS_RECOVERY)
 
 bool CardReader::jobRecoverFileExists() {
+  if (!isMounted()) return false;
   const bool exists = recovery.file.open(&root, recovery.filename, O_READ);
   if (exists) recovery.file.close();
   return exists;
 }
 
-void CardReader::openJobRecoveryFile(const bool read) {
-  if (!isMounted()) return;
-  if (recovery.file.isOpen()) return;
-  if (!recovery.file.open(&root, recovery.filename, read ? O_READ : O_CREAT | O_WRITE | O_TRUNC | O_SYNC))
+// The recovery journal is written in place, so for writing the file is
+// allocated whole, in one contiguous run, and zeroed when it's created.
+bool CardReader::openJobRecoveryFile(const bool read) {
+  if (!isMounted()) return false;
+  if (recovery.file.isOpen()) return true;
+  bool ok = recovery.file.open(&root, recovery.filename, read ? O_READ : O_RDWR);
+  if (!read && !(ok && recovery.file.fileSize() == recovery.journal_size)) {
+    if (ok) recovery.file.remove();
+    ok = recovery.file.createContiguous(&root, recovery.filename, recovery.journal_size);
+    if (ok) {
+      const uint8_t zero[64] = { 0 };
+      for (uint32_t pos = 0; ok && pos < recovery.journal_size; pos += sizeof(zero)) {
+        const uint16_t n = _MIN(sizeof(zero), recovery.journal_size - pos);
+        ok = recovery.file.write(zero, n) == n;
+      }
+      if (ok) echo_write_to_file(recovery.filename);
+    }
+  }
+  if (!ok) {
+    if (recovery.file.isOpen()) recovery.file.close();
     SERIAL_ECHOLNPAIR(STR_SD_OPEN_FILE_FAIL, recovery.filename, ".");
-  else if (!read)
-    echo_write_to_file(recovery.filename);
+  }
+  return ok;
 }
 
 // Removing the job recovery file currently requires closing
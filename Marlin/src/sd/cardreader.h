@@ -43,6 +43,10 @@
 
 #include "SdFile.h"
 
+#if ENABLED(SD_GCODE_CACHE)
+  #include "../feature/gcode_cache.h"
+#endif
+
 typedef struct {
   bool saving:1,
        logging:1,
@@ -58,6 +62,9 @@ typedef struct {
 } card_flags_t;
 
 class CardReader {
+  #if ENABLED(SD_GCODE_CACHE)
+    friend class GCodeCache;
+  #endif
 public:
   static card_flags_t flag;                         // Flags (above)
   static char filename[FILENAME_LENGTH],            // DOS 8.3 filename of the selected item
@@ -151,7 +158,7 @@ public:
 
   #if ENABLED(POWER_LOSS_RECOVERY)
     static bool jobRecoverFileExists();
-    static void openJobRecoveryFile(const bool read);
+    static bool openJobRecoveryFile(const bool read);
     static void removeJobRecoveryFile();
   #endif
 
@@ -159,11 +166,24 @@ public:
   static inline uint32_t getIndex() { return sdpos; }
   static inline uint32_t getFileSize() { return filesize; }
   static inline bool eof() { return sdpos >= filesize; }
-  static inline void setIndex(const uint32_t index) { sdpos = index; file.seekSet(index); }
   static inline char* getWorkDirName() { workDir.getDosName(filename); return filename; }
-  static inline int16_t get() { sdpos = file.curPosition(); return (int16_t)file.read(); }
-  static inline int16_t read(void* buf, uint16_t nbyte) { return file.isOpen() ? file.read(buf, nbyte) : -1; }
-  static inline int16_t write(void* buf, uint16_t nbyte) { return file.isOpen() ? file.write(buf, nbyte) : -1; }
+
+  #if ENABLED(SD_READ_AHEAD)
+    // sdpos is the position of the last byte returned by get(), as without read-ahead
+    static inline void setIndex(const uint32_t index) { TERN_(SD_GCODE_CACHE, gcode_cache.abort()); sdpos = index; file.seekSet(index); resetReadAhead(index); }
+    static inline int16_t get() {
+      if (ahead_pos >= ahead_len && !fillReadAhead()) { sdpos = ahead_base + ahead_len; return -1; }
+      sdpos = ahead_base + ahead_pos;
+      return ahead_buffer[ahead_pos++];
+    }
+    static inline int16_t read(void* buf, uint16_t nbyte) { syncReadAhead(); return file.isOpen() ? file.read(buf, nbyte) : -1; }
+    static inline int16_t write(void* buf, uint16_t nbyte) { syncReadAhead(); return file.isOpen() ? file.write(buf, nbyte) : -1; }
+  #else
+    static inline void setIndex(const uint32_t index) { TERN_(SD_GCODE_CACHE, gcode_cache.abort()); sdpos = index; file.seekSet(index); }
+    static inline int16_t get() { sdpos = file.curPosition(); return (int16_t)file.read(); }
+    static inline int16_t read(void* buf, uint16_t nbyte) { return file.isOpen() ? file.read(buf, nbyte) : -1; }
+    static inline int16_t write(void* buf, uint16_t nbyte) { return file.isOpen() ? file.write(buf, nbyte) : -1; }
+  #endif
 
   static Sd2Card& getSd2Card() { return sd2card; }
 
@@ -247,6 +267,20 @@ private:
 
   static uint32_t filesize, sdpos;
 
+  #if ENABLED(SD_READ_AHEAD)
+    //
+    // Read-ahead buffer holding the rest of the current sector. The file
+    // position is always at ahead_base + ahead_len while it is in use.
+    //
+    static uint8_t ahead_buffer[512];
+    static uint32_t ahead_base;         // File position of ahead_buffer[0]
+    static uint16_t ahead_pos,          // Next byte for get()
+                    ahead_len;          // Bytes in the buffer
+    static bool fillReadAhead();
+    static inline void resetReadAhead(const uint32_t pos=0) { ahead_base = pos; ahead_pos = ahead_len = 0; }
+    static void syncReadAhead();
+  #endif
+
   //
   // Procedure calls to other files
   //
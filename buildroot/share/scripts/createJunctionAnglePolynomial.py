@@ -0,0 +1,158 @@
+#!/usr/bin/env python
+"""Junction Angle Polynomial Generator
+
+Fits the polynomial Planner::junction_theta() uses to turn the chord between
+two unit direction vectors into the angle between them, for the small segment
+limit of junction deviation (JD_HANDLE_SMALL_SEGMENTS).
+
+For unit vectors a chord c spans the angle theta = 2 * asin(c / 2). With
+x = c / 2 and s = x^2 this is c * P(s), where P(s) ~ asin(x) / x is fitted
+by the Remez exchange algorithm for the least relative error over the angles
+the firmware asks about. Coefficients are rounded to float before the error
+is measured, so the bound printed is the one the firmware gets (less float
+rounding in the evaluation itself).
+
+Usage: python createJunctionAnglePolynomial.py [options]
+
+Options:
+  -h, --help        show this help
+  --degree=...      degree of P(s) (default: 2)
+  --max-angle=...   largest angle in degrees to fit (default: 45, i.e. junctions over 135 degrees)
+  --check=FILE      report the error of the jd_theta_poly coefficients in FILE and exit 1 if
+                    they are not the ones this script generates
+"""
+
+from __future__ import print_function
+from __future__ import division
+
+from math import *
+import struct
+import sys
+import re
+import getopt
+
+GRID = 20000                                # points to search for error extrema
+
+def to_float(v):
+    "Round to the nearest IEEE single"
+    return struct.unpack('f', struct.pack('f', v))[0]
+
+def target(s):
+    "asin(x) / x with x = sqrt(s)"
+    if s == 0: return 1.0
+    x = sqrt(s)
+    return asin(x) / x
+
+def poly(coeffs, s):
+    r = 0.0
+    for c in reversed(coeffs): r = r * s + c
+    return r
+
+def rel_error(coeffs, s):
+    return poly(coeffs, s) / target(s) - 1
+
+def solve(m, v):
+    "Gaussian elimination with partial pivoting"
+    n = len(v)
+    a = [row[:] + [v[i]] for i, row in enumerate(m)]
+    for col in range(n):
+        p = max(range(col, n), key=lambda r: abs(a[r][col]))
+        a[col], a[p] = a[p], a[col]
+        for r in range(col + 1, n):
+            f = a[r][col] / a[col][col]
+            for k in range(col, n + 1): a[r][k] -= f * a[col][k]
+    x = [0.0] * n
+    for r in reversed(range(n)):
+        x[r] = (a[r][n] - sum(a[r][k] * x[k] for k in range(r + 1, n))) / a[r][r]
+    return x
+
+def extrema(coeffs, smax):
+    "Points where the error peaks, alternating in sign, endpoints included"
+    grid = [smax * i / GRID for i in range(GRID + 1)]
+    err = [rel_error(coeffs, s) for s in grid]
+    peaks = [0] + [i for i in range(1, GRID) if (err[i] - err[i - 1]) * (err[i + 1] - err[i]) <= 0] + [GRID]
+    # Keep the largest of each run of same-signed peaks
+    out = []
+    for i in peaks:
+        if out and (err[i] >= 0) == (err[out[-1]] >= 0):
+            if abs(err[i]) > abs(err[out[-1]]): out[-1] = i
+        else:
+            out.append(i)
+    return [grid[i] for i in out]
+
+def remez(degree, smax):
+    n = degree + 2
+    ref = [smax * (1 - cos(pi * i / (n - 1))) / 2 for i in range(n)]
+    coeffs = None
+    for _ in range(20):
+        # P(s_i) - (-1)^i E f(s_i) = f(s_i)
+        m = [[s ** j for j in range(degree + 1)] + [-((-1) ** i) * target(s)] for i, s in enumerate(ref)]
+        sol = solve(m, [target(s) for s in ref])
+        coeffs = sol[:-1]
+        peaks = extrema(coeffs, smax)
+        if len(peaks) < n: break
+        # Take the n adjacent peaks holding the largest error
+        best = max(range(len(peaks) - n + 1), key=lambda k: max(abs(rel_error(coeffs, s)) for s in peaks[k:k + n]))
+        ref = peaks[best:best + n]
+    return coeffs
+
+def max_error(coeffs, smax):
+    return max(abs(rel_error(coeffs, smax * i / GRID)) for i in range(GRID + 1))
+
+def generate(degree, max_angle):
+    smax = sin(radians(max_angle) / 2) ** 2
+    coeffs = [to_float(c) for c in remez(degree, smax)]
+    return coeffs, max_error(coeffs, smax)
+
+def read_coeffs(path):
+    m = re.search(r'jd_theta_poly\[\]\s*=\s*\{([^}]*)\}', open(path).read())
+    if not m: return None
+    return [float(v.strip().rstrip('f')) for v in m.group(1).split(',') if v.strip()]
+
+def main(argv):
+    degree = 2                              # degree of P(s)
+    max_angle = 45                          # largest angle to fit, degrees
+    check = None                            # source file to check
+
+    try:
+        opts, args = getopt.getopt(argv, "h", ["help", "degree=", "max-angle=", "check="])
+    except getopt.GetoptError as err:
+        print(str(err))
+        usage()
+        sys.exit(2)
+
+    for opt, arg in opts:
+        if opt in ("-h", "--help"):
+            usage()
+            sys.exit()
+        elif opt == "--degree":
+            degree = int(arg)
+        elif opt == "--max-angle":
+            max_angle = float(arg)
+        elif opt == "--check":
+            check = arg
+
+    coeffs, error = generate(degree, max_angle)
+    smax = sin(radians(max_angle) / 2) ** 2
+
+    if check is not None:
+        found = read_coeffs(check)
+        if found is None:
+            print('%s has no jd_theta_poly coefficients' % check)
+            sys.exit(1)
+        print('%s: max relative error %.3g up to %g degrees' % (check, max_error(found, smax), max_angle))
+        if [to_float(c) for c in found] != coeffs:
+            print('%s is out of date, expected { %s }' % (check, ', '.join('%.9gf' % c for c in coeffs)))
+            sys.exit(1)
+        print('%s is up to date' % check)
+        sys.exit(0)
+
+    print("// ./createJunctionAnglePolynomial.py --degree=%d --max-angle=%g" % (degree, max_angle))
+    print("// Max relative error %.3g" % error)
+    print("static constexpr float jd_theta_poly[] = { %s };" % ', '.join('%.9gf' % c for c in coeffs))
+
+def usage():
+    print(__doc__)
+
+if __name__ == "__main__":
+    main(sys.argv[1:])
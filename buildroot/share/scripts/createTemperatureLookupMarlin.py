@@ -16,6 +16,12 @@ Options:
   --t2=ttt:rrr      middle temperature temperature:resistance point (around 150 degC)
   --t3=ttt:rrr      high temperature temperature:resistance point (around 250 degC)
   --num-temps=...   the number of temperature points to calculate (default: 36)
+
+Uniform tables:
+  --uniform         resample every Marlin/src/module/thermistor/thermistor_*.h table
+                    to an entry every 2^n ADC counts and print thermistors_uniform.h
+  --tolerance=...   largest error allowed against the original table (default: 0.25 degC)
+  --check=FILE      report the accuracy of every table and exit 1 if FILE is out of date
 """
 
 from __future__ import print_function
@@ -23,6 +29,8 @@ from __future__ import division
 
 from math import *
 import sys
+import os
+import re
 import getopt
 
 "Constants"
@@ -86,6 +94,243 @@ class Thermistor:
         r = exp((y-x)**(1.0/3) - (y+x)**(1.0/3))
         return (r / (self.rp + r)) * ARES
 
+#
+# Uniform tables
+#
+# The firmware finds a temperature in a uniform table by shifting the raw
+# reading, then interpolates between two entries held in 1/16 degC. These
+# helpers read the tables from their headers, emulate both conversions and
+# pick the coarsest spacing that stays within the tolerance.
+#
+THERMISTOR_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', '..', '..', 'Marlin', 'src', 'module', 'thermistor')
+UNIFORM_SCALE  = 16                         # table entries are 1/16 degC
+UNIFORM_SHIFTS = (4, 3, 2, 1, 0)            # an entry every 16, 8, 4, 2 or 1 ADC counts
+CHECK_OVERSAMPLE = 16                       # raw units per ADC count, as on AVR and STM32F1
+
+def strip_comments(text):
+    text = re.sub(r'/\*.*?\*/', ' ', text, flags=re.S)
+    return re.sub(r'//[^\n]*', '', text)
+
+def split_args(text):
+    "Split a macro argument list at top-level commas"
+    args, depth, cur = [], 0, ''
+    for ch in text:
+        if ch == ',' and depth == 0:
+            args.append(cur)
+            cur = ''
+            continue
+        depth += (ch in '({') - (ch in ')}')
+        cur += ch
+    args.append(cur)
+    return [a.strip() for a in args]
+
+def expand(text, macros):
+    "Expand object-like and function-like macros until nothing changes"
+    for _ in range(32):
+        changed = False
+        out, pos = '', 0
+        for m in re.finditer(r'\b[A-Za-z_]\w*\b', text):
+            name = m.group(0)
+            if name not in macros or m.start() < pos: continue
+            params, body = macros[name]
+            if params is None:
+                out += text[pos:m.start()] + '(' + body + ')'
+                pos = m.end()
+                changed = True
+                continue
+            rest = text[m.end():]
+            lead = len(rest) - len(rest.lstrip())
+            if not rest[lead:].startswith('('): continue
+            depth, i = 0, m.end() + lead
+            while True:
+                depth += (text[i] == '(') - (text[i] == ')')
+                if depth == 0: break
+                i += 1
+            args = split_args(text[m.end() + lead + 1:i])
+            sub = body
+            for p, a in zip(params, args):
+                sub = re.sub(r'\b%s\b' % p, lambda _: '(' + a + ')', sub)
+            out += text[pos:m.start()] + sub
+            pos = i + 1
+            changed = True
+        text = out + text[pos:]
+        if not changed: break
+    return text
+
+def c_eval(expr):
+    "Evaluate a C constant expression from a table"
+    expr = re.sub(r'\(short\)|\bint16_t\b', '__trunc', expr)
+    expr = re.sub(r'(\d(?:\.\d*)?(?:[eE][-+]?\d+)?)[fF]\b', r'\1', expr)
+    return eval(expr, { '__trunc': int, 'float': float, '__ov': lambda n: n })
+
+def read_defines(text):
+    macros = {}
+    for m in re.finditer(r'^\s*#define\s+(\w+)(\(([^)]*)\))?[ \t]*(.*)$', text, re.M):
+        params = [p.strip() for p in m.group(3).split(',')] if m.group(2) else None
+        macros[m.group(1)] = (params, m.group(4).strip())
+    return macros
+
+def read_table(path, base_macros):
+    """
+    Return (name, [(adc, celsius), ...], reason). The ADC values are in 10-bit
+    counts before oversampling. Tables that change with the configuration
+    return no entries and the reason.
+    """
+    macros = dict(base_macros)
+    text = strip_comments(open(path).read())
+    active, body, name = [True], None, None
+    for line in text.split('\n'):
+        d = re.match(r'\s*#\s*(\w+)\s*(.*)', line)
+        if d:
+            cmd, arg = d.group(1), d.group(2).strip()
+            if cmd in ('ifdef', 'ifndef'):
+                return re.findall(r'\d+', os.path.basename(path))[0], [], 'depends on %s' % arg
+            elif cmd == 'if':
+                active.append(active[-1] and bool(int(arg)))
+            elif cmd == 'else':
+                active[-1] = not active[-1] and active[-2]
+            elif cmd == 'endif':
+                active.pop()
+            elif cmd == 'define' and active[-1]:
+                macros.update(read_defines(line))
+            elif cmd == 'undef' and active[-1]:
+                macros.pop(arg, None)
+            continue
+        if not active[-1]: continue
+        m = re.search(r'temptable_(\w+)\[\]\s*PROGMEM\s*=\s*\{', line)
+        if m:
+            name, body = m.group(1), line[m.end():]
+            continue
+        if body is not None:
+            if '};' in line:
+                body += line[:line.index('};')]
+                entries = []
+                for e in re.findall(r'\{([^{}]*)\}', expand(body, macros)):
+                    adc, celsius = split_args(e)
+                    entries.append((c_eval(adc), c_eval(celsius)))
+                return name, entries, None
+            body += line + '\n'
+    return name, [], 'no table'
+
+def bisect_celsius(entries, raw, k):
+    "The firmware's SCAN_THERMISTOR_TABLE with k raw units per ADC count"
+    table = [(int(adc * k), celsius) for adc, celsius in entries]
+    l, r = 0, len(table)
+    while True:
+        m = (l + r) >> 1
+        if not m: return table[0][1]
+        if m == l or m == r: return table[-1][1]
+        v00, v10 = table[m - 1][0], table[m][0]
+        if raw < v00: r = m
+        elif raw > v10: l = m
+        else:
+            v01, v11 = table[m - 1][1], table[m][1]
+            return v01 + (raw - v00) * float(v11 - v01) / float(v10 - v00)
+
+def uniform_entries(entries, shift):
+    "Sample the table every 2^shift ADC counts from its first entry, in 1/16 degC"
+    k, step = 1 << 16, 1 << shift    # k is fine enough to follow fractional ADC values exactly
+    first, last = entries[0][0], entries[-1][0]
+    return [int(round(bisect_celsius(entries, int((first + i * step) * k), k) * UNIFORM_SCALE)) for i in range(int((last - first) / step) + 2)]
+
+def uniform_celsius(entries, table, shift, raw, k):
+    "The firmware's UNIFORM_THERMISTOR_TABLE with k raw units per ADC count"
+    lo, hi = int(entries[0][0] * k), int(entries[-1][0] * k)
+    s = shift + int(log(k, 2) + 0.5)
+    r = min(max(raw, lo), hi) - lo
+    i = r >> s
+    t0, t1 = table[i], table[i + 1]
+    return (t0 + (((t1 - t0) * (r & ((1 << s) - 1)) + (1 << s >> 1)) >> s)) / float(UNIFORM_SCALE)
+
+def uniform_error(entries, table, shift, k=CHECK_OVERSAMPLE):
+    "Largest difference from the original table over every raw reading"
+    return max(abs(uniform_celsius(entries, table, shift, raw, k) - bisect_celsius(entries, raw, k)) for raw in range(1024 * k))
+
+def read_tables(folder):
+    base = read_defines(open(os.path.join(folder, 'thermistors.h')).read())
+    base = dict((n, d) for n, d in base.items() if n.startswith('Pt') or n == 'OV_SCALE')
+    base['OV'] = (['N'], '__ov(OV_SCALE(N))')
+    paths = [os.path.join(folder, f) for f in os.listdir(folder) if re.match(r'thermistor_\d+\.h$', f)]
+    return [read_table(p, base) for p in sorted(paths, key=lambda p: int(re.findall(r'\d+', os.path.basename(p))[0]))]
+
+def resample(entries, tolerance):
+    "The coarsest uniform table within tolerance as (shift, table, error), or the closest miss"
+    for shift in UNIFORM_SHIFTS:
+        table = uniform_entries(entries, shift)
+        error = uniform_error(entries, table, shift)
+        if error <= tolerance: return shift, table, error
+    return None, None, error
+
+def uniform_header(tables, tolerance, report):
+    out = []
+    out.append('/**')
+    out.append(' * Marlin 3D Printer Firmware')
+    out.append(' * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]')
+    out.append(' *')
+    out.append(' * Based on Sprinter and grbl.')
+    out.append(' * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm')
+    out.append(' *')
+    out.append(' * This program is free software: you can redistribute it and/or modify')
+    out.append(' * it under the terms of the GNU General Public License as published by')
+    out.append(' * the Free Software Foundation, either version 3 of the License, or')
+    out.append(' * (at your option) any later version.')
+    out.append(' *')
+    out.append(' * This program is distributed in the hope that it will be useful,')
+    out.append(' * but WITHOUT ANY WARRANTY; without even the implied warranty of')
+    out.append(' * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the')
+    out.append(' * GNU General Public License for more details.')
+    out.append(' *')
+    out.append(' * You should have received a copy of the GNU General Public License')
+    out.append(' * along with this program.  If not, see <https://www.gnu.org/licenses/>.')
+    out.append(' *')
+    out.append(' */')
+    out.append('#pragma once')
+    out.append('')
+    out.append('//')
+    out.append('// Uniform thermistor tables, generated from the thermistor_*.h tables by')
+    out.append('// buildroot/share/scripts/createTemperatureLookupMarlin.py --uniform --tolerance=%g' % tolerance)
+    out.append('//')
+    out.append('// uniform_temptable_N[i] is the temperature in 1/16 degC at ADC count (i << SHIFT)')
+    out.append('// above the first entry of temptable_N. Readings outside temptable_N are clamped.')
+    out.append('// Regenerate this file after changing a table.')
+    out.append('//')
+    for name, entries, reason in tables:
+        if not entries:
+            out.append('')
+            out.append('// temptable_%s %s, so it has no uniform table' % (name, reason))
+            report('%-5s skipped, %s' % (name, reason))
+            continue
+        shift, table, error = resample(entries, tolerance)
+        if table is None:
+            out.append('')
+            out.append('// temptable_%s is off by %.2f degC with an entry every ADC count, so it has no uniform table' % (name, error))
+            report('%-5s skipped, max error %.3f degC' % (name, error))
+            continue
+        report('%-5s shift %d, %4d entries, max error %.3f degC' % (name, shift, len(table), error))
+        out.append('')
+        out.append('#if ANY_THERMISTOR_IS(%s)' % name)
+        out.append('  #define HAS_UNIFORM_TEMPTABLE_%s 1' % name)
+        out.append('  #define UNIFORM_TEMPTABLE_%s_SHIFT %d // max error %.2f degC' % (name, shift, error))
+        out.append('  const int16_t uniform_temptable_%s[] PROGMEM = {' % name)
+        for i in range(0, len(table), 12):
+            row = table[i:i + 12]
+            out.append('    ' + ', '.join('%5d' % v for v in row) + (',' if i + 12 < len(table) else ''))
+        out.append('  };')
+        out.append('#endif')
+    return '\n'.join(out) + '\n'
+
+def uniform_main(tolerance, check):
+    tables = read_tables(THERMISTOR_DIR)
+    if check is None:
+        print(uniform_header(tables, tolerance, lambda line: sys.stderr.write(line + '\n')), end='')
+        return 0
+    header = uniform_header(tables, tolerance, print)
+    if open(check).read() != header:
+        print('%s is out of date. Regenerate it with --uniform.' % check)
+        return 1
+    print('%s is up to date' % check)
+    return 0
+
 def main(argv):
     "Default values"
     t1 = 25                                 # low temperature in Kelvin (25 degC)
@@ -96,9 +341,12 @@ def main(argv):
     r3 = 226.15                             # resistance at high temperature (226.15 Ohm)
     rp = 4700;                              # pull-up resistor (4.7 kOhm)
     num_temps = 36;                         # number of entries for look-up table
+    uniform = False                         # resample the Marlin tables instead
+    tolerance = 0.25                        # largest uniform table error in degC
+    check = None                            # uniform header to check
 
     try:
-        opts, args = getopt.getopt(argv, "h", ["help", "rp=", "t1=", "t2=", "t3=", "num-temps="])
+        opts, args = getopt.getopt(argv, "h", ["help", "rp=", "t1=", "t2=", "t3=", "num-temps=", "uniform", "tolerance=", "check="])
     except getopt.GetoptError as err:
         print(str(err))
         usage()
@@ -124,6 +372,16 @@ def main(argv):
             r3 = float(arg[1])
         elif opt == "--num-temps":
             num_temps = int(arg)
+        elif opt == "--uniform":
+            uniform = True
+        elif opt == "--tolerance":
+            tolerance = float(arg)
+        elif opt == "--check":
+            uniform = True
+            check = arg
+
+    if uniform:
+        sys.exit(uniform_main(tolerance, check))
 
     t = Thermistor(rp, t1, r1, t2, r2, t3, r3)
     increment = int((ARES-1)/(num_temps-1));
@@ -0,0 +1,100 @@
+#!/usr/bin/env python3
+#
+# steptrace.py
+#
+# Decode and compare step traces written by the Linux simulator (-t FILE).
+#
+# Usage:
+#   steptrace.py TRACE              Summarize a trace
+#   steptrace.py TRACE --dump       Print every edge
+#   steptrace.py BASE NEW           Compare two traces, exit 1 if they differ
+#
+# Traces from a VIRTUAL clock replay (-g FILE) are repeatable, so a planner or
+# stepper change that should not alter motion must produce an identical trace.
+#
+import argparse
+import struct
+import sys
+
+def read_trace(path):
+	with open(path, 'rb') as f:
+		data = f.read()
+	if data[:4] != b'MSTP' or data[4] != 1:
+		raise ValueError('%s is not a version 1 step trace' % path)
+	axis_count = data[5]
+	rate = struct.unpack_from('<I', data, 6)[0]
+	pos = 10
+	names = []
+	for _ in range(axis_count):
+		end = data.index(b'\0', pos)
+		names.append(data[pos:end].decode())
+		pos = end + 1
+
+	# Each edge is an event byte followed by a LEB128 tick delta
+	edges = []
+	tick = 0
+	while pos < len(data):
+		event = data[pos]
+		pos += 1
+		delta = shift = 0
+		while True:
+			b = data[pos]
+			pos += 1
+			delta |= (b & 0x7F) << shift
+			shift += 7
+			if b < 0x80: break
+		tick += delta
+		edges.append((tick, event >> 2, (event >> 1) & 1, event & 1))
+	return names, rate, edges
+
+def summarize(path):
+	names, rate, edges = read_trace(path)
+	steps = [0] * len(names)
+	position = [0] * len(names)
+	forward = [True] * len(names)
+	for tick, axis, is_dir, level in edges:
+		if is_dir:
+			forward[axis] = bool(level)
+		elif level:
+			steps[axis] += 1
+			position[axis] += 1 if forward[axis] else -1
+	duration = edges[-1][0] / rate if edges else 0
+	print('%s: %d edges over %.3f s at %d ticks/s' % (path, len(edges), duration, rate))
+	for i, name in enumerate(names):
+		print('  %-4s %10d steps, net %+d (DIR high counts up)' % (name, steps[i], position[i]))
+
+def dump(path):
+	names, rate, edges = read_trace(path)
+	for tick, axis, is_dir, level in edges:
+		print('%12d %-4s %s %d' % (tick, names[axis], 'DIR ' if is_dir else 'STEP', level))
+
+def compare(base, new):
+	base_names, base_rate, base_edges = read_trace(base)
+	new_names, new_rate, new_edges = read_trace(new)
+	if (base_names, base_rate) != (new_names, new_rate):
+		print('Traces have different axes or tick rates')
+		return 1
+	for i, (a, b) in enumerate(zip(base_edges, new_edges)):
+		if a != b:
+			print('First difference at edge %d:' % i)
+			for label, (tick, axis, is_dir, level) in (('base', a), ('new', b)):
+				print('  %-4s tick %d %s %s %d' % (label, tick, base_names[axis], 'DIR' if is_dir else 'STEP', level))
+			return 1
+	if len(base_edges) != len(new_edges):
+		print('Traces match for %d edges, then base has %d and new has %d' % (min(len(base_edges), len(new_edges)), len(base_edges), len(new_edges)))
+		return 1
+	print('Traces are identical (%d edges)' % len(base_edges))
+	return 0
+
+parser = argparse.ArgumentParser(description='Decode and compare simulator step traces.')
+parser.add_argument('trace', help='step trace file')
+parser.add_argument('other', nargs='?', help='second trace to compare against the first')
+parser.add_argument('--dump', action='store_true', help='print every edge')
+args = parser.parse_args()
+
+if args.other:
+	sys.exit(compare(args.trace, args.other))
+elif args.dump:
+	dump(args.trace)
+else:
+	summarize(args.trace)